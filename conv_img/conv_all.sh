@@ -6,7 +6,23 @@ if [ -z "${OUT_DIR}" ]; then
     OUT_DIR=../vga_game
 fi
 
-SYNC_BITS=0xc0
+# Extra options for each sprite file. Pre-shifted frames use a lot of
+# flash, so they're only generated for the sprites drawn most often.
+# All images have at most 16 colors per frame, so they're stored with
+# 4 bits per pixel (-pal4) and expanded by the game when drawing. The
+# frames facing left are the frames facing right mirrored, so they're
+# omitted (-omit-mirrored) and the game mirrors them when drawing.
+# Transparency masks (-mask) can't be used with -pal4 (a mask has one
+# byte per pixel, more than the image data), so no image has them. The
+# large images are compressed (-lz) and decompressed by the game to a
+# cache in RAM when drawn.
+spr_options() {
+  case "$1" in
+    spr/castle3.spr)  echo "-spans -bbox -opacity -pal4 -lz" ;;
+    spr/loserboy.spr) echo "-preshift -spans -bbox -pal4 -omit-mirrored 11 -lz" ;;
+    spr/pwr2.spr)     echo "-preshift -spans -bbox -compiled -pal4 -omit-mirrored 1" ;;
+  esac
+}
 
 echo "=== un-gzipping =========="
 for file in spr/*.gz; do
@@ -14,8 +30,9 @@ for file in spr/*.gz; do
 done
 
 echo "=== converting ==========="
+# (the images are stored without the sync bits, the game adds them when drawing)
 for file in spr/*.spr; do
-  ./conv_spr -sync ${SYNC_BITS} -num-frames 64 ${file}
+  ./conv_spr -num-frames 64 $(spr_options ${file}) ${file}
 done
 
 echo "=== copying =============="
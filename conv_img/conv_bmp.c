@@ -18,6 +18,14 @@ struct INFO {
   unsigned int num_tiles_y;
   int dont_scramble_for_esp32;
   int dont_output_crlf;
+  int output_preshifted;
+  int output_spans;
+  int output_bbox;
+  int output_opacity;
+  int output_compiled;
+  int output_mask;
+  int output_pal4;
+  int output_lz;
 };
 
 struct IMAGE_READER {
@@ -43,6 +51,743 @@ static unsigned char *reader_get_image_line(struct IMAGE_READER *reader, int til
   return &reader->bmp->data[start_y * reader->bmp->stride + start_x*(reader->bmp->bpp/8)];
 }
 
+static unsigned int get_pixel(struct INFO *info, struct IMAGE_READER *reader, unsigned char *line, int x, unsigned int outside)
+{
+  if (x < 0 || x >= reader->w) {
+    return outside;
+  }
+  int bpp = reader->bmp->bpp / 8;
+  unsigned int pixel = (((unsigned int)line[bpp*x+0] <<  0) |
+                        ((unsigned int)line[bpp*x+1] <<  8) |
+                        ((unsigned int)line[bpp*x+2] << 16) |
+                        ((unsigned int)line[bpp*x+3] << 24));
+  return conv_pixel(info->sync_bits, pixel);
+}
+
+static unsigned int pack_pixels(struct INFO *info, const unsigned int *pixels)
+{
+  if (info->dont_scramble_for_esp32) {
+    return (pixels[0]<< 0) | (pixels[1]<< 8) | (pixels[2]<<16) | (pixels[3]<<24);
+  }
+  return (pixels[0]<<16) | (pixels[1]<<24) | (pixels[2]<< 0) | (pixels[3]<< 8);
+}
+
+static void write_word(FILE *out, const char *line_end, int *num_out, unsigned int v)
+{
+  if ((*num_out)++ % 8 == 0) {
+    fprintf(out, "%s  ", line_end);
+  }
+  fprintf(out, "0x%08xu,", v);
+}
+
+#define LZ_MIN_MATCH     3
+#define LZ_MAX_MATCH     34    // (5 bits of length)
+#define LZ_MAX_OFFSET    1024  // (10 bits of offset)
+#define LZ_MAX_LITERALS  128
+
+/*
+ * Compress src with a simple LZ77 format, decompressed by the game
+ * (lz_decompress() in game_data.cpp): a byte c < 0x80 is followed by
+ * c+1 literal bytes; a byte c >= 0x80 and the next byte n copy
+ * ((c>>2)&0x1f)+3 bytes from ((c&3)<<8 | n)+1 bytes back in the
+ * output (the copy can overlap the bytes it produces). dest must have
+ * room for src_len + src_len/LZ_MAX_LITERALS + 1 bytes. Return the
+ * compressed size.
+ */
+static int lz_compress(unsigned char *dest, const unsigned char *src, int src_len)
+{
+  int out = 0;
+  int lit_start = 0;
+  int pos = 0;
+  while (pos <= src_len) {
+    int best_len = 0;
+    int best_off = 0;
+    for (int off = 1; off <= LZ_MAX_OFFSET && off <= pos && best_len < LZ_MAX_MATCH; off++) {
+      int len = 0;
+      while (len < LZ_MAX_MATCH && pos + len < src_len && src[pos+len-off] == src[pos+len]) {
+        len++;
+      }
+      if (len > best_len) {
+        best_len = len;
+        best_off = off;
+      }
+    }
+
+    // flush the literals before a match, at the end or when the run is full
+    int num_lit = pos - lit_start;
+    if (num_lit > 0 && (best_len >= LZ_MIN_MATCH || pos == src_len || num_lit == LZ_MAX_LITERALS)) {
+      dest[out++] = num_lit - 1;
+      memcpy(&dest[out], &src[lit_start], num_lit);
+      out += num_lit;
+      lit_start = pos;
+    }
+    if (pos == src_len) {
+      break;
+    }
+
+    if (best_len >= LZ_MIN_MATCH) {
+      dest[out++] = 0x80 | ((best_len - LZ_MIN_MATCH) << 2) | ((best_off - 1) >> 8);
+      dest[out++] = (best_off - 1) & 0xff;
+      pos += best_len;
+      lit_start = pos;
+    } else {
+      pos++;
+    }
+  }
+  return out;
+}
+
+/*
+ * Image data array being written (the frames or the pre-shifted
+ * copies). The words are written as they're added or, with -lz,
+ * collected and compressed image by image when the array ends.
+ */
+struct DATA_OUT {
+  FILE *out;
+  const char *line_end;
+  const char *name;
+  int num_out;
+  int image_words;       // words of each image (-lz only)
+  unsigned int *words;   // words added (-lz only)
+};
+
+static int begin_data(struct INFO *info, struct DATA_OUT *data, FILE *out, const char *line_end, const char *name, int num_images, int image_words)
+{
+  data->out = out;
+  data->line_end = line_end;
+  data->name = name;
+  data->num_out = 0;
+  data->image_words = image_words;
+  data->words = NULL;
+  if (info->output_lz) {
+    data->words = malloc(sizeof(unsigned int) * num_images * image_words);
+    if (data->words == NULL) {
+      printf("ERROR: out of memory\n");
+      return 1;
+    }
+  } else {
+    fprintf(out, "const unsigned int img_%s_%s[] = {", info->var_name, name);
+  }
+  return 0;
+}
+
+static void add_data_word(struct DATA_OUT *data, unsigned int v)
+{
+  if (data->words) {
+    data->words[data->num_out++] = v;
+  } else {
+    write_word(data->out, data->line_end, &data->num_out, v);
+  }
+}
+
+/*
+ * Finish the image data array. With -lz, each image is compressed on
+ * its own (so the game can decompress any frame) to
+ * img_<name>_lz_<array>, and the start of each image is written to
+ * img_<name>_lz_<array>_index. Return the size of the output in bytes,
+ * or -1 on error.
+ */
+static int end_data(struct INFO *info, struct DATA_OUT *data)
+{
+  FILE *out = data->out;
+  const char *line_end = data->line_end;
+  if (! data->words) {
+    fprintf(out, "%s};%s\n", line_end, line_end);
+    return 4*data->num_out;
+  }
+
+  int num_images = data->num_out / data->image_words;
+  int image_bytes = 4*data->image_words;
+  unsigned char *src = malloc(image_bytes);
+  unsigned char *dest = malloc(image_bytes + image_bytes/LZ_MAX_LITERALS + 1);
+  int *index = malloc(sizeof(int) * num_images);
+  if (src == NULL || dest == NULL || index == NULL) {
+    free(src);
+    free(dest);
+    free(index);
+    free(data->words);
+    printf("ERROR: out of memory\n");
+    return -1;
+  }
+
+  fprintf(out, "const unsigned char img_%s_lz_%s[] = {", info->var_name, data->name);
+  int lz_size = 0;
+  for (int img = 0; img < num_images; img++) {
+    // the bytes of the words as they're stored in the ESP32 (little endian)
+    for (int i = 0; i < data->image_words; i++) {
+      unsigned int w = data->words[img*data->image_words + i];
+      for (int b = 0; b < 4; b++) {
+        src[4*i+b] = (w >> (8*b)) & 0xff;
+      }
+    }
+    int len = lz_compress(dest, src, image_bytes);
+    index[img] = lz_size;
+    for (int i = 0; i < len; i++) {
+      if ((lz_size + i) % 16 == 0) {
+        fprintf(out, "%s  ", line_end);
+      }
+      fprintf(out, "0x%02x,", dest[i]);
+    }
+    lz_size += len;
+  }
+  fprintf(out, "%s};%s\n", line_end, line_end);
+
+  fprintf(out, "const unsigned int img_%s_lz_%s_index[] = {", info->var_name, data->name);
+  for (int img = 0; img < num_images; img++) {
+    if (img % 16 == 0) {
+      fprintf(out, "%s  ", line_end);
+    }
+    fprintf(out, "%d,", index[img]);
+  }
+  fprintf(out, "%s};%s\n", line_end, line_end);
+
+  printf("compressed %s: %d bytes (%d uncompressed)%s", data->name, lz_size + 4*num_images, 4*data->num_out, line_end);
+  free(src);
+  free(dest);
+  free(index);
+  free(data->words);
+  return lz_size + 4*num_images;
+}
+
+/*
+ * Return word lx of line y of a frame (4 pixels), shifted right by
+ * `shift` pixels. Pixels outside the image are black in the normal
+ * image (shift 0) and transparent in the pre-shifted copies.
+ */
+static unsigned int get_frame_word(struct INFO *info, struct IMAGE_READER *reader, int tile_x, int tile_y, int shift, int lx, int y)
+{
+  unsigned int outside = conv_pixel(info->sync_bits, (shift == 0) ? 0 : 0x00ff00);
+  unsigned char *line = reader_get_image_line(reader, tile_x, tile_y, y);
+  unsigned int pixels[4];
+  for (int i = 0; i < 4; i++) {
+    pixels[i] = get_pixel(info, reader, line, 4*lx + i - shift, outside);
+  }
+  return pack_pixels(info, pixels);
+}
+
+/*
+ * Write the pre-shifted copies of all frames: for each frame, the
+ * image shifted right by 1, 2 and 3 pixels (in this order), with one
+ * extra word per line to hold the shifted pixels. Pixels outside the
+ * original image are filled with the transparent color. There's no
+ * copy shifted by 0 pixels, since that's just the normal image data.
+ */
+static int write_preshifted(struct INFO *info, FILE *out, const char *line_end, struct IMAGE_READER *reader, int stride)
+{
+  struct DATA_OUT data;
+  if (begin_data(info, &data, out, line_end, "shifted_data", 3*reader->num_tiles_x*reader->num_tiles_y, reader->h*(stride+1)) != 0) {
+    return 1;
+  }
+  int num_frames = 0;
+  for (int tile_x = 0; tile_x < reader->num_tiles_x; tile_x++) {
+    for (int tile_y = 0; tile_y < reader->num_tiles_y; tile_y++) {
+      if (num_frames++ > info->num_frames) {
+        break;
+      }
+      for (int shift = 1; shift < 4; shift++) {
+        for (int y = 0; y < reader->h; y++) {
+          for (int lx = 0; lx < stride+1; lx++) {
+            add_data_word(&data, get_frame_word(info, reader, tile_x, tile_y, shift, lx, y));
+          }
+        }
+      }
+    }
+  }
+  int size = end_data(info, &data);
+  if (size < 0) {
+    return 1;
+  }
+
+  printf("pre-shifted data: %d bytes%s", size, line_end);
+  return 0;
+}
+
+/*
+ * Return the type of a block of 4 pixels: 0 if all pixels are
+ * transparent, 2 if all pixels are opaque, 1 otherwise. Pixels
+ * outside the image are considered transparent.
+ */
+/*
+ * Write the transparency mask of each data word: 0x3f (the color bits)
+ * for each opaque pixel, 0x00 for each transparent (or padding) pixel.
+ */
+static void write_mask(struct INFO *info, FILE *out, const char *line_end, struct IMAGE_READER *reader, int stride)
+{
+  unsigned int transp = conv_pixel(info->sync_bits, 0x00ff00);
+  
+  fprintf(out, "const unsigned int img_%s_mask[] = {", info->var_name);
+  int num_out = 0;
+  int num_frames = 0;
+  for (int tile_x = 0; tile_x < reader->num_tiles_x; tile_x++) {
+    for (int tile_y = 0; tile_y < reader->num_tiles_y; tile_y++) {
+      if (num_frames++ > info->num_frames) {
+        break;
+      }
+      for (int y = 0; y < reader->h; y++) {
+        unsigned char *line = reader_get_image_line(reader, tile_x, tile_y, y);
+        for (int lx = 0; lx < stride; lx++) {
+          unsigned int masks[4];
+          for (int i = 0; i < 4; i++) {
+            unsigned int pixel = get_pixel(info, reader, line, 4*lx + i, transp);
+            masks[i] = ((pixel & 0x3f) != (transp & 0x3f)) ? 0x3f : 0;
+          }
+          write_word(out, line_end, &num_out, pack_pixels(info, masks));
+        }
+      }
+    }
+  }
+  fprintf(out, "%s};%s\n", line_end, line_end);
+}
+
+static int get_block_type(struct INFO *info, struct IMAGE_READER *reader, unsigned char *line, int lx)
+{
+  unsigned int transp = conv_pixel(info->sync_bits, 0x00ff00);
+  int num_opaque = 0;
+  for (int i = 0; i < 4; i++) {
+    if ((get_pixel(info, reader, line, 4*lx + i, transp) & 0x3f) != (transp & 0x3f)) {
+      num_opaque++;
+    }
+  }
+  return (num_opaque == 0) ? 0 : (num_opaque == 4) ? 2 : 1;
+}
+
+/*
+ * Write the span list of all frames. Each line is stored as a list of
+ * spans of 4-pixel blocks of the same type (fully opaque or partially
+ * transparent), skipping fully transparent blocks. Each span is a
+ * 16-bit value with the first block in bits 0-7, the number of blocks
+ * in bits 8-14 and bit 15 set if the span is fully opaque.
+ *
+ * The index of the first span of each line is written to another
+ * array, with an extra entry at the end marking the end of the last
+ * line.
+ */
+static int write_spans(struct INFO *info, FILE *out, const char *line_end, struct IMAGE_READER *reader, int stride)
+{
+  int num_lines = (info->num_frames + 1) * reader->h;
+  unsigned int *index = malloc(sizeof(unsigned int) * (num_lines + 1));
+  unsigned int *spans = malloc(sizeof(unsigned int) * num_lines * stride);
+  if (index == NULL || spans == NULL) {
+    free(index);
+    free(spans);
+    printf("ERROR: out of memory\n");
+    return 1;
+  }
+  
+  int num_spans = 0;
+  int num_index = 0;
+  int num_frames = 0;
+  for (int tile_x = 0; tile_x < reader->num_tiles_x; tile_x++) {
+    for (int tile_y = 0; tile_y < reader->num_tiles_y; tile_y++) {
+      if (num_frames++ > info->num_frames) {
+        break;
+      }
+      for (int y = 0; y < reader->h; y++) {
+        unsigned char *line = reader_get_image_line(reader, tile_x, tile_y, y);
+        index[num_index++] = num_spans;
+        int lx = 0;
+        while (lx < stride) {
+          int type = get_block_type(info, reader, line, lx);
+          if (type == 0) {
+            lx++;
+            continue;
+          }
+          int start = lx;
+          while (lx < stride && lx - start < 127 && get_block_type(info, reader, line, lx) == type) {
+            lx++;
+          }
+          spans[num_spans++] = ((type == 2) ? 0x8000 : 0) | ((lx - start) << 8) | start;
+        }
+      }
+    }
+  }
+  index[num_index++] = num_spans;
+  if (num_spans > 0xffff || stride > 0xff) {
+    free(index);
+    free(spans);
+    printf("ERROR: image too large for span list\n");
+    return 1;
+  }
+
+  fprintf(out, "const unsigned short img_%s_span_index[] = {", info->var_name);
+  for (int i = 0; i < num_index; i++) {
+    if (i % 12 == 0) {
+      fprintf(out, "%s  ", line_end);
+    }
+    fprintf(out, "0x%04x,", index[i]);
+  }
+  fprintf(out, "%s};%s\n", line_end, line_end);
+
+  fprintf(out, "const unsigned short img_%s_spans[] = {", info->var_name);
+  for (int i = 0; i < num_spans; i++) {
+    if (i % 12 == 0) {
+      fprintf(out, "%s  ", line_end);
+    }
+    fprintf(out, "0x%04x,", spans[i]);
+  }
+  fprintf(out, "%s};%s\n", line_end, line_end);
+
+  printf("span list: %d spans, %d bytes%s", num_spans, 2*(num_index + num_spans), line_end);
+  free(index);
+  free(spans);
+  return 0;
+}
+
+/*
+ * Write the bounding box of the opaque pixels of each frame: 4 bytes
+ * per frame with the first and last lines and the first and last
+ * 4-pixel blocks (all inclusive). Fully transparent frames have the
+ * first line greater than the last.
+ */
+static int write_bbox(struct INFO *info, FILE *out, const char *line_end, struct IMAGE_READER *reader, int stride)
+{
+  if (reader->h > 0xff || stride > 0xff) {
+    printf("ERROR: image too large for bounding box\n");
+    return 1;
+  }
+  
+  fprintf(out, "const unsigned char img_%s_bbox[] = {", info->var_name);
+  int num_frames = 0;
+  for (int tile_x = 0; tile_x < reader->num_tiles_x; tile_x++) {
+    for (int tile_y = 0; tile_y < reader->num_tiles_y; tile_y++) {
+      if (num_frames++ > info->num_frames) {
+        break;
+      }
+      int top = 0xff, bottom = 0, left = 0xff, right = 0;
+      for (int y = 0; y < reader->h; y++) {
+        unsigned char *line = reader_get_image_line(reader, tile_x, tile_y, y);
+        for (int lx = 0; lx < stride; lx++) {
+          if (get_block_type(info, reader, line, lx) != 0) {
+            if (top > y) top = y;
+            if (bottom < y) bottom = y;
+            if (left > lx) left = lx;
+            if (right < lx) right = lx;
+          }
+        }
+      }
+      if ((num_frames-1) % 4 == 0) {
+        fprintf(out, "%s  ", line_end);
+      }
+      fprintf(out, "0x%02x,0x%02x,0x%02x,0x%02x, ", top, bottom, left, right);
+    }
+  }
+  fprintf(out, "%s};%s\n", line_end, line_end);
+  return 0;
+}
+
+/*
+ * Write the opacity of each frame: 0 if all pixels are transparent, 2
+ * if all pixels are opaque, 1 otherwise.
+ */
+static int write_opacity(struct INFO *info, FILE *out, const char *line_end, struct IMAGE_READER *reader, int stride)
+{
+  fprintf(out, "const unsigned char img_%s_opacity[] = {", info->var_name);
+  int num_frames = 0;
+  for (int tile_x = 0; tile_x < reader->num_tiles_x; tile_x++) {
+    for (int tile_y = 0; tile_y < reader->num_tiles_y; tile_y++) {
+      if (num_frames++ > info->num_frames) {
+        break;
+      }
+      int has_transparent = 0, has_opaque = 0;
+      for (int y = 0; y < reader->h; y++) {
+        unsigned char *line = reader_get_image_line(reader, tile_x, tile_y, y);
+        for (int lx = 0; lx < stride; lx++) {
+          int type = get_block_type(info, reader, line, lx);
+          if (type != 2) has_transparent = 1;
+          if (type != 0) has_opaque = 1;
+        }
+      }
+      if ((num_frames-1) % 16 == 0) {
+        fprintf(out, "%s  ", line_end);
+      }
+      fprintf(out, "%d,", (! has_opaque) ? 0 : (! has_transparent) ? 2 : 1);
+    }
+  }
+  fprintf(out, "%s};%s\n", line_end, line_end);
+  return 0;
+}
+
+/*
+ * Find a palette for the colors used by a frame (used[c] is set for
+ * each color c), adding the missing colors to the first palette with
+ * room for them or to a new palette. Return the palette number, or -1
+ * if the frame has more than 16 colors.
+ */
+static int find_pal4_palette(unsigned char (*palettes)[16], int *palette_len, int *num_palettes, const int *used)
+{
+  int num_used = 0;
+  for (int c = 0; c < 256; c++) {
+    num_used += used[c];
+  }
+  if (num_used > 16) {
+    return -1;
+  }
+
+  for (int p = 0; ; p++) {
+    if (p == *num_palettes) {
+      palette_len[(*num_palettes)++] = 0;
+    }
+    int num_new = 0;
+    for (int c = 0; c < 256; c++) {
+      if (used[c] && memchr(palettes[p], c, palette_len[p]) == NULL) {
+        num_new++;
+      }
+    }
+    if (palette_len[p] + num_new > 16) {
+      continue;
+    }
+    for (int c = 0; c < 256; c++) {
+      if (used[c] && memchr(palettes[p], c, palette_len[p]) == NULL) {
+        palettes[p][palette_len[p]++] = c;
+      }
+    }
+    return p;
+  }
+}
+
+/*
+ * Write the lines of a frame (or of one of its pre-shifted copies)
+ * with 4 bits per pixel: each word has the palette indices of 2 data
+ * words, with the pixel in byte i of data word 2k+h in bits
+ * 16*h+4*i..16*h+4*i+3 of word k of the line.
+ */
+static void write_pal4_lines(struct INFO *info, struct DATA_OUT *data, struct IMAGE_READER *reader, int tile_x, int tile_y, int shift, int num_words, const unsigned char *palette)
+{
+  for (int y = 0; y < reader->h; y++) {
+    for (int lx = 0; lx < num_words; lx += 2) {
+      unsigned int v = 0;
+      for (int h = 0; h < 2 && lx + h < num_words; h++) {
+        unsigned int word = get_frame_word(info, reader, tile_x, tile_y, shift, lx + h, y);
+        for (int i = 0; i < 4; i++) {
+          const unsigned char *pos = memchr(palette, (word >> (8*i)) & 0xff, 16);
+          v |= (unsigned int) (pos - palette) << (16*h + 4*i);
+        }
+      }
+      add_data_word(data, v);
+    }
+  }
+}
+
+/*
+ * Write the image data (and the pre-shifted copies, if enabled) with 4
+ * bits per pixel. The frames are grouped in palettes of up to 16
+ * colors, written to img_<name>_palettes (16 bytes per palette), and
+ * the palette of each frame is written to img_<name>_palette_index.
+ */
+static int write_pal4(struct INFO *info, FILE *out, const char *line_end, struct IMAGE_READER *reader, int stride)
+{
+  // frames in the same order as the other data
+  int max_frames = reader->num_tiles_x * reader->num_tiles_y;
+  int *frame_tile = malloc(sizeof(int) * 2 * max_frames);
+  if (frame_tile == NULL) {
+    printf("ERROR: out of memory\n");
+    return 1;
+  }
+  int num_frames = 0;
+  for (int tile_x = 0; tile_x < reader->num_tiles_x; tile_x++) {
+    for (int tile_y = 0; tile_y < reader->num_tiles_y; tile_y++) {
+      if (num_frames > info->num_frames) {
+        break;
+      }
+      frame_tile[2*num_frames+0] = tile_x;
+      frame_tile[2*num_frames+1] = tile_y;
+      num_frames++;
+    }
+  }
+
+  unsigned char (*palettes)[16] = calloc(num_frames, 16);
+  int *palette_len = malloc(sizeof(int) * num_frames);
+  int *palette_index = malloc(sizeof(int) * num_frames);
+  if (palettes == NULL || palette_len == NULL || palette_index == NULL) {
+    free(palettes);
+    free(palette_len);
+    free(palette_index);
+    free(frame_tile);
+    printf("ERROR: out of memory\n");
+    return 1;
+  }
+
+  // assign palettes with the colors of the frames and pre-shifted copies
+  int num_palettes = 0;
+  for (int spr_num = 0; spr_num < num_frames; spr_num++) {
+    int used[256] = { 0 };
+    for (int shift = 0; shift < ((info->output_preshifted) ? 4 : 1); shift++) {
+      for (int y = 0; y < reader->h; y++) {
+        for (int lx = 0; lx < ((shift == 0) ? stride : stride+1); lx++) {
+          unsigned int word = get_frame_word(info, reader, frame_tile[2*spr_num], frame_tile[2*spr_num+1], shift, lx, y);
+          for (int i = 0; i < 4; i++) {
+            used[(word >> (8*i)) & 0xff] = 1;
+          }
+        }
+      }
+    }
+    palette_index[spr_num] = find_pal4_palette(palettes, palette_len, &num_palettes, used);
+    if (palette_index[spr_num] < 0) {
+      free(palettes);
+      free(palette_len);
+      free(palette_index);
+      free(frame_tile);
+      printf("ERROR: frame %d has more than 16 colors\n", spr_num);
+      return 1;
+    }
+  }
+
+  struct DATA_OUT data;
+  int data_size = -1;
+  if (begin_data(info, &data, out, line_end, "data", num_frames, reader->h*((stride+1)/2)) == 0) {
+    for (int spr_num = 0; spr_num < num_frames; spr_num++) {
+      write_pal4_lines(info, &data, reader, frame_tile[2*spr_num], frame_tile[2*spr_num+1], 0, stride, palettes[palette_index[spr_num]]);
+    }
+    data_size = end_data(info, &data);
+  }
+
+  int shifted_size = 0;
+  if (data_size >= 0 && info->output_preshifted) {
+    shifted_size = -1;
+    if (begin_data(info, &data, out, line_end, "shifted_data", 3*num_frames, reader->h*((stride+2)/2)) == 0) {
+      for (int spr_num = 0; spr_num < num_frames; spr_num++) {
+        for (int shift = 1; shift < 4; shift++) {
+          write_pal4_lines(info, &data, reader, frame_tile[2*spr_num], frame_tile[2*spr_num+1], shift, stride+1, palettes[palette_index[spr_num]]);
+        }
+      }
+      shifted_size = end_data(info, &data);
+    }
+  }
+  if (data_size < 0 || shifted_size < 0) {
+    free(palettes);
+    free(palette_len);
+    free(palette_index);
+    free(frame_tile);
+    return 1;
+  }
+
+  fprintf(out, "const unsigned char img_%s_palettes[] = {", info->var_name);
+  for (int p = 0; p < num_palettes; p++) {
+    fprintf(out, "%s ", line_end);
+    for (int i = 0; i < 16; i++) {
+      fprintf(out, " 0x%02x,", palettes[p][i]);
+    }
+  }
+  fprintf(out, "%s};%s\n", line_end, line_end);
+
+  fprintf(out, "const unsigned char img_%s_palette_index[] = {", info->var_name);
+  for (int spr_num = 0; spr_num < num_frames; spr_num++) {
+    if (spr_num % 16 == 0) {
+      fprintf(out, "%s  ", line_end);
+    }
+    fprintf(out, "%d,", palette_index[spr_num]);
+  }
+  fprintf(out, "%s};%s\n", line_end, line_end);
+
+  int size_8bit = 4 * num_frames * reader->h * (stride + ((info->output_preshifted) ? 3*(stride+1) : 0));
+  printf("4-bit data: %d bytes, pre-shifted: %d bytes, palettes: %d (%d bytes); 8-bit data would be %d bytes%s",
+         data_size, shifted_size, num_palettes, 16*num_palettes + num_frames, size_8bit, line_end);
+  free(palettes);
+  free(palette_len);
+  free(palette_index);
+  free(frame_tile);
+  return 0;
+}
+
+/*
+ * Print the estimated flash used by the compiled sprite code (Xtensa:
+ * each store needs a literal load, an OR with the sync bits and a store,
+ * masked stores need 2 literals and a load, AND and OR (the mask keeps
+ * the sync bits of the screen), and each line loads its pointer).
+ */
+static void print_compiled_size(struct INFO *info, int num_funcs, int num_lines, int num_stores, int num_masked)
+{
+  int code_size = 12*num_funcs + 9*num_lines + 13*num_stores + 23*num_masked;
+  printf("compiled %s: %d functions, %d stores, %d masked stores, ~%d bytes of flash\n",
+         info->var_name, num_funcs, num_stores, num_masked, code_size);
+}
+
+/*
+ * Write the frames as code: for each frame and alignment (x%4), a
+ * function that draws the opaque pixels of the frame at x%4 == align
+ * with word stores (and masked stores for blocks with some transparent
+ * pixels), without clipping. The functions are stored in the table
+ * img_<name>_compiled[4*frame + align], and the number of words each
+ * one stores in img_<name>_compiled_words[4*frame + align].
+ */
+static int write_compiled(struct INFO *info, FILE *out, const char *line_end, struct IMAGE_READER *reader)
+{
+  unsigned int transp = conv_pixel(info->sync_bits, 0x00ff00);
+  int num_funcs = 0, num_lines = 0, num_stores = 0, num_masked = 0;
+  int *func_words = malloc(sizeof(int) * 4 * (info->num_frames + 1));
+  if (! func_words) {
+    printf("ERROR: out of memory\n");
+    return 1;
+  }
+
+  int frame = 0;
+  for (int tile_x = 0; tile_x < reader->num_tiles_x; tile_x++) {
+    for (int tile_y = 0; tile_y < reader->num_tiles_y; tile_y++, frame++) {
+      if (frame > info->num_frames) {
+        break;
+      }
+      for (int align = 0; align < 4; align++) {
+        fprintf(out, "static void img_%s_compiled_%d_%d(unsigned char **lines, int block_x, unsigned int sb)%s{%s", info->var_name, frame, align, line_end, line_end);
+        fprintf(out, "  unsigned int *s;%s", line_end);
+        int words = num_stores + num_masked;
+        for (int y = 0; y < reader->h; y++) {
+          unsigned char *line = reader_get_image_line(reader, tile_x, tile_y, y);
+          int line_started = 0;
+          for (int sx = 0; sx < (reader->w + align + 3)/4; sx++) {
+            unsigned int pixels[4], masks[4];
+            int num_opaque = 0;
+            for (int i = 0; i < 4; i++) {
+              unsigned int pixel = get_pixel(info, reader, line, 4*sx + i - align, transp);
+              int opaque = (pixel & 0x3f) != (transp & 0x3f);
+              pixels[i] = (opaque) ? pixel : 0;
+              masks[i] = (opaque) ? 0x3f : 0;
+              num_opaque += opaque;
+            }
+            if (num_opaque == 0) continue;
+            if (! line_started) {
+              fprintf(out, "  s = (unsigned int *) lines[%d] + block_x;%s", y, line_end);
+              line_started = 1;
+              num_lines++;
+            }
+            if (num_opaque == 4) {
+              fprintf(out, "  s[%d] = 0x%08xu | sb;%s", sx, pack_pixels(info, pixels), line_end);
+              num_stores++;
+            } else {
+              fprintf(out, "  s[%d] = (s[%d] & 0x%08xu) | 0x%08xu;%s", sx, sx, ~pack_pixels(info, masks), pack_pixels(info, pixels), line_end);
+              num_masked++;
+            }
+          }
+        }
+        fprintf(out, "}%s%s", line_end, line_end);
+        func_words[num_funcs] = num_stores + num_masked - words;
+        num_funcs++;
+      }
+    }
+  }
+
+  fprintf(out, "void (*const img_%s_compiled[])(unsigned char **lines, int block_x, unsigned int sb) = {", info->var_name);
+  for (int i = 0; i < num_funcs; i++) {
+    if (i % 4 == 0) {
+      fprintf(out, "%s ", line_end);
+    }
+    fprintf(out, " img_%s_compiled_%d_%d,", info->var_name, i/4, i%4);
+  }
+  fprintf(out, "%s};%s", line_end, line_end);
+
+  fprintf(out, "const unsigned short img_%s_compiled_words[] = {", info->var_name);
+  for (int i = 0; i < num_funcs; i++) {
+    if (i % 16 == 0) {
+      fprintf(out, "%s ", line_end);
+    }
+    fprintf(out, " %d,", func_words[i]);
+  }
+  fprintf(out, "%s};%s", line_end, line_end);
+  free(func_words);
+
+  print_compiled_size(info, num_funcs, num_lines, num_stores, num_masked);
+  return 0;
+}
+
 static int conv_file(struct INFO *info)
 {
   struct IMAGE_READER reader;
@@ -81,49 +826,84 @@ static int conv_file(struct INFO *info)
   fprintf(out, "#define img_%s_stride  %d%s\n", info->var_name, width/4, line_end);
   fprintf(out, "#define img_%s_num_spr %d%s%s\n", info->var_name, info->num_frames, line_end, line_end);
 
-  fprintf(out, "const unsigned int img_%s_data[] = {", info->var_name);
-  int num_out = 0;
-  int num_frames = 0;
-  int bpp = reader.bmp->bpp / 8;
-  for (int tile_x = 0; tile_x < reader.num_tiles_x; tile_x++) {
-    for (int tile_y = 0; tile_y < reader.num_tiles_y; tile_y++) {
-      if (num_frames++ > info->num_frames) {
-        printf("stopping at frame %d\n", num_frames);
-        break;
-      }
-        
-      for (int y = 0; y < reader.h; y++) {
-        unsigned char *line = reader_get_image_line(&reader, tile_x, tile_y, y);
-        for (int lx = 0; lx < width/4; lx++) {  // process 4 pixels at a time
-          unsigned int pixels[4];
-          for (int i = 0; i < 4; i++) {
-            int x = 4*lx + i;
-            pixels[i] = (x >= reader.w) ? 0 : (((unsigned int)line[bpp*x+0] <<  0) |
-                                               ((unsigned int)line[bpp*x+1] <<  8) |
-                                               ((unsigned int)line[bpp*x+2] << 16) |
-                                               ((unsigned int)line[bpp*x+3] << 24));
-          }
-          unsigned int v;
-          if (info->dont_scramble_for_esp32) {
-            v = ((conv_pixel(info->sync_bits, pixels[0])<< 0) |
-                 (conv_pixel(info->sync_bits, pixels[1])<< 8) |
-                 (conv_pixel(info->sync_bits, pixels[2])<<16) |
-                 (conv_pixel(info->sync_bits, pixels[3])<<24));
-          } else {
-            v = ((conv_pixel(info->sync_bits, pixels[0])<<16) |
-                 (conv_pixel(info->sync_bits, pixels[1])<<24) |
-                 (conv_pixel(info->sync_bits, pixels[2])<< 0) |
-                 (conv_pixel(info->sync_bits, pixels[3])<< 8));
-          }
-          if (num_out++ % 8 == 0) {
-            fprintf(out, "%s  ", line_end);
+  if (info->output_pal4) {
+    if (write_pal4(info, out, line_end, &reader, width/4) != 0) {
+      fclose(out);
+      bmp_free(reader.bmp);
+      return 1;
+    }
+  } else {
+    struct DATA_OUT data;
+    if (begin_data(info, &data, out, line_end, "data", reader.num_tiles_x*reader.num_tiles_y, reader.h*(width/4)) != 0) {
+      fclose(out);
+      bmp_free(reader.bmp);
+      return 1;
+    }
+    int num_frames = 0;
+    for (int tile_x = 0; tile_x < reader.num_tiles_x; tile_x++) {
+      for (int tile_y = 0; tile_y < reader.num_tiles_y; tile_y++) {
+        if (num_frames++ > info->num_frames) {
+          printf("stopping at frame %d\n", num_frames);
+          break;
+        }
+
+        for (int y = 0; y < reader.h; y++) {
+          for (int lx = 0; lx < width/4; lx++) {  // process 4 pixels at a time
+            add_data_word(&data, get_frame_word(info, &reader, tile_x, tile_y, 0, lx, y));
           }
-          fprintf(out, "0x%08xu,", v);
         }
       }
     }
+    if (end_data(info, &data) < 0) {
+      fclose(out);
+      bmp_free(reader.bmp);
+      return 1;
+    }
+
+    if (info->output_preshifted) {
+      if (write_preshifted(info, out, line_end, &reader, width/4) != 0) {
+        fclose(out);
+        bmp_free(reader.bmp);
+        return 1;
+      }
+    }
+  }
+
+  if (info->output_mask) {
+    write_mask(info, out, line_end, &reader, width/4);
+  }
+
+  if (info->output_spans) {
+    if (write_spans(info, out, line_end, &reader, width/4) != 0) {
+      fclose(out);
+      bmp_free(reader.bmp);
+      return 1;
+    }
+  }
+
+  if (info->output_bbox) {
+    if (write_bbox(info, out, line_end, &reader, width/4) != 0) {
+      fclose(out);
+      bmp_free(reader.bmp);
+      return 1;
+    }
+  }
+
+  if (info->output_opacity) {
+    if (write_opacity(info, out, line_end, &reader, width/4) != 0) {
+      fclose(out);
+      bmp_free(reader.bmp);
+      return 1;
+    }
+  }
+
+  if (info->output_compiled) {
+    if (write_compiled(info, out, line_end, &reader) != 0) {
+      fclose(out);
+      bmp_free(reader.bmp);
+      return 1;
+    }
   }
-  fprintf(out, "%s};%s\n", line_end, line_end);
   
   fclose(out);
   bmp_free(reader.bmp);
@@ -138,9 +918,17 @@ static void print_help(const char *progname)
   printf("   -h              show this help\n");
   printf("   -out FILE       set output file (default: based on input file)\n");
   printf("   -name NAME      set C variable name (default: based on input file)\n");
-  printf("   -sync BITS      set sync bits (default: 0x3c)\n");
+  printf("   -sync BITS      set sync bits (default: 0, the game adds them when drawing)\n");
   printf("   -frames N       set maximum num frames to convert (defaut: 0=unlimited)\n");
   printf("   -noscramble     don't scramble image as required by ESP32 I2S\n");
+  printf("   -preshift       also output frames pre-shifted for unaligned drawing\n");
+  printf("   -spans          also output list of opaque spans for transparent drawing\n");
+  printf("   -bbox           also output bounding box of opaque pixels of each frame\n");
+  printf("   -opacity        also output opacity (empty, opaque or mixed) of each frame\n");
+  printf("   -compiled       also output code for drawing each frame (compiled sprite)\n");
+  printf("   -mask           also output transparency mask for each data word\n");
+  printf("   -pal4           output the image data with 4 bits per pixel and per-frame palettes\n");
+  printf("   -lz             output the image data compressed (each frame on its own)\n");
 }
 
 static int parse_sync_bits(struct INFO *info, const char *str)
@@ -270,6 +1058,14 @@ static int parse_args(struct INFO *info, int argc, char *argv[])
   info->num_frames = 0;
   info->dont_scramble_for_esp32 = 0;
   info->dont_output_crlf = 0;
+  info->output_preshifted = 0;
+  info->output_spans = 0;
+  info->output_bbox = 0;
+  info->output_opacity = 0;
+  info->output_compiled = 0;
+  info->output_mask = 0;
+  info->output_pal4 = 0;
+  info->output_lz = 0;
   for (int i = 1; i < argc; i++) {
     if (argv[i][0] == '-') {
       if (strcmp(argv[i], "-h") == 0) {
@@ -323,6 +1119,22 @@ static int parse_args(struct INFO *info, int argc, char *argv[])
         info->dont_scramble_for_esp32 = 1;
       } else if (strcmp(argv[i], "-no-crlf") == 0) {
         info->dont_output_crlf = 1;
+      } else if (strcmp(argv[i], "-preshift") == 0) {
+        info->output_preshifted = 1;
+      } else if (strcmp(argv[i], "-spans") == 0) {
+        info->output_spans = 1;
+      } else if (strcmp(argv[i], "-bbox") == 0) {
+        info->output_bbox = 1;
+      } else if (strcmp(argv[i], "-opacity") == 0) {
+        info->output_opacity = 1;
+      } else if (strcmp(argv[i], "-compiled") == 0) {
+        info->output_compiled = 1;
+      } else if (strcmp(argv[i], "-mask") == 0) {
+        info->output_mask = 1;
+      } else if (strcmp(argv[i], "-pal4") == 0) {
+        info->output_pal4 = 1;
+      } else if (strcmp(argv[i], "-lz") == 0) {
+        info->output_lz = 1;
       } else {
         printf("%s: unknown option: '%s'\n", info->progname, argv[i]);
         return 1;
@@ -340,6 +1152,10 @@ static int parse_args(struct INFO *info, int argc, char *argv[])
     printf("%s: no input file!\n", argv[0]);
     return 1;
   }
+  if (info->output_pal4 && info->output_mask) {
+    printf("%s: -mask can't be used with -pal4 (the mask would be larger than the image data)\n", argv[0]);
+    return 1;
+  }
   
   if (info->out_filename[0] == '\0') {
     if (make_default_out_filename(info, "spr_", ".h") != 0) {
@@ -0,0 +1,711 @@
+/* blit_test.cpp
+ *
+ * Host tests of the GameScreen blitters for line_sim: images are drawn
+ * to a small target through the real drawing code and compared pixel
+ * for pixel with a simple version that draws one pixel at a time. The
+ * target lines have guard bytes on both sides, and there's a guard
+ * line above and below the target; they must never be written.
+ *
+ * blit_test_spans() draws each sprite def with span lists as stored
+ * (compressed, with compiled frames, etc.), through its span lists
+ * with and without the pre-shifted frames, and through the raw
+ * blitters, at every x alignment, clipped on each side and unclipped,
+ * mirrored, transparent or not and with the colors remapped.
+ *
+ * blit_test_masks() draws random lines with transparency masks (like
+ * the ones written by conv_spr -mask) at random positions through the
+ * masked blitters and through the blitters that compare the pixels with
+ * the transparent color, and the sprites with masks made for them (if
+ * drawSprite() uses masks, see SPRITE_MASKS_ENABLED).
+ *
+ * blit_test_transp() draws random lines at random positions through the
+ * blitters that compare the pixels with the transparent color, with
+ * every color as the transparent color, and measures the time to draw
+ * the lines of the sprites at each x alignment with drawImageLineTrN.
+ *
+ * blit_test_rows() compares the tiles drawn with the blitters
+ * specialized for the tile width (drawImageRows(), used by drawSprite()
+ * for unclipped tiles) with the tiles drawn line by line with the
+ * blitters for any width, checking that they match and measuring both.
+ *
+ * blit_test_preshift() measures the time per pixel to draw the sprites
+ * with pre-shifted frames at each x alignment with and without them.
+ *
+ * blit_test_syncbits() measures the time to draw lines with each
+ * blitter at each x alignment with and without adding the sync bits
+ * (see sync_bench.cpp).
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <cstdarg>
+#include <chrono>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "game_screen.h"
+#include "game_data.h"
+#include "blit_test.h"
+#include "sync_bench.h"
+
+#define TARGET_W       96   // test target size (TARGET_W must be a multiple of 4)
+#define TARGET_H       80
+#define TARGET_GUARD   4    // guard bytes at each side of the target lines
+#define TARGET_STRIDE  (TARGET_W + 2*TARGET_GUARD)
+#define TEST_FRAMES    8    // frames of each sprite def tested (spread over all its frames)
+#define MAX_REPORTS    10   // mismatches reported in detail
+#define LINE_TESTS     200000  // random lines drawn by the line tests
+#define MAX_LINE_WIDTH (TARGET_W + 16)  // width of the widest random line (wider than the target)
+#define BENCH_REPEAT   3    // times each benchmark is run, keeping the shortest time (to filter out host noise)
+
+// clock for the benchmarks: the CPU time stamp counter if available
+#if defined(__x86_64__) || defined(__i386__)
+#define BENCH_CLOCK_UNIT "TSC cycles"
+static unsigned long long bench_clock() { return __rdtsc(); }
+#else
+#define BENCH_CLOCK_UNIT "ns"
+static unsigned long long bench_clock()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+// GameScreen with the drawing functions used by the tests made public
+class BlitTest : public GameScreen {
+public:
+  using GameScreen::setDrawTarget;
+  using GameScreen::readImageLine;
+  using GameScreen::drawImageLine;
+  using GameScreen::drawImageLineTr0;
+  using GameScreen::drawImageLineTr1;
+  using GameScreen::drawImageLineTr2;
+  using GameScreen::drawImageLineTr3;
+};
+
+// sprite def with its frames uncompressed and 8 bits per pixel
+struct PLAIN_DEF {
+  SPRITE_DEF def;
+  std::vector<unsigned int> data;
+  std::vector<unsigned int> shifted_data;
+  std::vector<unsigned int> mask;
+};
+
+// target lines, with a guard line above and below
+struct TEST_TARGET {
+  std::vector<unsigned char> mem;
+  unsigned char *lines[TARGET_H + 2];
+  unsigned char **target() { return &lines[1]; }
+};
+
+static int num_reports;
+
+// copy the frames (and pre-shifted frames) of `src` uncompressed and
+// expanded to 8 bits per pixel; the span lists, bounding boxes and
+// opacity are shared, and the copy has no compiled frames or masks
+static void make_plain_def(BlitTest &screen, const SPRITE_DEF *src, PLAIN_DEF *plain)
+{
+  std::vector<unsigned int> line(src->stride + 1);
+  plain->data.resize(src->num_frames * src->height * src->stride + 1);  // +1: the blitters may read one block past the end
+  for (int frame = 0; frame < src->num_frames; frame++) {
+    for (int y = 0; y < src->height; y++) {
+      const unsigned int *image = screen.readImageLine(src, frame, 0, y, nullptr, line.data());
+      memcpy(&plain->data[src->stride * (src->height * frame + y)], image, sizeof(unsigned int) * src->stride);
+    }
+  }
+  if (SPRITE_HAS_SHIFTED(src)) {
+    int stride = src->stride + 1;
+    plain->shifted_data.resize(3 * src->num_frames * src->height * stride + 1);
+    for (int frame = 0; frame < src->num_frames; frame++) {
+      for (int shift = 1; shift < 4; shift++) {
+        for (int y = 0; y < src->height; y++) {
+          const unsigned int *image = screen.readImageLine(src, frame, shift, y, nullptr, line.data());
+          memcpy(&plain->shifted_data[stride * (src->height * (3*frame + shift-1) + y)], image, sizeof(unsigned int) * stride);
+        }
+      }
+    }
+  }
+
+  plain->def = *src;
+  plain->def.data = plain->data.data();
+  plain->def.shifted_data = (plain->shifted_data.empty()) ? nullptr : plain->shifted_data.data();
+  plain->def.mask = nullptr;
+  plain->def.compiled = nullptr;
+  plain->def.palettes = nullptr;
+  plain->def.palette_index = nullptr;
+  plain->def.lz_data = nullptr;
+  plain->def.lz_data_index = nullptr;
+  plain->def.lz_shifted_data = nullptr;
+  plain->def.lz_shifted_data_index = nullptr;
+}
+
+// transparency mask of an image block: 0x3f for each opaque pixel
+static unsigned int opaque_mask(unsigned int block, unsigned char key)
+{
+  unsigned int mask = 0;
+  for (int i = 0; i < 4; i++) {
+    if (((block >> (8*i)) & 0x3f) != key) mask |= 0x3fu << (8*i);
+  }
+  return mask;
+}
+
+// make the transparency mask of the frames of a plain def, like
+// conv_spr -mask (the padding pixels are black, so they're opaque)
+static void make_mask(PLAIN_DEF *plain)
+{
+  int num_words = plain->def.num_frames * plain->def.height * plain->def.stride;
+  plain->mask.resize(num_words + 1);
+  for (int i = 0; i < num_words; i++) {
+    plain->mask[i] = opaque_mask(plain->data[i], plain->def.transparent_key);
+  }
+  plain->def.mask = plain->mask.data();
+}
+
+// fill num_words words of an image line with runs of transparent and
+// opaque pixels of random colors, and their transparency mask (if mask
+// is not nullptr)
+static void random_image_line(unsigned int *image, unsigned int *mask, int num_words, unsigned char key)
+{
+  unsigned char *pixels = (unsigned char *) image;
+  bool opaque = (rand() & 1) != 0;
+  for (int i = 0; i < 4*num_words; i++) {
+    if (rand() % 6 == 0) opaque = ! opaque;
+    pixels[i] = (opaque) ? (key + 1 + rand() % 63) & 0x3f : key;
+  }
+  for (int i = 0; i < num_words && mask; i++) {
+    mask[i] = opaque_mask(image[i], key);
+  }
+}
+
+static void init_target(TEST_TARGET *t)
+{
+  t->mem.resize(TARGET_STRIDE * (TARGET_H + 2));
+  for (int y = 0; y < TARGET_H + 2; y++) {
+    t->lines[y] = &t->mem[TARGET_STRIDE * y + TARGET_GUARD];
+  }
+}
+
+// fill the target (and the guards) with random colors
+static void fill_target(TEST_TARGET *t, unsigned char sync_bits)
+{
+  for (unsigned char &c : t->mem) {
+    c = (rand() & 0x3f) | sync_bits;
+  }
+}
+
+// draw a sprite def with 8 bits per pixel one pixel at a time (pixel x
+// of a line is in byte x^2, see the pixel order in game_screen.cpp)
+static void ref_draw_sprite(unsigned char **lines, const SPRITE_DEF *def, int spr_x, int spr_y, int frame,
+                            bool transparent, bool flip, const unsigned char *remap, unsigned char sync_bits)
+{
+  for (int y = 0; y < def->height; y++) {
+    if (spr_y + y < 0 || spr_y + y >= TARGET_H) continue;
+    const unsigned char *src = (const unsigned char *) &def->data[def->stride * (def->height * frame + y)];
+    for (int x = 0; x < def->width; x++) {
+      if (spr_x + x < 0 || spr_x + x >= TARGET_W) continue;
+      int image_x = (flip) ? def->width - 1 - x : x;
+      unsigned char color = src[image_x ^ 2] & 0x3f;
+      if (remap) color = remap[color];
+      if (transparent && color == def->transparent_key) continue;
+      lines[spr_y + y][(spr_x + x) ^ 2] = color | sync_bits;
+    }
+  }
+}
+
+// draw an image line with 8 bits per pixel one pixel at a time
+static void ref_draw_line(unsigned char *line, int x, const unsigned int *image, int width,
+                          bool transparent, unsigned char key, unsigned char sync_bits)
+{
+  const unsigned char *src = (const unsigned char *) image;
+  for (int i = 0; i < width; i++) {
+    if (x + i < 0 || x + i >= TARGET_W) continue;
+    unsigned char color = src[i ^ 2] & 0x3f;
+    if (transparent && color == key) continue;
+    line[(x + i) ^ 2] = color | sync_bits;
+  }
+}
+
+// report the first pixel of the target that doesn't match the expected image
+static void report_mismatch(const TEST_TARGET &t, const TEST_TARGET &expected, const char *what)
+{
+  if (num_reports++ >= MAX_REPORTS) return;
+  for (int i = 0; i < (int) t.mem.size(); i++) {
+    if (t.mem[i] != expected.mem[i]) {
+      int x = ((i % TARGET_STRIDE) ^ 2) - TARGET_GUARD;
+      int y = i / TARGET_STRIDE - 1;
+      printf("MISMATCH: %s: pixel (%d,%d) is 0x%02x, expected 0x%02x\n", what, x, y, t.mem[i], expected.mem[i]);
+      break;
+    }
+  }
+}
+
+// positions of an image of the given size along a side of the target:
+// fully outside, clipped at each edge and inside, each at 4 consecutive
+// positions (all alignments)
+static std::vector<int> test_positions(int size, int target_size)
+{
+  const int base[] = { -size - 4, -size + 1, -size/2, -2, (target_size - size)/2, target_size - size - 1, target_size - size/2, target_size - 2 };
+  std::vector<int> pos;
+  for (int b : base) {
+    for (int i = 0; i < 4; i++) pos.push_back(b + i);
+  }
+  return pos;
+}
+
+// state of a test: the screen whose blitters are tested, drawing to
+// `target`, and the images to compare
+struct BLIT_TEST {
+  BlitTest screen;
+  unsigned char sync_bits;
+  unsigned char key;          // transparent color of the test images
+  TEST_TARGET background;
+  TEST_TARGET expected;
+  TEST_TARGET target;
+  int num_draws;
+  int num_mismatches;
+};
+
+// a way of drawing a sprite def
+struct TEST_VARIANT {
+  const char *name;
+  const SPRITE_DEF *def;
+};
+
+// set the transparent color used by the blitters, which is set by
+// drawSprite(): draw a sprite with that color outside the target
+static void set_transparent_key(BLIT_TEST *t, unsigned char key)
+{
+  static const unsigned int data[2] = { 0, 0 };
+  SPRITE_DEF def = {};
+  def.width = 4;
+  def.height = 1;
+  def.stride = 1;
+  def.num_frames = 1;
+  def.data = data;
+  def.format = SPRITE_FORMAT_RAW;
+  def.transparent_key = key;
+  t->screen.drawSprite(&def, -1000, -1000, 0, true);
+  t->key = key;
+}
+
+static void init_test(BLIT_TEST *t, const int *pin_config, GameNetwork *net, GameJoy *joy)
+{
+  t->screen.init(pin_config, net, joy);
+  t->sync_bits = t->screen.getSBits();
+  init_target(&t->background);
+  init_target(&t->expected);
+  init_target(&t->target);
+  fill_target(&t->background, t->sync_bits);
+  t->screen.setDrawTarget(t->target.target(), TARGET_W, TARGET_H);
+
+  set_transparent_key(t, game_sprite_defs[0].transparent_key);
+  t->num_draws = 0;
+  t->num_mismatches = 0;
+}
+
+// compare the target with the expected image
+static void check_test(BLIT_TEST *t, const char *what_fmt, ...)
+{
+  t->num_draws++;
+  if (t->target.mem == t->expected.mem) return;
+  t->num_mismatches++;
+  char what[128];
+  va_list ap;
+  va_start(ap, what_fmt);
+  vsnprintf(what, sizeof(what), what_fmt, ap);
+  va_end(ap);
+  report_mismatch(t->target, t->expected, what);
+}
+
+// draw frames of sprite def number `d` in each of the given ways at all
+// test positions, mirrored or not, transparent or not and with or
+// without remapped colors, comparing them with the pixel by pixel
+// version of the plain copy of the def
+static void test_sprite_variants(BLIT_TEST *t, int d, const PLAIN_DEF &plain, const TEST_VARIANT *variants, int num_variants)
+{
+  const SPRITE_DEF *def = &plain.def;
+  std::vector<int> xs = test_positions(def->width, TARGET_W);
+  std::vector<int> ys = test_positions(def->height, TARGET_H);
+  int frame_step = (def->num_frames + TEST_FRAMES - 1) / TEST_FRAMES;
+  for (int frame = 0; frame < def->num_frames; frame += frame_step) {
+    for (int y : ys) {
+      for (int x : xs) {
+        for (int flags = 0; flags < 8; flags++) {
+          bool transparent = (flags & 1) != 0;
+          bool flip = (flags & 2) != 0;
+          const unsigned char *remap = (flags & 4) ? game_remap_remote_player : nullptr;
+          t->expected.mem = t->background.mem;
+          ref_draw_sprite(t->expected.target(), def, x, y, frame, transparent, flip, remap, t->sync_bits);
+          for (int v = 0; v < num_variants; v++) {
+            t->target.mem = t->background.mem;
+            t->screen.drawSprite(variants[v].def, x, y, frame, transparent, flip, remap);
+            check_test(t, "def %d (%s) frame %d at (%d,%d)%s%s%s", d, variants[v].name, frame, x, y,
+                       (transparent) ? " transparent" : "", (flip) ? " mirrored" : "", (remap) ? " remapped" : "");
+          }
+        }
+      }
+    }
+  }
+}
+
+// draw sprites with span lists through the span lists and through the
+// raw blitters, comparing them with the pixel by pixel version
+int blit_test_spans(const int *pin_config, GameNetwork *net, GameJoy *joy)
+{
+  BLIT_TEST t;
+  init_test(&t, pin_config, net, joy);
+  for (int d = 0; d < game_num_sprite_defs; d++) {
+    const SPRITE_DEF *src = &game_sprite_defs[d];
+    if (src->format != SPRITE_FORMAT_SPANS) continue;
+    PLAIN_DEF plain;
+    make_plain_def(t.screen, src, &plain);
+
+    // the span lists without the pre-shifted frames use the raw
+    // blitters for each span if x%4 != 0
+    SPRITE_DEF spans_unshifted = plain.def;
+    spans_unshifted.shifted_data = nullptr;
+    SPRITE_DEF raw = spans_unshifted;
+    raw.format = SPRITE_FORMAT_RAW;
+    SPRITE_DEF raw_shifted = plain.def;
+    raw_shifted.format = SPRITE_FORMAT_RAW;
+    const TEST_VARIANT variants[] = {
+      { "stored", src },
+      { "spans unshifted", &spans_unshifted },
+      { "raw", &raw },
+      { "spans", &plain.def },         // (only for defs with pre-shifted frames)
+      { "raw shifted", &raw_shifted },
+    };
+    test_sprite_variants(&t, d, plain, variants, (plain.def.shifted_data) ? 5 : 3);
+  }
+  printf("%d sprites drawn, %d mismatches\n", t.num_draws, t.num_mismatches);
+  return (t.num_mismatches == 0) ? 0 : 1;
+}
+
+// draw random image lines at random positions (many of them clipped)
+// with their transparency masks and with the transparent color,
+// comparing both with the pixel by pixel version
+static void test_mask_lines(BLIT_TEST *t)
+{
+  unsigned int image[MAX_LINE_WIDTH/4 + 2];  // (+1: the blitters may read one block past the end)
+  unsigned int mask[MAX_LINE_WIDTH/4 + 2];
+  for (int n = 0; n < LINE_TESTS; n++) {
+    int width = 1 + rand() % MAX_LINE_WIDTH;
+    int x = rand() % (TARGET_W + width + 8) - width - 4;
+    int y = rand() % TARGET_H;
+    random_image_line(image, mask, (width+3)/4 + 1, t->key);
+    t->expected.mem = t->background.mem;
+    ref_draw_line(t->expected.target()[y], x, image, width, true, t->key, t->sync_bits);
+
+    t->target.mem = t->background.mem;
+    t->screen.drawImageLine((unsigned int *) t->target.target()[y], x, image, width, true, mask);
+    check_test(t, "masked line of width %d at (%d,%d)", width, x, y);
+    t->target.mem = t->background.mem;
+    t->screen.drawImageLine((unsigned int *) t->target.target()[y], x, image, width, true);
+    check_test(t, "transparent line of width %d at (%d,%d)", width, x, y);
+  }
+}
+
+// draw random lines and sprites with transparency masks through the
+// masked blitters, comparing them with the pixel by pixel version
+int blit_test_masks(const int *pin_config, GameNetwork *net, GameJoy *joy)
+{
+  BLIT_TEST t;
+  init_test(&t, pin_config, net, joy);
+  test_mask_lines(&t);
+  printf("%d lines drawn, %d mismatches\n", t.num_draws, t.num_mismatches);
+  int line_mismatches = t.num_mismatches;
+#if ! SPRITE_MASKS_ENABLED
+  printf("sprites not drawn: drawSprite() ignores the masks (build with LINE_SIM_FLAGS=-DSPRITE_MASKS_ENABLED=1)\n");
+  return (line_mismatches == 0) ? 0 : 1;
+#endif
+
+  // the masks are only used for unmirrored frames that are not
+  // pre-shifted: drawn with the masks if x%4 == 0 or without pre-shifted
+  // frames, and without them otherwise
+  t.num_draws = t.num_mismatches = 0;
+  for (int d = 0; d < game_num_sprite_defs; d++) {
+    PLAIN_DEF plain;
+    make_plain_def(t.screen, &game_sprite_defs[d], &plain);
+    make_mask(&plain);
+    SPRITE_DEF raw = plain.def;
+    raw.format = SPRITE_FORMAT_RAW;
+    raw.shifted_data = nullptr;
+    SPRITE_DEF spans = plain.def;
+    spans.shifted_data = nullptr;
+    const TEST_VARIANT variants[] = {
+      { "raw masked", &raw },
+      { "spans masked", &spans },      // (only for defs with span lists)
+      { "spans shifted masked", &plain.def },  // (only for defs with span lists and pre-shifted frames)
+    };
+    int num_variants = 1;
+    if (plain.def.format == SPRITE_FORMAT_SPANS) num_variants = (plain.def.shifted_data) ? 3 : 2;
+    test_sprite_variants(&t, d, plain, variants, num_variants);
+  }
+  printf("%d sprites drawn, %d mismatches\n", t.num_draws, t.num_mismatches);
+  return (line_mismatches == 0 && t.num_mismatches == 0) ? 0 : 1;
+}
+
+// draw random image lines at random positions (many of them clipped)
+// with each color as the transparent color, comparing them with the
+// pixel by pixel version
+static void test_transp_lines(BLIT_TEST *t)
+{
+  unsigned int image[MAX_LINE_WIDTH/4 + 2];  // (+1: the blitters may read one block past the end)
+  for (int key = 0; key < 64; key++) {
+    set_transparent_key(t, key);
+    for (int n = 0; n < LINE_TESTS/64; n++) {
+      int width = 1 + rand() % MAX_LINE_WIDTH;
+      int x = rand() % (TARGET_W + width + 8) - width - 4;
+      int y = rand() % TARGET_H;
+      random_image_line(image, nullptr, (width+3)/4 + 1, key);
+      t->expected.mem = t->background.mem;
+      ref_draw_line(t->expected.target()[y], x, image, width, true, key, t->sync_bits);
+      t->target.mem = t->background.mem;
+      t->screen.drawImageLine((unsigned int *) t->target.target()[y], x, image, width, true);
+      check_test(t, "line of width %d at (%d,%d) with transparent color 0x%02x", width, x, y, key);
+    }
+  }
+  set_transparent_key(t, game_sprite_defs[0].transparent_key);
+}
+
+// time to draw all lines of all frames of a plain def at x%4 == align
+// with drawImageLineTrN (the shortest of BENCH_REPEAT runs)
+static unsigned int time_transp_lines(BLIT_TEST *t, const SPRITE_DEF *def, int align)
+{
+  unsigned int best_nanos = 0;
+  for (int r = 0; r < BENCH_REPEAT; r++) {
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < def->num_frames; frame++) {
+      for (int y = 0; y < def->height; y++) {
+        unsigned int *screen = (unsigned int *) t->target.target()[y % TARGET_H] + 1;
+        const unsigned int *image = &def->data[def->stride * (def->height * frame + y)];
+        switch (align) {
+        case 0: t->screen.drawImageLineTr0(screen, image, def->width); break;
+        case 1: t->screen.drawImageLineTr1(screen, image, def->width, false); break;
+        case 2: t->screen.drawImageLineTr2(screen, image, def->width, false); break;
+        case 3: t->screen.drawImageLineTr3(screen, image, def->width, false); break;
+        }
+      }
+    }
+    auto end = std::chrono::steady_clock::now();
+    unsigned int nanos = (unsigned int) std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    if (r == 0 || best_nanos > nanos) best_nanos = nanos;
+  }
+  return best_nanos;
+}
+
+// check the transparent blitters with random lines and measure the
+// time to draw the sprite lines with them at each alignment
+int blit_test_transp(const int *pin_config, GameNetwork *net, GameJoy *joy)
+{
+  BLIT_TEST t;
+  init_test(&t, pin_config, net, joy);
+  test_transp_lines(&t);
+  printf("%d lines drawn, %d mismatches\n", t.num_draws, t.num_mismatches);
+
+  printf("transparent line time, ns per line (per pixel):\n");
+  printf("def  width         x%%4 == 0             1             2             3\n");
+  for (int d = 0; d < game_num_sprite_defs; d++) {
+    PLAIN_DEF plain;
+    make_plain_def(t.screen, &game_sprite_defs[d], &plain);
+    const SPRITE_DEF *def = &plain.def;
+    int num_lines = def->num_frames * def->height;
+    printf("%3d  %5d", d, def->width);
+    for (int align = 0; align < 4; align++) {
+      double line_nanos = (double) time_transp_lines(&t, def, align) / num_lines;
+      printf("  %6.1f (%4.2f)", line_nanos, line_nanos / def->width);
+    }
+    printf("\n");
+  }
+  return (t.num_mismatches == 0) ? 0 : 1;
+}
+
+// draw all frames of a plain def of TILE_WIDTH pixels at (4+align, 0),
+// with drawSprite() (which uses drawImageRows() for unclipped lines of
+// TILE_WIDTH pixels) or line by line with drawImageLine()
+static void draw_tiles(BLIT_TEST *t, const SPRITE_DEF *def, int align, bool transparent, bool rows)
+{
+  for (int frame = 0; frame < def->num_frames; frame++) {
+    if (rows) {
+      t->screen.drawSprite(def, 4 + align, 0, frame, transparent);
+      continue;
+    }
+    for (int y = 0; y < def->height; y++) {
+      const unsigned int *image = &def->data[def->stride * (def->height * frame + y)];
+      t->screen.drawImageLine((unsigned int *) t->target.target()[y], 4 + align, image, def->width, transparent);
+    }
+  }
+}
+
+// time to draw all frames of a def with draw_tiles() (the shortest of
+// BENCH_REPEAT runs)
+static unsigned int time_tiles(BLIT_TEST *t, const SPRITE_DEF *def, int align, bool transparent, bool rows)
+{
+  unsigned int best_nanos = 0;
+  for (int r = 0; r < BENCH_REPEAT; r++) {
+    auto start = std::chrono::steady_clock::now();
+    draw_tiles(t, def, align, transparent, rows);
+    auto end = std::chrono::steady_clock::now();
+    unsigned int nanos = (unsigned int) std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    if (r == 0 || best_nanos > nanos) best_nanos = nanos;
+  }
+  return best_nanos;
+}
+
+// check and time the tiles drawn with the blitters specialized for the
+// tile width against the blitters for any width
+int blit_test_rows(const int *pin_config, GameNetwork *net, GameJoy *joy)
+{
+  BLIT_TEST t;
+  init_test(&t, pin_config, net, joy);
+  for (int d = 0; d < game_num_sprite_defs; d++) {
+    if (game_sprite_defs[d].width != TILE_WIDTH) continue;
+    PLAIN_DEF plain;
+    make_plain_def(t.screen, &game_sprite_defs[d], &plain);
+    SPRITE_DEF def = plain.def;  // drawn with the raw blitters without trimming
+    def.format = SPRITE_FORMAT_RAW;
+    def.shifted_data = nullptr;
+    def.bbox = nullptr;
+
+    for (int align = 0; align < 4; align++) {
+      for (int transparent = 0; transparent < 2; transparent++) {
+        for (int frame = 0; frame < def.num_frames; frame++) {
+          t.expected.mem = t.background.mem;
+          ref_draw_sprite(t.expected.target(), &def, 4 + align, 0, frame, transparent, false, nullptr, t.sync_bits);
+          t.target.mem = t.background.mem;
+          t.screen.drawSprite(&def, 4 + align, 0, frame, transparent);
+          check_test(&t, "def %d frame %d at x%%4 == %d%s (rows)", d, frame, align, (transparent) ? " transparent" : "");
+          t.target.mem = t.background.mem;
+          for (int y = 0; y < def.height; y++) {
+            const unsigned int *image = &def.data[def.stride * (def.height * frame + y)];
+            t.screen.drawImageLine((unsigned int *) t.target.target()[y], 4 + align, image, def.width, transparent);
+          }
+          check_test(&t, "def %d frame %d at x%%4 == %d%s (lines)", d, frame, align, (transparent) ? " transparent" : "");
+        }
+      }
+    }
+
+    printf("def %d: %d tiles of %dx%d, ns per tile:\n", d, def.num_frames, def.width, def.height);
+    printf("x%%4      opaque rows   lines    transparent rows   lines\n");
+    for (int align = 0; align < 4; align++) {
+      printf("%4d", align);
+      for (int transparent = 0; transparent < 2; transparent++) {
+        double rows_nanos = (double) time_tiles(&t, &def, align, transparent, true) / def.num_frames;
+        double lines_nanos = (double) time_tiles(&t, &def, align, transparent, false) / def.num_frames;
+        printf("  %15.0f %7.0f", rows_nanos, lines_nanos);
+      }
+      printf("\n");
+    }
+  }
+  printf("%d tiles drawn, %d mismatches\n", t.num_draws, t.num_mismatches);
+  return (t.num_mismatches == 0) ? 0 : 1;
+}
+
+// time to draw all frames of a def at (8+align, 8), in bench_clock()
+// units (the shortest of BENCH_REPEAT runs)
+static unsigned long long time_sprite(BLIT_TEST *t, const SPRITE_DEF *def, int align, bool transparent)
+{
+  unsigned long long best = 0;
+  for (int r = 0; r < BENCH_REPEAT; r++) {
+    unsigned long long start = bench_clock();
+    for (int frame = 0; frame < def->num_frames; frame++) {
+      t->screen.drawSprite(def, 8 + align, 8, frame, transparent);
+    }
+    unsigned long long time = bench_clock() - start;
+    if (r == 0 || best > time) best = time;
+  }
+  return best;
+}
+
+// measure the time per pixel to draw the sprites with pre-shifted
+// frames at each alignment, with and without the pre-shifted frames
+int blit_test_preshift(const int *pin_config, GameNetwork *net, GameJoy *joy)
+{
+  BLIT_TEST t;
+  init_test(&t, pin_config, net, joy);
+  for (int d = 0; d < game_num_sprite_defs; d++) {
+    if (! SPRITE_HAS_SHIFTED(&game_sprite_defs[d])) continue;
+    PLAIN_DEF plain;
+    make_plain_def(t.screen, &game_sprite_defs[d], &plain);
+    SPRITE_DEF raw_shifted = plain.def;
+    raw_shifted.format = SPRITE_FORMAT_RAW;
+    SPRITE_DEF raw = raw_shifted;
+    raw.shifted_data = nullptr;
+    SPRITE_DEF spans = plain.def;
+    spans.shifted_data = nullptr;
+    struct { const char *name; const SPRITE_DEF *shifted; const SPRITE_DEF *unshifted; bool transparent; } cases[] = {
+      { "transparent raw", &raw_shifted, &raw, true },
+      { "opaque raw", &raw_shifted, &raw, false },
+      { "transparent spans", &plain.def, &spans, true },  // (only for defs with span lists)
+    };
+    int num_cases = (plain.def.format == SPRITE_FORMAT_SPANS) ? 3 : 2;
+
+    // check the images before measuring them
+    for (int align = 0; align < 4; align++) {
+      for (int c = 0; c < num_cases; c++) {
+        for (int frame = 0; frame < plain.def.num_frames; frame++) {
+          t.expected.mem = t.background.mem;
+          ref_draw_sprite(t.expected.target(), &plain.def, 8 + align, 8, frame, cases[c].transparent, false, nullptr, t.sync_bits);
+          for (int shifted = 0; shifted < 2; shifted++) {
+            t.target.mem = t.background.mem;
+            t.screen.drawSprite((shifted) ? cases[c].shifted : cases[c].unshifted, 8 + align, 8, frame, cases[c].transparent);
+            check_test(&t, "def %d frame %d at x%%4 == %d (%s%s)", d, frame, align, cases[c].name, (shifted) ? ", pre-shifted" : "");
+          }
+        }
+      }
+    }
+
+    int num_pixels = plain.def.num_frames * plain.def.width * plain.def.height;
+    printf("def %d: %d frames of %dx%d, %s per pixel with and without the pre-shifted frames:\n",
+           d, plain.def.num_frames, plain.def.width, plain.def.height, BENCH_CLOCK_UNIT);
+    printf("x%%4");
+    for (int c = 0; c < num_cases; c++) printf("  %19s", cases[c].name);
+    printf("\n");
+    for (int align = 0; align < 4; align++) {
+      printf("%3d", align);
+      for (int c = 0; c < num_cases; c++) {
+        double shifted_time = (double) time_sprite(&t, cases[c].shifted, align, cases[c].transparent) / num_pixels;
+        double unshifted_time = (double) time_sprite(&t, cases[c].unshifted, align, cases[c].transparent) / num_pixels;
+        printf("  %9.2f %9.2f", shifted_time, unshifted_time);
+      }
+      printf("\n");
+    }
+  }
+  printf("%d sprites drawn, %d mismatches\n", t.num_draws, t.num_mismatches);
+  return (t.num_mismatches == 0) ? 0 : 1;
+}
+
+// measure the time per line of each blitter at each alignment with and
+// without adding the sync bits (the two are run alternately, so they
+// see the same host conditions)
+int blit_test_syncbits(const int *pin_config, GameNetwork *net, GameJoy *joy)
+{
+  static const char *names[SYNC_BENCH_NUM_BLITTERS] = {
+    "opaque line", "transparent line", "masked line", "opaque tile rows", "transp. tile rows", "background line",
+  };
+  sync_bench_init(pin_config, net, joy);
+  sync_bench_init_nosync(pin_config, net, joy);
+
+  printf("ns per line with and without adding the sync bits (lines of %d pixels,\n", SYNC_BENCH_LINE_WIDTH);
+  printf("tile rows of %d pixels, background lines of 320 pixels):\n", TILE_WIDTH);
+  printf("blitter                    x%%4 == 0                 1                 2                 3\n");
+  for (int b = 0; b < SYNC_BENCH_NUM_BLITTERS; b++) {
+    printf("%-18s", names[b]);
+    for (int align = 0; align < 4; align++) {
+      unsigned int sync_nanos = 0, nosync_nanos = 0;
+      int num_lines = 1;
+      for (int r = 0; r < 8*BENCH_REPEAT; r++) {  // (short runs: more of them to filter out host noise)
+        unsigned int nanos = sync_bench_time(b, align, &num_lines);
+        if (r == 0 || sync_nanos > nanos) sync_nanos = nanos;
+        nanos = sync_bench_time_nosync(b, align, &num_lines);
+        if (r == 0 || nosync_nanos > nanos) nosync_nanos = nanos;
+      }
+      printf("  %6.1f %6.1f %+3.0f%%", (double) sync_nanos / num_lines, (double) nosync_nanos / num_lines,
+             100.0 * ((double) sync_nanos / nosync_nanos - 1));
+    }
+    printf("\n");
+  }
+  return 0;
+}
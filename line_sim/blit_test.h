@@ -0,0 +1,16 @@
+#ifndef BLIT_TEST_H_FILE
+#define BLIT_TEST_H_FILE
+
+// host tests of the GameScreen blitters (see blit_test.cpp)
+
+class GameNetwork;
+class GameJoy;
+
+int blit_test_spans(const int *pin_config, GameNetwork *net, GameJoy *joy);
+int blit_test_masks(const int *pin_config, GameNetwork *net, GameJoy *joy);
+int blit_test_transp(const int *pin_config, GameNetwork *net, GameJoy *joy);
+int blit_test_rows(const int *pin_config, GameNetwork *net, GameJoy *joy);
+int blit_test_preshift(const int *pin_config, GameNetwork *net, GameJoy *joy);
+int blit_test_syncbits(const int *pin_config, GameNetwork *net, GameJoy *joy);
+
+#endif /* BLIT_TEST_H_FILE */
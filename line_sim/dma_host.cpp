@@ -0,0 +1,239 @@
+/* dma_host.cpp
+ *
+ * Host versions of the ESP-IDF functions used by vga_6bit.cpp (see
+ * dma_host.h), and a DMA engine that sends a frame by walking the
+ * descriptor chain set in the I2S registers, like the ESP32 would.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "dma_host.h"
+
+#define DMA_MEMORY_SIZE  (4*1024*1024)
+#define DMA_FILL_BYTE    0x5a              // contents of newly allocated DMA memory
+#define FRAME_MICROS     16683             // time to send a frame at 60Hz
+#define MAX_WAIT_FRAMES  3                 // frames sent waiting for a semaphore before giving up
+
+struct DMA_ALLOC {
+  size_t start;
+  size_t size;
+  bool live;
+};
+
+static uint8_t dma_memory[DMA_MEMORY_SIZE] __attribute__((aligned(4)));
+static size_t dma_memory_used;
+static std::vector<DMA_ALLOC> dma_allocs;
+static int dma_num_live_allocs;
+
+struct host_semaphore_t {
+  bool given;
+};
+
+static intr_handler_t isr_handler;
+static void *isr_arg;
+static bool isr_enabled;
+static int64_t host_micros;
+
+i2s_dev_t I2S1;
+const uint32_t GPIO_PIN_MUX_REG[40] = { 0 };
+
+// DMA memory: allocated in sequence and reused from the start when all
+// of it is freed (vga_deinit() frees everything allocated by vga_init())
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+  if ((uintptr_t) dma_memory + DMA_MEMORY_SIZE > 0xffffffffu) {
+    printf("ERROR: the DMA memory is not addressable with 32 bits (link with -no-pie)\n");
+    exit(1);
+  }
+  size_t start = (dma_memory_used + 3) & ~(size_t) 3;
+  if (start + size > DMA_MEMORY_SIZE) return nullptr;
+  dma_memory_used = start + size;
+  dma_allocs.push_back({ start, size, true });
+  dma_num_live_allocs++;
+  memset(dma_memory + start, DMA_FILL_BYTE, size);
+  return dma_memory + start;
+}
+
+void heap_caps_free(void *ptr)
+{
+  if (! ptr) return;
+  for (DMA_ALLOC &alloc : dma_allocs) {
+    if (alloc.live && dma_memory + alloc.start == ptr) {
+      alloc.live = false;
+      if (--dma_num_live_allocs == 0) {
+        dma_allocs.clear();
+        dma_memory_used = 0;
+      }
+      return;
+    }
+  }
+  printf("ERROR: freeing %p, which is not allocated DMA memory\n", ptr);
+  exit(1);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+  return DMA_MEMORY_SIZE - dma_memory_used;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+  return DMA_MEMORY_SIZE - dma_memory_used;
+}
+
+bool dma_host_is_dma_memory(const void *ptr, int len)
+{
+  const uint8_t *p = (const uint8_t *) ptr;
+  for (const DMA_ALLOC &alloc : dma_allocs) {
+    if (alloc.live && p >= dma_memory + alloc.start && p + len <= dma_memory + alloc.start + alloc.size) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int dma_host_get_num_allocs()
+{
+  return dma_num_live_allocs;
+}
+
+// interrupts: only the I2S interrupt handler is used
+
+int esp_intr_alloc(int source, int flags, intr_handler_t handler, void *arg, intr_handle_t *ret_handle)
+{
+  isr_handler = handler;
+  isr_arg = arg;
+  isr_enabled = (flags & ESP_INTR_FLAG_INTRDISABLED) == 0;
+  *ret_handle = (intr_handle_t) &isr_handler;
+  return 0;
+}
+
+int esp_intr_enable(intr_handle_t handle)
+{
+  isr_enabled = true;
+  return 0;
+}
+
+int esp_intr_disable(intr_handle_t handle)
+{
+  isr_enabled = false;
+  return 0;
+}
+
+int esp_intr_free(intr_handle_t handle)
+{
+  isr_handler = nullptr;
+  isr_enabled = false;
+  return 0;
+}
+
+int64_t esp_timer_get_time()
+{
+  return host_micros;
+}
+
+// tasks and semaphores
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t func, const char *name, uint32_t stack_size, void *arg,
+                                   UBaseType_t priority, TaskHandle_t *task, BaseType_t core)
+{
+  static int dummy_task;
+  *task = (TaskHandle_t) &dummy_task;
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {}
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) { return 0; }
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *task_woken) {}
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+  return new host_semaphore_t { false };
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+  delete sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+  static uint8_t frame[1024*1024];
+  static DMA_HOST_DESC descs[8192];
+  int num_descs;
+  for (int i = 0; i < MAX_WAIT_FRAMES && ! sem->given; i++) {
+    if (dma_host_send_frame(frame, sizeof(frame), descs, sizeof(descs)/sizeof(*descs), &num_descs) < 0) break;
+  }
+  if (! sem->given) {
+    printf("ERROR: semaphore not given after sending %d frames\n", MAX_WAIT_FRAMES);
+    exit(1);
+  }
+  sem->given = false;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+  sem->given = true;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *task_woken)
+{
+  sem->given = true;
+  *task_woken = pdTRUE;
+  return pdTRUE;
+}
+
+// Send a frame: walk the descriptor chain from the first descriptor set
+// in the I2S registers until it comes back to it, copying the buffers to
+// `frame` and calling the interrupt handler after each descriptor with
+// the eof bit set. The buffer and length of each descriptor are stored
+// in `descs`. Return the length of the frame, or -1 on error.
+int dma_host_send_frame(uint8_t *frame, int max_len, DMA_HOST_DESC *descs, int max_descs, int *num_descs)
+{
+  lldesc_t *first = (lldesc_t *) (uintptr_t) I2S1.out_link.addr;
+  if (! first || ! I2S1.out_link.start || ! I2S1.conf.tx_start) {
+    printf("ERROR: the I2S output is not started\n");
+    return -1;
+  }
+  int len = 0;
+  int n = 0;
+  lldesc_t *desc = first;
+  do {
+    if (! dma_host_is_dma_memory(desc, sizeof(lldesc_t))) {
+      printf("ERROR: descriptor %d is not in DMA memory\n", n);
+      return -1;
+    }
+    if (! desc->owner) {
+      printf("ERROR: descriptor %d is not owned by the DMA\n", n);
+      return -1;
+    }
+    if (n >= max_descs || len + (int) desc->length > max_len) {
+      printf("ERROR: the frame has more than %d descriptors or %d bytes\n", max_descs, max_len);
+      return -1;
+    }
+    descs[n].buf = (const uint8_t *) desc->buf;
+    descs[n].len = desc->length;
+    descs[n].pos = len;
+    if (desc->length > 0) {
+      memcpy(frame + len, (const uint8_t *) desc->buf, desc->length);
+    }
+    len += desc->length;
+    n++;
+    if (desc->eof && isr_handler && isr_enabled && I2S1.int_ena.out_eof) {
+      I2S1.out_eof_des_addr = (uint32_t) (uintptr_t) desc;
+      isr_handler(isr_arg);
+    }
+    desc = desc->qe.stqe_next;
+  } while (desc && desc != first);
+  if (! desc) {
+    printf("ERROR: the descriptor chain is not a loop\n");
+    return -1;
+  }
+  host_micros += FRAME_MICROS;
+  *num_descs = n;
+  return len;
+}
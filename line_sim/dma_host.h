@@ -0,0 +1,162 @@
+#ifndef DMA_HOST_H_FILE
+#define DMA_HOST_H_FILE
+
+/*
+ * Host versions of the ESP-IDF functions and registers used by
+ * vga_6bit.cpp, so dma_sim can run the real VGA code. The headers in
+ * dma_include/ only include this file.
+ *
+ * The DMA memory is a static block below 4GB (dma_sim is linked with
+ * -no-pie), so the descriptor addresses written to the 32-bit I2S
+ * registers are still valid pointers.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+// esp_heap_caps.h
+#define MALLOC_CAP_DMA  (1<<3)
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void heap_caps_free(void *ptr);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+
+// esp32/rom/lldesc.h (same bit fields as the ESP32)
+struct lldesc_t {
+  volatile uint32_t size   : 12,
+                    length : 12,
+                    offset : 5,
+                    sosf   : 1,
+                    eof    : 1,
+                    owner  : 1;
+  volatile uint8_t *buf;
+  union {
+    volatile uint32_t empty;
+    struct {
+      lldesc_t *stqe_next;
+    } qe;
+  };
+};
+
+// soc/i2s_struct.h: every register has all the fields used by
+// vga_6bit.cpp, as plain variables
+struct i2s_host_reg_t {
+  uint32_t val;
+  uint32_t tx_reset, rx_reset, tx_fifo_reset, rx_fifo_reset, tx_start;
+  uint32_t tx_right_first, tx_msb_right, tx_msb_shift, tx_mono, tx_short_sync;
+  uint32_t in_rst, out_rst;
+  uint32_t lcd_en, lcd_tx_wrx2_en, lcd_tx_sdx2_en;
+  uint32_t tx_bits_mod, tx_bck_div_num;
+  uint32_t clka_en, clkm_div_num, clkm_div_a, clkm_div_b;
+  uint32_t tx_fifo_mod_force_en, tx_fifo_mod, tx_data_num, dscr_en;
+  uint32_t tx_stop_en, tx_pcm_bypass, tx_chan_mod;
+  uint32_t rx_fifo_reset_back;
+  uint32_t addr, start, stop;
+  uint32_t out_eof;
+};
+
+struct i2s_dev_t {
+  i2s_host_reg_t conf, conf1, conf2, conf_chan, lc_conf, sample_rate_conf;
+  i2s_host_reg_t clkm_conf, fifo_conf, timing, state, out_link;
+  i2s_host_reg_t int_ena, int_raw, int_clr;
+  uint32_t out_eof_des_addr;   // descriptor that raised the last interrupt
+};
+extern i2s_dev_t I2S1;
+
+// soc/soc.h, soc/i2s_reg.h
+#define REG_READ(reg)             0u
+#define REG_WRITE(reg, val)       ((void) (val))
+#define I2S_INT_RAW_REG(i)        0
+#define I2S_INT_CLR_REG(i)        0
+#define I2S_IN_RST_M              (1<<0)
+#define I2S_OUT_RST_M             (1<<1)
+#define I2S_AHBM_FIFO_RST_M       (1<<2)
+#define I2S_AHBM_RST_M            (1<<3)
+#define I2S_OUT_DATA_BURST_EN     (1<<11)
+#define I2S_OUTDSCR_BURST_EN      (1<<10)
+#define I2S_TX_RESET_M            (1<<0)
+#define I2S_RX_RESET_M            (1<<1)
+#define I2S_TX_FIFO_RESET_M       (1<<2)
+#define I2S_RX_FIFO_RESET_M       (1<<3)
+
+// soc/rtc.h, soc/io_mux_reg.h, driver/gpio.h, driver/periph_ctrl.h
+typedef int gpio_num_t;
+typedef int gpio_mode_t;
+#define GPIO_MODE_DEF_OUTPUT      2
+#define PIN_FUNC_GPIO             2
+#define I2S1O_DATA_OUT0_IDX       166
+#define PERIPH_I2S1_MODULE        1
+extern const uint32_t GPIO_PIN_MUX_REG[40];
+#define PIN_FUNC_SELECT(reg, func) ((void) (reg), (void) (func))
+inline void rtc_clk_apll_enable(bool enable, uint32_t sdm0, uint32_t sdm1, uint32_t sdm2, uint32_t o_div) {}
+inline void periph_module_enable(int module) {}
+inline int gpio_set_direction(gpio_num_t pin, gpio_mode_t mode) { return 0; }
+inline void gpio_matrix_out(uint32_t pin, uint32_t idx, bool out_inv, bool oen_inv) {}
+
+// esp_intr_alloc.h
+typedef void (*intr_handler_t)(void *arg);
+typedef struct intr_handle_data_t *intr_handle_t;
+#define ETS_I2S1_INTR_SOURCE         33
+#define ESP_INTR_FLAG_LEVEL3         (1<<3)
+#define ESP_INTR_FLAG_IRAM           (1<<10)
+#define ESP_INTR_FLAG_INTRDISABLED   (1<<11)
+int esp_intr_alloc(int source, int flags, intr_handler_t handler, void *arg, intr_handle_t *ret_handle);
+int esp_intr_enable(intr_handle_t handle);
+int esp_intr_disable(intr_handle_t handle);
+int esp_intr_free(intr_handle_t handle);
+
+// esp_timer.h
+int64_t esp_timer_get_time();
+
+// freertos: tasks are never run and semaphores never block: taking a
+// semaphore that isn't given sends frames until the interrupt handler
+// gives it
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef struct host_task_t *TaskHandle_t;
+typedef struct host_semaphore_t *SemaphoreHandle_t;
+typedef void (*TaskFunction_t)(void *arg);
+typedef int portMUX_TYPE;
+#define pdFALSE                      0
+#define pdTRUE                       1
+#define pdPASS                       1
+#define portMAX_DELAY                0xffffffffu
+#define portTICK_PERIOD_MS           1
+#define configMAX_PRIORITIES         25
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux)      ((void) (mux))
+#define portEXIT_CRITICAL(mux)       ((void) (mux))
+#define portENTER_CRITICAL_ISR(mux)  ((void) (mux))
+#define portEXIT_CRITICAL_ISR(mux)   ((void) (mux))
+#define portYIELD_FROM_ISR()         ((void) 0)
+inline void vTaskDelay(TickType_t ticks) {}
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t func, const char *name, uint32_t stack_size, void *arg,
+                                   UBaseType_t priority, TaskHandle_t *task, BaseType_t core);
+void vTaskDelete(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *task_woken);
+SemaphoreHandle_t xSemaphoreCreateBinary();
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *task_woken);
+
+// host functions for dma_sim
+
+struct DMA_HOST_DESC {
+  const uint8_t *buf;
+  int len;
+  int pos;         // position of the buffer in the frame
+};
+
+bool dma_host_is_dma_memory(const void *ptr, int len);
+int dma_host_get_num_allocs();
+int dma_host_send_frame(uint8_t *frame, int max_len, DMA_HOST_DESC *descs, int max_descs, int *num_descs);
+
+#endif /* DMA_HOST_H_FILE */
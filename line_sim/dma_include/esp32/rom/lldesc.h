@@ -0,0 +1,2 @@
+/* host version for dma_sim */
+#include "dma_host.h"
@@ -0,0 +1,388 @@
+/* dma_sim.cpp
+ *
+ * Host check of the DMA descriptor chain built by vga_6bit.cpp: runs
+ * the real VGA code (with the ESP-IDF functions of dma_host.cpp) for
+ * each VGA mode and several configurations, sends frames by walking
+ * the descriptor chain like the DMA would, and checks that every byte
+ * sent matches the mode timing: front porch, sync pulse and back porch
+ * of each line, the vertical sync lines, and the pixels of the
+ * framebuffer, HUD, border or solid lines shown in each visible line.
+ *
+ * It also checks each descriptor (a buffer in DMA memory at a 4-byte
+ * boundary, with a length multiple of 4 up to 4092 bytes), that the
+ * swapped framebuffers are shown, and that vga_deinit() frees all the
+ * DMA memory. Build it with -DVGA_BLANK_LINES_PER_DESC=N (see the
+ * Makefile) to check other folds of the blank lines.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <vector>
+
+#include "vga_6bit.h"
+#include "dma_host.h"
+
+#define SYNC_IDLE       0xc0   // all modes use negative sync pulses: both bits are 1 outside the pulses
+#define HSYNC_PULSE_BIT 0x40
+#define VSYNC_PULSE_BIT 0x80
+#define MAX_DESCS       8192
+#define MAX_FRAME_LEN   (1024*1024)
+
+struct MODE_TIMING {
+  const char *name;
+  const VgaMode *mode;
+  int h_front;
+  int h_sync;
+  int h_back;
+  int h_pixels;
+  int v_front;
+  int v_sync;
+  int v_back;
+  int v_pixels;
+  int v_div;
+};
+
+// the timing of each mode, as in the VGA standard (not read from vga_6bit.cpp)
+static const MODE_TIMING mode_timings[] = {
+  { "320x240", &vga_mode_320x240,  8, 48, 24, 320,  11, 2, 31, 480, 2 },
+  { "288x240", &vga_mode_288x240, 24, 48, 40, 288,  11, 2, 31, 480, 2 },
+  { "240x240", &vga_mode_240x240, 48, 48, 64, 240,  11, 2, 31, 480, 2 },
+};
+
+struct TEST_CONFIG {
+  const char *name;
+  int num_fb;
+  int hud_top;
+  int hud_bottom;
+  int border_top;
+  int border_bottom;
+  uint8_t border_color;
+  int beam_bands;
+  int ring_lines;
+  int segments;
+  bool solid_lines;
+};
+
+static const TEST_CONFIG test_configs[] = {
+  // name                         fb  hud     border         bands ring segs solid
+  { "2 framebuffers",              2,  0,  0,  0, 0, 0x00,     0,   0,   0, true  },
+  { "3 framebuffers",              3,  0,  0,  0, 0, 0x00,     0,   0,   0, false },
+  { "HUD, border, beam racing",    1, 16,  8,  8, 4, 0x30,     4,   0,   0, false },
+  { "line buffer and HUD",         0, 16,  8,  0, 0, 0x00,     0,  16,   0, false },
+  { "segments",                    2,  0,  0,  0, 0, 0x00,     0,   0,   4, false },
+};
+
+struct OPTIONS {
+  int num_frames;
+  bool show_descs;
+};
+
+struct SCREEN_STATE {
+  const MODE_TIMING *t;
+  const TEST_CONFIG *cfg;
+  int fb_height;
+  int pattern;                    // pattern drawn in the framebuffer being displayed
+  std::vector<int> solid_color;   // color of each solid framebuffer line, or -1
+  uint8_t *segment_lines[2];      // DMA memory with the lines pointed to by the segments
+};
+
+static void show_usage(const char *progname)
+{
+  printf("USAGE: %s [options]\n", progname);
+  printf("\n");
+  printf("options:\n");
+  printf("  -h          show this help\n");
+  printf("  -frames N   number of frames checked for each configuration (default 4)\n");
+  printf("  -descs      show the descriptors of the first frame of each configuration\n");
+}
+
+static int read_options(OPTIONS *opt, int argc, char **argv)
+{
+  opt->num_frames = 4;
+  opt->show_descs = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-h") == 0) {
+      show_usage(argv[0]);
+      exit(0);
+    } else if (strcmp(argv[i], "-frames") == 0 && i+1 < argc) {
+      opt->num_frames = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-descs") == 0) {
+      opt->show_descs = true;
+    } else {
+      printf("%s: invalid option '%s'\n", argv[0], argv[i]);
+      show_usage(argv[0]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// pixel byte `x` (in memory order) of line `y` of pattern number `p`
+static uint8_t pattern_byte(int p, int y, int x)
+{
+  return SYNC_IDLE | ((p*17 + y*5 + x) & 0x3f);
+}
+
+static void draw_pattern(uint8_t *line, int p, int y, int len)
+{
+  for (int x = 0; x < len; x++) {
+    line[x] = pattern_byte(p, y, x);
+  }
+}
+
+static int get_hblank_len(const MODE_TIMING *t)
+{
+  return (t->h_front + t->h_sync + t->h_back + 3) & ~3;  // the back porch is extended to a multiple of 4 bytes
+}
+
+// write the expected bytes of a frame to `frame` (in memory order, where
+// the 4 bytes of each word are sent in the order 2,3,0,1)
+static int make_expected_frame(uint8_t *frame, const SCREEN_STATE &s)
+{
+  const MODE_TIMING *t = s.t;
+  const TEST_CONFIG *cfg = s.cfg;
+  int hblank_len = get_hblank_len(t);
+  int line_len = hblank_len + t->h_pixels;
+  int num_blank = t->v_front + t->v_sync + t->v_back;
+  for (int l = 0; l < num_blank + t->v_pixels; l++) {
+    uint8_t *line = frame + l * line_len;
+    bool vsync = (l >= t->v_front && l < t->v_front + t->v_sync);
+    uint8_t idle = (vsync) ? SYNC_IDLE & ~VSYNC_PULSE_BIT : SYNC_IDLE;
+    for (int i = 0; i < hblank_len; i++) {
+      bool hsync = (i >= t->h_front && i < t->h_front + t->h_sync);
+      line[i^2] = (hsync) ? idle & ~HSYNC_PULSE_BIT : idle;
+    }
+    uint8_t *pixels = line + hblank_len;
+    if (l < num_blank) {
+      memset(pixels, idle, t->h_pixels);
+      continue;
+    }
+    int y = (l - num_blank) / t->v_div;
+    if (y < cfg->border_top) {
+      memset(pixels, SYNC_IDLE | (cfg->border_color & 0x3f), t->h_pixels);
+    } else if ((y -= cfg->border_top) < cfg->hud_top) {
+      draw_pattern(pixels, 100, y, t->h_pixels);
+    } else if ((y -= cfg->hud_top) < s.fb_height) {
+      if (cfg->ring_lines > 0) {
+        memset(pixels, SYNC_IDLE, t->h_pixels);   // (the ring lines are not rendered)
+      } else if (s.solid_color[y] >= 0) {
+        memset(pixels, SYNC_IDLE | s.solid_color[y], t->h_pixels);
+      } else {
+        draw_pattern(pixels, s.pattern, y, t->h_pixels);
+      }
+    } else if ((y -= s.fb_height) < cfg->hud_bottom) {
+      draw_pattern(pixels, 100, cfg->hud_top + y, t->h_pixels);
+    } else {
+      memset(pixels, SYNC_IDLE | (cfg->border_color & 0x3f), t->h_pixels);
+    }
+  }
+  return (num_blank + t->v_pixels) * line_len;
+}
+
+// draw pattern `p` in the back framebuffer (or segment list) and swap it
+static void draw_frame(SCREEN_STATE &s, int p)
+{
+  const MODE_TIMING *t = s.t;
+  if (s.cfg->segments > 0) {
+    // segments of varying lengths pointing to pattern lines in DMA memory
+    uint8_t *lines = s.segment_lines[p % 2];
+    VgaSegment *seg = vga_get_segments();
+    int n = s.cfg->segments;
+    for (int y = 0; y < s.fb_height; y++) {
+      draw_pattern(lines + y * t->h_pixels, p, y, t->h_pixels);
+      int x = 0;
+      for (int i = 0; i < n; i++) {
+        int len = (i < n-1) ? 4 * (1 + (3*y + i) % 16) : t->h_pixels - x;
+        seg[y*n + i].buf = lines + y * t->h_pixels + x;
+        seg[y*n + i].len = len;
+        x += len;
+      }
+    }
+  } else {
+    uint8_t **fb = vga_get_framebuffer();
+    for (int y = 0; y < s.fb_height; y++) {
+      draw_pattern(fb[y], p, y, t->h_pixels);
+      s.solid_color[y] = -1;
+    }
+    if (s.cfg->solid_lines) {
+      for (int y = p % 3; y < s.fb_height; y += 7) {
+        int color = (p + y) & 0x3f;
+        if (vga_set_solid_line(y, color)) s.solid_color[y] = color;
+      }
+    }
+  }
+  vga_swap_buffers();
+}
+
+static void print_descs(const DMA_HOST_DESC *descs, int num_descs, int line_len)
+{
+  for (int i = 0; i < num_descs; i++) {
+    printf("  %4d: line %3d+%-3d len %4d buf %p\n",
+           i, descs[i].pos / line_len, descs[i].pos % line_len, descs[i].len, (const void *) descs[i].buf);
+  }
+}
+
+// check the descriptors and the bytes of a frame sent; return the number of errors
+static int check_frame(const SCREEN_STATE &s, const uint8_t *frame, int len, const DMA_HOST_DESC *descs, int num_descs,
+                       uint8_t *expected)
+{
+  const MODE_TIMING *t = s.t;
+  int line_len = get_hblank_len(t) + t->h_pixels;
+  int num_errors = 0;
+  for (int i = 0; i < num_descs; i++) {
+    const DMA_HOST_DESC &d = descs[i];
+    if (d.len <= 0 || d.len > 4092 || d.len % 4 != 0 || (uintptr_t) d.buf % 4 != 0 || ! dma_host_is_dma_memory(d.buf, d.len)) {
+      if (num_errors++ < 10) {
+        printf("ERROR: invalid descriptor %d (line %d, len %d, buf %p)\n", i, d.pos / line_len, d.len, (const void *) d.buf);
+      }
+    }
+  }
+
+  int expected_len = make_expected_frame(expected, s);
+  if (len != expected_len) {
+    printf("ERROR: frame has %d bytes, expected %d\n", len, expected_len);
+    return num_errors + 1;
+  }
+  for (int l = 0; l * line_len < len; l++) {
+    const uint8_t *line = frame + l * line_len;
+    const uint8_t *exp_line = expected + l * line_len;
+    for (int i = 0; i < line_len; i++) {
+      if (line[i] != exp_line[i]) {
+        if (num_errors++ < 10) {
+          printf("ERROR: line %d, byte %d is 0x%02x, expected 0x%02x\n", l, i^2, line[i], exp_line[i]);
+        }
+        break;
+      }
+    }
+  }
+
+  // in line buffer mode, each framebuffer line must use the same ring line in every frame
+  if (s.cfg->ring_lines > 0) {
+    int num_blank = t->v_front + t->v_sync + t->v_back;
+    int first_line = num_blank + (s.cfg->border_top + s.cfg->hud_top) * t->v_div;
+    int ring_lines = vga_get_line_buffer_lines();
+    std::vector<const uint8_t *> ring_buf(ring_lines);
+    for (int i = 0; i < num_descs; i++) {
+      int l = descs[i].pos / line_len;
+      if (descs[i].pos % line_len == 0 || l < first_line || l >= first_line + s.fb_height * t->v_div) continue;
+      int y = (l - first_line) / t->v_div;
+      const uint8_t *&buf = ring_buf[y % ring_lines];
+      if (! buf) buf = descs[i].buf;
+      if (buf != descs[i].buf) {
+        if (num_errors++ < 10) {
+          printf("ERROR: framebuffer line %d doesn't use ring line %d\n", y, y % ring_lines);
+        }
+      }
+    }
+    for (int i = 0; i < ring_lines; i++) {
+      for (int j = i+1; j < ring_lines; j++) {
+        if (ring_buf[i] == ring_buf[j]) {
+          printf("ERROR: ring lines %d and %d use the same buffer\n", i, j);
+          num_errors++;
+        }
+      }
+    }
+  }
+  return num_errors;
+}
+
+// run the checks for a mode and configuration; return the number of errors
+static int check_config(const OPTIONS &opt, const int *pins, const MODE_TIMING *t, const TEST_CONFIG *cfg)
+{
+  static uint8_t frame[MAX_FRAME_LEN];
+  static uint8_t expected[MAX_FRAME_LEN];
+  static DMA_HOST_DESC descs[MAX_DESCS];
+
+  vga_set_hud(cfg->hud_top, cfg->hud_bottom);
+  vga_set_border(cfg->border_top, cfg->border_bottom, cfg->border_color);
+  vga_set_beam_bands(cfg->beam_bands);
+  vga_set_line_buffer(cfg->ring_lines, nullptr, nullptr, nullptr);
+  vga_set_segments(cfg->segments);
+  vga_init(pins, *t->mode, cfg->num_fb);
+
+  SCREEN_STATE s;
+  s.t = t;
+  s.cfg = cfg;
+  s.fb_height = vga_get_yres();
+  s.pattern = 0;
+  s.solid_color.assign(s.fb_height, -1);
+  s.segment_lines[0] = s.segment_lines[1] = nullptr;
+  int num_errors = 0;
+  if (vga_get_sync_bits() != SYNC_IDLE || vga_get_xres() != t->h_pixels ||
+      s.fb_height != t->v_pixels / t->v_div - cfg->border_top - cfg->border_bottom - cfg->hud_top - cfg->hud_bottom) {
+    printf("ERROR: wrong sync bits or resolution\n");
+    num_errors++;
+  }
+  if (cfg->segments > 0) {
+    s.segment_lines[0] = (uint8_t *) vga_alloc_dma(s.fb_height * t->h_pixels);
+    s.segment_lines[1] = (uint8_t *) vga_alloc_dma(s.fb_height * t->h_pixels);
+  }
+  uint8_t **hud = vga_get_hud_lines();
+  for (int y = 0; y < cfg->hud_top + cfg->hud_bottom; y++) {
+    draw_pattern(hud[y], 100, y, t->h_pixels);
+  }
+
+  int line_len = get_hblank_len(t) + t->h_pixels;
+  int num_descs = 0;
+  unsigned int band_count = 0;
+  for (int f = 1; f <= opt.num_frames && num_errors == 0; f++) {
+    if (cfg->ring_lines == 0) {
+      draw_frame(s, f);
+      s.pattern = f;
+    }
+
+    // a frame swapped without waiting is displayed after the current frame
+    int len = dma_host_send_frame(frame, MAX_FRAME_LEN, descs, MAX_DESCS, &num_descs);
+    if (len >= 0) len = dma_host_send_frame(frame, MAX_FRAME_LEN, descs, MAX_DESCS, &num_descs);
+    if (len < 0) return num_errors + 1;
+    if (f == 1 && opt.show_descs) {
+      print_descs(descs, num_descs, line_len);
+    }
+    num_errors += check_frame(s, frame, len, descs, num_descs, expected);
+
+    if (cfg->beam_bands > 0) {
+      unsigned int count = vga_get_beam_band_count();
+      if (count % cfg->beam_bands != 0 || count <= band_count) {
+        printf("ERROR: beam racing band count %u after %u\n", count, band_count);
+        num_errors++;
+      }
+      band_count = count;
+    }
+  }
+
+  int num_blank_descs = 0;
+  int num_blank_lines = t->v_front + t->v_sync + t->v_back;
+  for (int i = 0; i < num_descs && descs[i].pos < num_blank_lines * line_len; i++) {
+    num_blank_descs++;
+  }
+  printf("%s, %-26s %4d descriptors (%2d for %d blank lines): %s\n",
+         t->name, cfg->name, num_descs, num_blank_descs, num_blank_lines, (num_errors == 0) ? "OK" : "ERRORS");
+
+  vga_deinit();
+  heap_caps_free(s.segment_lines[0]);
+  heap_caps_free(s.segment_lines[1]);
+  if (dma_host_get_num_allocs() != 0) {
+    printf("ERROR: %d blocks of DMA memory not freed by vga_deinit()\n", dma_host_get_num_allocs());
+    num_errors++;
+  }
+  return num_errors;
+}
+
+int main(int argc, char **argv)
+{
+  OPTIONS opt;
+  if (read_options(&opt, argc, argv) != 0) {
+    return 1;
+  }
+
+  int pins[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  int num_errors = 0;
+  for (const MODE_TIMING &t : mode_timings) {
+    for (const TEST_CONFIG &cfg : test_configs) {
+      num_errors += check_config(opt, pins, &t, &cfg);
+    }
+  }
+  printf("%d errors\n", num_errors);
+  return (num_errors == 0) ? 0 : 1;
+}
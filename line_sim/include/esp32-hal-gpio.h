@@ -0,0 +1 @@
+/* empty: line_sim is built for the host */
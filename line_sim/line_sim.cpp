@@ -0,0 +1,565 @@
+/* line_sim.cpp
+ *
+ * Host simulation of the line buffer mode: renders the game screen at
+ * many positions of the map with the full frame renderer and again
+ * line by line through the same functions used by the VGA task in
+ * line buffer mode, checking that both images match and measuring the
+ * time to render each line.
+ *
+ * With -tiles, the tile mode is checked instead: the screen is
+ * rebuilt from the segment list composed for each frame (like the DMA
+ * would send it) and compared with the full frame.
+ *
+ * With -walk, the camera walks over the whole map instead, and the
+ * hits and misses of the decompression cache of the compressed images
+ * are reported for several cache sizes (to choose the size).
+ *
+ * With -spans, the blitters are checked instead: sprites are drawn
+ * through their span lists and through the raw blitters at every
+ * alignment and clipping, and compared pixel for pixel with a simple
+ * version (see blit_test.cpp). With -masks, the blitters of images
+ * with transparency masks are checked the same way, with random lines
+ * and with the sprites, and with -transp the blitters of transparent
+ * images are checked with every transparent color and timed at each
+ * x alignment. With -rows, the tiles drawn with the blitters
+ * specialized for the tile width are checked and timed against the
+ * blitters for any width, and with -preshift the sprites with
+ * pre-shifted frames are timed with and without them. With -syncbits,
+ * each blitter is timed with and without adding the sync bits.
+ *
+ * With -bgbench, the full frames are rendered with the background
+ * drawn tile by tile and line by line, checking that they match and
+ * comparing the frame times for each screen_x%4 phase.
+ *
+ * The time to render the full frames is also measured, to compare the
+ * blitters of different versions of the drawing code (with -remap, all
+ * sprites are drawn with the remote player's colors).
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <chrono>
+#include <vector>
+
+#include "game_screen.h"
+#include "game_data.h"
+#include "vga_6bit.h"
+#include "vga_host.h"
+#include "blit_test.h"
+
+#define HUD_TOP     40
+#define HUD_BOTTOM  20
+#define FRAME_REPEAT 3   // times each full frame is rendered, keeping the shortest time (to filter out host noise)
+#define WALK_STEP    6   // pixels the camera moves in each frame of the walk
+
+static const auto start_time = std::chrono::steady_clock::now();
+
+unsigned long millis()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count();
+}
+
+unsigned long micros()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count();
+}
+
+void GameNetwork::init() {}
+void GameNetwork::stop() {}
+void GameNetwork::step() {}
+
+class SimJoy : public GameJoy {
+public:
+  void init() {}
+  int getType() { return 0; }
+  const char *getName() { return "sim"; }
+  void update() {}
+};
+
+struct OPTIONS {
+  int num_lines;
+  int num_positions;
+  bool bg_lines;
+  bool tiles;
+  bool remap;
+  bool walk;
+  bool spans;
+  bool masks;
+  bool transp;
+  bool rows;
+  bool preshift;
+  bool sync_bits;
+  bool bg_bench;
+  int cache_slots;   // 0 to use the default (or all sizes in the walk)
+};
+
+static const int walk_cache_slots[] = { 8, 12, 16, 20, 24, 32, 48, 64 };
+
+static void show_usage(const char *progname)
+{
+  printf("USAGE: %s [options]\n", progname);
+  printf("\n");
+  printf("options:\n");
+  printf("  -h          show this help\n");
+  printf("  -lines N    number of lines of the line buffer (default 16)\n");
+  printf("  -pos N      number of screen positions to render (default 1000)\n");
+  printf("  -bglines    render the background line by line instead of tile by tile\n");
+  printf("  -tiles      check the tile mode instead of the line buffer mode\n");
+  printf("  -remap      draw all sprites with the remote player's colors\n");
+  printf("  -walk       walk over the map and report the image decompression cache use\n");
+  printf("  -cache N    number of slots of the image decompression cache (default 32,\n");
+  printf("              or several sizes with -walk)\n");
+  printf("  -spans      compare sprites drawn with span lists and with the raw blitters\n");
+  printf("  -masks      check the blitters for images with transparency masks\n");
+  printf("  -transp     check and time the blitters for transparent images\n");
+  printf("  -rows       check and time the blitters specialized for the tile width\n");
+  printf("  -preshift   time the sprites drawn with and without pre-shifted frames\n");
+  printf("  -syncbits   time the blitters with and without adding the sync bits\n");
+  printf("  -bgbench    compare the frames rendered with the background drawn tile by tile\n");
+  printf("              and line by line\n");
+}
+
+static int read_options(OPTIONS *opt, int argc, char **argv)
+{
+  opt->num_lines = 16;
+  opt->num_positions = 1000;
+  opt->bg_lines = false;
+  opt->tiles = false;
+  opt->remap = false;
+  opt->walk = false;
+  opt->spans = false;
+  opt->masks = false;
+  opt->transp = false;
+  opt->rows = false;
+  opt->preshift = false;
+  opt->sync_bits = false;
+  opt->bg_bench = false;
+  opt->cache_slots = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-h") == 0) {
+      show_usage(argv[0]);
+      exit(0);
+    } else if (strcmp(argv[i], "-lines") == 0 && i+1 < argc) {
+      opt->num_lines = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-pos") == 0 && i+1 < argc) {
+      opt->num_positions = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-bglines") == 0) {
+      opt->bg_lines = true;
+    } else if (strcmp(argv[i], "-tiles") == 0) {
+      opt->tiles = true;
+    } else if (strcmp(argv[i], "-remap") == 0) {
+      opt->remap = true;
+    } else if (strcmp(argv[i], "-walk") == 0) {
+      opt->walk = true;
+    } else if (strcmp(argv[i], "-cache") == 0 && i+1 < argc) {
+      opt->cache_slots = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-spans") == 0) {
+      opt->spans = true;
+    } else if (strcmp(argv[i], "-masks") == 0) {
+      opt->masks = true;
+    } else if (strcmp(argv[i], "-transp") == 0) {
+      opt->transp = true;
+    } else if (strcmp(argv[i], "-rows") == 0) {
+      opt->rows = true;
+    } else if (strcmp(argv[i], "-preshift") == 0) {
+      opt->preshift = true;
+    } else if (strcmp(argv[i], "-syncbits") == 0) {
+      opt->sync_bits = true;
+    } else if (strcmp(argv[i], "-bgbench") == 0) {
+      opt->bg_bench = true;
+    } else {
+      printf("%s: invalid option '%s'\n", argv[0], argv[i]);
+      show_usage(argv[0]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// place the camera and sprites for position number `pos`, covering the
+// whole map with sprites partially off-screen; if `align` is true, the
+// screen x position is kept at a multiple of 4 (as in tile mode); the
+// sprites are drawn with the color remap table `remap`
+static void set_position(int pos, bool align, const unsigned char *remap)
+{
+  int map_w = game_map.width * TILE_WIDTH;
+  int map_h = game_map.height * TILE_HEIGHT;
+  int cx = (pos * 53) % map_w;
+  int cy = (pos * 37 + (pos * 53) / map_w * 11) % map_h;
+  if (align) {
+    // (away from the right edge, where the screen position is clamped to an odd number)
+    int w = vga_get_xres();
+    if (cx > map_w - w/2 - 4) cx = map_w - w/2 - 4;
+    cx = w/2 + ((cx - w/2) & ~3);
+    if (cx < w/2) cx = w/2;
+  }
+  game_data.camera_x = cx;
+  game_data.camera_y = cy;
+  for (int i = 0; i < GAME_NUM_SPRITES; i++) {
+    if (i >= 8) {
+      game_sprites[i].def = nullptr;
+      continue;
+    }
+    const SPRITE_DEF *def = &game_sprite_defs[1 + i % (game_num_sprite_defs - 1)];
+    game_sprites[i].def = def;
+    game_sprites[i].x = cx - 170 + (cx*7 + i*61 + cy) % 380;
+    game_sprites[i].y = cy - 130 + (cy*3 + i*47) % 280;
+    game_sprites[i].frame = (cx + cy + i) % def->num_frames;
+    game_sprites[i].flip = ((cx + cy + i) / def->num_frames) % 2 != 0;
+    game_sprites[i].remap = remap;
+  }
+}
+
+static const unsigned char *sprite_remap(const OPTIONS &opt)
+{
+  return (opt.remap) ? game_remap_remote_player : nullptr;
+}
+
+static unsigned long long hash_screen()
+{
+  unsigned long long hash = 14695981039346656037ull;
+  uint8_t **lines = vga_get_framebuffer();
+  for (int y = 0; y < vga_get_yres(); y++) {
+    for (int x = 0; x < vga_get_xres(); x++) {
+      hash = (hash ^ lines[y][x]) * 1099511628211ull;
+    }
+  }
+  return hash;
+}
+
+// tile mode: compare the screen rebuilt from the segment list with the
+// full frame
+static int check_tiles(const OPTIONS &opt, const std::vector<unsigned long long> &frame_hash,
+                       const int *pin_config, GameNetwork *net, GameJoy *joy)
+{
+  GameScreen tile_screen;
+  tile_screen.setHudLines(HUD_TOP, HUD_BOTTOM);
+  tile_screen.setTileMode(true);
+  tile_screen.init(pin_config, net, joy);
+  int num_mismatches = 0;
+  unsigned long long total_nanos = 0;
+  unsigned int max_frame_nanos = 0;
+  for (int pos = 0; pos < opt.num_positions; pos++) {
+    set_position(pos, true, sprite_remap(opt));
+    auto start = std::chrono::steady_clock::now();
+    tile_screen.show(millis());
+    auto end = std::chrono::steady_clock::now();
+    if (hash_screen() != frame_hash[pos]) {
+      if (num_mismatches < 10) {
+        printf("MISMATCH at position %d (camera %d,%d)\n", pos, game_data.camera_x, game_data.camera_y);
+      }
+      num_mismatches++;
+    }
+    unsigned int frame_nanos = (unsigned int) std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    total_nanos += frame_nanos;
+    if (max_frame_nanos < frame_nanos) max_frame_nanos = frame_nanos;
+  }
+
+  const TILE_MODE_STATS &stats = tile_screen.getTileModeStats();
+  printf("%d positions, %d mismatched frames, %u invalid segments\n",
+         opt.num_positions, num_mismatches, vga_host_get_segment_errors());
+  printf("overlay lines: last %u, max %u of %d; cache misses %u, frames with overflow %u\n",
+         stats.overlay_lines, stats.max_overlay_lines, TILE_OVERLAY_LINES, stats.cache_misses, stats.overflow_frames);
+  printf("DMA memory for tiles and overlays: %d bytes\n",
+         TILE_CACHE_SLOTS * 4 * TILE_STRIDE * TILE_HEIGHT + 2 * TILE_OVERLAY_LINES * TILE_WIDTH + TILE_WIDTH);
+  printf("frame time (composing and copying segments): average %.0f us, worst %.0f us\n",
+         (double) total_nanos / opt.num_positions / 1000, max_frame_nanos / 1000.0);
+  return (num_mismatches == 0 && vga_host_get_segment_errors() == 0) ? 0 : 1;
+}
+
+struct WALK_POINT {
+  int x;
+  int y;
+  int dir;  // 1=right, -1=left
+};
+
+// camera path walking over the whole map: left to right and back,
+// going down half a screen at each end
+static std::vector<WALK_POINT> make_walk_path()
+{
+  int map_w = game_map.width * TILE_WIDTH;
+  int map_h = game_map.height * TILE_HEIGHT;
+  int w = vga_get_xres();
+  int h = vga_get_yres();
+  std::vector<WALK_POINT> path;
+  WALK_POINT p = { w/2, h/2, 1 };
+  while (p.y <= map_h - h/2) {
+    path.push_back(p);
+    p.x += p.dir * WALK_STEP;
+    if (p.x < w/2 || p.x > map_w - w/2) {
+      p.x = (p.x < w/2) ? w/2 : map_w - w/2;
+      for (int i = 0; i < h/2 && p.y <= map_h - h/2; i += WALK_STEP) {
+        path.push_back(p);
+        p.y += WALK_STEP;
+      }
+      p.dir = -p.dir;
+    }
+  }
+  return path;
+}
+
+// place the camera and sprites for frame `n` of the walk: the player
+// walking at the center of the screen, the remote player walking
+// behind it and a shot flying ahead
+static void set_walk_position(const WALK_POINT &p, int n)
+{
+  game_data.camera_x = p.x;
+  game_data.camera_y = p.y;
+  for (int i = 0; i < GAME_NUM_SPRITES; i++) {
+    game_sprites[i].def = nullptr;
+  }
+  const SPRITE_DEF *player = &game_sprite_defs[1];
+  const SPRITE_DEF *shot = &game_sprite_defs[GAME_NUM_SPRITE_DEF_SHOT];
+  for (int i = 0; i < 2; i++) {
+    SPRITE &spr = game_sprites[GAME_SPRITE_LOCAL_PLAYER + i];
+    spr.def = player;
+    spr.x = p.x - player->width/2 - i * p.dir * 80;
+    spr.y = p.y - player->height/2;
+    spr.frame = char_def.walk[(n + 7*i) % char_def.num_walk];
+    spr.flip = (p.dir < 0);
+    spr.remap = (i == 0) ? nullptr : game_remap_remote_player;
+  }
+  SPRITE &spr = game_sprites[GAME_NUM_SPRITE_FIRST_LOCAL_SHOT];
+  spr.def = shot;
+  spr.x = p.x + p.dir * (n * 12 % 200);
+  spr.y = p.y - shot->height/2;
+  spr.frame = 0;
+  spr.flip = (p.dir < 0);
+  spr.remap = nullptr;
+}
+
+// walk over the map with each size of the image decompression cache,
+// reporting its hits and misses and the time to render each frame
+static int walk_map(const OPTIONS &opt, const int *pin_config, GameNetwork *net, GameJoy *joy)
+{
+  GameScreen screen;
+  screen.setHudLines(HUD_TOP, HUD_BOTTOM);
+  screen.init(pin_config, net, joy);
+  if (opt.bg_lines) screen.setBackgroundRenderMode(BG_RENDER_LINES);
+  std::vector<WALK_POINT> path = make_walk_path();
+
+  std::vector<int> sizes;
+  if (opt.cache_slots > 0) {
+    sizes.push_back(opt.cache_slots);
+  } else {
+    sizes.assign(walk_cache_slots, walk_cache_slots + sizeof(walk_cache_slots)/sizeof(*walk_cache_slots));
+  }
+  printf("%d frames walking over the map\n", (int) path.size());
+  printf("slots   RAM bytes      hits   misses  evictions  misses/frame (worst)  frame us (worst)\n");
+  for (int num_slots : sizes) {
+    if (! game_image_cache_init(num_slots)) {
+      printf("ERROR: not enough memory for %d cache slots\n", num_slots);
+      return 1;
+    }
+    unsigned long long total_nanos = 0;
+    unsigned int max_nanos = 0;
+    unsigned int max_misses = 0;
+    for (int n = 0; n < (int) path.size(); n++) {
+      set_walk_position(path[n], n);
+      unsigned int misses = game_image_cache_stats.misses;
+      auto start = std::chrono::steady_clock::now();
+      screen.show(millis());
+      auto end = std::chrono::steady_clock::now();
+      unsigned int nanos = (unsigned int) std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+      total_nanos += nanos;
+      if (max_nanos < nanos) max_nanos = nanos;
+      if (max_misses < game_image_cache_stats.misses - misses) max_misses = game_image_cache_stats.misses - misses;
+    }
+    const IMAGE_CACHE_STATS &stats = game_image_cache_stats;
+    printf("%5d  %10d  %8u  %7u  %9u  %12.2f (%5u)  %8.0f (%5.0f)\n",
+           stats.num_slots, stats.num_slots * stats.slot_bytes, stats.hits, stats.misses, stats.evictions,
+           (double) stats.misses / path.size(), max_misses,
+           (double) total_nanos / path.size() / 1000, max_nanos / 1000.0);
+  }
+  return 0;
+}
+
+// screen_x % 4 of the current camera position (as in GameScreen::setScreenPos())
+static int screen_x_phase()
+{
+  int w = vga_get_xres();
+  int screen_x = game_data.camera_x - w/2;
+  if (screen_x < 0) {
+    screen_x = 0;
+  } else if (screen_x >= game_map.width*TILE_WIDTH - w) {
+    screen_x = game_map.width*TILE_WIDTH - w - 1;
+  }
+  return screen_x % 4;
+}
+
+// render the full frames with the background drawn tile by tile and
+// line by line, checking that they match and comparing the frame times
+// for each screen_x%4 phase; both modes are rendered at each position
+// before moving to the next, so host noise affects them alike
+static int compare_bg_modes(const OPTIONS &opt, const int *pin_config, GameNetwork *net, GameJoy *joy)
+{
+  static const int modes[] = { BG_RENDER_TILES, BG_RENDER_LINES };
+  GameScreen screen;
+  screen.setHudLines(HUD_TOP, HUD_BOTTOM);
+  screen.init(pin_config, net, joy);
+  int num_mismatches = 0;
+  int phase_positions[4] = { 0 };
+  unsigned long long total_nanos[4][2] = { { 0 } };
+  unsigned int max_nanos[4][2] = { { 0 } };
+  for (int pos = 0; pos < opt.num_positions; pos++) {
+    set_position(pos, false, sprite_remap(opt));
+    int phase = screen_x_phase();
+    phase_positions[phase]++;
+    unsigned long long hash = 0;
+    for (int m = 0; m < 2; m++) {
+      screen.setBackgroundRenderMode(modes[m]);
+      unsigned int frame_nanos = 0;
+      for (int i = 0; i < FRAME_REPEAT; i++) {
+        screen.clear();
+        auto start = std::chrono::steady_clock::now();
+        screen.show(millis());
+        auto end = std::chrono::steady_clock::now();
+        unsigned int nanos = (unsigned int) std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        if (i == 0 || frame_nanos > nanos) frame_nanos = nanos;
+      }
+      total_nanos[phase][m] += frame_nanos;
+      if (max_nanos[phase][m] < frame_nanos) max_nanos[phase][m] = frame_nanos;
+      if (m == 0) {
+        hash = hash_screen();
+      } else if (hash_screen() != hash) {
+        if (num_mismatches < 10) {
+          printf("MISMATCH at position %d (camera %d,%d)\n", pos, game_data.camera_x, game_data.camera_y);
+        }
+        num_mismatches++;
+      }
+    }
+  }
+
+  printf("frame time in us, average (worst):\n");
+  printf("x%%4  positions    tile by tile    line by line\n");
+  for (int phase = 0; phase < 4; phase++) {
+    int n = (phase_positions[phase] > 0) ? phase_positions[phase] : 1;
+    printf("%3d  %9d", phase, phase_positions[phase]);
+    for (int m = 0; m < 2; m++) {
+      printf("  %6.0f (%5.0f)", (double) total_nanos[phase][m] / n / 1000, max_nanos[phase][m] / 1000.0);
+    }
+    printf("\n");
+  }
+  printf("%d positions, %d mismatched frames\n", opt.num_positions, num_mismatches);
+  return (num_mismatches == 0) ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+  OPTIONS opt;
+  if (read_options(&opt, argc, argv) != 0) {
+    return 1;
+  }
+
+  int pin_config[8] = { 0 };
+  GameNetwork net;
+  SimJoy joy;
+
+  if (opt.walk) {
+    return walk_map(opt, pin_config, &net, &joy);
+  }
+  if (! game_image_cache_init((opt.cache_slots > 0) ? opt.cache_slots : 32)) {
+    printf("ERROR: not enough memory for the image cache\n");
+    return 1;
+  }
+  if (opt.spans) {
+    return blit_test_spans(pin_config, &net, &joy);
+  }
+  if (opt.masks) {
+    return blit_test_masks(pin_config, &net, &joy);
+  }
+  if (opt.transp) {
+    return blit_test_transp(pin_config, &net, &joy);
+  }
+  if (opt.rows) {
+    return blit_test_rows(pin_config, &net, &joy);
+  }
+  if (opt.preshift) {
+    return blit_test_preshift(pin_config, &net, &joy);
+  }
+  if (opt.sync_bits) {
+    return blit_test_syncbits(pin_config, &net, &joy);
+  }
+  if (opt.bg_bench) {
+    return compare_bg_modes(opt, pin_config, &net, &joy);
+  }
+
+  // full frame rendering
+  std::vector<unsigned long long> frame_hash(opt.num_positions);
+  GameScreen frame_screen;
+  frame_screen.setHudLines(HUD_TOP, HUD_BOTTOM);
+  frame_screen.init(pin_config, &net, &joy);
+  if (opt.bg_lines) frame_screen.setBackgroundRenderMode(BG_RENDER_LINES);
+  unsigned long long total_full_nanos = 0;
+  unsigned int max_full_nanos = 0;
+  for (int pos = 0; pos < opt.num_positions; pos++) {
+    set_position(pos, opt.tiles, sprite_remap(opt));
+    unsigned int full_nanos = 0;
+    for (int i = 0; i < FRAME_REPEAT; i++) {
+      frame_screen.clear();
+      auto start = std::chrono::steady_clock::now();
+      frame_screen.show(millis());
+      auto end = std::chrono::steady_clock::now();
+      unsigned int nanos = (unsigned int) std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+      if (i == 0 || full_nanos > nanos) full_nanos = nanos;
+    }
+    frame_hash[pos] = hash_screen();
+    total_full_nanos += full_nanos;
+    if (max_full_nanos < full_nanos) max_full_nanos = full_nanos;
+  }
+  printf("full frame time: average %.0f us, worst %.0f us\n",
+         (double) total_full_nanos / opt.num_positions / 1000, max_full_nanos / 1000.0);
+
+  if (opt.tiles) {
+    return check_tiles(opt, frame_hash, pin_config, &net, &joy);
+  }
+
+  // line buffer rendering
+  GameScreen line_screen;
+  line_screen.setHudLines(HUD_TOP, HUD_BOTTOM);
+  line_screen.setLineBuffer(opt.num_lines);
+  line_screen.init(pin_config, &net, &joy);
+  if (opt.bg_lines) line_screen.setBackgroundRenderMode(BG_RENDER_LINES);
+  int num_mismatches = 0;
+  unsigned long long total_nanos = 0;
+  unsigned int max_nanos = 0;
+  unsigned int max_frame_nanos = 0;
+  int max_pos = 0, max_y = 0;
+  unsigned int line_misses = 0;
+  int miss_frames = 0;
+  for (int pos = 0; pos < opt.num_positions; pos++) {
+    set_position(pos, false, sprite_remap(opt));
+    line_screen.show(millis());
+    line_misses += vga_host_get_line_cache_misses();
+    if (vga_host_get_line_cache_misses() > 0) miss_frames++;
+    if (hash_screen() != frame_hash[pos]) {
+      if (num_mismatches < 10) {
+        printf("MISMATCH at position %d (camera %d,%d)\n", pos, game_data.camera_x, game_data.camera_y);
+      }
+      num_mismatches++;
+    }
+
+    unsigned int frame_nanos = 0;
+    for (int y = 0; y < vga_get_yres(); y++) {
+      unsigned int nanos = vga_host_get_line_nanos(y);
+      frame_nanos += nanos;
+      if (max_nanos < nanos) {
+        max_nanos = nanos;
+        max_pos = pos;
+        max_y = y;
+      }
+    }
+    total_nanos += frame_nanos;
+    if (max_frame_nanos < frame_nanos) max_frame_nanos = frame_nanos;
+  }
+
+  int num_lines = opt.num_positions * vga_get_yres();
+  printf("%d positions, %d mismatched frames\n", opt.num_positions, num_mismatches);
+  printf("line time: average %.0f ns, worst %u ns (position %d, line %d)\n",
+         (double) total_nanos / num_lines, max_nanos, max_pos, max_y);
+  printf("frame time: average %.0f us, worst %.0f us\n",
+         (double) total_nanos / opt.num_positions / 1000, max_frame_nanos / 1000.0);
+  printf("frames decompressed while rendering the lines: %u (in %d frames)\n", line_misses, miss_frames);
+  return (num_mismatches == 0) ? 0 : 1;
+}
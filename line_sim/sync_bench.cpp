@@ -0,0 +1,140 @@
+/* sync_bench.cpp
+ *
+ * Timing of the GameScreen blitters for blit_test_syncbits(). This
+ * file is compiled twice: once with the real GameScreen, and once
+ * with GAME_SCREEN_NO_SYNC_BITS and GameScreen renamed to
+ * GameScreenNoSync (see the Makefile), linked with a copy of
+ * game_screen.cpp built the same way, whose blitters don't add the
+ * sync bits to the words they store. Both copies draw the same random
+ * lines and tiles, so the difference of their times is the cost of
+ * adding the sync bits.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <vector>
+
+#include "game_screen.h"
+#include "game_data.h"
+
+#if GAME_SCREEN_NO_SYNC_BITS
+#define sync_bench_init  sync_bench_init_nosync
+#define sync_bench_time  sync_bench_time_nosync
+#endif
+#include "sync_bench.h"
+
+#define BENCH_W        320  // target size (BENCH_W must be a multiple of 4)
+#define BENCH_H        TILE_HEIGHT
+#define BENCH_LINES    64   // random lines drawn by each pass
+#define BENCH_PASSES   64   // passes over the lines in each run
+#define LINE_WORDS     ((SYNC_BENCH_LINE_WIDTH+3)/4 + 1)  // (+1: the blitters may read one block past the end)
+#define TILE_WORDS     (TILE_WIDTH/4 * TILE_HEIGHT + 1)
+
+// GameScreen with the drawing functions used by the benchmark made public
+class SyncBench : public GameScreen {
+public:
+  using GameScreen::setDrawTarget;
+  using GameScreen::drawImageLine;
+  using GameScreen::renderBackgroundLines;
+};
+
+static SyncBench *screen;
+static std::vector<unsigned char> target_mem;
+static unsigned char *target[BENCH_H];
+static unsigned int lines[BENCH_LINES][LINE_WORDS];
+static unsigned int masks[BENCH_LINES][LINE_WORDS];
+static unsigned int tile_data[TILE_WORDS];
+static SPRITE_DEF tile_def;
+
+// random image block with about 1/4 of the pixels of the transparent
+// color, and its transparency mask (0x3f for each opaque pixel)
+static unsigned int random_block(unsigned char key, unsigned int *mask)
+{
+  unsigned int block = 0;
+  *mask = 0;
+  for (int i = 0; i < 4; i++) {
+    unsigned int pixel = (rand() % 4 == 0) ? key : rand() % 64;
+    block |= pixel << (8*i);
+    if (pixel != key) *mask |= 0x3fu << (8*i);
+  }
+  return block;
+}
+
+// prepare the target, the random lines and a random tile (the same in
+// both copies of this file)
+void sync_bench_init(const int *pin_config, GameNetwork *net, GameJoy *joy)
+{
+  static SyncBench bench_screen;
+  screen = &bench_screen;
+  screen->init(pin_config, net, joy);
+
+  unsigned char key = SPRITE_TRANSPARENT_GREEN;
+  unsigned int mask;
+  srand(1);
+  for (int i = 0; i < BENCH_LINES; i++) {
+    for (int j = 0; j < LINE_WORDS; j++) {
+      lines[i][j] = random_block(key, &masks[i][j]);
+    }
+  }
+  for (int i = 0; i < TILE_WORDS; i++) {
+    tile_data[i] = random_block(key, &mask);
+  }
+  memset(&tile_def, 0, sizeof(tile_def));
+  tile_def.width = TILE_WIDTH;
+  tile_def.height = TILE_HEIGHT;
+  tile_def.stride = TILE_WIDTH/4;
+  tile_def.num_frames = 1;
+  tile_def.data = tile_data;
+  tile_def.format = SPRITE_FORMAT_RAW;
+  tile_def.transparent_key = key;
+
+  target_mem.assign((BENCH_W + 8) * BENCH_H, screen->getSBits());
+  for (int y = 0; y < BENCH_H; y++) {
+    target[y] = &target_mem[(BENCH_W + 8) * y + 4];
+  }
+  screen->setDrawTarget(target, BENCH_W, BENCH_H);
+  screen->drawSprite(&tile_def, -1000, -1000, 0, true);  // (sets the transparent color of the blitters)
+}
+
+// time in ns to draw BENCH_PASSES times the lines (or tiles) with a
+// blitter at x%4 == align; the lines drawn are stored in *num_lines
+unsigned int sync_bench_time(int blitter, int align, int *num_lines)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < BENCH_PASSES; pass++) {
+    switch (blitter) {
+    case SYNC_BENCH_OPAQUE:
+    case SYNC_BENCH_TRANSP:
+    case SYNC_BENCH_MASK:
+      for (int i = 0; i < BENCH_LINES; i++) {
+        unsigned int *line = (unsigned int *) target[i % BENCH_H];
+        const unsigned int *mask = (blitter == SYNC_BENCH_MASK) ? masks[i] : nullptr;
+        screen->drawImageLine(line, 4*(i%8) + align, lines[i], SYNC_BENCH_LINE_WIDTH, blitter != SYNC_BENCH_OPAQUE, mask);
+      }
+      break;
+
+    case SYNC_BENCH_ROWS:
+    case SYNC_BENCH_ROWS_TRANSP:
+      screen->drawSprite(&tile_def, 4 + 4*(pass%8) + align, 0, 0, blitter == SYNC_BENCH_ROWS_TRANSP);
+      break;
+
+    case SYNC_BENCH_BG_LINE:
+      for (int i = 0; i < BENCH_H; i++) {
+        screen->setDrawTarget(&target[i], BENCH_W, 1);
+        screen->renderBackgroundLines(4*pass + align, 7*i, BENCH_W, 1);
+      }
+      screen->setDrawTarget(target, BENCH_W, BENCH_H);
+      break;
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  switch (blitter) {
+  case SYNC_BENCH_ROWS:
+  case SYNC_BENCH_ROWS_TRANSP: *num_lines = BENCH_PASSES * TILE_HEIGHT; break;
+  case SYNC_BENCH_BG_LINE: *num_lines = BENCH_PASSES * BENCH_H; break;
+  default: *num_lines = BENCH_PASSES * BENCH_LINES; break;
+  }
+  return (unsigned int) std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
@@ -0,0 +1,28 @@
+#ifndef SYNC_BENCH_H_FILE
+#define SYNC_BENCH_H_FILE
+
+// timing of the GameScreen blitters for blit_test_syncbits() (see
+// sync_bench.cpp): the _nosync functions use the copy of GameScreen
+// built without adding the sync bits
+
+class GameNetwork;
+class GameJoy;
+
+enum {
+  SYNC_BENCH_OPAQUE,       // drawImageLineN()
+  SYNC_BENCH_TRANSP,       // drawImageLineTrN()
+  SYNC_BENCH_MASK,         // drawImageLineMask<N>()
+  SYNC_BENCH_ROWS,         // drawImageRows() (opaque tiles)
+  SYNC_BENCH_ROWS_TRANSP,  // drawImageRows() (transparent tiles)
+  SYNC_BENCH_BG_LINE,      // renderBackgroundLines() (drawTileMapLine())
+  SYNC_BENCH_NUM_BLITTERS
+};
+
+#define SYNC_BENCH_LINE_WIDTH  63   // pixels of each line drawn
+
+void sync_bench_init(const int *pin_config, GameNetwork *net, GameJoy *joy);
+void sync_bench_init_nosync(const int *pin_config, GameNetwork *net, GameJoy *joy);
+unsigned int sync_bench_time(int blitter, int align, int *num_lines);
+unsigned int sync_bench_time_nosync(int blitter, int align, int *num_lines);
+
+#endif /* SYNC_BENCH_H_FILE */
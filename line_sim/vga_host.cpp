@@ -0,0 +1,256 @@
+/* vga_host.cpp
+ *
+ * Host version of vga_6bit.cpp for line_sim: it keeps the framebuffer
+ * (or the HUD and line buffer) in normal memory, and in line buffer
+ * mode renders the whole frame through the user functions when
+ * vga_swap_buffers() is called, measuring the time to render each
+ * line and counting the compressed frames decompressed while rendering
+ * the lines (they should all be decompressed by the start function).
+ * In segment mode, vga_swap_buffers() checks the segment list
+ * and copies the segments to the framebuffer, like the DMA would send
+ * them.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <chrono>
+
+#include "vga_6bit.h"
+#include "vga_host.h"
+#include "game_data.h"
+
+class VgaMode {
+public:
+  int x_res;
+  int y_res;
+};
+
+const VgaMode vga_mode_320x240 = { 320, 240 };
+const VgaMode vga_mode_288x240 = { 288, 240 };
+const VgaMode vga_mode_240x240 = { 240, 240 };
+
+#define SYNC_BITS 0xc0
+#define LINE_REPEAT 3   // times each line is rendered, keeping the shortest time (to filter out host noise)
+
+static const VgaMode *vga_mode;
+static int xres;
+static int yres;
+#define MAX_DMA_BUF_LEN 4092
+
+static uint8_t **framebuffer;       // framebuffer, or the output of line buffer or segment mode
+static int hud_top;
+static int hud_bottom;
+static uint8_t **hud_lines;
+
+static int num_ring_lines;
+static vga_frame_func ring_start_frame;
+static vga_line_func ring_render_line;
+static void *ring_data;
+static uint8_t *ring_line;
+static unsigned int *line_nanos;
+static unsigned int line_cache_misses;  // frames decompressed while rendering the lines of the last frame
+
+static int num_segments;
+static VgaSegment *segment_list;
+static unsigned int segment_errors;
+
+static uint8_t **alloc_lines(int num_lines)
+{
+  uint8_t **lines = (uint8_t **) malloc(sizeof(uint8_t *) * num_lines);
+  if (! lines) {
+    printf("ERROR: out of memory\n");
+    exit(1);
+  }
+  for (int i = 0; i < num_lines; i++) {
+    lines[i] = (uint8_t *) malloc(xres + 4);  // +4: the blitters may read one block past the end
+    if (! lines[i]) {
+      printf("ERROR: out of memory\n");
+      exit(1);
+    }
+    memset(lines[i], SYNC_BITS, xres + 4);
+  }
+  return lines;
+}
+
+void vga_init(const int *pin_map, const VgaMode &mode, int num_fb)
+{
+  vga_mode = &mode;
+  xres = mode.x_res;
+  yres = mode.y_res - hud_top - hud_bottom;
+  framebuffer = alloc_lines(yres);
+  hud_lines = (hud_top + hud_bottom > 0) ? alloc_lines(hud_top + hud_bottom) : nullptr;
+  if (num_ring_lines > 0) {
+    ring_line = (uint8_t *) malloc(xres + 4);
+    line_nanos = (unsigned int *) calloc(yres, sizeof(unsigned int));
+    if (! ring_line || ! line_nanos) {
+      printf("ERROR: out of memory\n");
+      exit(1);
+    }
+  }
+  if (num_segments > 0) {
+    segment_list = (VgaSegment *) calloc(yres * num_segments, sizeof(VgaSegment));
+    if (! segment_list) {
+      printf("ERROR: out of memory\n");
+      exit(1);
+    }
+  }
+}
+
+// copy the segments of each line to the framebuffer, counting the
+// segments the DMA couldn't send
+static void copy_segments()
+{
+  for (int y = 0; y < yres; y++) {
+    int x = 0;
+    memset(framebuffer[y], 0, xres);
+    for (int s = 0; s < num_segments; s++) {
+      const VgaSegment &seg = segment_list[y * num_segments + s];
+      if (! seg.buf || ((uintptr_t) seg.buf) % 4 != 0 || seg.len < 4 || seg.len > MAX_DMA_BUF_LEN ||
+          seg.len % 4 != 0 || x + seg.len > xres) {
+        if (segment_errors < 10) {
+          printf("ERROR: invalid segment %d of line %d (x=%d, len=%d)\n", s, y, x, seg.len);
+        }
+        segment_errors++;
+        break;
+      }
+      memcpy(framebuffer[y] + x, seg.buf, seg.len);
+      x += seg.len;
+    }
+    if (x != xres) {
+      if (segment_errors < 10) {
+        printf("ERROR: segments of line %d have %d pixels\n", y, x);
+      }
+      segment_errors++;
+    }
+  }
+}
+
+static void free_lines(uint8_t **lines, int num_lines)
+{
+  if (! lines) return;
+  for (int i = 0; i < num_lines; i++) {
+    free(lines[i]);
+  }
+  free(lines);
+}
+
+void vga_deinit()
+{
+  free_lines(framebuffer, yres);
+  free_lines(hud_lines, hud_top + hud_bottom);
+  free(ring_line);
+  free(line_nanos);
+  free(segment_list);
+  framebuffer = hud_lines = nullptr;
+  ring_line = nullptr;
+  line_nanos = nullptr;
+  segment_list = nullptr;
+}
+
+void vga_set_mode(const VgaMode &mode, int num_fb)
+{
+  vga_deinit();
+  vga_init(nullptr, mode, num_fb);
+}
+
+const VgaMode &vga_get_mode()
+{
+  return *vga_mode;
+}
+
+void vga_swap_buffers(bool wait_vsync)
+{
+  if (num_segments > 0) {
+    copy_segments();
+    return;
+  }
+  if (num_ring_lines == 0) return;
+
+  // render the frame line by line, like the VGA task would
+  ring_start_frame(ring_data);
+  unsigned int misses = game_image_cache_stats.misses;
+  for (int y = 0; y < yres; y++) {
+    memset(ring_line, 0, xres + 4);
+    for (int i = 0; i < LINE_REPEAT; i++) {
+      auto start = std::chrono::steady_clock::now();
+      ring_render_line(y, ring_line, ring_data);
+      auto end = std::chrono::steady_clock::now();
+      unsigned int nanos = (unsigned int) std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+      if (i == 0 || line_nanos[y] > nanos) line_nanos[y] = nanos;
+    }
+    memcpy(framebuffer[y], ring_line, xres);
+  }
+  line_cache_misses = game_image_cache_stats.misses - misses;
+}
+
+void vga_clear_screen(uint8_t color)
+{
+  if (num_ring_lines > 0 || num_segments > 0) return;
+  for (int y = 0; y < yres; y++) {
+    memset(framebuffer[y], SYNC_BITS | (color & 0x3f), xres);
+  }
+}
+
+void vga_set_line_buffer(int num_lines, vga_frame_func start_frame, vga_line_func render_line, void *data)
+{
+  num_ring_lines = (num_lines < 0) ? 0 : num_lines;
+  ring_start_frame = start_frame;
+  ring_render_line = render_line;
+  ring_data = data;
+}
+
+void vga_set_segments(int num)
+{
+  num_segments = (num < 0) ? 0 : num;
+}
+
+void *vga_alloc_dma(int size)
+{
+  return malloc(size);
+}
+
+void vga_set_hud(int top, int bottom)
+{
+  hud_top = top;
+  hud_bottom = bottom;
+}
+
+uint8_t **vga_get_framebuffer() { return framebuffer; }
+uint8_t **vga_get_hud_lines() { return hud_lines; }
+int vga_get_line_buffer_lines() { return num_ring_lines; }
+unsigned int vga_get_late_lines() { return 0; }
+int vga_get_swap_latency() { return 0; }
+int vga_get_num_segments() { return num_segments; }
+VgaSegment *vga_get_segments() { return segment_list; }
+int vga_get_num_framebuffers() { return (num_ring_lines > 0) ? 0 : (num_segments > 0) ? 2 : 1; }
+unsigned int vga_get_queued_frames() { return 0; }
+unsigned int vga_get_dropped_frames() { return 0; }
+bool vga_set_solid_line(int y, uint8_t color) { return false; }
+void vga_set_border(int top, int bottom, uint8_t color) {}
+void vga_set_beam_bands(int num_bands) {}
+int vga_get_beam_bands() { return 0; }
+int vga_get_beam_band_line(int band) { return 0; }
+unsigned int vga_get_beam_band_count() { return 0; }
+unsigned int vga_wait_beam_band(unsigned int count) { return count; }
+bool vga_add_framebuffer() { return false; }
+uint8_t *vga_get_framebuffer_base() { return nullptr; }
+int vga_get_framebuffer_stride() { return xres + 4; }
+uint8_t vga_get_sync_bits() { return SYNC_BITS; }
+int vga_get_xres() { return xres; }
+int vga_get_yres() { return yres; }
+
+unsigned int vga_host_get_line_nanos(int y)
+{
+  return line_nanos[y];
+}
+
+unsigned int vga_host_get_line_cache_misses()
+{
+  return line_cache_misses;
+}
+
+unsigned int vga_host_get_segment_errors()
+{
+  return segment_errors;
+}
@@ -0,0 +1,10 @@
+#ifndef VGA_HOST_H_FILE
+#define VGA_HOST_H_FILE
+
+// extra functions of the host version of vga_6bit.cpp
+
+unsigned int vga_host_get_line_nanos(int y);
+unsigned int vga_host_get_line_cache_misses();
+unsigned int vga_host_get_segment_errors();
+
+#endif /* VGA_HOST_H_FILE */
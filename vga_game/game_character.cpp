@@ -19,12 +19,13 @@
 void GameCharacter::calcSpriteState()
 {
   switch (state) {
-  case STATE_STAND:    spr->frame = def->stand[frame % def->num_stand] + ((dir==DIR_LEFT) ? def->mirror : 0) + ((shooting_pose>0) ? def->shoot_frame : 0); break;
-  case STATE_WALK:     spr->frame = def->walk [frame % def->num_walk]  + ((dir==DIR_LEFT) ? def->mirror : 0) + ((shooting_pose>0) ? def->shoot_frame : 0); break;
+  case STATE_STAND:    spr->frame = def->stand[frame % def->num_stand] + ((shooting_pose>0) ? def->shoot_frame : 0); break;
+  case STATE_WALK:     spr->frame = def->walk [frame % def->num_walk]  + ((shooting_pose>0) ? def->shoot_frame : 0); break;
   case STATE_JUMP_START:
-  case STATE_JUMP_END: spr->frame = def->jump [frame % def->num_jump]  + ((dir==DIR_LEFT) ? def->mirror : 0) + ((shooting_pose>0) ? def->shoot_frame : 0); break;
+  case STATE_JUMP_END: spr->frame = def->jump [frame % def->num_jump]  + ((shooting_pose>0) ? def->shoot_frame : 0); break;
   default:             spr->frame = 0; break;
   }
+  spr->flip = (dir == DIR_LEFT);
 
   spr->x = x + ((dir == DIR_RIGHT) ? -def->clip.x : def->clip.x + def->clip.width - spr->def->width - 1);
   spr->y = y - def->clip.y;
@@ -39,11 +40,11 @@ bool GameCharacter::createNewShot()
       game_sprites[i].y = y - def->clip.y + spr->def->height/2 - shot_def->height/2 - 4;
       if (dir == DIR_LEFT) {
         game_sprites[i].x = x - def->clip.x - shot_def->width;
-        game_sprites[i].frame = shot_def->num_frames/2;
       } else {
         game_sprites[i].x = x - def->clip.x + spr->def->width;
-        game_sprites[i].frame = 0;
       }
+      game_sprites[i].frame = 0;
+      game_sprites[i].flip = (dir == DIR_LEFT);
       return true;
     }
   }
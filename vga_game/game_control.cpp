@@ -20,7 +20,7 @@ void GameControl::moveShots()
 {
   for (int i = GAME_NUM_SPRITE_FIRST_LOCAL_SHOT; i < GAME_NUM_SPRITE_FIRST_REMOTE_SHOT; i++) {
     if (! game_sprites[i].def) continue;
-    int dx = (game_sprites[i].frame == 0) ? 12 : -12;
+    int dx = (game_sprites[i].flip) ? -12 : 12;
     int dy = 0;
     int flags = calc_movement(game_sprites[i].x, game_sprites[i].y,
                               game_sprites[i].def->width, game_sprites[i].def->height,
@@ -1,4 +1,7 @@
 
+#include <cstdlib>
+#include <cassert>
+
 #include "game_data.h"
 
 // maps
@@ -11,23 +14,54 @@
 
 GAME_DATA game_data;
 
+// The optional sprite data (pre-shifted frames, masks, spans, bounding boxes, opacity, compiled frames), the
+// 4 bits per pixel format and the compression must be enabled in the conversion script (conv_img/conv_all.sh).
+// No sprite has a mask: all images are stored with 4 bits per pixel, and a mask (one byte per pixel) would be
+// larger than their data, so castle3 lost its mask when it was converted to 4 bits per pixel (its transparent
+// tiles are drawn comparing the pixels with the transparent color instead)
+#define SPRITE_SIZE_DATA(name) img_##name##_width, img_##name##_height, img_##name##_stride, img_##name##_num_spr, img_##name##_data
+#define SPRITE_SIZE_LZ(name)   img_##name##_width, img_##name##_height, img_##name##_stride, img_##name##_num_spr, nullptr
+#define SHIFTED(name)          img_##name##_shifted_data
+#define NO_SHIFTED             nullptr
+#define MASK(name)             img_##name##_mask
+#define NO_MASK                nullptr
+#define SPANS(name)            SPRITE_FORMAT_SPANS, img_##name##_span_index, img_##name##_spans
+#define NO_SPANS               SPRITE_FORMAT_RAW, nullptr, nullptr
+#define BBOX(name)             img_##name##_bbox
+#define NO_BBOX                nullptr
+#define OPACITY(name)          img_##name##_opacity
+#define NO_OPACITY             nullptr
+#define COMPILED(name)         img_##name##_compiled, img_##name##_compiled_words
+#define NO_COMPILED            nullptr, nullptr
+#define PAL4(name)             img_##name##_palettes, img_##name##_palette_index
+#define NO_PAL4                nullptr, nullptr
+#define LZ(name)               img_##name##_lz_data, img_##name##_lz_data_index, nullptr, nullptr
+#define LZ_SHIFTED(name)       img_##name##_lz_data, img_##name##_lz_data_index, img_##name##_lz_shifted_data, img_##name##_lz_shifted_data_index
+#define NO_LZ                  nullptr, nullptr, nullptr, nullptr
+
 const SPRITE_DEF game_sprite_defs[] = {
-#define ADD_SPRITE_DEF(name) { img_##name##_width, img_##name##_height, img_##name##_stride, img_##name##_num_spr, img_##name##_data }
-  ADD_SPRITE_DEF(castle3),
-  ADD_SPRITE_DEF(loserboy),
-  ADD_SPRITE_DEF(pwr2),
+  { SPRITE_SIZE_LZ(castle3),    NO_SHIFTED,        NO_MASK, SPANS(castle3),  BBOX(castle3),  OPACITY(castle3), NO_COMPILED,    SPRITE_TRANSPARENT_GREEN, PAL4(castle3),  LZ(castle3) },
+  { SPRITE_SIZE_LZ(loserboy),   NO_SHIFTED,        NO_MASK, SPANS(loserboy), BBOX(loserboy), NO_OPACITY,       NO_COMPILED,    SPRITE_TRANSPARENT_GREEN, PAL4(loserboy), LZ_SHIFTED(loserboy) },
+  { SPRITE_SIZE_DATA(pwr2),     SHIFTED(pwr2),     NO_MASK, SPANS(pwr2),     BBOX(pwr2),     NO_OPACITY,       COMPILED(pwr2), SPRITE_TRANSPARENT_GREEN, PAL4(pwr2),     NO_LZ },
 };
 const int game_num_sprite_defs = (int) (sizeof(game_sprite_defs)/sizeof(*game_sprite_defs));
 
+// remote player: red and blue swapped (the transparent green is kept)
+#define SWAP_RED_BLUE(c)  ((((c) & 0x03) << 4) | ((c) & 0x0c) | (((c) >> 4) & 0x03))
+#define REMAP_ROW(f, c)   f((c)+0), f((c)+1), f((c)+2), f((c)+3), f((c)+4), f((c)+5), f((c)+6), f((c)+7)
+const unsigned char game_remap_remote_player[64] = {
+  REMAP_ROW(SWAP_RED_BLUE,  0), REMAP_ROW(SWAP_RED_BLUE,  8), REMAP_ROW(SWAP_RED_BLUE, 16), REMAP_ROW(SWAP_RED_BLUE, 24),
+  REMAP_ROW(SWAP_RED_BLUE, 32), REMAP_ROW(SWAP_RED_BLUE, 40), REMAP_ROW(SWAP_RED_BLUE, 48), REMAP_ROW(SWAP_RED_BLUE, 56),
+};
+
 SPRITE game_sprites[GAME_NUM_SPRITES] = {
-  { &game_sprite_defs[1],  64,  64,  0, },   // loserboy (player)
-  { &game_sprite_defs[1], -64, -64,  0, },   // loserboy (network)
+  { &game_sprite_defs[1],  64,  64,  0, false, nullptr },                    // loserboy (player)
+  { &game_sprite_defs[1], -64, -64,  0, false, game_remap_remote_player },   // loserboy (network)
 };
 
 const CHAR_DEF char_def = {
   .clip = { 15, 5, 31, 35 },
-  .mirror = 11,
-  .shoot_frame = 22,
+  .shoot_frame = 11,
   .num_stand = 1,
   .stand = { 10 },
   .num_jump = 1,
@@ -38,3 +72,193 @@ const CHAR_DEF char_def = {
     0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0,
   },
 };
+
+struct IMAGE_CACHE_SLOT {
+  const SPRITE_DEF *def;   // nullptr if unused
+  int image;
+  unsigned int last_use;
+  bool locked;             // kept until game_unlock_images()
+  unsigned int *data;
+};
+
+IMAGE_CACHE_STATS game_image_cache_stats;
+static IMAGE_CACHE_SLOT *image_cache_slots;
+static unsigned int *image_cache_data;
+static unsigned short **image_cache_index;  // slot of each image of each sprite def (0xffff if not in the cache)
+static unsigned int image_cache_uses;
+static int image_cache_locked;             // number of locked slots
+
+// number of words of a frame (or of a pre-shifted frame if shift != 0) as stored
+static int get_image_words(const SPRITE_DEF *def, int shift)
+{
+  int line_words = (shift == 0) ? def->stride : def->stride + 1;
+  if (def->palettes) line_words = (line_words + 1) / 2;
+  return def->height * line_words;
+}
+
+// number of images of a sprite def: the frames followed by the pre-shifted frames
+static int get_num_images(const SPRITE_DEF *def)
+{
+  return (SPRITE_HAS_SHIFTED(def)) ? 4 * def->num_frames : def->num_frames;
+}
+
+// decompress an image compressed by the conversion tools: a byte c <
+// 0x80 is followed by c+1 literal bytes; a byte c >= 0x80 and the next
+// byte n copy ((c>>2)&0x1f)+3 bytes from ((c&3)<<8 | n)+1 bytes back
+// in the output (the copy can overlap the bytes it produces)
+static void lz_decompress(unsigned char *dest, int size, const unsigned char *src)
+{
+  unsigned char *end = dest + size;
+  while (dest < end) {
+    unsigned int c = *src++;
+    if (c < 0x80) {
+      for (unsigned int i = 0; i <= c; i++) {
+        *dest++ = *src++;
+      }
+    } else {
+      const unsigned char *from = dest - (((c & 3) << 8) | *src++) - 1;
+      for (unsigned int i = 0; i < ((c >> 2) & 0x1f) + 3; i++) {
+        *dest++ = *from++;
+      }
+    }
+  }
+}
+
+// Allocate the decompression cache with num_slots slots, each one large
+// enough for the largest compressed image. Return false if there's not
+// enough memory (no image can be drawn from the compressed frames then).
+bool game_image_cache_init(int num_slots)
+{
+  game_image_cache_free();
+  if (num_slots < IMAGE_CACHE_MIN_SLOTS) num_slots = IMAGE_CACHE_MIN_SLOTS;
+
+  int slot_words = 0;
+  for (int i = 0; i < game_num_sprite_defs; i++) {
+    const SPRITE_DEF *def = &game_sprite_defs[i];
+    if (def->lz_data && slot_words < get_image_words(def, 0)) slot_words = get_image_words(def, 0);
+    if (def->lz_shifted_data && slot_words < get_image_words(def, 1)) slot_words = get_image_words(def, 1);
+  }
+  if (slot_words == 0) return true;  // nothing is compressed
+
+  image_cache_slots = (IMAGE_CACHE_SLOT *) calloc(num_slots, sizeof(IMAGE_CACHE_SLOT));
+  image_cache_data = (unsigned int *) malloc(sizeof(unsigned int) * (num_slots * slot_words + 1));  // +1: the blitters may read one block past the end
+  image_cache_index = (unsigned short **) calloc(game_num_sprite_defs, sizeof(unsigned short *));
+  if (! image_cache_slots || ! image_cache_data || ! image_cache_index) {
+    game_image_cache_free();
+    return false;
+  }
+  for (int i = 0; i < game_num_sprite_defs; i++) {
+    const SPRITE_DEF *def = &game_sprite_defs[i];
+    if (! def->lz_data) continue;
+    int num_images = get_num_images(def);
+    image_cache_index[i] = (unsigned short *) malloc(sizeof(unsigned short) * num_images);
+    if (! image_cache_index[i]) {
+      game_image_cache_free();
+      return false;
+    }
+    for (int j = 0; j < num_images; j++) {
+      image_cache_index[i][j] = 0xffff;
+    }
+  }
+  for (int i = 0; i < num_slots; i++) {
+    image_cache_slots[i].data = image_cache_data + i * slot_words;
+  }
+  image_cache_uses = 0;
+  image_cache_locked = 0;
+  game_image_cache_stats.num_slots = num_slots;
+  game_image_cache_stats.slot_bytes = sizeof(unsigned int) * slot_words;
+  game_image_cache_stats.hits = 0;
+  game_image_cache_stats.misses = 0;
+  game_image_cache_stats.evictions = 0;
+  return true;
+}
+
+void game_image_cache_free()
+{
+  if (image_cache_index) {
+    for (int i = 0; i < game_num_sprite_defs; i++) {
+      free(image_cache_index[i]);
+    }
+    free(image_cache_index);
+    image_cache_index = nullptr;
+  }
+  free(image_cache_slots);
+  image_cache_slots = nullptr;
+  free(image_cache_data);
+  image_cache_data = nullptr;
+  game_image_cache_stats.num_slots = 0;
+}
+
+// Return the words of a frame (pre-shifted by `shift` pixels if it's
+// not 0) as stored, with def->stride words per line (def->stride+1 if
+// pre-shifted, half of that rounded up with 4 bits per pixel).
+// Compressed frames are decompressed to the cache, so the returned
+// data is only valid for the next IMAGE_CACHE_MIN_SLOTS-1 calls (see
+// IMAGE_CACHE_MIN_SLOTS); game_image_cache_init() must have succeeded.
+const unsigned int *game_get_image(const SPRITE_DEF *def, int frame, int shift)
+{
+  int index = (shift == 0) ? frame : 3*frame + shift-1;
+  if (! def->lz_data) {
+    const unsigned int *data = (shift == 0) ? def->data : def->shifted_data;
+    return &data[get_image_words(def, shift) * index];
+  }
+
+  assert(image_cache_index);  // compressed images need the cache
+  int image = (shift == 0) ? index : def->num_frames + index;
+  unsigned short *def_index = image_cache_index[def - game_sprite_defs];
+  if (def_index[image] != 0xffff) {
+    IMAGE_CACHE_SLOT &slot = image_cache_slots[def_index[image]];
+    slot.last_use = ++image_cache_uses;
+    game_image_cache_stats.hits++;
+    return slot.data;
+  }
+
+  int lru = -1;
+  for (int i = 0; i < game_image_cache_stats.num_slots; i++) {
+    if (image_cache_slots[i].locked) continue;
+    if (lru < 0 || image_cache_slots[lru].last_use > image_cache_slots[i].last_use) lru = i;
+  }
+  IMAGE_CACHE_SLOT &slot = image_cache_slots[lru];
+  if (slot.def) {
+    image_cache_index[slot.def - game_sprite_defs][slot.image] = 0xffff;
+    game_image_cache_stats.evictions++;
+  }
+  const unsigned char *src = ((shift == 0)
+                              ? &def->lz_data[def->lz_data_index[index]]
+                              : &def->lz_shifted_data[def->lz_shifted_data_index[index]]);
+  lz_decompress((unsigned char *) slot.data, sizeof(unsigned int) * get_image_words(def, shift), src);
+  slot.def = def;
+  slot.image = image;
+  slot.last_use = ++image_cache_uses;
+  def_index[image] = lru;
+  game_image_cache_stats.misses++;
+  return slot.data;
+}
+
+// Decompress a frame (or pre-shifted frame) to the cache, if it's
+// compressed and not there already, and keep it there until
+// game_unlock_images(), so drawing it later never decompresses it.
+// Return false if no more frames can be kept (IMAGE_CACHE_MIN_SLOTS
+// slots are always left for game_get_image()).
+bool game_lock_image(const SPRITE_DEF *def, int frame, int shift)
+{
+  if (! def->lz_data || ! image_cache_index) return true;
+
+  int image = (shift == 0) ? frame : def->num_frames + 3*frame + shift-1;
+  unsigned short slot_index = image_cache_index[def - game_sprite_defs][image];
+  if (slot_index != 0xffff && image_cache_slots[slot_index].locked) return true;
+  if (image_cache_locked >= game_image_cache_stats.num_slots - IMAGE_CACHE_MIN_SLOTS) return false;
+
+  game_get_image(def, frame, shift);
+  image_cache_slots[image_cache_index[def - game_sprite_defs][image]].locked = true;
+  image_cache_locked++;
+  return true;
+}
+
+void game_unlock_images()
+{
+  for (int i = 0; i < game_image_cache_stats.num_slots; i++) {
+    image_cache_slots[i].locked = false;
+  }
+  image_cache_locked = 0;
+}
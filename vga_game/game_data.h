@@ -37,14 +37,77 @@ enum {
   N_MAP_BLOCKS,
 };
 
+// sprite formats
+#define SPRITE_FORMAT_RAW    0   // only raw data
+#define SPRITE_FORMAT_SPANS  1   // raw data with a list of opaque spans per line
+
+// span list entry: 4-pixel blocks [start, start+len), all opaque or with some transparent pixels
+#define SPAN_START(span)   ((span) & 0xff)
+#define SPAN_LEN(span)     (((span) >> 8) & 0x7f)
+#define SPAN_OPAQUE(span)  (((span) & 0x8000) != 0)
+
+// bounding box of the opaque pixels of a frame: first and last lines,
+// first and last 4-pixel blocks (all inclusive)
+#define BBOX_TOP(bbox)     ((bbox)[0])
+#define BBOX_BOTTOM(bbox)  ((bbox)[1])
+#define BBOX_LEFT(bbox)    ((bbox)[2])
+#define BBOX_RIGHT(bbox)   ((bbox)[3])
+#define BBOX_EMPTY(bbox)   ((bbox)[0] > (bbox)[1])
+
+// first and last 4-pixel blocks of the bounding box of a frame drawn
+// mirrored (pixel x of the frame is drawn at width-1-x)
+#define BBOX_MIRRORED_LEFT(bbox, width)   ((4*BBOX_RIGHT(bbox) + 4 < (width)) ? ((width) - 4*BBOX_RIGHT(bbox) - 4) / 4 : 0)
+#define BBOX_MIRRORED_RIGHT(bbox, width)  (((width) - 1 - 4*BBOX_LEFT(bbox)) / 4)
+
+// frame opacity
+#define SPRITE_OPACITY_EMPTY   0   // all pixels transparent
+#define SPRITE_OPACITY_MIXED   1   // some pixels transparent
+#define SPRITE_OPACITY_OPAQUE  2   // no transparent pixels
+
+// color bits of pure green (#00ff00), the transparent color of the converted images
+#define SPRITE_TRANSPARENT_GREEN  0x0c
+
+// drawSprite() draws the sprites with a transparency mask (SPRITE_DEF.mask)
+// only if enabled: no image has a mask now (they can't be used with 4 bits
+// per pixel, see game_data.cpp), so the checks for them are left out of
+// every sprite drawn; masks of sprites drawn with them disabled are ignored
+#ifndef SPRITE_MASKS_ENABLED
+#define SPRITE_MASKS_ENABLED  0
+#endif
+
+// compiled sprite frame: draws the frame's opaque pixels with the
+// given first block and sync bits (repeated in the 4 bytes), without
+// clipping (the conversion tools only make them for images whose
+// transparent color is SPRITE_TRANSPARENT_GREEN)
+typedef void (*SPRITE_COMPILED_FUNC)(unsigned char **lines, int block_x, unsigned int sb);
+
 struct SPRITE_DEF {
   int width;
   int height;
   int stride;
   int num_frames;
   const unsigned int *data;
+  const unsigned int *shifted_data;  // frames shifted by 1,2,3 pixels (stride+1 words per line), or nullptr
+  const unsigned int *mask;          // transparency mask of each data word (0x3f for opaque pixels, only used if SPRITE_MASKS_ENABLED), or nullptr
+  int format;                        // SPRITE_FORMAT_xxx
+  const unsigned short *span_index;  // index of first span of each line (SPRITE_FORMAT_SPANS only)
+  const unsigned short *spans;       // span list (SPRITE_FORMAT_SPANS only)
+  const unsigned char *bbox;         // bounding box of each frame (4 bytes per frame), or nullptr
+  const unsigned char *opacity;      // SPRITE_OPACITY_xxx of each frame, or nullptr
+  const SPRITE_COMPILED_FUNC *compiled;  // compiled frames ([4*frame + x%4]), or nullptr
+  const unsigned short *compiled_words;  // words stored by each compiled frame (for measuring overdraw)
+  unsigned char transparent_key;     // color bits (without sync bits) of the transparent pixels
+  const unsigned char *palettes;     // palettes of 16 colors if data and shifted_data have 4 bits per pixel, or nullptr
+  const unsigned char *palette_index;  // palette of each frame (4 bits per pixel only)
+  const unsigned char *lz_data;      // compressed frames (instead of data), or nullptr
+  const unsigned int *lz_data_index; // start of each frame in lz_data
+  const unsigned char *lz_shifted_data;      // compressed pre-shifted frames (instead of shifted_data), or nullptr
+  const unsigned int *lz_shifted_data_index; // start of each pre-shifted frame in lz_shifted_data
 };
 
+// true if the sprite has frames pre-shifted by 1,2,3 pixels (stored compressed or not)
+#define SPRITE_HAS_SHIFTED(def)  ((def)->shifted_data || (def)->lz_shifted_data)
+
 struct MAP_TILE {
   unsigned short back;
   unsigned short fore;
@@ -75,6 +138,33 @@ struct SPRITE {
   int x;
   int y;
   int frame;
+  bool flip;          // drawn mirrored horizontally
+  const unsigned char *remap;  // color remap table (drawn with other colors), or nullptr
+};
+
+// decompression cache of the compressed frames: each slot holds a
+// decompressed frame (or pre-shifted frame), and the least recently
+// used slot is replaced when a frame is not in the cache.
+//
+// A pointer returned by game_get_image() stays valid for the next
+// IMAGE_CACHE_MIN_SLOTS-1 calls: each call uses at most one slot, and
+// the slots used by the last IMAGE_CACHE_MIN_SLOTS-1 calls are more
+// recent than at least one other slot, so they are never the one
+// replaced. The background line renderer holds the lines of up to 7
+// tiles at once, so there must be at least 8 slots.
+//
+// game_lock_image() decompresses a frame ahead of time (e.g. before
+// rendering the lines of a frame) and keeps it until game_unlock_images();
+// the locked slots are never replaced, and at most all but
+// IMAGE_CACHE_MIN_SLOTS slots are locked, so the rule above still holds.
+#define IMAGE_CACHE_MIN_SLOTS  8
+
+struct IMAGE_CACHE_STATS {
+  int num_slots;            // 0 if the cache is not allocated
+  int slot_bytes;
+  unsigned int hits;
+  unsigned int misses;
+  unsigned int evictions;   // misses that replaced a frame in the cache
 };
 
 struct GAME_DATA {
@@ -89,7 +179,6 @@ struct CHAR_DEF {
     unsigned char width;
     unsigned char height;
   } clip;
-  unsigned int mirror;
   unsigned int shoot_frame;
   unsigned int num_stand;
   unsigned char stand[64];
@@ -104,6 +193,17 @@ extern const SPRITE_DEF game_sprite_defs[];
 
 extern SPRITE game_sprites[];
 
+// color remap tables: new color bits (without sync bits) of each of the
+// 64 colors; the transparent color must be mapped to itself
+extern const unsigned char game_remap_remote_player[64];
+
+bool game_image_cache_init(int num_slots);
+void game_image_cache_free();
+const unsigned int *game_get_image(const SPRITE_DEF *def, int frame, int shift);
+bool game_lock_image(const SPRITE_DEF *def, int frame, int shift);
+void game_unlock_images();
+extern IMAGE_CACHE_STATS game_image_cache_stats;
+
 extern const MAP game_map;
 extern GAME_DATA game_data;
 
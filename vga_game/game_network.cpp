@@ -4,7 +4,9 @@
 #include "util.h"
 
 #define GAME_NETWORK_MESSAGE_MAGIC1 0x1234
-#define GAME_NETWORK_MESSAGE_MAGIC2 0x5678
+#define GAME_NETWORK_MESSAGE_MAGIC2 0x5679
+
+#define GAME_NETWORK_FRAME_FLIP     0x8000   // set in the frame of sprites drawn mirrored
 
 void GameNetwork::init()
 {
@@ -21,6 +23,15 @@ void GameNetwork::init()
   remote_spr = &game_sprites[1];
 }
 
+void GameNetwork::stop()
+{
+  if (! running) {
+    return;
+  }
+  net_deinit();
+  running = false;
+}
+
 void GameNetwork::step()
 {
   if (! running) {
@@ -41,7 +52,7 @@ void GameNetwork::step()
     // add player info
     *p++ = local_spr->x;
     *p++ = local_spr->y;
-    *p++ = local_spr->frame;
+    *p++ = local_spr->frame | ((local_spr->flip) ? GAME_NETWORK_FRAME_FLIP : 0);
 
     // add shots
     int num_shots = 0;
@@ -49,7 +60,7 @@ void GameNetwork::step()
       if (! game_sprites[i].def) continue;
       *p++ = game_sprites[i].x;
       *p++ = game_sprites[i].y;
-      *p++ = game_sprites[i].frame;
+      *p++ = game_sprites[i].frame | ((game_sprites[i].flip) ? GAME_NETWORK_FRAME_FLIP : 0);
       num_shots++;
     }
 
@@ -80,13 +91,15 @@ void GameNetwork::step()
     // read remote player
     remote_spr->x = (short) *p++;
     remote_spr->y = (short) *p++;
-    remote_spr->frame = *p++;
+    remote_spr->frame = *p & ~GAME_NETWORK_FRAME_FLIP;
+    remote_spr->flip = (*p++ & GAME_NETWORK_FRAME_FLIP) != 0;
 
     // read remote shots
     for (int i = 0; i < num_shots; i++) {
       game_sprites[GAME_NUM_SPRITE_FIRST_REMOTE_SHOT+i].x = *p++;
       game_sprites[GAME_NUM_SPRITE_FIRST_REMOTE_SHOT+i].y = *p++;
-      game_sprites[GAME_NUM_SPRITE_FIRST_REMOTE_SHOT+i].frame = *p++;
+      game_sprites[GAME_NUM_SPRITE_FIRST_REMOTE_SHOT+i].frame = *p & ~GAME_NETWORK_FRAME_FLIP;
+      game_sprites[GAME_NUM_SPRITE_FIRST_REMOTE_SHOT+i].flip = (*p++ & GAME_NETWORK_FRAME_FLIP) != 0;
       game_sprites[GAME_NUM_SPRITE_FIRST_REMOTE_SHOT+i].def = &game_sprite_defs[GAME_NUM_SPRITE_DEF_SHOT];
     }
     // remove absent shots
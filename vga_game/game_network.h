@@ -20,6 +20,7 @@ protected:
 public:
   GameNetwork() { running = false; }
   void init();
+  void stop();
   void step();
   unsigned int get_num_tx_packets() { return tx_packets; }
   unsigned int get_num_tx_errors() { return tx_errors; }
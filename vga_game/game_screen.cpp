@@ -1,4 +1,8 @@
 #include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdarg>
+#include <cassert>
 
 #include "game_screen.h"
 #include "game_data.h"
@@ -17,25 +21,54 @@ enum {
   DEBUG_SHOW_NETWORK,
   DEBUG_SHOW_CONTROLLER,
   DEBUG_SHOW_FRAMETIME,
+  DEBUG_SHOW_LAYER_WRITES,
+  DEBUG_SHOW_CACHES,
   DEBUG_MAX_LEVEL
 };
 
+// screen lines used by the debug info drawn over the screen
+#define DEBUG_INFO_TOP_LINES     50
+#define DEBUG_INFO_BOTTOM_LINES  30
+
 // x-coord : |        0        1        2        3 |        4        5        6        7 | ...
 // address : |      [2]      [3]      [0]      [1] |      [6]      [7]      [4]      [5] | ...
 // mask    : | 00ff0000 ff000000 000000ff 0000ff00 | 00ff0000 ff000000 000000ff 0000ff00 | ...
 
-#define GET_PIX0_TRANSP_MASK(block) ((((block) & 0x003f0000) != 0x000c0000) ? 0x00ff0000 : 0)
-#define GET_PIX1_TRANSP_MASK(block) ((((block) & 0x3f000000) != 0x0c000000) ? 0xff000000 : 0)
-#define GET_PIX2_TRANSP_MASK(block) ((((block) & 0x0000003f) != 0x0000000c) ? 0x000000ff : 0)
-#define GET_PIX3_TRANSP_MASK(block) ((((block) & 0x00003f00) != 0x00000c00) ? 0x0000ff00 : 0)
-#define GET_4PIX_TRANSP_MASK(block) (GET_PIX0_TRANSP_MASK(block) | GET_PIX1_TRANSP_MASK(block) | \
-                                     GET_PIX2_TRANSP_MASK(block) | GET_PIX3_TRANSP_MASK(block))
+// mask of the non-transparent pixels of a block, given the transparent
+// color repeated in the 4 bytes of key: the color bits of all pixels are
+// compared with the key at once, and adding 0x3f to each 6-bit result
+// sets bit 6 of its byte if and only if it's not zero (no carries into
+// the neighbor bytes); only the color bits of the pixels are selected,
+// so stores masked with it keep the sync bits already in the screen
+#define GET_4PIX_TRANSP_MASK(block, key) (((((((block) & 0x3f3f3f3f) ^ (key)) + 0x3f3f3f3f) & 0x40404040) >> 6) * 0x3f)
+
+// masks selecting the pixels of a block starting at/ending at the given x-coord
+static const unsigned int pixel_mask_from[4] = { 0xffffffff, 0xff00ffff, 0x0000ffff, 0x0000ff00 };
+static const unsigned int pixel_mask_upto[4] = { 0x00ff0000, 0xffff0000, 0xffff00ff, 0xffffffff };
+
+// screen block for an image drawn at x%4 == ALIGN: the last ALIGN
+// pixels of the image block 'old' followed by the first 4-ALIGN
+// pixels of the image block 'cur'
+template<int ALIGN> static inline unsigned int shift_block(unsigned int old, unsigned int cur);
+template<> inline unsigned int shift_block<0>(unsigned int old, unsigned int cur) {
+  return cur;
+}
+template<> inline unsigned int shift_block<1>(unsigned int old, unsigned int cur) {
+  return ((old << 8) & 0x00ff0000) | ((cur << 8) & 0xff00ff00) | ((cur >> 24) & 0x000000ff);
+}
+template<> inline unsigned int shift_block<2>(unsigned int old, unsigned int cur) {
+  return ((old << 16) & 0xffff0000) | ((cur >> 16) & 0x0000ffff);
+}
+template<> inline unsigned int shift_block<3>(unsigned int old, unsigned int cur) {
+  return ((old >> 8) & 0x00ff00ff) | ((old << 24) & 0xff000000) | ((cur >> 8) & 0x0000ff00);
+}
 
 // Select screen resolution according to the enabled features (there's
-// not enough memory to enable everything at max resolution)
-static const VgaMode &get_vga_mode(GameNetwork *net, GameJoy *joy)
+// not enough memory to enable everything at max resolution with more
+// than one framebuffer)
+static const VgaMode &get_vga_mode(bool net_running, GameJoy *joy, int num_fb)
 {
-  if (net->is_running() && joy->getType() == CONTROLLER_WIIMOTE) {
+  if (num_fb > 1 && net_running && joy->getType() == CONTROLLER_WIIMOTE) {
     // WiFi with Bluetooth:
     return vga_mode_240x240;
   }
@@ -44,34 +77,312 @@ static const VgaMode &get_vga_mode(GameNetwork *net, GameJoy *joy)
   return vga_mode_320x240;
 }
 
+// Select number of framebuffers: triple buffering only without WiFi
+// (vga_init() still falls back to 2 if there's not enough DMA memory)
+static int get_vga_num_framebuffers(bool net_running)
+{
+  return (net_running) ? 2 : 3;
+}
+
+
+// Select number of framebuffers for the enabled features: beam racing
+// uses a single framebuffer, line buffer and tile modes use none
+int GameScreen::getNumFramebuffers(bool net_running) {
+  if (line_buffer_lines > 0 || beam_bands > 0 || tile_mode) return 1;
+  return get_vga_num_framebuffers(net_running);
+}
 
 void GameScreen::init(const int *pin_config, GameNetwork *net, GameJoy *joy) {
-  vga_init(pin_config, get_vga_mode(net, joy));
+  this->net = net;
+  this->joy = joy;
+  if (line_buffer_lines > 0) tile_mode = false;
+  if (line_buffer_lines > 0 || tile_mode) beam_bands = 0;
+  vga_num_fb = getNumFramebuffers(net->is_running());
+  vga_set_hud(hud_top, hud_bottom);
+  vga_set_beam_bands(beam_bands);
+  vga_set_line_buffer(line_buffer_lines, startLineFrameFunc, renderLineFunc, this);
+  vga_set_segments((tile_mode) ? TILE_MODE_COLS : 0);
+  vga_init(pin_config, get_vga_mode(net->is_running(), joy, vga_num_fb), vga_num_fb);
+  beam_bands = vga_get_beam_bands();
+  line_buffer_lines = vga_get_line_buffer_lines();
+  tile_mode = (vga_get_num_segments() > 0);
+  beam_torn_frames = 0;
+  setupScreen();
+  if (line_buffer_lines > 0) {
+    line_sprite_mask = (unsigned int *) calloc(screen_h, sizeof(unsigned int));
+    if (! line_sprite_mask) {
+      printf("ERROR: not enough memory for line sprites\n");
+    }
+    memset(line_words, 0, sizeof(line_words));
+    line_micros = line_micros_max = line_max_micros = 0;
+  }
+  if (tile_mode && ! allocTileMode()) {
+    printf("ERROR: not enough DMA memory for tile mode\n");
+  }
+  if (! allocImageLines()) {
+    printf("ERROR: not enough memory for image lines\n");
+  }
+  for (int i = 0; i < TILE_STRIDE; i++) {
+    bg_black_line[i] = (unsigned int) sync_bits * 0x01010101;
+  }
+  debug_level = DEBUG_MAX_LEVEL;
+  last_btn_press_frame = 0;
+}
+
+// Read the screen size and buffers from the VGA code (after it's
+// initialized or the VGA mode is changed)
+void GameScreen::setupScreen() {
+  hud_lines = vga_get_hud_lines();
+  memset(hud_text, 0, sizeof(hud_text));
   screen_w  = vga_get_xres();
   screen_h  = vga_get_yres();
   sync_bits = vga_get_sync_bits();
-  debug_level = DEBUG_MAX_LEVEL;
-  last_btn_press_frame = 0;
-  checkSprites();
-  this->net = net;
-  this->joy = joy;
+  sync_word = (unsigned int) sync_bits * 0x01010101;
+  setDrawTarget(vga_get_framebuffer(), screen_w, screen_h);
+  beam_next_base = 0;
+  beam_window_frames = 0;
+  beam_window_torn = 0;
+}
+
+// Switch to the VGA mode selected for the given network state. All
+// VGA memory is freed and allocated again, and the background cache
+// (whose width depends on the screen width) is allocated again after
+// the framebuffers.
+void GameScreen::setVgaMode(bool net_running) {
+  int num_fb = getNumFramebuffers(net_running);
+  const VgaMode &mode = get_vga_mode(net_running, joy, num_fb);
+  if (&mode == &vga_get_mode() && num_fb == vga_num_fb) return;
+
+  bool bg_cache = (bg_cache_lines != nullptr);
+  freeBackgroundCache();
+  vga_set_beam_bands(beam_bands);  // (beam racing may have switched to double buffering)
+  vga_set_mode(mode, num_fb);
+  vga_num_fb = num_fb;
+  setupScreen();
+  if (bg_cache) {
+    enableBackgroundCache(true);
+  }
+  clear();
+}
+
+// Start or stop the network when button E is pressed. The radio needs
+// the memory of a framebuffer, so the VGA mode is switched before
+// starting it and after stopping it.
+void GameScreen::updateNetwork() {
+  if (! JOY_BTN_PRESSED(joy, JOY_BTN_E) || frame_count-last_btn_press_frame <= 5) return;
+  last_btn_press_frame = frame_count;
+  if (net->is_running()) {
+    net->stop();
+    setVgaMode(false);
+  } else {
+    setVgaMode(true);
+    net->init();
+    if (! net->is_running()) {
+      setVgaMode(false);
+    }
+  }
+}
+
+// Enable or disable the background cache. The cache uses a bit more
+// memory than a framebuffer, so it can fail to be enabled.
+bool GameScreen::enableBackgroundCache(bool enable) {
+  if (! enable) {
+    freeBackgroundCache();
+    return true;
+  }
+  if (bg_cache_lines) return true;
+  if (tile_mode) return false;  // (the screen is never rendered in tile mode)
+
+  // the cache is 4 pixels wider than the screen because its x position
+  // must be aligned to 4 pixels
+  bg_cache_w = screen_w + 4;
+  bg_cache_h = screen_h;
+  bg_cache_lines = (unsigned char **) calloc(bg_cache_h, sizeof(unsigned char *));
+  bg_strip_lines = (unsigned char **) malloc(sizeof(unsigned char *) * bg_cache_h);
+  if (! bg_cache_lines || ! bg_strip_lines) {
+    freeBackgroundCache();
+    printf("ERROR: not enough memory for background cache\n");
+    return false;
+  }
+  for (int i = 0; i < bg_cache_h; i++) {
+    bg_cache_lines[i] = (unsigned char *) malloc(bg_cache_w + 4);  // +4: the blitters may read one block past the end
+    if (! bg_cache_lines[i]) {
+      freeBackgroundCache();
+      printf("ERROR: not enough memory for background cache\n");
+      return false;
+    }
+  }
+  bg_cache_valid = false;
+  bg_cache_hits = 0;
+  bg_cache_misses = 0;
+  return true;
 }
 
-void GameScreen::checkSprites() {
-  bool ok = true;
+void GameScreen::freeBackgroundCache() {
+  if (bg_cache_lines) {
+    for (int i = 0; i < bg_cache_h; i++) {
+      free(bg_cache_lines[i]);
+    }
+    free(bg_cache_lines);
+    bg_cache_lines = nullptr;
+  }
+  free(bg_strip_lines);
+  bg_strip_lines = nullptr;
+}
+
+// Allocate the buffer for the lines of images that can't be drawn
+// directly from flash (stored with 4 bits per pixel or drawn mirrored),
+// large enough for a whole frame of the largest image, followed by a
+// line for reading the source of mirrored lines
+bool GameScreen::allocImageLines() {
+  int frame_size = 0, line_size = 0;
   for (int i = 0; i < game_num_sprite_defs; i++) {
-    if (! checkImageSBits(game_sprite_defs[i].data)) {
-      ok = false;
+    const SPRITE_DEF *def = &game_sprite_defs[i];
+    if (frame_size < def->height * (def->stride + 1)) frame_size = def->height * (def->stride + 1);
+    if (line_size < def->stride + 1) line_size = def->stride + 1;
+  }
+  image_lines = (unsigned int *) malloc(sizeof(unsigned int) * (frame_size + line_size + 1));  // +1: the blitters may read one block past the end
+  if (! image_lines) return false;
+  image_line_tmp = image_lines + frame_size;
+  return true;
+}
+
+// return the lookup table for expanding pixels of the given palette
+// (with its colors remapped if remap is not nullptr), building it in the
+// least recently used slot if it's not there
+const unsigned short *GameScreen::getPal4Lut(const unsigned char *palette, const unsigned char *remap) {
+  PAL4_LUT *lru = &pal4_luts[0];
+  for (int i = 0; i < PAL4_LUT_SLOTS; i++) {
+    PAL4_LUT &slot = pal4_luts[i];
+    if (slot.palette == palette && slot.remap == remap) {
+      slot.last_use = ++pal4_lut_uses;
+      return slot.lut;
     }
+    if (lru->last_use > slot.last_use) lru = &slot;
   }
-  setImagesSBitsOk(ok);
-  
-  if (! ok) {
-    printf("ERROR: bad SBits in sprite images\n");
-    printf("Current VGA mode SBits value: %02x\n", sync_bits);
+  unsigned char colors[16];
+  for (int i = 0; i < 16; i++) {
+    colors[i] = (remap) ? remap[palette[i] & 0x3f] : palette[i];
+  }
+  for (int b = 0; b < 256; b++) {
+    lru->lut[b] = colors[b & 15] | (colors[b >> 4] << 8);
+  }
+  lru->palette = palette;
+  lru->remap = remap;
+  lru->last_use = ++pal4_lut_uses;
+  return lru->lut;
+}
+
+// expand a line of num_words image words from 4 bits per pixel: each
+// source word has the 8 pixels of 2 image words, in the same order
+void GameScreen::expandPal4Line(unsigned int *dest, const unsigned int *src, int num_words, const unsigned short *lut) {
+  for (int i = 0; i < num_words/2; i++) {
+    unsigned int w = *src++;
+    *dest++ = lut[w & 0xff] | (lut[(w >> 8) & 0xff] << 16);
+    *dest++ = lut[(w >> 16) & 0xff] | (lut[w >> 24] << 16);
+  }
+  if (num_words & 1) {
+    unsigned int w = *src;
+    *dest = lut[w & 0xff] | (lut[(w >> 8) & 0xff] << 16);
+  }
+}
+
+// remap the colors of a line of num_words image words, 4 pixels at a time
+void GameScreen::remapImageLine(unsigned int *dest, const unsigned int *src, int num_words, const unsigned char *remap) {
+  for (int i = 0; i < num_words; i++) {
+    unsigned int w = src[i];
+    dest[i] = ((remap[w & 0x3f]) | (remap[(w >> 8) & 0x3f] << 8) |
+               (remap[(w >> 16) & 0x3f] << 16) | (remap[(w >> 24) & 0x3f] << 24));
+  }
+}
+
+// return line y of a frame, pre-shifted by `shift` pixels if it's not 0
+// (def->stride words, or def->stride+1 if pre-shifted); lines with 4
+// bits per pixel or with the colors remapped are written to dest (for
+// images with 4 bits per pixel, the remapped colors are in the lookup
+// table, so they cost nothing)
+const unsigned int *GameScreen::readImageLine(const SPRITE_DEF *def, int frame, int shift, int y, const unsigned char *remap, unsigned int *dest) {
+  int stride = (shift == 0) ? def->stride : def->stride + 1;
+  const unsigned int *image = game_get_image(def, frame, shift);
+  if (! def->palettes) {
+    const unsigned int *src = &image[stride * y];
+    if (! remap) return src;
+    remapImageLine(dest, src, stride, remap);
+    return dest;
+  }
+
+  int packed_stride = (stride + 1) / 2;
+  const unsigned short *lut = getPal4Lut(&def->palettes[16 * def->palette_index[frame]], remap);
+  expandPal4Line(dest, &image[packed_stride * y], stride, lut);
+  return dest;
+}
+
+// write line y of a frame mirrored horizontally, pre-shifted by `shift`
+// pixels if it's not 0, to dest. Reversing the order of the words of a
+// line and of the 4 pixels of each word (a byte swap, since the pixel
+// order [2][3][0][1] reversed is [1][0][3][2]) mirrors the line, moving
+// its padding pixels to the start, so the line is read from the stored
+// copy whose padding leaves the mirrored pixels at the wanted alignment
+// (only whole words must be skipped)
+void GameScreen::mirrorImageLine(unsigned int *dest, const SPRITE_DEF *def, int frame, int shift, int y, const unsigned char *remap) {
+  int pad = 4*def->stride - def->width;  // 0 to 3
+  int src_shift = (pad - shift) & 3;
+  int num_words = (shift == 0) ? def->stride : def->stride + 1;
+  unsigned int key = def->transparent_key * 0x01010101u;
+
+  if (src_shift != 0 && ! SPRITE_HAS_SHIFTED(def)) {
+    // no pre-shifted copy: shift the pixels of the unshifted line
+    const unsigned int *src = readImageLine(def, frame, 0, y, remap, image_line_tmp);
+    unsigned int cur = __builtin_bswap32(src[def->stride-1]);
+    for (int i = 0; i < def->stride; i++) {
+      unsigned int next = (i+1 < def->stride) ? __builtin_bswap32(src[def->stride-2-i]) : 0;
+      switch (pad) {
+      case 1: dest[i] = shift_block<3>(cur, next); break;
+      case 2: dest[i] = shift_block<2>(cur, next); break;
+      case 3: dest[i] = shift_block<1>(cur, next); break;
+      }
+      cur = next;
+    }
+    return;
+  }
+
+  // the reversed source line has the mirrored pixels shifted right by `offset`
+  int src_words = (src_shift == 0) ? def->stride : def->stride + 1;
+  int offset = (src_shift == 0) ? pad : pad + 4 - src_shift;
+  int skip = (offset - shift) / 4;
+  const unsigned int *src = readImageLine(def, frame, src_shift, y, remap, image_line_tmp);
+  for (int i = 0; i < num_words; i++) {
+    int j = i + skip;
+    dest[i] = (j < src_words) ? __builtin_bswap32(src[src_words-1-j]) : key;
+  }
+  if (shift != 0 && src_shift == 0) {
+    // the padding of unshifted lines is black, but the pixels outside pre-shifted lines are transparent
+    dest[0] = (dest[0] & pixel_mask_from[shift]) | (key & ~pixel_mask_from[shift]);
   }
 }
 
+// return lines [first, first+num) of a frame, pre-shifted by `shift`
+// pixels if it's not 0 (def->stride words per line, or def->stride+1 if
+// pre-shifted), mirrored horizontally if `flip` is set and with the
+// colors remapped if `remap` is not nullptr; images with 4 bits per
+// pixel and mirrored or remapped frames are written to image_lines, so
+// only the lines actually drawn are read
+const unsigned int *GameScreen::getImageLines(const SPRITE_DEF *def, int frame, int shift, int first, int num, bool flip, const unsigned char *remap) {
+  if (! flip && ! remap && ! def->palettes) {
+    return readImageLine(def, frame, shift, first, nullptr, nullptr);
+  }
+
+  int stride = (shift == 0) ? def->stride : def->stride + 1;
+  for (int y = 0; y < num; y++) {
+    if (flip) {
+      mirrorImageLine(image_lines + stride*y, def, frame, shift, first + y, remap);
+    } else {
+      readImageLine(def, frame, shift, first + y, remap, image_lines + stride*y);
+    }
+  }
+  return image_lines;
+}
+
 int GameScreen::fpsCounter(int cur_millis) {
   if (cur_millis/1000 != last_millis/1000) {
     last_fps = fps_frame_count;
@@ -84,26 +395,35 @@ int GameScreen::fpsCounter(int cur_millis) {
 
 // draw image line when x%4 == 0
 void GameScreen::drawImageLine0(unsigned int *screen, const unsigned int *image, int image_width) {
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += (image_width+3)/4;
   for (int x = 0; x < image_width/4; x++) {
-    *screen++ = *image++;
+    *screen++ = *image++ | sb;
   }
   switch (image_width%4) {
   case 0: break; // nothing to do
-  case 1: *screen = (*screen&0xff00ffff) | (*image&0x00ff0000); break;
-  case 2: *screen = (*screen&0x0000ffff) | (*image&0xffff0000); break;
-  case 3: *screen = (*screen&0x0000ff00) | (*image&0xffff00ff); break;
+  case 1: *screen = (*screen&0xff00ffff) | (*image&0x00ff0000) | sb; break;
+  case 2: *screen = (*screen&0x0000ffff) | (*image&0xffff0000) | sb; break;
+  case 3: *screen = (*screen&0x0000ff00) | (*image&0xffff00ff) | sb; break;
   }
 }
 
 // draw image line when x%4 == 1
 void GameScreen::drawImageLine1(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block) {
   unsigned int cur, old;
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += (image_width+3)/4;
 
   // first block (3 pixels)
   cur = *image++;
-  if (image_width >= 3 && ! skip_first_block) {
+  if (image_width < 3 && ! skip_first_block) {
+    unsigned int mask = pixel_mask_from[1] & pixel_mask_upto[image_width];
+    *screen = (*screen & ~mask) | ((((cur << 8) & 0xff00ff00) | ((cur >> 24) & 0x000000ff)) & mask) | sb;
+    return;
+  }
+  if (! skip_first_block) {
     image_width -= 3;
-    *screen = (*screen & 0x00ff0000) | ((cur << 8) & 0xff00ff00) | ((cur >> 24) & 0x000000ff);
+    *screen = (*screen & 0x00ff0000) | ((cur << 8) & 0xff00ff00) | ((cur >> 24) & 0x000000ff) | sb;
     screen++;
   }
 
@@ -111,7 +431,7 @@ void GameScreen::drawImageLine1(unsigned int *screen, const unsigned int *image,
   for (int x = 0; x < image_width/4; x++) {
     old = cur;
     cur = *image++;
-    *screen = ((old << 8) & 0x00ff0000) | ((cur << 8) & 0xff00ff00) | ((cur >> 24) & 0x000000ff);
+    *screen = ((old << 8) & 0x00ff0000) | ((cur << 8) & 0xff00ff00) | ((cur >> 24) & 0x000000ff) | sb;
     screen++;
   }
 
@@ -121,21 +441,27 @@ void GameScreen::drawImageLine1(unsigned int *screen, const unsigned int *image,
   old = cur;
   cur = *image;
   switch (image_width%4) {
-  case 1: *screen = (*screen & 0xff00ffff) | ((old << 8) & 0x00ff0000); break;
-  case 2: *screen = (*screen & 0x0000ffff) | ((old << 8) & 0x00ff0000) | ((cur << 8) & 0xff000000); break;
-  case 3: *screen = (*screen & 0x0000ff00) | ((old << 8) & 0x00ff0000) | ((cur << 8) & 0xff000000) | ((cur >> 24) & 0x000000ff); break;
+  case 1: *screen = (*screen & 0xff00ffff) | ((old << 8) & 0x00ff0000) | sb; break;
+  case 2: *screen = (*screen & 0x0000ffff) | ((old << 8) & 0x00ff0000) | ((cur << 8) & 0xff000000) | sb; break;
+  case 3: *screen = (*screen & 0x0000ff00) | ((old << 8) & 0x00ff0000) | ((cur << 8) & 0xff000000) | ((cur >> 24) & 0x000000ff) | sb; break;
   }
 }
 
 // draw image line when x%4 == 2
 void GameScreen::drawImageLine2(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block) {
   unsigned int cur, old;
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += (image_width+3)/4;
 
   // first block (2 pixels)
   cur = *image++;
-  if (image_width >= 2 && ! skip_first_block) {
+  if (image_width < 2 && ! skip_first_block) {
+    *screen = (*screen & 0xffffff00) | ((cur >> 16) & 0x000000ff) | sb;
+    return;
+  }
+  if (! skip_first_block) {
     image_width -= 2;
-    *screen = (*screen & 0xffff0000) | ((cur >> 16) & 0x0000ffff);
+    *screen = (*screen & 0xffff0000) | ((cur >> 16) & 0x0000ffff) | sb;
     screen++;
   }
 
@@ -143,7 +469,7 @@ void GameScreen::drawImageLine2(unsigned int *screen, const unsigned int *image,
   for (int x = 0; x < image_width/4; x++) {
     old = cur;
     cur = *image++;
-    *screen = ((old << 16) & 0xffff0000) | ((cur >> 16) & 0x0000ffff);
+    *screen = ((old << 16) & 0xffff0000) | ((cur >> 16) & 0x0000ffff) | sb;
     screen++;
   }
 
@@ -153,21 +479,23 @@ void GameScreen::drawImageLine2(unsigned int *screen, const unsigned int *image,
   old = cur;
   cur = *image;
   switch (image_width%4) {
-  case 1: *screen = (*screen & 0xff00ffff) | ((old << 16) & 0x00ff0000); break;
-  case 2: *screen = (*screen & 0x0000ffff) | ((old << 16) & 0xffff0000); break;
-  case 3: *screen = (*screen & 0x0000ff00) | ((old << 16) & 0xffff0000) | ((cur >> 16) & 0x000000ff); break;
+  case 1: *screen = (*screen & 0xff00ffff) | ((old << 16) & 0x00ff0000) | sb; break;
+  case 2: *screen = (*screen & 0x0000ffff) | ((old << 16) & 0xffff0000) | sb; break;
+  case 3: *screen = (*screen & 0x0000ff00) | ((old << 16) & 0xffff0000) | ((cur >> 16) & 0x000000ff) | sb; break;
   }
 }
 
 // draw image line when x%4 == 3
 void GameScreen::drawImageLine3(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block) {
   unsigned int cur, old;
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += (image_width+3)/4;
 
   // first block (1 pixel)
   cur = *image++;
   if (image_width >= 1 && ! skip_first_block) {
     image_width -= 1;
-    *screen = (*screen & 0xffff00ff) | ((cur >> 8) & 0x0000ff00);
+    *screen = (*screen & 0xffff00ff) | ((cur >> 8) & 0x0000ff00) | sb;
     screen++;
   }
 
@@ -175,7 +503,7 @@ void GameScreen::drawImageLine3(unsigned int *screen, const unsigned int *image,
   for (int x = 0; x < image_width/4; x++) {
     old = cur;
     cur = *image++;
-    *screen = ((old >> 8) & 0x00ff00ff) | ((old << 24) & 0xff000000) | ((cur >> 8) & 0x0000ff00);
+    *screen = ((old >> 8) & 0x00ff00ff) | ((old << 24) & 0xff000000) | ((cur >> 8) & 0x0000ff00) | sb;
     screen++;
   }
 
@@ -184,18 +512,21 @@ void GameScreen::drawImageLine3(unsigned int *screen, const unsigned int *image,
   // last block (1-3 pixels)
   old = cur;
   switch (image_width%4) {
-  case 1: *screen = (*screen & 0xff00ffff) | ((old >> 8) & 0x00ff0000); break;
-  case 2: *screen = (*screen & 0x0000ffff) | ((old >> 8) & 0x00ff0000) | ((old << 24) & 0xff000000); break;
-  case 3: *screen = (*screen & 0x0000ff00) | ((old >> 8) & 0x00ff00ff) | ((old << 24) & 0xff000000); break;
+  case 1: *screen = (*screen & 0xff00ffff) | ((old >> 8) & 0x00ff0000) | sb; break;
+  case 2: *screen = (*screen & 0x0000ffff) | ((old >> 8) & 0x00ff0000) | ((old << 24) & 0xff000000) | sb; break;
+  case 3: *screen = (*screen & 0x0000ff00) | ((old >> 8) & 0x00ff00ff) | ((old << 24) & 0xff000000) | sb; break;
   }
 }
 
 // draw transparent image line when x%4 == 0
 void GameScreen::drawImageLineTr0(unsigned int *screen, const unsigned int *image, int image_width) {
+  unsigned int key = transp_key;  // local copy, since the compiler can't know the screen writes don't change it
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += (image_width+3)/4;
   for (int x = 0; x < image_width/4; x++) {
-    unsigned int mask = GET_4PIX_TRANSP_MASK(*image);
-    if (mask == 0xffffffff) {
-      *screen++ = *image++;
+    unsigned int mask = GET_4PIX_TRANSP_MASK(*image, key);
+    if (mask == 0x3f3f3f3f) {
+      *screen++ = *image++ | sb;
     } else {
       *screen = (*screen & ~mask) | (*image++ & mask);
       screen++;
@@ -205,24 +536,28 @@ void GameScreen::drawImageLineTr0(unsigned int *screen, const unsigned int *imag
   if (image_width % 4 == 0) return;
 
   // TODO: optimize by calculating mask for the used pixels only
-  unsigned int mask = GET_4PIX_TRANSP_MASK(*image);
-  switch (image_width%4) {
-  case 1: *screen = (*screen & ((~mask) | 0xff00ffff)) | (*image & mask); break;
-  case 2: *screen = (*screen & ((~mask) | 0x0000ffff)) | (*image & mask); break;
-  case 3: *screen = (*screen & ((~mask) | 0x0000ff00)) | (*image & mask); break;
-  }
+  unsigned int mask = GET_4PIX_TRANSP_MASK(*image, key) & pixel_mask_upto[image_width%4 - 1];
+  *screen = (*screen & ~mask) | (*image & mask);
 }
 
 // draw transparent image line when x%4 == 1
 void GameScreen::drawImageLineTr1(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block) {
+  unsigned int key = transp_key;
   unsigned int cur, old;
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += (image_width+3)/4;
 
   // first block (3 pixels)
   cur = *image++;
-  if (image_width >= 3 && ! skip_first_block) {
-    image_width -= 3;
+  if (! skip_first_block) {
     unsigned int block = ((cur << 8) & 0xff00ff00) | ((cur >> 24) & 0x000000ff);
-    unsigned int mask = GET_PIX1_TRANSP_MASK(block) | GET_PIX2_TRANSP_MASK(block) | GET_PIX3_TRANSP_MASK(block);
+    unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & pixel_mask_from[1];
+    if (image_width < 3) {
+      mask &= pixel_mask_upto[image_width];
+      *screen = (*screen & ~mask) | (block & mask);
+      return;
+    }
+    image_width -= 3;
     *screen = (*screen & ~mask) | (block & mask);
     screen++;
   }
@@ -232,9 +567,9 @@ void GameScreen::drawImageLineTr1(unsigned int *screen, const unsigned int *imag
     old = cur;
     cur = *image++;
     unsigned int block = ((old << 8) & 0x00ff0000) | ((cur << 8) & 0xff00ff00) | ((cur >> 24) & 0x000000ff);
-    unsigned int mask = GET_4PIX_TRANSP_MASK(block);
-    if (mask == 0xffffffff) {
-      *screen++ = block;
+    unsigned int mask = GET_4PIX_TRANSP_MASK(block, key);
+    if (mask == 0x3f3f3f3f) {
+      *screen++ = block | sb;
     } else {
       *screen = (*screen & ~mask) | (block & mask);
       screen++;
@@ -251,21 +586,21 @@ void GameScreen::drawImageLineTr1(unsigned int *screen, const unsigned int *imag
   case 1:
     {
       unsigned int block = ((old << 8) & 0x00ff0000);
-      unsigned int mask = GET_PIX0_TRANSP_MASK(block);
+      unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & pixel_mask_upto[0];
       *screen = (*screen & ~mask) | (block & mask);
     }
     break;
   case 2:
     {
       unsigned int block = ((old << 8) & 0x00ff0000) | ((cur << 8) & 0xff000000);
-      unsigned int mask = GET_PIX0_TRANSP_MASK(block) | GET_PIX1_TRANSP_MASK(block);
+      unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & pixel_mask_upto[1];
       *screen = (*screen & ~mask) | (block & mask);
     }
     break;
   case 3:
     {
       unsigned int block = ((old << 8) & 0x00ff0000) | ((cur << 8) & 0xff000000) | ((cur >> 24) & 0x000000ff);
-      unsigned int mask = GET_PIX0_TRANSP_MASK(block) | GET_PIX1_TRANSP_MASK(block) | GET_PIX2_TRANSP_MASK(block);
+      unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & pixel_mask_upto[2];
       *screen = (*screen & ~mask) | (block & mask);
     }
     break;
@@ -274,15 +609,19 @@ void GameScreen::drawImageLineTr1(unsigned int *screen, const unsigned int *imag
 
 // draw transparent image line when x%4 == 2
 void GameScreen::drawImageLineTr2(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block) {
+  unsigned int key = transp_key;
   unsigned int cur, old;
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += (image_width+3)/4;
 
   // first block (2 pixels)
   cur = *image++;
-  if (image_width >= 2 && ! skip_first_block) {
-    image_width -= 2;
+  if (! skip_first_block) {
     unsigned int block = ((cur >> 16) & 0x0000ffff);
-    unsigned int mask = GET_PIX2_TRANSP_MASK(block) | GET_PIX3_TRANSP_MASK(block);
+    unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & ((image_width >= 2) ? pixel_mask_from[2] : 0x000000ff);
     *screen = (*screen & ~mask) | (block & mask);
+    if (image_width < 2) return;
+    image_width -= 2;
     screen++;
   }
 
@@ -291,9 +630,9 @@ void GameScreen::drawImageLineTr2(unsigned int *screen, const unsigned int *imag
     old = cur;
     cur = *image++;
     unsigned int block = ((old << 16) & 0xffff0000) | ((cur >> 16) & 0x0000ffff);
-    unsigned int mask = GET_4PIX_TRANSP_MASK(block);
-    if (mask == 0xffffffff) {
-      *screen++ = block;
+    unsigned int mask = GET_4PIX_TRANSP_MASK(block, key);
+    if (mask == 0x3f3f3f3f) {
+      *screen++ = block | sb;
     } else {
       *screen = (*screen & ~mask) | (block & mask);
       screen++;
@@ -309,21 +648,21 @@ void GameScreen::drawImageLineTr2(unsigned int *screen, const unsigned int *imag
   case 1:
     {
       unsigned int block = ((old << 16) & 0x00ff0000);
-      unsigned int mask = GET_PIX0_TRANSP_MASK(block);
+      unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & pixel_mask_upto[0];
       *screen = (*screen & ~mask) | (block & mask);
     }
     break;
   case 2:
     {
       unsigned int block = ((old << 16) & 0xffff0000);
-      unsigned int mask = GET_PIX0_TRANSP_MASK(block) | GET_PIX1_TRANSP_MASK(block);
+      unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & pixel_mask_upto[1];
       *screen = (*screen & ~mask) | (block & mask);
     }
     break;
   case 3:
     {
       unsigned int block = ((old << 16) & 0xffff0000) | ((cur >> 16) & 0x000000ff);
-      unsigned int mask = GET_PIX0_TRANSP_MASK(block) | GET_PIX1_TRANSP_MASK(block) | GET_PIX2_TRANSP_MASK(block);
+      unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & pixel_mask_upto[2];
       *screen = (*screen & ~mask) | (block & mask);
     }
     break;
@@ -332,14 +671,17 @@ void GameScreen::drawImageLineTr2(unsigned int *screen, const unsigned int *imag
 
 // draw transparent image line when x%4 == 3
 void GameScreen::drawImageLineTr3(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block) {
+  unsigned int key = transp_key;
   unsigned int cur, old;
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += (image_width+3)/4;
 
   // first block (1 pixel)
   cur = *image++;
   if (image_width >= 1 && ! skip_first_block) {
     image_width -= 1;
     unsigned int block = ((cur >> 8) & 0x0000ff00);
-    unsigned int mask = GET_PIX3_TRANSP_MASK(block);
+    unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & pixel_mask_from[3];
     *screen = (*screen & ~mask) | (block & mask);
     screen++;
   }
@@ -349,9 +691,9 @@ void GameScreen::drawImageLineTr3(unsigned int *screen, const unsigned int *imag
     old = cur;
     cur = *image++;
     unsigned int block = ((old >> 8) & 0x00ff00ff) | ((old << 24) & 0xff000000) | ((cur >> 8) & 0x0000ff00);
-    unsigned int mask = GET_4PIX_TRANSP_MASK(block);
-    if (mask == 0xffffffff) {
-      *screen++ = block;
+    unsigned int mask = GET_4PIX_TRANSP_MASK(block, key);
+    if (mask == 0x3f3f3f3f) {
+      *screen++ = block | sb;
     } else {
       *screen = (*screen & ~mask) | (block & mask);
       screen++;
@@ -366,52 +708,453 @@ void GameScreen::drawImageLineTr3(unsigned int *screen, const unsigned int *imag
   case 1:
     {
       unsigned int block = ((old >> 8) & 0x00ff0000);
-      unsigned int mask = GET_PIX0_TRANSP_MASK(block);
+      unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & pixel_mask_upto[0];
       *screen = (*screen & ~mask) | (block & mask);
     }
     break;
   case 2:
     {
       unsigned int block = ((old >> 8) & 0x00ff0000) | ((old << 24) & 0xff000000);
-      unsigned int mask = GET_PIX0_TRANSP_MASK(block) | GET_PIX1_TRANSP_MASK(block);
+      unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & pixel_mask_upto[1];
       *screen = (*screen & ~mask) | (block & mask);
     }
     break;
   case 3:
     {
       unsigned int block = ((old >> 8) & 0x00ff00ff) | ((old << 24) & 0xff000000);
-      unsigned int mask = GET_PIX0_TRANSP_MASK(block) | GET_PIX1_TRANSP_MASK(block) | GET_PIX2_TRANSP_MASK(block);
+      unsigned int mask = GET_4PIX_TRANSP_MASK(block, key) & pixel_mask_upto[2];
       *screen = (*screen & ~mask) | (block & mask);
     }
     break;
   }
 }
 
-void GameScreen::drawSprite(const SPRITE_DEF *def, int spr_x, int spr_y, int frame, bool transparent) {
-  const unsigned int *image_start = &def->data[def->stride * def->height * frame];
-  
-  int height = def->height;
+// draw image line of whole blocks, writing only the pixels selected by
+// the masks in the first and last blocks
+void GameScreen::drawImageLineMasked(unsigned int *screen, const unsigned int *image, int num_blocks, unsigned int first_mask, unsigned int last_mask) {
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += num_blocks;
+  if (num_blocks == 1) {
+    unsigned int mask = first_mask & last_mask;
+    *screen = (*screen & ~mask) | (*image & mask) | sb;
+    return;
+  }
+
+  *screen = (*screen & ~first_mask) | (*image++ & first_mask) | sb;
+  screen++;
+  for (int x = 0; x < num_blocks-2; x++) {
+    *screen++ = *image++ | sb;
+  }
+  *screen = (*screen & ~last_mask) | (*image & last_mask) | sb;
+}
+
+// draw sprite using the frame pre-shifted to the sprite's x alignment,
+// so every line is drawn as if x%4 == 0; only lines [top, bottom) and
+// blocks [left, right) of the frame are drawn (trimming is only done
+// for transparent drawing, so the masks are only needed for full lines)
+void GameScreen::drawShiftedSprite(const SPRITE_DEF *def, int spr_x, int spr_y, int frame, bool flip, const unsigned char *remap, bool transparent, int top, int bottom, int left, int right) {
+  int shift = spr_x & 3;
+  int stride = def->stride + 1;
+  int first_line = top;
+  int image_x = left;
+
+  spr_y += top;
+  int height = bottom - top;
   if (spr_y < 0) {
-    image_start += def->stride * (-spr_y);
+    first_line -= spr_y;
     height += spr_y;
     spr_y = 0;
   }
-  if (height > screen_h - spr_y) height = screen_h - spr_y;
+  if (height > target_h - spr_y) height = target_h - spr_y;
   if (height <= 0) return;
 
+  int block_x = (spr_x - shift) / 4 + left;
+  int num_blocks = (def->width + shift + 3) / 4;
+  if (num_blocks > right + 1) num_blocks = right + 1;  // the last block of a trimmed line spills into the next
+  num_blocks -= left;
+  unsigned int first_mask = pixel_mask_from[shift];
+  unsigned int last_mask = pixel_mask_upto[(def->width + shift - 1) % 4];
+  if (block_x < 0) {
+    image_x += -block_x;
+    num_blocks += block_x;
+    block_x = 0;
+    first_mask = 0xffffffff;
+  }
+  if (num_blocks > target_w/4 - block_x) {
+    num_blocks = target_w/4 - block_x;
+    last_mask = 0xffffffff;
+  }
+  if (num_blocks <= 0) return;
+  const unsigned int *image_start = getImageLines(def, frame, shift, first_line, height, flip, remap) + image_x;
+
+  unsigned char **framebuffer = target_lines;
+#define LINE(l) ((unsigned int *)framebuffer[l])
+  if (transparent) {
+    // pixels outside the original image are transparent, no need for masks
+    for (int y = 0; y < height; y++) drawImageLineTr0(LINE(y+spr_y) + block_x, image_start + stride*y, 4*num_blocks);
+  } else {
+    for (int y = 0; y < height; y++) drawImageLineMasked(LINE(y+spr_y) + block_x, image_start + stride*y, num_blocks, first_mask, last_mask);
+  }
+#undef LINE
+}
+
+// fill line with a color (4 pixels), clipping it to the target
+void GameScreen::fillImageLine(unsigned int *line, int x, int width, unsigned int color) {
+  if (x < 0) {
+    width += x;
+    x = 0;
+  }
+  if (width > target_w - x) width = target_w - x;
+  if (width <= 0) return;
+
+  line += x/4;
+  int num_blocks = (x%4 + width + 3) / 4;
+  unsigned int first_mask = pixel_mask_from[x%4];
+  unsigned int last_mask = pixel_mask_upto[(x+width-1)%4];
+  words_written += num_blocks;
+  if (num_blocks == 1) {
+    unsigned int mask = first_mask & last_mask;
+    *line = (*line & ~mask) | (color & mask);
+    return;
+  }
+  *line = (*line & ~first_mask) | (color & first_mask);
+  line++;
+  for (int i = 0; i < num_blocks-2; i++) {
+    *line++ = color;
+  }
+  *line = (*line & ~last_mask) | (color & last_mask);
+}
+
+// draw transparent image line at x%4 == ALIGN using the transparency
+// mask of each image block (same parameters as drawImageLineTrN)
+template<int ALIGN>
+void GameScreen::drawImageLineMask(unsigned int *screen, const unsigned int *image, const unsigned int *mask, int image_width, bool skip_first_block) {
+  unsigned int m;
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += (image_width+3)/4;
+
+  if (ALIGN == 0) {
+    for (int x = 0; x < image_width/4; x++) {
+      m = *mask++;
+      if (m == 0x3f3f3f3f) {
+        *screen = *image | sb;
+      } else if (m != 0) {
+        *screen = (*screen & ~m) | (*image & m);
+      }
+      screen++;
+      image++;
+    }
+    if (image_width % 4 != 0) {
+      m = *mask & pixel_mask_upto[image_width%4 - 1];
+      *screen = (*screen & ~m) | (*image & m);
+    }
+    return;
+  }
+
+  // first block (4-ALIGN pixels)
+  unsigned int cur = *image++;
+  unsigned int cur_mask = *mask++;
+  if (! skip_first_block) {
+    m = shift_block<ALIGN>(0, cur_mask) & pixel_mask_from[ALIGN];
+    if (image_width < 4-ALIGN) {
+      m &= pixel_mask_upto[ALIGN + image_width - 1];
+      *screen = (*screen & ~m) | (shift_block<ALIGN>(0, cur) & m);
+      return;
+    }
+    *screen = (*screen & ~m) | (shift_block<ALIGN>(0, cur) & m);
+    screen++;
+    image_width -= 4-ALIGN;
+  }
+
+  // middle blocks (4 pixels)
+  for (int x = 0; x < image_width/4; x++) {
+    unsigned int old = cur;
+    unsigned int old_mask = cur_mask;
+    cur = *image++;
+    cur_mask = *mask++;
+    m = shift_block<ALIGN>(old_mask, cur_mask);
+    if (m == 0x3f3f3f3f) {
+      *screen = shift_block<ALIGN>(old, cur) | sb;
+    } else if (m != 0) {
+      *screen = (*screen & ~m) | (shift_block<ALIGN>(old, cur) & m);
+    }
+    screen++;
+  }
+
+  // last block (1-3 pixels, reading the next image block only if needed)
+  int rest = image_width % 4;
+  if (rest == 0) return;
+  unsigned int old = cur;
+  unsigned int old_mask = cur_mask;
+  cur = (rest > ALIGN) ? *image : 0;
+  cur_mask = (rest > ALIGN) ? *mask : 0;
+  m = shift_block<ALIGN>(old_mask, cur_mask) & pixel_mask_upto[rest-1];
+  *screen = (*screen & ~m) | (shift_block<ALIGN>(old, cur) & m);
+}
+
+// draw image line at any x position, clipping it to the screen; if a
+// transparency mask is given, it's used for transparent drawing
+void GameScreen::drawImageLine(unsigned int *line, int x, const unsigned int *image, int width, bool transparent, const unsigned int *mask) {
   bool skip_first_block = false;
-  int width = def->width;
+  if (x < 0) {
+    image += (-x) / 4;
+    if (mask) mask += (-x) / 4;
+    width += x;
+    x = ((unsigned int) x) % 4;
+    skip_first_block = true;
+  }
+  int first_x = (skip_first_block) ? 0 : x;  // the line starts at 0 when clipped on the left
+  if (width > target_w - first_x) width = target_w - first_x;
+  if (width <= 0) return;
+
+  line += x/4;
+  if (transparent && mask) {
+    switch (x % 4) {
+    case 0: drawImageLineMask<0>(line, image, mask, width, skip_first_block); break;
+    case 1: drawImageLineMask<1>(line, image, mask, width, skip_first_block); break;
+    case 2: drawImageLineMask<2>(line, image, mask, width, skip_first_block); break;
+    case 3: drawImageLineMask<3>(line, image, mask, width, skip_first_block); break;
+    }
+  } else if (transparent) {
+    switch (x % 4) {
+    case 0: drawImageLineTr0(line, image, width); break;
+    case 1: drawImageLineTr1(line, image, width, skip_first_block); break;
+    case 2: drawImageLineTr2(line, image, width, skip_first_block); break;
+    case 3: drawImageLineTr3(line, image, width, skip_first_block); break;
+    }
+  } else {
+    switch (x % 4) {
+    case 0: drawImageLine0(line, image, width); break;
+    case 1: drawImageLine1(line, image, width, skip_first_block); break;
+    case 2: drawImageLine2(line, image, width, skip_first_block); break;
+    case 3: drawImageLine3(line, image, width, skip_first_block); break;
+    }
+  }
+}
+
+// draw transparent sprite using its span list: fully transparent
+// blocks are skipped and fully opaque blocks are copied without
+// checking for transparent pixels; only lines [top, bottom) are drawn
+void GameScreen::drawSpanSprite(const SPRITE_DEF *def, int spr_x, int spr_y, int frame, const unsigned char *remap, int top, int bottom) {
+  int first_y = (spr_y < -top) ? -spr_y : top;
+  int last_y = bottom;
+  if (last_y > target_h - spr_y) last_y = target_h - spr_y;
+  if (first_y >= last_y) return;
+
+  // pre-shifted frames are drawn in whole blocks; the first and last
+  // blocks of each span have pixels of the neighbor blocks, which are
+  // masked out for opaque spans (for partially transparent spans, they
+  // are either transparent or the same pixels drawn by the neighbor span)
+  int shift = spr_x & 3;
+  bool use_blocks = (shift == 0 || SPRITE_HAS_SHIFTED(def));
+  int block_x = (spr_x - shift) / 4;
+  int data_shift = (use_blocks) ? shift : 0;
+  int stride = (data_shift == 0) ? def->stride : def->stride + 1;
+  const unsigned int *image_start = getImageLines(def, frame, data_shift, first_y, last_y - first_y, false, remap);
+  unsigned int span_first_mask = pixel_mask_from[shift];
+  unsigned int span_last_mask = (shift == 0) ? 0xffffffff : pixel_mask_upto[shift-1];
+  int pad = 4*def->stride - def->width;  // padding pixels at the end of unshifted lines
+#if SPRITE_MASKS_ENABLED
+  const unsigned int *mask_start = ((def->mask && data_shift == 0)
+                                    ? &def->mask[def->stride * (def->height * frame + first_y)]
+                                    : nullptr);
+#else
+  const unsigned int *mask_start = nullptr;  // (the compiler leaves out the mask branches below)
+#endif
+
+  const unsigned short *span_index = &def->span_index[def->height * frame];
+  unsigned char **framebuffer = target_lines;
+  for (int y = first_y; y < last_y; y++) {
+    unsigned int *line = (unsigned int *) framebuffer[spr_y + y];
+    const unsigned int *image = image_start + stride*(y - first_y);
+    const unsigned int *mask = (mask_start) ? mask_start + stride*(y - first_y) : nullptr;
+    const unsigned short *span_end = &def->spans[span_index[y+1]];
+    for (const unsigned short *span = &def->spans[span_index[y]]; span != span_end; span++) {
+      int start = SPAN_START(*span);
+      int len = SPAN_LEN(*span);
+      bool opaque = SPAN_OPAQUE(*span);
+
+      if (! use_blocks) {
+        int width = (start + len == def->stride) ? 4*len - pad : 4*len;
+        drawImageLine(line, spr_x + 4*start, image + start, width, ! opaque, (mask) ? mask + start : nullptr);
+        continue;
+      }
+
+      const unsigned int *src = image + start;
+      int b = block_x + start;
+      int num_blocks = (shift == 0) ? len : len + 1;
+      unsigned int first_mask = span_first_mask;
+      unsigned int last_mask = span_last_mask;
+      bool clipped = false;
+      if (b < 0) {
+        src -= b;
+        num_blocks += b;
+        b = 0;
+        first_mask = 0xffffffff;
+      }
+      if (num_blocks > target_w/4 - b) {
+        num_blocks = target_w/4 - b;
+        last_mask = 0xffffffff;
+        clipped = true;
+      }
+      if (num_blocks <= 0) continue;
+      int width = (shift == 0 && ! clipped && start + len == def->stride) ? 4*num_blocks - pad : 4*num_blocks;
+      if (opaque) {
+        drawImageLineMasked(line + b, src, num_blocks, first_mask, last_mask);
+      } else if (mask) {
+        drawImageLineMask<0>(line + b, src, mask + (src - image), width, false);
+      } else {
+        drawImageLineTr0(line + b, src, width);
+      }
+    }
+  }
+}
+
+// draw image lines of a compile-time width (multiple of 4) at x%4 ==
+// ALIGN, without clipping; the compiler can fully unroll each line
+template<int ALIGN, bool TRANSP, int WIDTH>
+void GameScreen::drawImageRows(unsigned char **lines, int block_x, const unsigned int *image, int stride, int height) {
+  static_assert(WIDTH % 4 == 0, "image width must be a multiple of 4");
+  const int num_blocks = WIDTH/4;
+  unsigned int key = transp_key;
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += height * ((ALIGN == 0) ? num_blocks : num_blocks + 1);
+
+  for (int y = 0; y < height; y++) {
+    unsigned int *screen = (unsigned int *) lines[y] + block_x;
+    const unsigned int *src = image + stride*y;
+
+    if (ALIGN == 0) {
+      for (int i = 0; i < num_blocks; i++) {
+        if (TRANSP) {
+          unsigned int mask = GET_4PIX_TRANSP_MASK(src[i], key);
+          screen[i] = (mask == 0x3f3f3f3f) ? src[i] | sb : (screen[i] & ~mask) | (src[i] & mask);
+        } else {
+          screen[i] = src[i] | sb;
+        }
+      }
+      continue;
+    }
+
+    // first block (4-ALIGN pixels), middle blocks, last block (ALIGN pixels)
+    unsigned int block = shift_block<ALIGN>(0, src[0]);
+    unsigned int mask = pixel_mask_from[ALIGN];
+    if (TRANSP) mask &= GET_4PIX_TRANSP_MASK(block, key);
+    screen[0] = (screen[0] & ~mask) | (block & mask) | sb;
+    for (int i = 1; i < num_blocks; i++) {
+      block = shift_block<ALIGN>(src[i-1], src[i]);
+      if (TRANSP) {
+        mask = GET_4PIX_TRANSP_MASK(block, key);
+        screen[i] = (mask == 0x3f3f3f3f) ? block | sb : (screen[i] & ~mask) | (block & mask);
+      } else {
+        screen[i] = block | sb;
+      }
+    }
+    block = shift_block<ALIGN>(src[num_blocks-1], 0);
+    mask = pixel_mask_upto[(ALIGN+3)%4];  // ALIGN-1 (without a negative index when ALIGN == 0)
+    if (TRANSP) mask &= GET_4PIX_TRANSP_MASK(block, key);
+    screen[num_blocks] = (screen[num_blocks] & ~mask) | (block & mask) | sb;
+  }
+}
+
+void GameScreen::drawSprite(const SPRITE_DEF *def, int spr_x, int spr_y, int frame, bool transparent, bool flip, const unsigned char *remap) {
+  transp_key = def->transparent_key * 0x01010101u;
+
+  // part of the frame to draw: lines [top, bottom), blocks [left, right)
+  int top = 0, bottom = def->height;
+  int left = 0, right = def->stride;
+  if (transparent && def->bbox) {
+    const unsigned char *bbox = &def->bbox[4*frame];
+    if (BBOX_EMPTY(bbox)) return;
+    top = BBOX_TOP(bbox);
+    bottom = BBOX_BOTTOM(bbox) + 1;
+    left = (flip) ? BBOX_MIRRORED_LEFT(bbox, def->width) : BBOX_LEFT(bbox);
+    right = ((flip) ? BBOX_MIRRORED_RIGHT(bbox, def->width) : BBOX_RIGHT(bbox)) + 1;
+  }
+
+  // the compiled frames, span lists and masks are only for unmirrored
+  // frames, and the compiled frames have the colors (and the pixels
+  // skipped as transparent) in the code
+  if (transparent && def->compiled && ! flip && ! remap && spr_x >= 0 && spr_y >= 0 &&
+      spr_x + def->width <= target_w && spr_y + def->height <= target_h) {
+    assert(def->transparent_key == SPRITE_TRANSPARENT_GREEN);
+    def->compiled[4*frame + (spr_x&3)](&target_lines[spr_y], spr_x/4, sync_word);
+    words_written += def->compiled_words[4*frame + (spr_x&3)];
+    return;
+  }
+  if (transparent && def->format == SPRITE_FORMAT_SPANS && ! flip) {
+    drawSpanSprite(def, spr_x, spr_y, frame, remap, top, bottom);
+    return;
+  }
+  if (SPRITE_HAS_SHIFTED(def) && (spr_x & 3) != 0) {
+    drawShiftedSprite(def, spr_x, spr_y, frame, flip, remap, transparent, top, bottom, left, right);
+    return;
+  }
+
+  int first_line = top;
+  int image_x = left;
+
+  spr_y += top;
+  spr_x += 4*left;
+  int height = bottom - top;
+  if (spr_y < 0) {
+    first_line -= spr_y;
+    height += spr_y;
+    spr_y = 0;
+  }
+  if (height > target_h - spr_y) height = target_h - spr_y;
+  if (height <= 0) return;
+
+  bool skip_first_block = false;
+  int width = ((4*right < def->width) ? 4*right : def->width) - 4*left;
   if (spr_x < 0) {
-    image_start += (-spr_x) / 4;
+    image_x += (-spr_x) / 4;
     width += spr_x;
     spr_x = ((unsigned int) spr_x) % 4;
     skip_first_block = true;
   }
-  if (width > screen_w - spr_x) width = screen_w - spr_x;
+  int first_x = (skip_first_block) ? 0 : spr_x;  // the line starts at 0 when clipped on the left
+  if (width > target_w - first_x) width = target_w - first_x;
   if (width <= 0) return;
+  const unsigned int *image_start = getImageLines(def, frame, 0, first_line, height, flip, remap) + image_x;
 
-  unsigned char **framebuffer = vga_get_framebuffer();
+  unsigned char **framebuffer = target_lines;
 #define LINE(l) ((unsigned int *)framebuffer[l])
+#if SPRITE_MASKS_ENABLED
+  if (transparent && def->mask && ! flip) {
+    const unsigned int *mask_start = &def->mask[def->stride * (def->height * frame + first_line) + image_x];
+    switch (spr_x % 4) {
+    case 0: for (int y = 0; y < height; y++) drawImageLineMask<0>(LINE(y+spr_y) + spr_x/4, image_start + def->stride*y, mask_start + def->stride*y, width, skip_first_block); break;
+    case 1: for (int y = 0; y < height; y++) drawImageLineMask<1>(LINE(y+spr_y) + spr_x/4, image_start + def->stride*y, mask_start + def->stride*y, width, skip_first_block); break;
+    case 2: for (int y = 0; y < height; y++) drawImageLineMask<2>(LINE(y+spr_y) + spr_x/4, image_start + def->stride*y, mask_start + def->stride*y, width, skip_first_block); break;
+    case 3: for (int y = 0; y < height; y++) drawImageLineMask<3>(LINE(y+spr_y) + spr_x/4, image_start + def->stride*y, mask_start + def->stride*y, width, skip_first_block); break;
+    }
+    return;
+  }
+#endif
+
+  // unclipped tile lines: use the versions specialized for the tile width
+  if (width == TILE_WIDTH && ! skip_first_block) {
+    unsigned char **lines = &target_lines[spr_y];
+    int block_x = spr_x/4;
+    if (transparent) {
+      switch (spr_x % 4) {
+      case 0: drawImageRows<0, true, TILE_WIDTH>(lines, block_x, image_start, def->stride, height); break;
+      case 1: drawImageRows<1, true, TILE_WIDTH>(lines, block_x, image_start, def->stride, height); break;
+      case 2: drawImageRows<2, true, TILE_WIDTH>(lines, block_x, image_start, def->stride, height); break;
+      case 3: drawImageRows<3, true, TILE_WIDTH>(lines, block_x, image_start, def->stride, height); break;
+      }
+    } else {
+      switch (spr_x % 4) {
+      case 0: drawImageRows<0, false, TILE_WIDTH>(lines, block_x, image_start, def->stride, height); break;
+      case 1: drawImageRows<1, false, TILE_WIDTH>(lines, block_x, image_start, def->stride, height); break;
+      case 2: drawImageRows<2, false, TILE_WIDTH>(lines, block_x, image_start, def->stride, height); break;
+      case 3: drawImageRows<3, false, TILE_WIDTH>(lines, block_x, image_start, def->stride, height); break;
+      }
+    }
+    return;
+  }
+
   if (transparent) {
     switch (spr_x % 4) {
     case 0: for (int y = 0; y < height; y++) drawImageLineTr0(LINE(y+spr_y) + spr_x/4, image_start + def->stride*y, width); break;
@@ -447,54 +1190,331 @@ void GameScreen::setScreenPos() {
   }
 }
 
-void GameScreen::renderScreen() {
-  setScreenPos();
+// check if any opaque pixel of the sprite frame is on the screen
+bool GameScreen::isSpriteVisible(const SPRITE_DEF *def, int spr_x, int spr_y, int frame, bool flip) {
+  int x0 = 0, y0 = 0, x1 = def->width, y1 = def->height;
+  if (def->bbox) {
+    const unsigned char *bbox = &def->bbox[4*frame];
+    if (BBOX_EMPTY(bbox)) return false;
+    x0 = 4*((flip) ? BBOX_MIRRORED_LEFT(bbox, def->width) : BBOX_LEFT(bbox));
+    x1 = 4*((flip) ? BBOX_MIRRORED_RIGHT(bbox, def->width) : BBOX_RIGHT(bbox)) + 4;
+    y0 = BBOX_TOP(bbox);
+    y1 = BBOX_BOTTOM(bbox) + 1;
+  }
+  if (spr_x + x1 <= 0 || spr_y + y1 <= 0) return false;
+  if (spr_x + x0 >= target_w || spr_y + y0 >= target_h) return false;
+  return true;
+}
 
-  int tile_x_first = screen_x/TILE_WIDTH;
-  int tile_x_last = (screen_x+screen_w)/TILE_WIDTH;
-  int tile_y_first = screen_y/TILE_HEIGHT;
-  int tile_y_last = (screen_y+screen_h)/TILE_HEIGHT;
+// return the shift of the stored frame that drawSprite() reads to draw
+// a sprite at spr_x: the frame pre-shifted to the sprite's x alignment
+// (or to the alignment of the mirrored pixels, if flipped) if the
+// sprite has pre-shifted frames
+int GameScreen::getSpriteImageShift(const SPRITE_DEF *def, int spr_x, bool flip) {
+  if (! SPRITE_HAS_SHIFTED(def)) return 0;
+  if (! flip) return spr_x & 3;
+  int pad = 4*def->stride - def->width;
+  return (pad - (spr_x & 3)) & 3;
+}
 
-  int x_pos_start = -(screen_x%TILE_WIDTH);
-  int y_pos_start = -(screen_y%TILE_HEIGHT);
+// select the background render mode; in line buffer mode it's changed
+// at the start of the next frame
+void GameScreen::setBackgroundRenderMode(int mode) {
+  bg_render_mode_next = mode;
+  if (line_buffer_lines == 0) {
+    applyBackgroundRenderMode();
+  }
+}
 
-  int y_pos;
+// switch to the requested background render mode; the background cache
+// is rendered again with the new mode
+void GameScreen::applyBackgroundRenderMode() {
+  if (bg_render_mode != bg_render_mode_next) {
+    bg_render_mode = bg_render_mode_next;
+    bg_cache_valid = false;
+  }
+}
 
-  // background
-  y_pos = y_pos_start;
+// render the background of the world area (x,y)-(x+w,y+h) to the
+// drawing target; w must be a multiple of 4
+void GameScreen::renderBackground(int x, int y, int w, int h) {
+  switch (bg_render_mode) {
+  case BG_RENDER_TILES: renderBackgroundTiles(x, y, w, h); break;
+  case BG_RENDER_LINES: renderBackgroundLines(x, y, w, h); break;
+  }
+}
+
+// combine consecutive source blocks from the tile lines in bg_tile_lines[]
+// into screen blocks, starting at source block 'block' of the first tile;
+// for tiles covered by the foreground (nullptr lines), only the first
+// screen block is written, since it has pixels of the previous tile
+#define TILE_MAP_LINE_LOOP(combine) do {                                \
+    const unsigned int **tile_line = bg_tile_lines;                     \
+    const unsigned int *src = *tile_line++;                             \
+    unsigned int old, cur = (src) ? src[block] : bg_black_line[0];      \
+    if (src) src += block + 1;                                          \
+    int left = TILE_STRIDE - block - 1;                                 \
+    while (num_words > 0) {                                             \
+      if (left == 0) {                                                  \
+        src = *tile_line++;                                             \
+        left = TILE_STRIDE;                                             \
+      }                                                                 \
+      int n = (left < num_words) ? left : num_words;                    \
+      left -= n;                                                        \
+      num_words -= n;                                                   \
+      if (! src) {                                                      \
+        old = cur;                                                      \
+        cur = bg_black_line[0];                                         \
+        *screen = (combine) | sb;                                       \
+        screen += n;                                                    \
+        words_written -= n-1;                                           \
+        continue;                                                       \
+      }                                                                 \
+      for (int i = 0; i < n; i++) {                                     \
+        old = cur;                                                      \
+        cur = *src++;                                                   \
+        *screen++ = (combine) | sb;                                     \
+      }                                                                 \
+    }                                                                   \
+  } while (0)
+
+// draw a line of the tile map starting at world coordinate x, reading
+// the tile lines from bg_tile_lines[] (the first one is the line of the
+// tile containing x)
+void GameScreen::drawTileMapLine(unsigned int *screen, int x, int num_words) {
+  int block = (x/4) % TILE_STRIDE;
+  unsigned int sb = BLIT_SYNC_WORD;
+  words_written += num_words;
+  switch (x % 4) {
+  case 0:
+    {
+      const unsigned int **tile_line = bg_tile_lines;
+      const unsigned int *src = *tile_line++;
+      int left = TILE_STRIDE - block;
+      if (src) src += block;
+      while (num_words > 0) {
+        int n = (left < num_words) ? left : num_words;
+        num_words -= n;
+        if (src) {
+          for (int i = 0; i < n; i++) {
+            *screen++ = *src++ | sb;
+          }
+        } else {
+          screen += n;
+          words_written -= n;
+        }
+        src = *tile_line++;
+        left = TILE_STRIDE;
+      }
+    }
+    break;
+
+    // the line starts at pixel x%4 of the first block, so it's like drawing it at -x%4
+  case 1: TILE_MAP_LINE_LOOP(shift_block<3>(old, cur)); break;
+  case 2: TILE_MAP_LINE_LOOP(shift_block<2>(old, cur)); break;
+  case 3: TILE_MAP_LINE_LOOP(shift_block<1>(old, cur)); break;
+  }
+}
+
+// render the background line by line: for each line, get the line of
+// all tiles it crosses and draw them with a single call; empty tiles are
+// drawn black and tiles covered by opaque foreground tiles are skipped
+void GameScreen::renderBackgroundLines(int x, int y, int w, int h) {
+  int tile_x_first = x/TILE_WIDTH;
+  int num_tiles = (x%TILE_WIDTH + w)/TILE_WIDTH + 1;  // +1 for the block after the last pixel
+  const SPRITE_DEF *tileset = game_map.tileset;
+
+  int tile_y = -1;
+  const MAP_TILE *tiles = nullptr;
+  for (int ty = 0; ty < h; ty++) {
+    int world_y = y + ty;
+    if (world_y / TILE_HEIGHT != tile_y) {
+      tile_y = world_y / TILE_HEIGHT;
+      tiles = &game_map.tiles[tile_y*game_map.width];
+    }
+    int tile_line = world_y % TILE_HEIGHT;
+    for (int i = 0; i < num_tiles; i++) {
+      int tile_x = tile_x_first + i;
+      bool in_map = (tile_x < game_map.width && tile_y < game_map.height);
+      int tile_num = (in_map) ? tiles[tile_x].back : 0xffff;
+      int fore_num = (in_map) ? tiles[tile_x].fore : 0xffff;
+      if (fore_num != 0xffff && getTileOpacity(fore_num) == SPRITE_OPACITY_OPAQUE) {
+        bg_tile_lines[i] = nullptr;
+      } else if (tile_num == 0xffff) {
+        bg_tile_lines[i] = bg_black_line;
+      } else if (tileset->palettes) {
+        const unsigned int *src = &game_get_image(tileset, tile_num, 0)[(tileset->stride + 1)/2 * tile_line];
+        const unsigned short *lut = getPal4Lut(&tileset->palettes[16 * tileset->palette_index[tile_num]], nullptr);
+        expandPal4Line(bg_tile_expanded[i], src, tileset->stride, lut);
+        bg_tile_lines[i] = bg_tile_expanded[i];
+      } else {
+        bg_tile_lines[i] = &game_get_image(tileset, tile_num, 0)[tileset->stride * tile_line];
+      }
+    }
+    drawTileMapLine((unsigned int *) target_lines[ty], x, w/4);
+  }
+}
+
+// render the background tile by tile; tiles covered by opaque foreground
+// tiles are skipped, and empty tiles (or tiles outside the map) are filled
+// with black
+void GameScreen::renderBackgroundTiles(int x, int y, int w, int h) {
+  unsigned int black = (unsigned int) sync_bits * 0x01010101;
+  int tile_x_first = x/TILE_WIDTH;
+  int tile_x_last = (x+w-1)/TILE_WIDTH;
+  int tile_y_first = y/TILE_HEIGHT;
+  int tile_y_last = (y+h-1)/TILE_HEIGHT;
+
+  int y_pos = tile_y_first*TILE_HEIGHT - y;
   for (int tile_y = tile_y_first; tile_y <= tile_y_last; tile_y++) {
-    int x_pos = x_pos_start;
+    int x_pos = tile_x_first*TILE_WIDTH - x;
     const MAP_TILE *tiles = &game_map.tiles[tile_y*game_map.width];
     for (int tile_x = tile_x_first; tile_x <= tile_x_last; tile_x++) {
-      int tile_num = tiles[tile_x].back;
-      if (tile_num != 0xffff) {
-        drawSprite(game_map.tileset, x_pos, y_pos, tile_num, false);
+      bool in_map = (tile_x < game_map.width && tile_y < game_map.height);
+      int tile_num = (in_map) ? tiles[tile_x].back : 0xffff;
+      int fore_num = (in_map) ? tiles[tile_x].fore : 0xffff;
+      if (fore_num == 0xffff || getTileOpacity(fore_num) != SPRITE_OPACITY_OPAQUE) {
+        if (tile_num != 0xffff) {
+          drawSprite(game_map.tileset, x_pos, y_pos, tile_num, false);
+        } else {
+          int first_y = (y_pos < 0) ? 0 : y_pos;
+          int last_y = (y_pos + TILE_HEIGHT < target_h) ? y_pos + TILE_HEIGHT : target_h;
+          for (int ty = first_y; ty < last_y; ty++) {
+            fillImageLine((unsigned int *) target_lines[ty], x_pos, TILE_WIDTH, black);
+          }
+        }
       }
       x_pos += TILE_WIDTH;
     }
     y_pos += TILE_HEIGHT;
   }
+}
+
+// render the background of the world area (x,y)-(x+w,y+h) to the
+// background cache; x and w must be multiples of 4
+void GameScreen::renderBackgroundCacheArea(int x, int y, int w, int h) {
+  if (w <= 0 || h <= 0) return;
+
+  int cache_x = x % bg_cache_w;
+  if (cache_x + w > bg_cache_w) {
+    // split at the ring buffer edge
+    int w1 = bg_cache_w - cache_x;
+    renderBackgroundCacheArea(x, y, w1, h);
+    renderBackgroundCacheArea(x + w1, y, w - w1, h);
+    return;
+  }
+
+  for (int i = 0; i < h; i++) {
+    bg_strip_lines[i] = bg_cache_lines[(y+i) % bg_cache_h] + cache_x;
+  }
+  setDrawTarget(bg_strip_lines, w, h);
+  renderBackground(x, y, w, h);
+}
+
+// update the background cache for the current screen position,
+// rendering only the newly exposed areas
+void GameScreen::updateBackgroundCache() {
+  int x = screen_x & ~3;
+  int y = screen_y;
+
+  if (! bg_cache_valid || abs(x - bg_cache_x) >= bg_cache_w || abs(y - bg_cache_y) >= bg_cache_h) {
+    renderBackgroundCacheArea(x, y, bg_cache_w, bg_cache_h);
+    bg_cache_misses++;
+  } else {
+    // newly exposed columns (only for lines that were already cached)
+    int first_y = (y > bg_cache_y) ? y : bg_cache_y;
+    int last_y = ((y < bg_cache_y) ? y : bg_cache_y) + bg_cache_h;
+    if (x > bg_cache_x) {
+      renderBackgroundCacheArea(bg_cache_x + bg_cache_w, first_y, x - bg_cache_x, last_y - first_y);
+    } else if (x < bg_cache_x) {
+      renderBackgroundCacheArea(x, first_y, bg_cache_x - x, last_y - first_y);
+    }
+
+    // newly exposed lines
+    if (y > bg_cache_y) {
+      renderBackgroundCacheArea(x, bg_cache_y + bg_cache_h, bg_cache_w, y - bg_cache_y);
+    } else if (y < bg_cache_y) {
+      renderBackgroundCacheArea(x, y, bg_cache_w, bg_cache_y - y);
+    }
+    bg_cache_hits++;
+  }
+
+  bg_cache_x = x;
+  bg_cache_y = y;
+  bg_cache_valid = true;
+}
+
+// copy screen lines [y, y+h) of the background cache to the drawing
+// target (the screen)
+void GameScreen::copyBackgroundCache(int y, int h) {
+  // the screen's first pixel is at cache_x in the cache: the cache lines
+  // are drawn in 2 parts (before and after the ring buffer edge), the first
+  // one at x <= 0 so it starts at the cache block containing cache_x
+  int cache_x = screen_x % bg_cache_w;
+  int w1 = bg_cache_w - cache_x;
+  if (w1 > screen_w) w1 = screen_w;
+  for (int i = 0; i < h; i++) {
+    unsigned int *line = (unsigned int *) target_lines[i];
+    const unsigned int *cache_line = (const unsigned int *) bg_cache_lines[(screen_y + y + i) % bg_cache_h];
+    drawImageLine(line, -(cache_x%4), cache_line + cache_x/4, w1 + cache_x%4, false);
+    if (w1 < screen_w) {
+      drawImageLine(line, w1, cache_line, screen_w - w1, false);
+    }
+  }
+}
+
+// render screen lines [y, y+h) to the framebuffer (the screen position
+// and the background cache must be already updated for the frame);
+// the words written for each layer are added to words[]
+void GameScreen::renderScreenLines(int y, int h, unsigned int *words) {
+  // background
+  words_written = 0;
+  setDrawTarget(&vga_get_framebuffer()[y], screen_w, h);
+  if (bg_cache_lines) {
+    copyBackgroundCache(y, h);
+  } else {
+    renderBackground(screen_x, screen_y + y, screen_w, h);
+  }
+  words[0] += words_written;
 
   // sprites
+  words_written = 0;
   for (int i = 0; i < GAME_NUM_SPRITES; i++) {
     if (! game_sprites[i].def) continue;
     int spr_x = game_sprites[i].x - screen_x;
-    int spr_y = game_sprites[i].y - screen_y;
-    if (spr_x <= -game_sprites[i].def->width) continue;
-    if (spr_y <= -game_sprites[i].def->height) continue;
-    if (spr_x >= screen_w || spr_y >= screen_h) continue;
-    drawSprite(game_sprites[i].def, spr_x, spr_y, game_sprites[i].frame, true);
+    int spr_y = game_sprites[i].y - screen_y - y;
+    if (! isSpriteVisible(game_sprites[i].def, spr_x, spr_y, game_sprites[i].frame, game_sprites[i].flip)) continue;
+    drawSprite(game_sprites[i].def, spr_x, spr_y, game_sprites[i].frame, true, game_sprites[i].flip, game_sprites[i].remap);
   }
+  words[1] += words_written;
 
   // foreground
-  y_pos = y_pos_start;
+  words_written = 0;
+  renderForeground(y, h);
+  words[2] += words_written;
+}
+
+// render the foreground tiles of screen lines [y, y+h) to the drawing
+// target (opaque tiles don't need the transparent drawing path)
+void GameScreen::renderForeground(int y, int h) {
+  int tile_x_first = screen_x/TILE_WIDTH;
+  int tile_x_last = (screen_x+screen_w)/TILE_WIDTH;
+  int tile_y_first = (screen_y+y)/TILE_HEIGHT;
+  int tile_y_last = (screen_y+y+h)/TILE_HEIGHT;
+
+  int x_pos_start = -(screen_x%TILE_WIDTH);
+  int y_pos = -((screen_y+y)%TILE_HEIGHT);
   for (int tile_y = tile_y_first; tile_y <= tile_y_last; tile_y++) {
     int x_pos = x_pos_start;
     const MAP_TILE *tiles = &game_map.tiles[tile_y*game_map.width];
     for (int tile_x = tile_x_first; tile_x <= tile_x_last; tile_x++) {
       int tile_num = tiles[tile_x].fore;
       if (tile_num != 0xffff) {
-        drawSprite(game_map.tileset, x_pos, y_pos, tile_num, true);
+        switch (getTileOpacity(tile_num)) {
+        case SPRITE_OPACITY_EMPTY: break;
+        case SPRITE_OPACITY_OPAQUE: drawSprite(game_map.tileset, x_pos, y_pos, tile_num, false); break;
+        default: drawSprite(game_map.tileset, x_pos, y_pos, tile_num, true); break;
+        }
       }
       x_pos += TILE_WIDTH;
     }
@@ -502,26 +1522,547 @@ void GameScreen::renderScreen() {
   }
 }
 
-void GameScreen::renderDebugInfo(FONT_INFO &fi, int cur_millis) {
-  int fps = fpsCounter(cur_millis);
-  last_millis = cur_millis;
+void GameScreen::renderScreen() {
+  setScreenPos();
+  if (bg_cache_lines) {
+    updateBackgroundCache();
+  }
+  unsigned int words[3] = { 0, 0, 0 };
+  renderScreenLines(0, screen_h, words);
+  memcpy(layer_words, words, sizeof(layer_words));
+}
 
-  if ((! net->is_running()) && (joy->cur & JOY_BTN_E)) {
-    net->init();
+// Render the screen band by band to the single framebuffer, each band
+// right after the beam has sent it to the monitor, so it's ready before
+// the beam gets back to it in the next frame. If it's not, the band is
+// displayed torn (part old frame, part new frame).
+void GameScreen::renderScreenBeam(int fps) {
+  // start at the frame being displayed, but never before the frame
+  // rendered last time has been displayed
+  unsigned int count = vga_get_beam_band_count();
+  unsigned int base = count - count % beam_bands;
+  if ((int) (base - beam_next_base) < 0) base = beam_next_base;
+  beam_next_base = base + beam_bands;
+
+  setScreenPos();
+  if (bg_cache_lines) {
+    updateBackgroundCache();
+  }
+  // (the debug info drawn with the bands shows the stats of the last frame)
+  unsigned int words[3] = { 0, 0, 0 };
+  unsigned int micros_sum = 0;
+  bool torn = false;
+  for (int band = 0; band < beam_bands; band++) {
+    vga_wait_beam_band(base + band + 1);
+    unsigned long start_micros = micros();
+    int y0 = vga_get_beam_band_line(band);
+    int y1 = vga_get_beam_band_line(band+1);
+    renderScreenLines(y0, y1 - y0, words);
+
+    // draw the debug info lines of this band (the text is clipped at the
+    // end of the band, and the lines above it already have the same text)
+    if (! hud_lines && (y0 < DEBUG_INFO_TOP_LINES || y1 > screen_h - DEBUG_INFO_BOTTOM_LINES)) {
+      FONT_INFO fi = { screen_w, y1, sync_bits, vga_get_framebuffer(), &font6x8 };
+      drawDebugInfo(fi, fps);
+    }
+    micros_sum += micros() - start_micros;
+
+    // the beam gets back to this band after the previous band of the next frame is sent
+    if ((int) (vga_get_beam_band_count() - (base + beam_bands + band)) >= 0) {
+      torn = true;
+    }
+  }
+  memcpy(layer_words, words, sizeof(layer_words));
+  render_micros = micros_sum;
+  render_micros_phase[screen_x%4] = render_micros;
+  checkBeamTears(torn);
+}
+
+// Count torn frames, and switch to double buffering if too many frames
+// in the last tear window were torn (and there's enough memory)
+void GameScreen::checkBeamTears(bool torn) {
+  if (torn) {
+    beam_torn_frames++;
+    beam_window_torn++;
+  }
+  if (++beam_window_frames < BEAM_TEAR_WINDOW) return;
+  if (beam_window_torn > BEAM_MAX_TORN_FRAMES) {
+    if (vga_add_framebuffer()) {
+      printf("Beam racing: %u of %u frames torn, switching to double buffering\n", beam_window_torn, beam_window_frames);
+      beam_bands = 0;
+    } else {
+      printf("Beam racing: %u of %u frames torn, not enough memory for double buffering\n", beam_window_torn, beam_window_frames);
+    }
+  }
+  beam_window_frames = 0;
+  beam_window_torn = 0;
+}
+
+// Line buffer mode: prepare to render a new frame (called by the VGA
+// task before line 0 while show() waits for it, so it's safe to read
+// the game state). The sprites are listed here once for the frame,
+// with a mask of the sprites in each screen line, and their compressed
+// frames are decompressed here (followed by the visible tiles, while
+// there's room in the cache), so rendering the lines doesn't have to.
+void GameScreen::startLineFrame() {
+  memcpy(layer_words, line_words, sizeof(layer_words));
+  memset(line_words, 0, sizeof(line_words));
+  render_micros = line_micros;
+  render_micros_phase[screen_x%4] = line_micros;
+  line_max_micros = line_micros_max;
+  line_micros = line_micros_max = 0;
+
+  applyBackgroundRenderMode();
+  setScreenPos();
+  if (bg_cache_lines) {
+    updateBackgroundCache();
+  }
+
+  game_unlock_images();
+  if (! line_sprite_mask) {
+    lockLineFrameTiles();
+    return;
+  }
+  memset(line_sprite_mask, 0, screen_h * sizeof(unsigned int));
+  setDrawTarget(line_target, screen_w, screen_h);  // for isSpriteVisible()
+  for (int i = 0; i < GAME_NUM_SPRITES; i++) {
+    line_sprites[i].def = nullptr;
+    const SPRITE_DEF *def = game_sprites[i].def;
+    if (! def) continue;
+    int spr_x = game_sprites[i].x - screen_x;
+    int spr_y = game_sprites[i].y - screen_y;
+    int frame = game_sprites[i].frame;
+    bool flip = game_sprites[i].flip;
+    if (! isSpriteVisible(def, spr_x, spr_y, frame, flip)) continue;
+    line_sprites[i].def = def;
+    line_sprites[i].x = spr_x;
+    line_sprites[i].y = spr_y;
+    line_sprites[i].frame = frame;
+    line_sprites[i].flip = flip;
+    line_sprites[i].remap = game_sprites[i].remap;
+    game_lock_image(def, frame, getSpriteImageShift(def, spr_x, flip));
+
+    int top = spr_y, bottom = spr_y + def->height;
+    if (def->bbox) {
+      top = spr_y + BBOX_TOP(&def->bbox[4*frame]);
+      bottom = spr_y + BBOX_BOTTOM(&def->bbox[4*frame]) + 1;
+    }
+    if (top < 0) top = 0;
+    if (bottom > screen_h) bottom = screen_h;
+    for (int y = top; y < bottom; y++) {
+      line_sprite_mask[y] |= 1u << i;
+    }
+  }
+  lockLineFrameTiles();
+}
+
+// Line buffer mode: decompress the visible foreground tiles of the
+// frame, and the background tiles if they're not in the background
+// cache (the tiles that don't fit in the cache are decompressed when
+// their lines are rendered)
+void GameScreen::lockLineFrameTiles() {
+  const SPRITE_DEF *tileset = game_map.tileset;
+  int tile_x_last = (screen_x+screen_w)/TILE_WIDTH;
+  int tile_y_last = (screen_y+screen_h-1)/TILE_HEIGHT;
+  for (int tile_y = screen_y/TILE_HEIGHT; tile_y <= tile_y_last && tile_y < game_map.height; tile_y++) {
+    const MAP_TILE *tiles = &game_map.tiles[tile_y*game_map.width];
+    for (int tile_x = screen_x/TILE_WIDTH; tile_x <= tile_x_last && tile_x < game_map.width; tile_x++) {
+      int fore_num = tiles[tile_x].fore;
+      int back_num = tiles[tile_x].back;
+      int fore_opacity = (fore_num != 0xffff) ? getTileOpacity(fore_num) : SPRITE_OPACITY_EMPTY;
+      if (fore_opacity != SPRITE_OPACITY_EMPTY && ! game_lock_image(tileset, fore_num, 0)) return;
+      if (! bg_cache_lines && back_num != 0xffff && fore_opacity != SPRITE_OPACITY_OPAQUE &&
+          ! game_lock_image(tileset, back_num, 0)) return;
+    }
+  }
+}
+
+// Line buffer mode: render screen line y (called by the VGA task just
+// before the line is displayed)
+void GameScreen::renderLine(int y, unsigned char *line) {
+  unsigned long start_micros = micros();
+  line_target[0] = line;
+  setDrawTarget(line_target, screen_w, 1);
+
+  // background
+  words_written = 0;
+  if (bg_cache_lines) {
+    copyBackgroundCache(y, 1);
+  } else {
+    renderBackground(screen_x, screen_y + y, screen_w, 1);
   }
+  line_words[0] += words_written;
+
+  // sprites
+  words_written = 0;
+  if (line_sprite_mask) {
+    for (unsigned int mask = line_sprite_mask[y]; mask != 0; mask &= mask - 1) {
+      const LINE_SPRITE &spr = line_sprites[__builtin_ctz(mask)];
+      drawSprite(spr.def, spr.x, spr.y - y, spr.frame, true, spr.flip, spr.remap);
+    }
+  }
+  line_words[1] += words_written;
+
+  // foreground
+  words_written = 0;
+  renderForeground(y, 1);
+  line_words[2] += words_written;
+
+  unsigned int t = micros() - start_micros;
+  line_micros += t;
+  if (line_micros_max < t) line_micros_max = t;
+}
+
+// Tile mode: allocate the tile cache and overlay lines in DMA memory
+bool GameScreen::allocTileMode() {
+  int tile_size = 4 * game_map.tileset->stride * TILE_HEIGHT;
+  for (int i = 0; i < TILE_CACHE_SLOTS; i++) {
+    tile_cache[i].data = (unsigned char *) vga_alloc_dma(tile_size);
+    if (! tile_cache[i].data) return false;
+    tile_cache[i].tile = -1;
+    tile_cache[i].last_frame = 0;
+  }
+  for (int i = 0; i < 2; i++) {
+    tile_overlay_pool[i] = (unsigned char *) vga_alloc_dma(TILE_OVERLAY_LINES * TILE_WIDTH);
+    if (! tile_overlay_pool[i]) return false;
+  }
+  tile_black_row = (unsigned char *) vga_alloc_dma(TILE_WIDTH);
+  if (! tile_black_row) return false;
+  memset(tile_black_row, sync_bits, TILE_WIDTH);
+  tile_frame = 2;
+  memset(&tile_stats, 0, sizeof(tile_stats));
+  return true;
+}
+
+// Tile mode: return the tile data in the cache, copying it from flash
+// if necessary, or nullptr if there's no free slot (the tiles used in
+// the current frame and in the frame being displayed can't be replaced)
+const unsigned char *GameScreen::getCachedTile(int tile_num) {
+  TILE_CACHE_SLOT *free_slot = nullptr;
+  for (int i = 0; i < TILE_CACHE_SLOTS; i++) {
+    TILE_CACHE_SLOT &slot = tile_cache[i];
+    if (slot.tile == tile_num) {
+      slot.last_frame = tile_frame;
+      return slot.data;
+    }
+    if (slot.last_frame + 1 < tile_frame && (! free_slot || free_slot->last_frame > slot.last_frame)) {
+      free_slot = &slot;
+    }
+  }
+  if (! free_slot) return nullptr;
+
+  // the tile rows are sent directly by the DMA, so the sync bits are added here
+  const SPRITE_DEF *tileset = game_map.tileset;
+  const unsigned int *src = getImageLines(tileset, tile_num, 0, 0, TILE_HEIGHT, false, nullptr);
+  unsigned int *dest = (unsigned int *) free_slot->data;
+  unsigned int sb = BLIT_SYNC_WORD;
+  int num_words = tileset->stride * TILE_HEIGHT;
+  for (int i = 0; i < num_words; i++) {
+    dest[i] = src[i] | sb;
+  }
+  free_slot->tile = tile_num;
+  free_slot->last_frame = tile_frame;
+  tile_stats.cache_misses++;
+  return free_slot->data;
+}
+
+// Tile mode: display tile lines [top, bottom) of the cell from overlay
+// lines, limited to the tile and to the visible lines [vis_top, vis_bottom)
+void GameScreen::addTileOverlayLines(TILE_CELL &cell, int top, int bottom, int vis_top, int vis_bottom) {
+  if (top < vis_top) top = vis_top;
+  if (top < 0) top = 0;
+  if (bottom > vis_bottom) bottom = vis_bottom;
+  if (bottom > TILE_HEIGHT) bottom = TILE_HEIGHT;
+  if (top >= bottom) return;
+  if (cell.top > top) cell.top = top;
+  if (cell.bottom < bottom) cell.bottom = bottom;
+}
+
+// Tile mode: draw the overlay lines of a cell whose tile is at screen
+// position (x,y): the base tile, the sprites over it and the
+// transparent foreground tile, in the same order as renderScreen()
+void GameScreen::renderTileOverlay(TILE_CELL &cell, int x, int y) {
+  int x0 = (x < 0) ? 0 : x;
+  int x1 = (x + TILE_WIDTH < screen_w) ? x + TILE_WIDTH : screen_w;
+  int height = cell.bottom - cell.top;
+  for (int i = 0; i < height; i++) {
+    tile_overlay_target[i] = cell.overlay + i*TILE_WIDTH;
+  }
+  setDrawTarget(tile_overlay_target, x1 - x0, height);
+
+  int tile_x = x - x0;
+  int tile_y = -cell.top;
+  if (cell.base_tile != 0xffff) {
+    drawSprite(game_map.tileset, tile_x, tile_y, cell.base_tile, false);
+  } else {
+    for (int i = 0; i < height; i++) {
+      memset(tile_overlay_target[i], sync_bits, x1 - x0);
+    }
+  }
+  for (unsigned int mask = cell.sprite_mask; mask != 0; mask &= mask - 1) {
+    const LINE_SPRITE &spr = tile_sprites[__builtin_ctz(mask)];
+    drawSprite(spr.def, spr.x - x0, spr.y - (y + cell.top), spr.frame, true, spr.flip, spr.remap);
+  }
+  if (cell.fore_tile != 0xffff) {
+    drawSprite(game_map.tileset, tile_x, tile_y, cell.fore_tile, true);
+  }
+}
+
+// Tile mode: compose the frame in the VGA segment list. Each line has
+// one segment per visible tile column, pointing to the tile row in the
+// cache or (where sprites or transparent foreground are drawn over the
+// tile) to an overlay line. The screen x position is rounded down to a
+// multiple of 4, since segments must start at a 4-byte boundary.
+void GameScreen::composeTileFrame() {
+  setScreenPos();
+  screen_x &= ~3;
+  tile_frame++;
+  bool overflow = false;
+
+  int tile_row_bytes = 4 * game_map.tileset->stride;
+  int tile_x_first = screen_x/TILE_WIDTH;
+  int tile_y_first = screen_y/TILE_HEIGHT;
+  int num_cols = (screen_x+screen_w-1)/TILE_WIDTH - tile_x_first + 1;
+  int num_rows = (screen_y+screen_h-1)/TILE_HEIGHT - tile_y_first + 1;
+  if (num_cols > TILE_MODE_COLS) num_cols = TILE_MODE_COLS;
+  if (num_rows > TILE_MODE_ROWS) num_rows = TILE_MODE_ROWS;
+
+  // tiles: tiles not in the cache must be drawn in overlay lines
+  for (int r = 0; r < num_rows; r++) {
+    int tile_y = tile_y_first + r;
+    int vis_top = screen_y - tile_y*TILE_HEIGHT;
+    int vis_bottom = screen_y + screen_h - tile_y*TILE_HEIGHT;
+    const MAP_TILE *tiles = &game_map.tiles[tile_y*game_map.width];
+    for (int c = 0; c < num_cols; c++) {
+      TILE_CELL &cell = tile_cells[r][c];
+      int back_num = tiles[tile_x_first + c].back;
+      int fore_num = tiles[tile_x_first + c].fore;
+      int fore_opacity = (fore_num != 0xffff) ? getTileOpacity(fore_num) : SPRITE_OPACITY_EMPTY;
+      cell.covered = (fore_opacity == SPRITE_OPACITY_OPAQUE);
+      cell.base_tile = (cell.covered) ? fore_num : back_num;
+      cell.fore_tile = (fore_opacity == SPRITE_OPACITY_MIXED) ? fore_num : 0xffff;
+      cell.src = (cell.base_tile != 0xffff) ? getCachedTile(cell.base_tile) : nullptr;
+      cell.sprite_mask = 0;
+      cell.top = TILE_HEIGHT;
+      cell.bottom = 0;
+      if (cell.base_tile != 0xffff && ! cell.src) {
+        addTileOverlayLines(cell, 0, TILE_HEIGHT, vis_top, vis_bottom);
+      }
+      if (cell.fore_tile != 0xffff) {
+        const unsigned char *bbox = (game_map.tileset->bbox) ? &game_map.tileset->bbox[4*cell.fore_tile] : nullptr;
+        if (bbox && BBOX_EMPTY(bbox)) {
+          cell.fore_tile = 0xffff;
+        } else if (bbox) {
+          addTileOverlayLines(cell, BBOX_TOP(bbox), BBOX_BOTTOM(bbox) + 1, vis_top, vis_bottom);
+        } else {
+          addTileOverlayLines(cell, 0, TILE_HEIGHT, vis_top, vis_bottom);
+        }
+      }
+    }
+  }
+
+  // sprites: add the lines of each visible sprite to the overlay of the
+  // cells it touches (except the ones covered by the foreground)
+  setDrawTarget(tile_overlay_target, screen_w, screen_h);  // for isSpriteVisible()
+  for (int i = 0; i < GAME_NUM_SPRITES; i++) {
+    tile_sprites[i].def = nullptr;
+    const SPRITE_DEF *def = game_sprites[i].def;
+    if (! def) continue;
+    int spr_x = game_sprites[i].x - screen_x;
+    int spr_y = game_sprites[i].y - screen_y;
+    int frame = game_sprites[i].frame;
+    bool flip = game_sprites[i].flip;
+    if (! isSpriteVisible(def, spr_x, spr_y, frame, flip)) continue;
+    tile_sprites[i].def = def;
+    tile_sprites[i].x = spr_x;
+    tile_sprites[i].y = spr_y;
+    tile_sprites[i].frame = frame;
+    tile_sprites[i].flip = flip;
+    tile_sprites[i].remap = game_sprites[i].remap;
+
+    int x0 = spr_x, y0 = spr_y, x1 = spr_x + def->width, y1 = spr_y + def->height;
+    if (def->bbox) {
+      const unsigned char *bbox = &def->bbox[4*frame];
+      x0 = spr_x + 4*((flip) ? BBOX_MIRRORED_LEFT(bbox, def->width) : BBOX_LEFT(bbox));
+      x1 = spr_x + 4*((flip) ? BBOX_MIRRORED_RIGHT(bbox, def->width) : BBOX_RIGHT(bbox)) + 4;
+      y0 = spr_y + BBOX_TOP(bbox);
+      y1 = spr_y + BBOX_BOTTOM(bbox) + 1;
+    }
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > screen_w) x1 = screen_w;
+    if (y1 > screen_h) y1 = screen_h;
+    for (int r = (screen_y+y0)/TILE_HEIGHT - tile_y_first; r <= (screen_y+y1-1)/TILE_HEIGHT - tile_y_first; r++) {
+      int tile_y = (tile_y_first + r) * TILE_HEIGHT - screen_y;
+      for (int c = (screen_x+x0)/TILE_WIDTH - tile_x_first; c <= (screen_x+x1-1)/TILE_WIDTH - tile_x_first; c++) {
+        TILE_CELL &cell = tile_cells[r][c];
+        if (cell.covered) continue;
+        cell.sprite_mask |= 1u << i;
+        addTileOverlayLines(cell, y0 - tile_y, y1 - tile_y, -tile_y, screen_h - tile_y);
+      }
+    }
+  }
+
+  // overlays: allocate and draw the overlay lines of each cell
+  unsigned char *pool = tile_overlay_pool[tile_frame % 2];
+  int pool_used = 0;
+  for (int r = 0; r < num_rows; r++) {
+    for (int c = 0; c < num_cols; c++) {
+      TILE_CELL &cell = tile_cells[r][c];
+      cell.overlay = nullptr;
+      if (cell.top >= cell.bottom) continue;
+      if (pool_used + cell.bottom - cell.top > TILE_OVERLAY_LINES) {
+        overflow = true;
+        cell.top = cell.bottom = 0;
+        continue;
+      }
+      cell.overlay = pool + pool_used*TILE_WIDTH;
+      pool_used += cell.bottom - cell.top;
+      renderTileOverlay(cell, (tile_x_first + c)*TILE_WIDTH - screen_x, (tile_y_first + r)*TILE_HEIGHT - screen_y);
+    }
+  }
+  tile_stats.overlay_lines = pool_used;
+  if (tile_stats.max_overlay_lines < (unsigned int) pool_used) tile_stats.max_overlay_lines = pool_used;
+  if (overflow) tile_stats.overflow_frames++;
+
+  // split the columns in pieces so each line has exactly TILE_MODE_COLS
+  // segments, splitting the longest piece in two while there are too few
+  int piece_col[TILE_MODE_COLS];
+  int piece_start[TILE_MODE_COLS];   // position of the piece in the tile
+  int piece_len[TILE_MODE_COLS];
+  int num_pieces = num_cols;
+  for (int c = 0; c < num_cols; c++) {
+    int x0 = (tile_x_first + c)*TILE_WIDTH - screen_x;
+    int x1 = x0 + TILE_WIDTH;
+    piece_col[c] = c;
+    piece_start[c] = (x0 < 0) ? -x0 : 0;
+    piece_len[c] = ((x1 < screen_w) ? x1 : screen_w) - ((x0 < 0) ? 0 : x0);
+  }
+  while (num_pieces < TILE_MODE_COLS) {
+    int p = 0;
+    for (int i = 1; i < num_pieces; i++) {
+      if (piece_len[p] < piece_len[i]) p = i;
+    }
+    for (int i = num_pieces; i > p + 1; i--) {
+      piece_col[i] = piece_col[i-1];
+      piece_start[i] = piece_start[i-1];
+      piece_len[i] = piece_len[i-1];
+    }
+    int len = (piece_len[p] / 2) & ~3;
+    piece_col[p+1] = piece_col[p];
+    piece_start[p+1] = piece_start[p] + len;
+    piece_len[p+1] = piece_len[p] - len;
+    piece_len[p] = len;
+    num_pieces++;
+  }
+
+  // segments of each line (the overlay lines start at the first visible
+  // pixel of the tile, the black row is as wide as a tile)
+  VgaSegment *seg = vga_get_segments();
+  for (int y = 0; y < screen_h; y++) {
+    int r = (screen_y+y)/TILE_HEIGHT - tile_y_first;
+    int tile_line = (screen_y+y) % TILE_HEIGHT;
+    for (int p = 0; p < num_pieces; p++) {
+      const TILE_CELL &cell = tile_cells[r][piece_col[p]];
+      const unsigned char *buf;
+      if (tile_line >= cell.top && tile_line < cell.bottom) {
+        int first_x = ((tile_x_first + piece_col[p])*TILE_WIDTH < screen_x) ? screen_x % TILE_WIDTH : 0;
+        buf = cell.overlay + (tile_line - cell.top)*TILE_WIDTH + piece_start[p] - first_x;
+      } else if (cell.src) {
+        buf = cell.src + tile_line*tile_row_bytes + piece_start[p];
+      } else {
+        buf = tile_black_row + piece_start[p];
+      }
+      seg->buf = (uint8_t *) buf;
+      seg->len = piece_len[p];
+      seg++;
+    }
+  }
+}
+
+// update the fps counter and handle the debug buttons; return the fps
+int GameScreen::updateDebugInfo(int cur_millis) {
+  int fps = fpsCounter(cur_millis);
+  last_millis = cur_millis;
 
   if (JOY_BTN_PRESSED(joy, JOY_BTN_F) && (frame_count-last_btn_press_frame > 5)) {
     debug_level++;
-    if (debug_level >= DEBUG_MAX_LEVEL-1) {
+    if (debug_level >= DEBUG_MAX_LEVEL) {
       debug_level = 0;
     }
     last_btn_press_frame = frame_count;
   }
-  
+
+  if (JOY_BTN_PRESSED(joy, JOY_BTN_A) && (frame_count-last_btn_press_frame > 5)) {
+    // in line buffer mode the VGA task reads the mode while rendering, so
+    // it's only requested here and changed by the next frame
+    bg_render_mode_next = (bg_render_mode_next + 1 < BG_RENDER_NUM_MODES) ? bg_render_mode_next + 1 : 0;
+    if (line_buffer_lines == 0) {
+      applyBackgroundRenderMode();
+    }
+    last_btn_press_frame = frame_count;
+  }
+  return fps;
+}
+
+// draw the debug info over the screen (it uses the top
+// DEBUG_INFO_TOP_LINES and the bottom DEBUG_INFO_BOTTOM_LINES lines)
+void GameScreen::drawDebugInfo(FONT_INFO &fi, int fps) {
   if (debug_level >= DEBUG_SHOW_FPS) {
     font_set_cursor(10, 10);
     font_draw(fi, 0x3f, fps);
     font_draw(fi, 0x3f, " fps");
+    if (vga_get_num_framebuffers() > 2) {
+      font_draw(fi, 0x3f, " queued ");
+      font_draw(fi, 0x3f, vga_get_queued_frames());
+      font_draw(fi, 0x3f, " dropped ");
+      font_draw(fi, 0x3f, vga_get_dropped_frames());
+    }
+    if (beam_bands > 0) {
+      font_draw(fi, 0x3f, " tears ");
+      font_draw(fi, 0x3f, beam_torn_frames);
+    }
+  }
+
+  if (debug_level >= DEBUG_SHOW_FRAMETIME) {
+    font_set_cursor(10, 20);
+    font_draw(fi, 0x3f, render_micros);
+    font_draw(fi, 0x3f, (bg_render_mode == BG_RENDER_LINES) ? " us lines " : " us tiles ");
+    for (int i = 0; i < 4; i++) {
+      if (i > 0) font_draw(fi, 0x3f, "/");
+      font_draw(fi, 0x3f, render_micros_phase[i]);
+    }
+    font_draw(fi, 0x3f, " vsync ");
+    font_draw(fi, 0x3f, vga_get_swap_latency());
+  }
+
+  if (debug_level >= DEBUG_SHOW_LAYER_WRITES) {
+    font_set_cursor(10, 30);
+    font_draw(fi, 0x3f, "b ");
+    font_draw(fi, 0x3f, layer_words[0]);
+    font_draw(fi, 0x3f, " s ");
+    font_draw(fi, 0x3f, layer_words[1]);
+    font_draw(fi, 0x3f, " f ");
+    font_draw(fi, 0x3f, layer_words[2]);
+  }
+
+  if (debug_level >= DEBUG_SHOW_CACHES) {
+    font_set_cursor(10, 40);
+    if (bg_cache_lines) {
+      font_draw(fi, 0x3f, "cache ");
+      font_draw(fi, 0x3f, bg_cache_hits);
+      font_draw(fi, 0x3f, ":");
+      font_draw(fi, 0x3f, bg_cache_misses);
+      font_draw(fi, 0x3f, " ");
+    }
+    if (game_image_cache_stats.num_slots > 0) {
+      font_draw(fi, 0x3f, "images ");
+      font_draw(fi, 0x3f, game_image_cache_stats.hits);
+      font_draw(fi, 0x3f, ":");
+      font_draw(fi, 0x3f, game_image_cache_stats.misses);
+      font_draw(fi, 0x3f, ":");
+      font_draw(fi, 0x3f, game_image_cache_stats.evictions);
+    }
   }
 
   if (debug_level >= DEBUG_SHOW_POSITION) {
@@ -568,22 +2109,173 @@ void GameScreen::renderDebugInfo(FONT_INFO &fi, int cur_millis) {
   }
 }
 
+void GameScreen::renderDebugInfo(FONT_INFO &fi, int cur_millis) {
+  int fps = updateDebugInfo(cur_millis);
+  if (hud_lines) {
+    renderHud(fps);
+  } else {
+    drawDebugInfo(fi, fps);
+  }
+}
+
+static void append_text(char *text, const char *fmt, ...) {
+  int len = strlen(text);
+  va_list ap;
+  va_start(ap, fmt);
+  vsnprintf(text + len, HUD_TEXT_LEN - len, fmt, ap);
+  va_end(ap);
+}
+
+// Draw the debug info in the HUD lines. The HUD is not part of the
+// framebuffer, so each text row is only redrawn when its text changes.
+void GameScreen::renderHud(int fps) {
+  int num_top = hud_top / HUD_ROW_HEIGHT;
+  int num_bottom = hud_bottom / HUD_ROW_HEIGHT;
+  if (num_top > HUD_MAX_ROWS) num_top = HUD_MAX_ROWS;
+  if (num_bottom > HUD_MAX_ROWS - num_top) num_bottom = HUD_MAX_ROWS - num_top;
+  char text[HUD_MAX_ROWS][HUD_TEXT_LEN];
+  for (int i = 0; i < HUD_MAX_ROWS; i++) {
+    text[i][0] = '\0';
+  }
+
+  // top rows
+  int row = 0;
+  if (debug_level >= DEBUG_SHOW_FPS && row < num_top) {
+    append_text(text[row], "%d fps", fps);
+    if (vga_get_num_framebuffers() > 2) {
+      append_text(text[row], " queued %u dropped %u", vga_get_queued_frames(), vga_get_dropped_frames());
+    }
+    if (beam_bands > 0) {
+      append_text(text[row], " tears %u", beam_torn_frames);
+    }
+    if (debug_level >= DEBUG_SHOW_POSITION) {
+      append_text(text[row], "  x %d y %d", game_sprites[0].x, game_sprites[0].y);
+      if (net->is_running()) {
+        append_text(text[row], "  x %d y %d", game_sprites[1].x, game_sprites[1].y);
+      }
+    }
+    row++;
+  }
+  if (debug_level >= DEBUG_SHOW_FRAMETIME && row < num_top) {
+    append_text(text[row], "%u us %s %u/%u/%u/%u vsync %d", render_micros,
+                (bg_render_mode == BG_RENDER_LINES) ? "lines" : "tiles",
+                render_micros_phase[0], render_micros_phase[1], render_micros_phase[2], render_micros_phase[3],
+                vga_get_swap_latency());
+    row++;
+  }
+  if (debug_level >= DEBUG_SHOW_FRAMETIME && line_buffer_lines > 0 && row < num_top) {
+    append_text(text[row], "line max %u us late %u", line_max_micros, vga_get_late_lines());
+    row++;
+  }
+  if (debug_level >= DEBUG_SHOW_FRAMETIME && tile_mode && row < num_top) {
+    append_text(text[row], "overlay %u max %u miss %u over %u", tile_stats.overlay_lines,
+                tile_stats.max_overlay_lines, tile_stats.cache_misses, tile_stats.overflow_frames);
+    row++;
+  }
+  if (debug_level >= DEBUG_SHOW_LAYER_WRITES && row < num_top) {
+    append_text(text[row], "b %u s %u f %u", layer_words[0], layer_words[1], layer_words[2]);
+    row++;
+  }
+  if (debug_level >= DEBUG_SHOW_CACHES && (bg_cache_lines || game_image_cache_stats.num_slots > 0) && row < num_top) {
+    if (bg_cache_lines) {
+      append_text(text[row], "cache %u:%u ", bg_cache_hits, bg_cache_misses);
+    }
+    if (game_image_cache_stats.num_slots > 0) {
+      append_text(text[row], "images %u:%u:%u", game_image_cache_stats.hits,
+                  game_image_cache_stats.misses, game_image_cache_stats.evictions);
+    }
+    row++;
+  }
+
+  // bottom rows
+  row = num_top;
+  if (debug_level >= DEBUG_SHOW_NETWORK && row < num_top + num_bottom) {
+    if (net->is_running()) {
+      append_text(text[row], "Network enabled: %u:%u", net->get_num_tx_packets(), net->get_num_tx_errors());
+    } else {
+      append_text(text[row], "Network disabled");
+    }
+    row++;
+  }
+  if (debug_level >= DEBUG_SHOW_CONTROLLER && row < num_top + num_bottom) {
+    append_text(text[row], "Controller: %s ", joy->getName());
+    static const struct { unsigned int btn; char ch; } btns[] = {
+      { JOY_BTN_A, 'A' }, { JOY_BTN_B, 'B' }, { JOY_BTN_C, 'C' }, { JOY_BTN_D, 'D' }, { JOY_BTN_E, 'E' }, { JOY_BTN_F, 'F' },
+      { JOY_BTN_LEFT, '<' }, { JOY_BTN_RIGHT, '>' }, { JOY_BTN_UP, '^' }, { JOY_BTN_DOWN, 'v' },
+    };
+    for (unsigned int i = 0; i < sizeof(btns)/sizeof(*btns); i++) {
+      if (joy->cur & btns[i].btn) append_text(text[row], "%c", btns[i].ch);
+    }
+    row++;
+  }
+
+  // redraw changed rows
+  FONT_INFO fi = { screen_w, hud_top + hud_bottom, sync_bits, hud_lines, &font6x8 };
+  for (int i = 0; i < num_top + num_bottom; i++) {
+    if (strcmp(text[i], hud_text[i]) == 0) continue;
+    int y = (i < num_top) ? i*HUD_ROW_HEIGHT : hud_top + (i-num_top)*HUD_ROW_HEIGHT;
+    for (int j = 0; j < HUD_ROW_HEIGHT; j++) {
+      memset(hud_lines[y+j], sync_bits, screen_w);
+    }
+    font_draw(fi, 10, y+1, 0x3f, text[i]);
+    strcpy(hud_text[i], text[i]);
+  }
+}
+
 void GameScreen::clear(unsigned char color) {
   vga_clear_screen(color);
 }
 
 void GameScreen::show(int cur_millis) {
-  FONT_INFO fi = { screen_w, screen_h, sync_bits, vga_get_framebuffer(), &font6x8 };
+  updateNetwork();
+
+  if (line_buffer_lines > 0) {
+    // the screen is rendered line by line by the VGA task; the debug
+    // info can only be shown in the HUD
+    int fps = updateDebugInfo(cur_millis);
+    if (hud_lines) {
+      renderHud(fps);
+    }
+    frame_count++;
+    vga_swap_buffers();
+    return;
+  }
 
-  if (images_sbits_ok) {
-    renderScreen();
-  } else {
-    clear(0x30);
-    font_draw(fi, 10, 40, 0x3f, "Image data doesn't match");
-    font_draw(fi, 10, 50, 0x3f, "VGA mode sync bits");
-    font_draw(fi, 10, 60, 0x3f, (int) sync_bits);
+  if (tile_mode) {
+    // only the segment list is composed; like in line buffer mode, the
+    // debug info can only be shown in the HUD
+    int fps = updateDebugInfo(cur_millis);
+    if (tile_black_row) {
+      unsigned long start_micros = micros();
+      composeTileFrame();
+      render_micros = micros() - start_micros;
+      render_micros_phase[screen_x%4] = render_micros;
+    }
+    if (hud_lines) {
+      renderHud(fps);
+    }
+    frame_count++;
+    vga_swap_buffers();
+    return;
   }
 
+  if (beam_bands > 0) {
+    int fps = updateDebugInfo(cur_millis);
+    if (hud_lines) {
+      renderHud(fps);
+    }
+    renderScreenBeam(fps);
+    frame_count++;
+    return;
+  }
+
+  FONT_INFO fi = { screen_w, screen_h, sync_bits, vga_get_framebuffer(), &font6x8 };
+
+  unsigned long start_micros = micros();
+  renderScreen();
+  render_micros = micros() - start_micros;
+  render_micros_phase[screen_x%4] = render_micros;
+
   renderDebugInfo(fi, cur_millis);
   
   frame_count++;
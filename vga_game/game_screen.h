@@ -11,6 +11,93 @@
 #include "game_network.h"
 #include "game_joy.h"
 
+// background rendering modes
+enum {
+  BG_RENDER_TILES,   // tile by tile
+  BG_RENDER_LINES,   // line by line across all tiles
+  BG_RENDER_NUM_MODES
+};
+
+// HUD (heads-up display) text rows
+#define HUD_ROW_HEIGHT  10
+#define HUD_MAX_ROWS    8
+#define HUD_TEXT_LEN    56
+
+// sync bits added by the blitters to every word they store; line_sim
+// builds a copy of GameScreen with GAME_SCREEN_NO_SYNC_BITS, where
+// they're left out, to measure what adding them costs (-syncbits)
+#if GAME_SCREEN_NO_SYNC_BITS
+#define BLIT_SYNC_WORD  0u
+#else
+#define BLIT_SYNC_WORD  sync_word
+#endif
+
+// beam racing: fall back to double buffering if more than
+// BEAM_MAX_TORN_FRAMES of each BEAM_TEAR_WINDOW frames are torn
+#define BEAM_TEAR_WINDOW      60
+#define BEAM_MAX_TORN_FRAMES  6
+
+// tile mode: the screen lines are displayed directly from rows of the
+// tiles copied to a cache in DMA memory, with overlay lines only where
+// sprites or transparent foreground tiles are drawn over them
+#define TILE_MODE_COLS      6     // max. visible tile columns (screens up to 320 pixels wide at x%4 == 0)
+#define TILE_MODE_ROWS      5     // max. visible tile rows (screens up to 256 pixels high)
+#define TILE_CACHE_SLOTS    16    // tiles in the cache
+#define TILE_OVERLAY_LINES  512   // overlay lines (TILE_WIDTH pixels each) for each of the 2 frames
+
+// images with 4 bits per pixel: palettes with a lookup table for
+// expanding 2 pixels at a time
+#define PAL4_LUT_SLOTS      8
+
+#if GAME_NUM_SPRITES > 32
+#error line buffer and tile modes need one bit of an unsigned int for each sprite
+#endif
+
+// line buffer and tile modes: sprite drawn in the current frame
+struct LINE_SPRITE {
+  const SPRITE_DEF *def;
+  int x;                  // screen position
+  int y;
+  int frame;
+  bool flip;
+  const unsigned char *remap;
+};
+
+// tile mode: visible tile of the current frame
+struct TILE_CELL {
+  const unsigned char *src;  // tile in the cache (nullptr if black or not cached)
+  int base_tile;             // background (or opaque foreground) tile, 0xffff if black
+  int fore_tile;             // transparent foreground tile drawn over the sprites, or 0xffff
+  bool covered;              // covered by an opaque foreground tile (sprites are hidden)
+  unsigned int sprite_mask;  // bit i set if it has pixels of tile_sprites[i]
+  int top;                   // tile lines [top, bottom) are displayed from overlay lines
+  int bottom;
+  unsigned char *overlay;    // overlay line of tile line `top`
+};
+
+// tile mode: tile copied to the cache
+struct TILE_CACHE_SLOT {
+  unsigned char *data;
+  int tile;                  // tile number, -1 if unused
+  unsigned int last_frame;   // last frame using the tile
+};
+
+struct TILE_MODE_STATS {
+  unsigned int cache_misses;       // tiles copied to the cache
+  unsigned int overlay_lines;      // overlay lines used in the last frame
+  unsigned int max_overlay_lines;  // max. overlay lines used in a frame
+  unsigned int overflow_frames;    // frames with tiles or sprites missing for lack of cache slots or overlay lines
+};
+
+// lookup table from 2 pixels (4 bits each) to 2 color bytes for a palette
+// (with its colors remapped if remap is not nullptr)
+struct PAL4_LUT {
+  const unsigned char *palette;  // nullptr if unused
+  const unsigned char *remap;
+  unsigned int last_use;
+  unsigned short lut[256];
+};
+
 class GameScreen {
 private:
   int last_millis = 0;
@@ -19,47 +106,175 @@ private:
   unsigned int frame_count;
   unsigned int last_btn_press_frame;  // for debouncing buttons
   unsigned int debug_level;
-  bool images_sbits_ok = false;
+  unsigned int render_micros;
+  unsigned int render_micros_phase[4]; // last render time for each screen_x%4
+  unsigned int words_written;         // framebuffer words written, for measuring overdraw
+  unsigned int layer_words[3];        // words written for background, sprites and foreground
   unsigned char sync_bits;
+  unsigned int sync_word;             // sync bits repeated in the 4 bytes, added by the blitters to every word stored
   GameNetwork *net;
   GameJoy *joy;
+  int vga_num_fb;                     // number of framebuffers requested to the VGA code
+
+  // HUD lines outside the game screen (the debug info is drawn there if enabled)
+  int hud_top = 0;
+  int hud_bottom = 0;
+  unsigned char **hud_lines = nullptr;       // top HUD lines followed by bottom HUD lines
+  char hud_text[HUD_MAX_ROWS][HUD_TEXT_LEN];  // text currently drawn in each HUD row
+
+  // beam racing: render each band of the single framebuffer right after it's displayed
+  int beam_bands = 0;                        // 0 if beam racing is disabled
+  unsigned int beam_next_base;               // band count of the start of the next frame to render
+  unsigned int beam_torn_frames;             // frames with a band not finished before it was displayed
+  unsigned int beam_window_frames;           // frames rendered in the current tear window
+  unsigned int beam_window_torn;             // torn frames in the current tear window
+
+  // line buffer mode: each line is rendered by the VGA task just before it's displayed
+  int line_buffer_lines = 0;                 // 0 if line buffer mode is disabled
+  unsigned char *line_target[1];             // drawing target lines (the line being rendered)
+  LINE_SPRITE line_sprites[GAME_NUM_SPRITES];  // sprites of the current frame (def is nullptr if not visible)
+  unsigned int *line_sprite_mask = nullptr;  // for each screen line, bit i set if it has pixels of line_sprites[i]
+  unsigned int line_words[3];                // words written for each layer in the current frame
+  unsigned int line_micros;                  // render time of the current frame
+  unsigned int line_micros_max;              // worst line render time of the current frame
+  unsigned int line_max_micros;              // worst line render time of the last frame
+
+  // tile mode: the screen is composed of VGA segments pointing to tile rows and overlay lines
+  bool tile_mode = false;
+  unsigned int tile_frame;                   // frames composed since the start
+  TILE_CELL tile_cells[TILE_MODE_ROWS][TILE_MODE_COLS];
+  TILE_CACHE_SLOT tile_cache[TILE_CACHE_SLOTS];
+  LINE_SPRITE tile_sprites[GAME_NUM_SPRITES];  // sprites of the current frame (def is nullptr if not visible)
+  unsigned char *tile_overlay_pool[2] = { nullptr, nullptr };  // overlay lines of even and odd frames
+  unsigned char *tile_overlay_target[TILE_HEIGHT];  // drawing target lines (the overlay being rendered)
+  unsigned char *tile_black_row = nullptr;   // black tile row (in DMA memory)
+  TILE_MODE_STATS tile_stats;
 
   int screen_x;
   int screen_y;
   int screen_w;
   int screen_h;
+  int bg_render_mode = BG_RENDER_TILES;
+  int bg_render_mode_next = BG_RENDER_TILES;  // requested mode, applied when a frame starts
+  unsigned int bg_black_line[TILE_STRIDE];  // black tile line for drawing empty background tiles
+  const unsigned int *bg_tile_lines[16];     // tile lines for the line being rendered
+  unsigned int bg_tile_expanded[16][TILE_STRIDE];  // tile lines expanded from 4 bits per pixel
+
+  // frames stored with 4 bits per pixel or drawn mirrored are written to image_lines before drawing
+  unsigned int *image_lines = nullptr;       // room for all lines of the largest (pre-shifted) frame
+  unsigned int *image_line_tmp = nullptr;    // source line of a mirrored line
+  PAL4_LUT pal4_luts[PAL4_LUT_SLOTS] = {};
+  unsigned int pal4_lut_uses = 0;
+
+  unsigned int transp_key = SPRITE_TRANSPARENT_GREEN * 0x01010101u;  // transparent color of the sprite being drawn, repeated in the 4 bytes
+
+  // current drawing target (the framebuffer or part of the background cache)
+  unsigned char **target_lines;
+  int target_w;
+  int target_h;
+
+  // background cache: ring buffer holding the background of the world
+  // area starting at (bg_cache_x, bg_cache_y); world pixel (x,y) is
+  // stored at (x % bg_cache_w, y % bg_cache_h)
+  unsigned char **bg_cache_lines = nullptr;  // nullptr if the cache is disabled
+  unsigned char **bg_strip_lines = nullptr;  // lines of the cache area being rendered
+  int bg_cache_w;
+  int bg_cache_h;
+  int bg_cache_x;                            // always a multiple of 4
+  int bg_cache_y;
+  bool bg_cache_valid;
+  unsigned int bg_cache_hits;                // frames drawn from the cache
+  unsigned int bg_cache_misses;              // frames with the cache fully redrawn
   
 protected:
   
   int fpsCounter(int cur_millis);
+  int getNumFramebuffers(bool net_running);
+  void setupScreen();
+  void setVgaMode(bool net_running);
+  void updateNetwork();
 
   void drawImageLine0(unsigned int *screen, const unsigned int *image, int image_width);
   void drawImageLine1(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block);
   void drawImageLine2(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block);
   void drawImageLine3(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block);
   
+  bool allocImageLines();
+  const unsigned short *getPal4Lut(const unsigned char *palette, const unsigned char *remap);
+  void expandPal4Line(unsigned int *dest, const unsigned int *src, int num_words, const unsigned short *lut);
+  void remapImageLine(unsigned int *dest, const unsigned int *src, int num_words, const unsigned char *remap);
+  const unsigned int *readImageLine(const SPRITE_DEF *def, int frame, int shift, int y, const unsigned char *remap, unsigned int *dest);
+  void mirrorImageLine(unsigned int *dest, const SPRITE_DEF *def, int frame, int shift, int y, const unsigned char *remap);
+  const unsigned int *getImageLines(const SPRITE_DEF *def, int frame, int shift, int first, int num, bool flip, const unsigned char *remap);
+
   void drawImageLineTr0(unsigned int *screen, const unsigned int *image, int image_width);
   void drawImageLineTr1(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block);
   void drawImageLineTr2(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block);
   void drawImageLineTr3(unsigned int *screen, const unsigned int *image, int image_width, bool skip_first_block);
 
+  template<int ALIGN, bool TRANSP, int WIDTH>
+  void drawImageRows(unsigned char **lines, int block_x, const unsigned int *image, int stride, int height);
+
+  void drawImageLineMasked(unsigned int *screen, const unsigned int *image, int num_blocks, unsigned int first_mask, unsigned int last_mask);
+  void drawShiftedSprite(const SPRITE_DEF *def, int spr_x, int spr_y, int frame, bool flip, const unsigned char *remap, bool transparent, int top, int bottom, int left, int right);
+
+  template<int ALIGN>
+  void drawImageLineMask(unsigned int *screen, const unsigned int *image, const unsigned int *mask, int image_width, bool skip_first_block);
+  void drawImageLine(unsigned int *line, int x, const unsigned int *image, int width, bool transparent, const unsigned int *mask = nullptr);
+  void drawSpanSprite(const SPRITE_DEF *def, int spr_x, int spr_y, int frame, const unsigned char *remap, int top, int bottom);
+  bool isSpriteVisible(const SPRITE_DEF *def, int spr_x, int spr_y, int frame, bool flip);
+  int getSpriteImageShift(const SPRITE_DEF *def, int spr_x, bool flip);
+  int getTileOpacity(int tile_num) {
+    return (game_map.tileset->opacity) ? game_map.tileset->opacity[tile_num] : SPRITE_OPACITY_MIXED;
+  }
+
+  void setDrawTarget(unsigned char **lines, int w, int h) { target_lines = lines; target_w = w; target_h = h; }
+  void fillImageLine(unsigned int *line, int x, int width, unsigned int color);
+  void applyBackgroundRenderMode();
+  void renderBackground(int x, int y, int w, int h);
+  void renderBackgroundTiles(int x, int y, int w, int h);
+  void renderBackgroundLines(int x, int y, int w, int h);
+  void drawTileMapLine(unsigned int *screen, int x, int num_words);
+  void renderBackgroundCacheArea(int x, int y, int w, int h);
+  void updateBackgroundCache();
+  void copyBackgroundCache(int y, int h);
+  void freeBackgroundCache();
+
+  int updateDebugInfo(int cur_millis);
+  void drawDebugInfo(FONT_INFO &fi, int fps);
   void renderDebugInfo(FONT_INFO &fi, int cur_millis);
+  void renderHud(int fps);
+  void renderScreenLines(int y, int h, unsigned int *words);
   void renderScreen();
-  void checkSprites();
+  void renderScreenBeam(int fps);
+  void checkBeamTears(bool torn);
+  void renderForeground(int y, int h);
+  void startLineFrame();
+  void lockLineFrameTiles();
+  void renderLine(int y, unsigned char *line);
+  static void startLineFrameFunc(void *data) { ((GameScreen *) data)->startLineFrame(); }
+  static void renderLineFunc(int y, unsigned char *line, void *data) { ((GameScreen *) data)->renderLine(y, line); }
+  bool allocTileMode();
+  const unsigned char *getCachedTile(int tile_num);
+  void addTileOverlayLines(TILE_CELL &cell, int top, int bottom, int vis_top, int vis_bottom);
+  void renderTileOverlay(TILE_CELL &cell, int x, int y);
+  void composeTileFrame();
   
 public:
 
+  void setHudLines(int top, int bottom) { hud_top = top; hud_bottom = bottom; }  // must be called before init()
+  void setBeamRacing(int num_bands) { beam_bands = num_bands; }                 // must be called before init()
+  void setLineBuffer(int num_lines) { line_buffer_lines = num_lines; }          // must be called before init()
+  void setTileMode(bool enable) { tile_mode = enable; }                         // must be called before init()
+  const TILE_MODE_STATS &getTileModeStats() { return tile_stats; }
   void init(const int *pin_config, GameNetwork *net, GameJoy *joy);
+  bool enableBackgroundCache(bool enable);
+  void setBackgroundRenderMode(int mode);
 
-  void setImagesSBitsOk(bool ok) { images_sbits_ok = ok; }
-  bool getImagesSBitsOk(bool ok) { return images_sbits_ok; }
   unsigned char getSBits() { return sync_bits; }
-  bool checkImageSBits(const unsigned int *image_data) {
-    return (sync_bits == (image_data[0]&0xc0));
-  }
 
   void clear(unsigned char color = 0);
-  void drawSprite(const SPRITE_DEF *def, int spr_x, int spr_y, int frame, bool transparent);
+  void drawSprite(const SPRITE_DEF *def, int spr_x, int spr_y, int frame, bool transparent, bool flip = false, const unsigned char *remap = nullptr);
   void setScreenPos();
   void show(int cur_millis);
 };
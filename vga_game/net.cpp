@@ -21,13 +21,18 @@ static volatile int     net_rx_msg_first_available;
 static volatile int     net_rx_msg_num_available;
 static volatile uint8_t net_rx_msg_buf[NET_MSG_SIZE*NET_MSG_RX_QUEUE_LEN];
 
+static bool net_netif_ready;  // the TCP/IP adapter is only initialized once
+
 static int init_wifi()
 {
+  if (! net_netif_ready) {
 #if ARDUINO_ARCH_ESP32
-  tcpip_adapter_init();
+    tcpip_adapter_init();
 #else
-  if (esp_netif_init() != ESP_OK) return 1;
+    if (esp_netif_init() != ESP_OK) return 1;
 #endif
+    net_netif_ready = true;
+  }
   wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
   cfg.static_tx_buf_num = 0;
   cfg.dynamic_tx_buf_num = 8;
@@ -131,3 +136,19 @@ int net_init()
   printf("OK: network initialized\n");
   return 0;
 }
+
+int net_deinit()
+{
+  if (esp_now_deinit() != ESP_OK) {
+    printf("ERROR stopping ESP-NOW\n");
+    return 1;
+  }
+
+  if (esp_wifi_stop() != ESP_OK || esp_wifi_deinit() != ESP_OK) {
+    printf("ERROR stopping WiFi\n");
+    return 1;
+  }
+
+  printf("OK: network stopped\n");
+  return 0;
+}
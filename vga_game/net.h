@@ -8,6 +8,7 @@
 #define NET_MSG_RX_QUEUE_LEN  4  // up to N messages in receive queue
 
 int net_init();
+int net_deinit();
 
 int net_can_send_message();
 int net_send_message(const uint8_t *data);
@@ -3,2867 +3,2887 @@
 const int img_loserboy_width   = 51;
 const int img_loserboy_height  = 40;
 const int img_loserboy_stride  = 13;
-const int img_loserboy_num_spr = 44;
+const int img_loserboy_num_spr = 22;
 
-const unsigned int img_loserboy_data[] = {
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0c0d0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd4d0d0d4u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd4c0d4d4u,0xd0c0d4d0u,0xc0d4d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xe5d4e5e5u,
-  0xc0d4d4d0u,0xd4d4d0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd4c0e5e5u,0xd4e5d4c0u,0xd0d4c0d0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6ccc6u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd7c0u,0xc0d7d4c0u,0xd4e5d4c0u,0xd0d4c0d0u,0xc0eac0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xd7ebc0d7u,0xd4d4d4c0u,
-  0xd0d0eac0u,0xeaeaeaeau,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd7c0ebebu,0xd7ebc0c0u,0xc0c0d4d0u,0xc0d0eaeau,0xeaeaeaeau,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0ebebu,
-  0xd7d7d7d7u,0xd4c0d4d0u,0xeac0eaeau,0xeaeaeaeau,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0ebebu,0xebebebebu,0xc0d7d0d4u,0xeac0eaeau,
-  0xeaeac0eau,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xd7c0ebebu,0xebebebebu,0xd7ebc0c0u,0xeaeaeaeau,0xeaead7c0u,0xd7d7d7d7u,0xccc0ccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xebebebebu,
-  0xd7ebc0c0u,0xeaeaeaeau,0xeaead7c0u,0xebebd7ebu,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xebd7ebebu,0xc0d7c0d4u,0xeaeaeaeau,0xeaeac0eau,
-  0xebd7d7ebu,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd7c0d7d7u,0xd0c0c0c0u,0xeaeaeaeau,0xeaeac0eau,0xebd7d7ebu,0xccc0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd0c0c0c0u,
-  0xeaeaeaeau,0xeaeac0eau,0xd7c0d7ebu,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0eac0u,0xc0d5c0d7u,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xc0c0d5d5u,0xc0c0c0c0u,0xc0c0d5d5u,0xead5d5eau,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xd5c0d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xeaeac0eau,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0d5c0u,0xc0c0d5d5u,0xc0c0c0c0u,0xd5c0ead5u,0xeaeac0d5u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d5d5u,0xc0d5c0d5u,
-  0xc0c0c0c0u,0xc0c0d5c0u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5c0c0u,0xc0c0d5c0u,0xd5d5c0d5u,0xd5d5c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccd5c0u,0xd5d5c0c0u,0xc0c0d5d5u,0xeaeaeaeau,0xd5ead5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5c0c0c0u,0xc0c0ead5u,
-  0xeaeaeaeau,0xeaead5eau,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0d5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd0c0u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd0c0d4d0u,0xc0d0d0d0u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4c0u,
-  0xd0c0d4d4u,0xd4d4d0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd4c0e5e5u,0xc0d4d4d0u,0xd4d4c0d4u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6ccc6u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0e5d4u,0xd4e5d0c0u,0xd4d4c0d0u,0xeaeac0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd7d7d4c0u,0xe5e5c0d4u,
-  0xd4d4eac0u,0xeaeaeaeau,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccd7c0u,0xebebc0d7u,0xe5d4c0d4u,0xd0d4eac0u,0xeaeaeaeau,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,
-  0xebebd7ebu,0xd4c0d0c0u,0xc0d4eaeau,0xeaeac0eau,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xd7ebd7d7u,0xc0c0d4d0u,0xc0d4eaeau,
-  0xeaead7c0u,0xd7d7ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccebd7u,0xebebd7ebu,0xc0d7d4d4u,0xc0d0eaeau,0xc0eaebd7u,0xebebc0d7u,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xebebebebu,
-  0xc0d7d4d4u,0xeac0eaeau,0xc0eaebd7u,0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xebebebebu,0xc0d7d4d4u,0xeac0eaeau,0xc0ead7d7u,
-  0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xc0c0d4d4u,0xeac0c0eau,0xc0c0d7c0u,0xd7d7ccc0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0d4u,
-  0xc0c0d5c0u,0xd5d5c0d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xd5d5eaeau,0xeaeac0c0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xc0c0c0d5u,0xc0c0d5c0u,0xead5eaeau,0xd5eaccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5c0c0d5u,0xc0c0d5d5u,0xeaeaeaeau,
-  0xc0eaccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0c0u,0xd5d5c0c0u,0xd5c0ead5u,0xc0d5c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5c0c0u,
-  0xd5c0d5d5u,0xd5c0d5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ead5u,0xeaeaeaeau,0xd5eac0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xc0c0d5d5u,0xeaeaeaeau,0xeaeac0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,0xc0d5d5c0u,
-  0xead5eaeau,0xd5eac0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5c0d5d5u,0xd5d5c0c0u,0xd5d5d5d5u,0xd5d5c0c0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccc0ccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4d4u,0xc0c0c0c0u,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0cce5d4u,0xc0d4d0d0u,0xd0c0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0e5c0u,0xd4e5c0c0u,0xd4d0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd7d7c0d7u,0xd4e5d4c0u,0xd4c0d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd7d7u,0xebebc0d7u,
-  0xd4e5d4c0u,0xc0d4d4d4u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0ebebu,0xebebc0d7u,0xc0d4d4d0u,0xd4d4d4c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6ccc6u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xd7d7d7d7u,0xd7d7c0c0u,0xd0c0d4d0u,0xd0d4c0c0u,0xeaeac0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xebd7ebebu,0xc0d7ccccu,0xd0c0d4d4u,
-  0xc0d0eaeau,0xeaeaeaeau,0xc0c0ccc0u,0xc0ccc0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xebd7ebebu,0xc0d7c0ccu,0xd4d0d4d4u,0xc0d0eaeau,0xeaeaeaeau,0xc0c0c0c0u,
-  0xd7c0d7d7u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xebd7ebebu,
-  0xc0d7d0c0u,0xd4d4d0d4u,0xeac0eaeau,0xeaeaeaeau,0xc0c0d7d7u,0xebd7ebebu,0xc0d7ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0d7d7u,0xc0c0d4d0u,0xd4d4d0d4u,0xeac0eaeau,
-  0xeaeaeaeau,0xc0c0ebd7u,0xebebebebu,0xc0d7ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0c0u,0xd0c0d4d4u,0xd4d4d0d0u,0xeac0eaeau,0xc0eac0c0u,0xc0c0d7d7u,0xebd7ebebu,
-  0xc0d7ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d4d4u,
-  0xd4d4c0d0u,0xeaeaeaeau,0xc0c0d5d5u,0xc0d5c0c0u,0xd7c0d7d7u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd0d0u,0xd4d4c0d0u,0xeaeac0eau,0xc0c0ead5u,
-  0xd5eaccc0u,0xc0ccc0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd0c0u,0xd4d0c0d0u,0xeaeac0c0u,0xd5c0ead5u,0xeaeac0c0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xd0c0c0d0u,
-  0xc0c0c0c0u,0xd5d5eaeau,0xeaead5d5u,0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0d4d4c0u,0xccc0c0c0u,0xd5d5eaeau,0xeaead5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,
-  0xd5d5c0d5u,0xd4c0c0d4u,0xccccc0c0u,0xd5d5eaeau,0xd5d5eaeau,0xeaeac0d5u,0xc0c0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xccccc0c0u,
-  0xd5d5d5d5u,0xeaeaeaeau,0xd5eac0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccc0c0u,0xc0c0ead5u,0xeaead5eau,0xc0c0c0c0u,
-  0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5d5u,0xc0c0d5c0u,
-  0xc0d5ccc0u,0xccccc0c0u,0xd5c0eaeau,0xd5eac0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5c0d5d5u,0xd5d5c0d5u,0xc0c0ccc0u,0xccccc0ccu,0xd5d5d5eau,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xd5c0d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xccccc0ccu,0xd5d5c0d5u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,
-  0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xd5c0d5d5u,0xc0d5c0c0u,0xccccccccu,0xc0ccc0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccc0ccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4d4u,0xc0c0c0c0u,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xd4c0d4d4u,0xc0d4c0d0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0e5e5u,0xd4d4c0c0u,0xd4d0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccd7c0u,0xd7d7e5c0u,0xd4e5d4c0u,0xd4c0d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd7c0ebd7u,0xebebc0d7u,
-  0xd4e5d4c0u,0xc0d4d4d4u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccd7c0u,0xd7d7ebebu,0xd7ebc0d7u,0xc0d4d4d0u,0xd4d4d4c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6ccc6u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,
-  0xd7ebebd7u,0xc0d7c0c0u,0xc0c0d0d0u,0xd4d4c0d0u,0xeaeac0c0u,0xc0c0ccc0u,0xccccc0c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xebebd7d7u,0xccc0ccccu,0xd0c0d4d0u,
-  0xd0d4eac0u,0xeaeac0eau,0xd4c0c0c0u,0xc0c0d7d7u,0xc0d7ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccebd7u,0xebebc0d7u,0xccccc0ccu,0xd4d0d4d4u,0xc0d0eaeau,0xeaeaeaeau,0xd4c0d7c0u,
-  0xd7d7ebebu,0xd7ebccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xebebc0d7u,
-  0xccccc0ccu,0xd4d0d4d4u,0xeac0eaeau,0xeaeaeaeau,0xd4c0d7c0u,0xebebebebu,0xd7ebccc0u,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xd7d7ccc0u,0xccccd0c0u,0xd4d4d0d4u,0xeac0eaeau,
-  0xeaeaeaeau,0xd4c0d7c0u,0xebd7ebebu,0xd7d7ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0ccc0u,0xc0c0d4d0u,0xd4d4c0d4u,0xeaeaeaeau,0xeaeaeaeau,0xc0eac0c0u,0xd7d7d7d7u,
-  0xc0d7ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xd5d5c0d5u,0xc0d4d4d0u,
-  0xd4d4c0d4u,0xeaeaeaeau,0xeaeac0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5c0d5u,0xd4d4d0c0u,0xd4d4c0d4u,0xeaeaeaeau,0xc0ead5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd4c0c0d4u,0xd0d0eac0u,0xeaeaeaeau,0xc0ead5d5u,0xeaeac0d5u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0d4u,0xc0c0c0ccu,
-  0xc0c0eaeau,0xd5c0ead5u,0xeaead5eau,0xc0c0c0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccc0c0u,0xd5c0ead5u,0xeaead5d5u,
-  0xd5d5d5d5u,0xd5d5ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xd5c0ead5u,0xd5ead5d5u,0xead5d5eau,0xc0d5ccc0u,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xd5c0ead5u,0xd5d5ead5u,0xeaead5d5u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0ead5u,0xd5d5eaeau,0xd5eac0c0u,
-  0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd5c0ead5u,0xd5d5eaeau,0xc0d5c0c0u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,
-  0xd5d5d5eau,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd5c0u,0xd5d5c0c0u,0xc0c0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xd5c0d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xc0d5c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccc0ccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d4d4u,0xc0d4c0c0u,0xc0d0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d7d7u,
-  0xc0d7e5d4u,0xd4e5d4c0u,0xd0d4c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd7c0u,0xd7d7ebebu,0xd7ebe5c0u,0xd4e5c0c0u,0xd4d4c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xd7c0ebd7u,0xd7ebebebu,0xd7d7e5c0u,0xd4e5d0c0u,0xd4c0d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xebd7ebebu,0xebebd7d7u,0xc0c0d4c0u,
-  0xc0d4d0c0u,0xc0d0d4d4u,0xc0c0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xebd7ebebu,0xd7ebc0c0u,0xccccc0c0u,0xc0c0d4d0u,0xd4d4c0c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6c0c6u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xebd7ebebu,
-  0xc0d7ccccu,0xccccc0ccu,0xd4c0d4d4u,0xc0c0eaeau,0xc0eac0c0u,0xc0c0c0c0u,0xc0c0d7c0u,0xd7d7c0d7u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0d7d7u,0xc0d7ccccu,0xc0ccd0c0u,0xd4d4c0d4u,
-  0xeaeaeaeau,0xeaead0c0u,0xd4c0c0e5u,0xd7d7ebd7u,0xebebd7d7u,0xccc0c0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0c0u,0xccc0c0ccu,0xd0c0d4d0u,0xd4d4eac0u,0xeaeaeaeau,0xeaead0c0u,0xd4c0c0e5u,
-  0xebd7ebebu,0xebebd7ebu,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd0c0u,
-  0xd4d0d4d4u,0xc0d4eaeau,0xeaeaeaeau,0xeaead0c0u,0xd4c0c0e5u,0xd7d7ebebu,0xebebd7d7u,0xccc0c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xccccd0c0u,0xd4d4d4d4u,0xc0d4eaeau,0xeaeaeaeau,
-  0xeaead0c0u,0xd4c0c0d4u,0xd7d7d7d7u,0xd7d7c0d7u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xccc0d0c0u,0xd4d4d0d4u,0xeac0eaeau,0xeaeaeaeau,0xeaead0c0u,0xd4c0ccc0u,0xc0c0c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xc0d5c0ccu,0xd4d0d0d4u,
-  0xeac0eaeau,0xeaeaeaeau,0xc0eac0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xd0d0d0d4u,0xeac0eaeau,0xeaeaeaeau,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5d4c0u,0xd0c0d0d0u,0xeac0eaeau,0xeaeac0eau,0xd5d5d5eau,0xd5d5c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d4c0u,0xc0d4c0c0u,0xeaeaeaeau,
-  0xeaeac0eau,0xead5eaeau,0xd5d5d5c0u,0xd5d5d5d5u,0xc0d5c0c0u,0xccccc0ccu,0xccccccccu,0xccccd5c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xd4d4ccc0u,0xc0c0eaeau,0xeaead5c0u,0xead5eaeau,0xd5ead5d5u,
-  0xead5eaeau,0xc0d5c0c0u,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd4c0ccc0u,0xccccc0c0u,0xc0c0d5c0u,0xead5eaeau,0xeaead5d5u,0xeaead5eau,0xc0c0ccc0u,0xccccc0ccu,
-  0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0c0ccccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5eaeau,0xd5eaead5u,0xeaeac0d5u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xd5c0ead5u,0xd5d5eaeau,0xd5eac0c0u,
-  0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd5c0d5d5u,0xead5eaeau,0xc0d5c0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5d5d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,
-  0xd5d5d5eau,0xc0c0c0c0u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5c0d5u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xd5d5c0d5u,0xc0c0c0c0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,
-  0xc0c0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd0d0u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d0d0u,0xc0d4d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xd4d0d4d0u,0xd4d4d0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd0c0u,0xc0c0c0c0u,0xd0d4c0c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6ccc6u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd4d4d4d4u,0xd4c0d0d4u,0xc0d0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4c0u,0xe5e5d4e5u,
-  0xc0c0c0c0u,0xd7c0c0d7u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0cce5d4u,0xd4e5c0d4u,0xd7d7d7d7u,0xebd7d7ebu,0xc0d7ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccd4c0u,0xc0d4d7c0u,0xebebebebu,0xebebebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d7d7u,0xebd7ebebu,
-  0xebebebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccd4d0u,0xc0c0c0c0u,0xd7d7d7d7u,0xd7d7d7d7u,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4d0u,
-  0xd4d4d4d4u,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd0c0u,0xd4d4d4d4u,0xc0d4d5c0u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd0d0d4d4u,0xc0d4d5d5u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xc0c0d0d0u,
-  0xd0d0d5c0u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5c0c0u,0xc0c0d5c0u,0xd5d5d5d5u,0xd5d5ccc0u,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,
-  0xd5d5ead5u,0xd5ead5d5u,0xd5d5c0d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5ead5u,0xeaeaeaeau,0xd5d5c0d5u,
-  0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xd5c0d5d5u,0xd5d5eaeau,0xeaead5eau,0xd5d5d5c0u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0ead5u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xc0d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0ead5u,0xd5ead5d5u,0xd5d5c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xd5c0d5d5u,0xeaeaeaeau,0xd5d5c0d5u,0xc0c0d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xeaeaeaeau,0xd5eac0d5u,
-  0xc0ccd5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccd5c0u,0xead5eaeau,0xd5eac0d5u,0xccccd5c0u,0xd5d5d5d5u,0xc0d5ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0ccc0u,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd0d0u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d4d0u,0xc0d4d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xd4d0d4d4u,0xd4d4d0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd0c0u,0xc0d4c0c0u,0xd4d4c0c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6ccc6u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd0c0u,0xd4c0d4d4u,0xd4c0d4d4u,0xd0d0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xe5d4d4e5u,
-  0xc0c0d0d0u,0xc0d0c0eau,0xebd7ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4c0u,0xe5e5c0d4u,0xd7d7c0c0u,0xc0d0c0eau,0xebd7ccc0u,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0d0u,0xd4d4d7c0u,0xebebd7d7u,0xc0c0c0c0u,0xd7d7ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d0d4u,0xc0c0d7d7u,0xebebebebu,
-  0xd7d7c0d7u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd0c0d4d4u,0xd4d4c0c0u,0xd7d7ebebu,0xebebc0d7u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d4d4u,
-  0xd4d4d0d4u,0xc0c0d7d7u,0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d4d4u,0xd4d4d0d4u,0xc0d0c0c0u,0xd7d7c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0c0u,0xc0c0d0d0u,0xd0d0d0d0u,0xc0d0eaeau,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xc0d5c0c0u,0xc0c0c0c0u,
-  0xc0c0eaeau,0xeaeac0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5c0c0u,0xd5d5c0d5u,0xc0c0c0c0u,0xc0c0d5c0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0eaeau,
-  0xc0ead5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xd5c0d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xead5eaeau,0xeaeaeaeau,0xeaead5eau,0xc0c0c0c0u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd5eaead5u,0xeaeaeaeau,0xeaeac0d5u,0xc0c0d5c0u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5eac0c0u,0xead5eaeau,
-  0xd5d5c0c0u,0xc0c0d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccd5c0u,0xeaead5d5u,0xc0c0c0d5u,0xc0c0c0c0u,0xd5c0d5d5u,0xc0d5c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,
-  0xeaead5eau,0xc0d5c0c0u,0xc0ccc0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xeaead5d5u,0xc0c0ccccu,0xc0ccc0c0u,
-  0xd5c0d5d5u,0xd5d5d5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd5c0u,0xd5d5c0d5u,0xccc0ccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5ccc0u,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0ccc0u,
-  0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d0d0u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d0d0u,0xc0d4d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xd0c0d4d0u,0xd4d4d0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd0c0d4d0u,0xd0d4c0c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6ccc6u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd0d0d4d4u,0xc0d4d4d4u,0xc0d4c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0d4d4d4u,
-  0xc0d4e5d4u,0xc0d4c0c0u,0xc0c0d7d7u,0xc0d7ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd4c0u,0xd0d0d4c0u,0xd4c0d4e5u,0xd7c0d7d7u,0xd7d7ebebu,
-  0xd7ebccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccd4d0u,0xd4d4c0d0u,0xd4c0d4e5u,0xd7c0ebebu,0xebebebebu,0xd7ebccc0u,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xccccccccu,0xc0ccd4d4u,0xd4d4d0d0u,0xd4c0d4d4u,
-  0xd7c0ebebu,0xebebebebu,0xd7ebccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0ccccu,0xd0c0d4d4u,0xd4d4d0d4u,0xc0d0c0c0u,0xc0c0d7d7u,0xd7d7d7d7u,0xc0d7ccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0ccc0u,0xd4c0d4d4u,
-  0xd4d4d4d4u,0xc0d0eaeau,0xeaeac0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xc0d5d5c0u,0xc0d5c0c0u,0xd0c0d4d4u,0xd4d4d4d4u,0xc0d0eaeau,0xc0eac0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xc0d5d5d5u,
-  0xc0d5c0c0u,0xc0d4d0d0u,0xd4d4d4d4u,0xc0d0eaeau,0xc0c0d5c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xc0eaead5u,0xc0d5c0c0u,0xe5e5c0c0u,0xd0d0d4d4u,
-  0xc0c0c0c0u,0xc0c0d5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,
-  0xd5c0ead5u,0xd5eaead5u,0xd5eac0c0u,0xe5e5d4e5u,0xc0c0c0c0u,0xccccc0c0u,0xd5c0d5d5u,0xc0d5ccc0u,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5eaeau,0xc0eaead5u,0xd5eac0c0u,
-  0xe5e5c0d4u,0xccccccccu,0xccccc0c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccc0ccu,0xead5eaeau,0xc0eaead5u,0xd5eac0c0u,0xd4e5ccc0u,0xccccccccu,0xccccd5c0u,
-  0xd5d5c0d5u,0xd5d5d5d5u,0xc0d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xead5eaeau,
-  0xc0d5eac0u,0xeaeac0c0u,0xc0c0ccccu,0xccccccccu,0xc0ccd5c0u,0xd5d5d5c0u,0xd5d5d5d5u,0xd5d5c0d5u,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xeaeac0eau,0xc0c0ccccu,
-  0xccccccccu,0xc0ccc0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,
-  0xd5d5c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xd5c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd0c0c0d0u,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d0d0u,0xd0d0c0c0u,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xc0d0d0d0u,0xc0d0c0d0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0e5d0d0u,0xd0c0d0d4u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xe5e5c0c0u,0xd4d0d4d4u,0xc0d0c0c0u,0xc0c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xe5c0c0e5u,
-  0xd4d0d4d4u,0xd0d4d4c0u,0xd4d4c6c0u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xc0ebd0c0u,0xc0d4d4d4u,0xd0d4d4c0u,0xd4e5c0c0u,
-  0xc6c0c6c6u,0xc0c0ccc6u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccd7d7u,0xc0ebd4d0u,0xd0d4c0c0u,0xc0d4e5d4u,0xd4e5d7c0u,0xc0d7c0c0u,0xd7d7ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xc0d7d4d0u,0xd4d4d0d0u,
-  0xc0c0e5d4u,0xc0e5ebd7u,0xd7ebd7d7u,0xebebc0d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccc0c0u,0xc0c0ccccu,0xccccc0ccu,0xd0c0d4d4u,0xd4d4d0d0u,0xc0d0d4d4u,0xc0d4ebd7u,0xebebebebu,
-  0xebebc0d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xccc0ccccu,
-  0xd0c0d4d4u,0xd4d4d0d4u,0xc0d0c0c0u,0xc0c0d7c0u,0xebd7ebebu,0xd7ebc0d7u,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xc0d5c0c0u,0xc0c0c0c0u,0xd4c0d4d4u,0xd4d4d4d4u,0xc0d0eaeau,
-  0xeaeac0c0u,0xd7c0d7d7u,0xd7d7ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0ead5u,
-  0xd5d5d5d5u,0xc0c0c0c0u,0xd0c0d4d4u,0xd4d4d4d4u,0xc0d0eaeau,0xc0eac0d4u,0xc0c0c0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0eaeau,0xd5eaeaeau,0xd5eac0c0u,0xc0c0d0d0u,
-  0xd4d4d4d4u,0xc0d0eaeau,0xd4c0c0d4u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0c0u,0xead5eaeau,0xd5d5eaeau,0xeaeac0d5u,0xe5d4c0c0u,0xd0d0d4d4u,0xc0c0c0c0u,0xd4d4c0c0u,
-  0xd5c0d5d5u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xead5d5eau,0xd5c0eaeau,
-  0xd5eac0d5u,0xe5d4e5e5u,0xc0c0c0c0u,0xccccc0c0u,0xc0d4c0c0u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xc0ccd5c0u,0xeaead5eau,0xd5c0ead5u,0xd5eac0c0u,0xd4d4d4d4u,0xccc0ccccu,
-  0xccccccccu,0xc0c0c0c0u,0xd5d5d5d5u,0xc0d5c0c0u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xc0ccd5c0u,
-  0xeaead5eau,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5c0c0u,0xccccc0ccu,0xccccccccu,0xc0ccd5c0u,0xead5c0d5u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5c0c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xccccc0ccu,
-  0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xc0c0d5c0u,0xd5d5c0d5u,0xc0c0c0c0u,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0d5c0u,0xd5d5c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0d5d5u,0xc0d5c0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0d5d5u,0xc0c0c0c0u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5c0u,0xc0c0c0c0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,
-  0xc0c0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0c0d0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0e5c0u,0xc0d4d0d0u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xd7c0d7d7u,0xd7d7e5c0u,0xc0d4d0d0u,0xc0d4d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0ebd7u,0xebebe5c0u,
-  0xc0d4d4d0u,0xd4d4c0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0ebebu,0xd7d7e5c0u,0xd0c0c0d0u,0xd4d4d4d4u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6c0c0u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xd7c0c0d7u,0xc0c0c0c0u,0xd0d0c0d0u,0xd4d4d4d4u,0xc0d4c0c0u,0xccc0ccccu,0xc0ccd7d7u,0xc0d7ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xccccd0c0u,0xd4d0d0d0u,
-  0xd0c0d4d4u,0xc0d4d4d4u,0xc0d4c0c0u,0xd7c0ebebu,0xd7ebccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xc0ccd0d0u,0xd4d4d0d4u,0xc0d0d4d0u,0xc0d0e5d4u,0xc0d4d7d7u,
-  0xebd7ebebu,0xd7ebccc0u,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xd0c0d4d0u,0xd4d4d0d4u,0xd0d0d0c0u,0xc0c0e5d4u,0xc0d4ebd7u,0xebebebebu,0xd7ebccc0u,0xccccc0ccu,
-  0xccccccccu,0xc0c0c0c0u,0xead5d5d5u,0xc0d5c0c0u,0xccccc0ccu,0xd0c0d4d4u,0xd4d4d4d4u,0xd0d0c0d0u,
-  0xc0c0e5d4u,0xc0d4d7d7u,0xd7d7d7d7u,0xc0d7ccccu,0xccccc0ccu,0xccccc0ccu,0xc0c0d5d5u,0xeaeaead5u,
-  0xd5eac0c0u,0xccc0d4c0u,0xc0d4d4d0u,0xd4d4d4d4u,0xd0d4c0c0u,0xc0d4d4c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xccc0ccccu,0xccccc0ccu,0xccccc0c0u,0xd5d5eaeau,0xd5eaead5u,0xd5eac0d5u,0xc0c0d4d4u,0xc0e5d0d0u,
-  0xd4d4d4d4u,0xd0d0d4c0u,0xd4d4c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0ccd5c0u,
-  0xead5eaeau,0xd5d5ead5u,0xeaead5d5u,0xc0d5e5c0u,0xd4e5d0c0u,0xd4d0d4d4u,0xc0d0d4d4u,0xd4d4d5c0u,
-  0xc0d5ccc0u,0xccccccccu,0xc0ccc0c0u,0xc0c0c0ccu,0xc0c0d5d5u,0xeaead5eau,0xc0d5d5c0u,0xeaead5eau,
-  0xd5d5d4c0u,0xd4e5d0c0u,0xd0d0d0d4u,0xc0d0d4c0u,0xc0d4d5d5u,0xd5d5c0d5u,0xc0c0c0c0u,0xd5c0d5d5u,
-  0xc0d5c0c0u,0xc0c0d5d5u,0xd5d5d5d5u,0xc0c0d5c0u,0xead5eaeau,0xd5d5c0c0u,0xc0d4c0ccu,0xd0c0d0d0u,
-  0xc0d0c0ccu,0xc0c0d5c0u,0xd5d5d5d5u,0xc0d5d5c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xd5c0eaeau,0xc0d5c0c0u,0xccc0ccccu,0xc0ccc0c0u,0xc0c0ccccu,0xc0ccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5c0d5u,0xc0c0c0c0u,0xccccc0c0u,0xc0c0c0c0u,0xccccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xc0c0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0d5u,0xd5d5d5d5u,
-  0xc0d5c0c0u,0xc0c0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xccc0c0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xd5c0c0d5u,0xc0c0c0c0u,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0d5u,0xc0c0c0c0u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,0xd5d5c0d5u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d5d5u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccd5d5u,0xc0c0d5c0u,0xd5d5c0c0u,0xd5c0d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0d5u,0xd7d7d5c0u,
-  0xc0c0ffebu,0xc0c0d5d5u,0xc0d5c0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd7c0u,0xebebc0c0u,0xebc6ffffu,0xeac0d5c0u,0xd5c0ccc0u,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd7c0u,0xebebd7ebu,0xebebffffu,0xeac0c0ebu,0xd5c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xebebd7ebu,0xebebffffu,
-  0xead5ffebu,0xd5eaccc6u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xd7d7d7ebu,0xebebffebu,0xffffebebu,0xffffccc6u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0d7d7u,0xebd7c6ebu,0xebc6ebebu,0xebebccc6u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0c0d0u,0xd0d4c6c0u,0xd7d7ebebu,0xc6d7ebebu,
-  0xc6ebccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd0d0d0d4u,0xd4c0c0d4u,0xc6c6d7d7u,0xebebc6ebu,0xccc6ccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd4d0d0d4u,0xd4c0d0d0u,
-  0xc6c0c0c6u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccd4c0u,0xc0c0d4d4u,0xc0c0c0c0u,0xc6c0c6c6u,0xd4c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd4c0e5d4u,
-  0xd4e5d0c0u,0xd0c0c0d0u,0xc0eac0c0u,0xd4c0ccc0u,0xccccc0ccu,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd4c0e5e5u,0xe5e5c0d4u,0xd0c0c0d0u,0xeaeaeaeau,
-  0xd4c0c0c0u,0xc0c0ebc0u,0xebebccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0e5d4u,0xe5e5c0e5u,0xd0d0c0d0u,0xeaeaeaeau,0xd4c0c0d4u,0xc0ebebebu,0xebebc0ebu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd7d7c0c0u,0xe5d4c0d4u,
-  0xd0d0eac0u,0xeaeaeaeau,0xd4c0c0d4u,0xc0ebebebu,0xebebc0d7u,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xebebd7d7u,0xd4c0c0d4u,0xd0d0eac0u,0xeaeaeaeau,0xd4c0c0d4u,
-  0xebd7ebc0u,0xebebc0d7u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccebc0u,
-  0xd7ebc0d7u,0xc0ccd0c0u,0xd0d0eac0u,0xeaeaeaeau,0xd4c0c0d4u,0xc0c0ebc0u,0xd7ebc0d7u,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccebc0u,0xd7d7ccc0u,0xccccd0c0u,0xd0d0eac0u,
-  0xeaeaeaeau,0xc0ead0d4u,0xccc0c0ccu,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccebebu,0xd7ebc0d7u,0xc0ccd0d0u,0xc0d0eaeau,0xeaeaeaeau,0xc0ead0d4u,0xccc0ccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebebu,0xebebc0d7u,
-  0xd0c0d0d0u,0xc0d0eaeau,0xeaeaeaeau,0xc0ead0d4u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebebu,0xd7ebd7d7u,0xd0c0d0d0u,0xeac0eaeau,0xeaeaeaeau,
-  0xc0ead0d0u,0xc0d0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd7c0u,0xd7d7c0d7u,0xc0c0c0c0u,0xeaeaeaeau,0xeaeaeaeau,0xeaeac0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d5c0u,0xd5d5c0d5u,
-  0xeac0eaeau,0xeaeaeaeau,0xc0c0d5d5u,0xc0d5ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xead5d5eau,0xc0d5c0c0u,0xc0c0c0c0u,0xd5d5ead5u,
-  0xd5d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xd5c0d5d5u,0xeaeaeaeau,0xc0d5ccccu,0xccccd5c0u,0xd5d5eaeau,0xd5eaccc0u,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xeaeaeaeau,0xc0d5ccccu,
-  0xccccd5c0u,0xd5d5eaeau,0xd5eac0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xeaeaeaeau,0xc0d5ccccu,0xc0ccd5d5u,0xd5d5eaeau,0xd5d5c0d5u,
-  0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5d5d5u,
-  0xead5d5eau,0xccc0ccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccc0u,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xc0ccd5d5u,
-  0xd5d5d5d5u,0xeaeaeaeau,0xd5d5c0d5u,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,
-  0xd5d5eaeau,0xeaead5d5u,0xd5d5d5d5u,0xccc0ccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xead5eaeau,0xeaead5d5u,
-  0xc0d5c0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xead5eaeau,0xeaead5eau,0xd5d5c0d5u,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xc0d0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xd4d4c0d0u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d4d4d4u,0xd0d0d4c0u,0xd4d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d0d0u,0xd4c0d4d4u,
-  0xc0d0e5d4u,0xe5e5c0d4u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd0d0d4d4u,0xd4c0e5e5u,0xd4e5c0c0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,
-  0xc0c0c0eau,0xd0d0d4d4u,0xd4c0d4e5u,0xc0c0d7d7u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0cceac0u,0xeaeaeaeau,0xd0c0d4d0u,0xd4c0c0d4u,
-  0xd7d7ebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0cceac0u,0xeaeaeaeau,0xc0ead4d0u,0xc0d0c0c0u,0xd7c0ebebu,0xd7ebccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xcccceac0u,0xeaeaeaeau,
-  0xeaead4c0u,0xd4d0d7c0u,0xd7d7ebd7u,0xd7ebccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xeaeaeaeau,0xeaead0c0u,0xc0d4ebd7u,0xebebebebu,
-  0xd7ebccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccd7c0u,
-  0xd7d7d7d7u,0xeac0eaeau,0xeaeac0eau,0xd7c0ebebu,0xebebebebu,0xd7ebccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xebebd7ebu,0xeac0eaeau,0xeaeac0eau,
-  0xd7c0ebebu,0xebebebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccd7c0u,0xebebc0d7u,0xeaeaeaeau,0xeaeac0eau,0xc0d4ebd7u,0xebebd7d7u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xebebc0d7u,
-  0xeaeaeaeau,0xeaeac0eau,0xd0c0d7c0u,0xd7d7c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xd7ebc0c0u,0xeaeaeaeau,0xeaeac0eau,0xd0c0c0c0u,
-  0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xc0d7ead5u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xeaead5d5u,
-  0xc0d5c0c0u,0xc0c0d5c0u,0xc0d5c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xeaead5eau,0xd5d5c0c0u,0xc0c0d5d5u,0xd5d5c0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xead5eaeau,0xd5d5c0c0u,0xc0c0d5c0u,0xc0d5d5c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0d5d5d5u,0xc0d5c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0c0d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xd5c0d5d5u,0xc0d5ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,
-  0xd5d5eaeau,0xeaead5eau,0xc0d5c0c0u,0xd5c0d5d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xeaeaeaeau,0xeaeaeaeau,0xc0d5c0c0u,
-  0xd5c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d0d4d0u,0xd0d0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d0d0u,0xd4c0d4d4u,
-  0xd0d4d4c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd4d4d4d4u,0xc0d0e5d4u,0xd4e5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xeac0c0eau,0xd4d0d0d4u,0xd4c0e5e5u,0xc0d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xcccceac0u,0xeaeaeaeau,0xd4c0c0d4u,0xe5d4d4e5u,
-  0xd7c0c0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xcccceac0u,0xeaeaeaeau,0xd0c0c0d4u,0xe5d4c0d4u,0xebd7d7ebu,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xeaeaeaeau,
-  0xc0ead0d4u,0xd4c0d7c0u,0xebebebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0d7d7u,0xeac0eaeau,0xc0ead4d4u,0xc0d0d7c0u,0xd7d7ebebu,
-  0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xebd7ebebu,0xc0d7eaeau,0xc0ead4d0u,0xc0d4d7d7u,0xebebebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xebd7ebebu,0xc0d7eaeau,0xeaead4c0u,
-  0xc0d4ebd7u,0xebebebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xebd7d7ebu,0xc0d7eaeau,0xeaead4c0u,0xc0d4ebd7u,0xebebd7ebu,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0d7d7u,
-  0xc0c0c0c0u,0xeaead4c0u,0xc0d4d7c0u,0xd7d7c0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xc0d4c0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xeac0eaeau,0xd5eac0d5u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0eaeau,
-  0xeaead5d5u,0xc0c0c0c0u,0xc0d5c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0eaeau,0xeaead5eau,0xc0d5c0c0u,0xd5d5c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0c0u,0xc0c0ead5u,0xd5d5c0c0u,0xd5c0c0d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5d5c0u,
-  0xd5d5c0c0u,0xd5c0d5d5u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0eaeau,0xeaeaeaeau,0xc0d5c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xead5eaeau,0xeaead5eau,0xc0d5d5c0u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5d5eaeau,0xeaead5d5u,0xc0c0d5d5u,
-  0xd5d5c0d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd5c0d5d5u,0xd5d5c0d5u,0xd5c0d5d5u,0xd5d5c0c0u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccc0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xc0c0d4c0u,0xc0d4ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0d0c0u,0xc0d0e5d4u,0xc0d4ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd4d0c0d0u,0xd4c0e5e5u,0xc0c0ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xd4d4d4c0u,0xd4c0c0e5u,0xd7d7c0d7u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d4d0u,0xc0d4d4d4u,
-  0xd4c0c0e5u,0xebd7d7ebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0d4c0u,0xd4c0d4d4u,0xc0d0c0d4u,0xebd7ebebu,0xd7ebccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,
-  0xeac0c0eau,0xd0c0d4d4u,0xd0d0c0c0u,0xd7c0d7d7u,0xd7d7c0d7u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xc0c0ccccu,0xc0c0eac0u,0xeaeaeaeau,0xc0ead4d0u,0xd0d4ccc0u,
-  0xc0ccebd7u,0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c0u,
-  0xd7d7c0c0u,0xc0c0eac0u,0xeaeaeaeau,0xc0ead4d0u,0xd4d4c0d0u,0xc0ccebd7u,0xebebc0d7u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccebd7u,0xebebd7d7u,0xc0d7eac0u,0xeaeaeaeau,
-  0xeaead0c0u,0xd4d4d0d4u,0xc0c0ebd7u,0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccebd7u,0xebebebebu,0xc0d7eac0u,0xeaeaeaeau,0xeaead0c0u,0xd4d4d4d4u,0xc0d0d7c0u,
-  0xd7d7ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccebd7u,0xebebd7d7u,
-  0xc0d7c0c0u,0xc0c0eaeau,0xeaead0c0u,0xd4d0d4d4u,0xd0d4c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c0u,0xd7d7c0c0u,0xc0c0d5d5u,0xc0d5eac0u,0xeaeac0eau,
-  0xd4d0d4d4u,0xd0d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0ccccu,0xd5c0eaeau,0xc0d5c0c0u,0xeaeac0eau,0xd4d0d0d4u,0xc0d0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xeac0eaeau,
-  0xd5d5c0c0u,0xeac0c0eau,0xd4d0d0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xead5eaeau,0xd5eac0d5u,0xc0c0c0c0u,0xd0d0c0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xead5eaeau,0xd5eac0d5u,0xccc0d4c0u,0xc0c0c0d4u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xead5eaeau,0xd5eaead5u,0xd5eac0d5u,
-  0xccc0c0ccu,0xd4d4c0c0u,0xd5d5d5d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccc0c0u,0xd5c0eaeau,0xeaead5eau,0xd5d5c0d5u,0xccc0c0ccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xc0c0d5c0u,
-  0xeaeaeaeau,0xc0d5c0c0u,0xccc0c0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xd5c0eaeau,0xd5eac0c0u,0xccc0ccccu,
-  0xc0c0d5d5u,0xc0c0d5c0u,0xc0d5c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xc0c0d5c0u,0xd5eac0d5u,0xccccccccu,0xc0c0c0c0u,0xd5d5d5d5u,0xd5d5c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,
-  0xd5d5c0d5u,0xccccc0ccu,0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0ccc0u,0xccccc0ccu,0xd5c0d5d5u,
-  0xd5d5d5d5u,0xc0d5c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0c0u,0xc0c0ccccu,0xccccc0ccu,0xc0c0d5d5u,0xd5d5c0c0u,0xc0c0c0c0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccc0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xc0c0d4c0u,0xc0d4ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xc0d0d4d4u,0xd4d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd4d0c0d0u,0xd4c0e5d4u,0xc0e5c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xd4d4d4c0u,0xd4c0e5e5u,0xd7c0d7d7u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d4d0u,0xc0d4d4d4u,
-  0xd4c0c0e5u,0xebd7ebebu,0xd7d7c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0d4c0u,0xd4c0d4d4u,0xc0d0c0d4u,0xd7d7ebebu,0xd7ebd7d7u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xccc0ccccu,0xc0c0c0c0u,
-  0xeac0c0eau,0xd4d0d0d4u,0xc0d0c0c0u,0xc0c0ebd7u,0xd7d7ebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xc0ccd7d7u,0xc0d7c0c0u,0xd4c0c0c0u,0xeaeaeaeau,0xd0c0d4d4u,0xd0d0ccc0u,
-  0xccccd7c0u,0xebd7ebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xd7c0ebebu,
-  0xd7ebd7d7u,0xd4c0eac0u,0xeaeaeaeau,0xc0ead4d0u,0xd4d4c0d0u,0xccccc0ccu,0xebd7ebebu,0xc0d7ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xd7c0ebebu,0xebebd7ebu,0xd4c0eac0u,0xeaeaeaeau,
-  0xeaead4c0u,0xd4d4c0d0u,0xccccc0ccu,0xebd7ebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xd7c0ebd7u,0xebebd7d7u,0xd4c0eac0u,0xeaeaeaeau,0xeaead0c0u,0xd4d4d0d4u,0xccc0ccccu,
-  0xd7c0d7d7u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd7d7u,0xd7d7c0d7u,
-  0xc0c0eaeau,0xeaeaeaeau,0xeaeac0eau,0xd4d4d4d4u,0xc0d0ccc0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xeac0eaeau,0xeaeac0eau,
-  0xd4d4d4d4u,0xc0d0c0d4u,0xd5d5d5d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xc0d5eaeau,0xeaeac0eau,0xd4d4d0d4u,0xd4c0c0d4u,0xd5d5d5d5u,
-  0xd5d5c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xead5d5eau,
-  0xc0d5eaeau,0xeaeaeaeau,0xd0c0c0d0u,0xd4d4d5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xc0c0d5c0u,0xeaeaeaeau,0xd5d5eac0u,0xc0eac0c0u,0xc0ccc0c0u,
-  0xc0d4d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xd5c0d5d5u,
-  0xd5d5d5d5u,0xead5eaeau,0xd5d5c0c0u,0xccc0ccccu,0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0d5d5u,0xeaead5d5u,0xd5d5eaeau,0xd5d5ccc0u,
-  0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5c0u,0xead5eaeau,0xd5d5ead5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccd5c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xd5c0eaeau,
-  0xd5eaead5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0c0ead5u,0xd5eaead5u,0xd5d5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0d5c0u,0xd5ead5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,
-  0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5c0d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccc0c0u,0xc0c0d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0d5d5u,
-  0xd5d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0ccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccc0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0d0u,0xc0c0d4d4u,0xc0d4c0c0u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0d4d4u,0xd4c0e5e5u,0xc0d4d7d7u,0xc0d7c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd4d0c0d4u,0xd4c0e5e5u,0xd7c0ebebu,
-  0xd7ebd7d7u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xd4d4d0c0u,0xd4c0e5e5u,0xd7c0ebd7u,0xd7ebebebu,0xd7d7ccc0u,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d4c0u,0xc0d4d0d0u,
-  0xc0c0d4d4u,0xc0c0d7c0u,0xebd7ebebu,0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xc0c0c0c0u,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd4c0d4d4u,0xc0d0c0c0u,0xccc0c0ccu,0xd7c0ebebu,
-  0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xd7d7d7d7u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0eaeau,0xc0ead4c0u,0xd4d4c0c0u,0xccccccccu,0xc0ccebd7u,0xebebc0d7u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7d7c0d7u,0xd4e5d0c0u,0xeac0eaeau,0xeaeac0eau,0xd4d4d0d4u,
-  0xc0c0ccccu,0xc0ccd7d7u,0xd7d7ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebebebebu,
-  0xebebc0d7u,0xd4e5d0c0u,0xeac0eaeau,0xeaeaeaeau,0xd4c0d4d4u,0xd0d0c0c0u,0xccccc0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7ebc0d7u,0xd4e5d0c0u,0xeac0eaeau,
-  0xeaeaeaeau,0xc0ead4d4u,0xd4d4d0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xd7d7c0d7u,0xd4d4d0c0u,0xeac0eaeau,0xeaeaeaeau,0xc0ead4d4u,0xd4d4d0d4u,
-  0xccc0c0ccu,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xd4c0d0c0u,0xeac0eaeau,0xeaeaeaeau,0xeaead0c0u,0xd4d4d0d4u,0xccc0d5c0u,0xd5d5c0d5u,0xccc0ccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0eaeau,0xeaeaeaeau,
-  0xeaead0c0u,0xd4d4c0d0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5eac0u,0xeaeaeaeau,0xeaead0c0u,0xd0d4c0d0u,0xd5c0d5d5u,
-  0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xd5c0d5d5u,
-  0xd5eac0d5u,0xeaeaeaeau,0xeaead0c0u,0xd0d0d4c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,
-  0xccccc0ccu,0xccccc0ccu,0xc0c0d5d5u,0xd5d5d5d5u,0xd5c0ead5u,0xeaeac0d5u,0xeaeaeaeau,0xeaeac0eau,
-  0xc0c0d4d4u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xc0c0ead5u,
-  0xeaead5d5u,0xd5d5eaeau,0xeaead5d5u,0xeac0eaeau,0xc0eaccc0u,0xd4c0c0d4u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xc0c0d5c0u,0xeaead5eau,0xead5eaeau,0xeaead5d5u,
-  0xc0c0c0c0u,0xccc0ccccu,0xd4c0d5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xc0c0c0c0u,0xead5eaeau,0xd5d5eaeau,0xd5eac0d5u,0xccc0ccccu,0xccccccccu,0xc0ccd5c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xd5c0eaeau,
-  0xd5eaead5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5c0u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xc0c0ead5u,0xeaead5d5u,0xd5d5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0c0u,0xc0c0d5c0u,0xd5ead5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccd5c0u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xd5c0c0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xc0d0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d4d0d4u,0xd0d0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d0d0u,0xd4c0d4d4u,
-  0xd4d0c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd0c0c0d4u,0xc0c0d0c0u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,
-  0xc0c0d0d0u,0xd4d4d4c0u,0xd4d4c0d4u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd7d7c0c0u,0xc0c0d4c0u,0xe5e5d4e5u,
-  0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccd7d7u,0xebebd7d7u,0xd7d7c0d7u,0xd4d4e5e5u,0xc0d4ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xebebebebu,
-  0xebebd7ebu,0xc0c0d4d4u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xebebebebu,0xebebd7d7u,0xc0d7c0c0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccd7c0u,0xd7d7d7d7u,0xd7d7c0d7u,0xc0c0d4c0u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0d4c0u,
-  0xd4d4d4d4u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0d4d4u,0xd4d4d0d4u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0d5d5u,
-  0xd5d5d5d5u,0xc0d5d4d4u,0xd0d4c0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd0c0d0d0u,0xc0d0d5c0u,
-  0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0d5u,
-  0xd5d5d5d5u,0xd5d5eaeau,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0d5u,0xd5d5ead5u,0xeaeaeaeau,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5d5d5u,0xd5c0d5d5u,0xeaeaeaeau,0xd5ead5d5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xc0d5d5d5u,
-  0xd5d5d5d5u,0xd5d5ead5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xd5c0d5d5u,0xd5d5eaeau,0xd5d5ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,
-  0xd5d5d5d5u,0xc0d5c0c0u,0xd5d5ead5u,0xeaead5eau,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xc0d5c0ccu,0xd5d5eaeau,
-  0xeaead5eau,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xccc0c0ccu,0xd5d5eaeau,0xeaead5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xc0d0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d4d4d4u,0xd0d0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d0d0u,0xd4c0d4d4u,
-  0xd4d4c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd4c0c0d4u,0xc0c0d0d4u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xd0c0d4d0u,0xd4d4d4c0u,0xd4d4d0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xebc0c0d7u,0xc0ead0d0u,0xc0d0d4c0u,0xe5e5c0d4u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xebc0c0d7u,0xc0eac0d0u,0xd7c0c0d7u,0xe5d4d4e5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0c0d7u,0xc0c0d7c0u,
-  0xebd7d7ebu,0xd4c0c0d4u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd7d7ebd7u,0xebebd7ebu,0xc0d7d0c0u,0xd0d4ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xebd7ebebu,0xd7ebc0d7u,0xd4c0d4d4u,0xd0d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xebd7d7ebu,0xc0d7d0c0u,
-  0xd4d4d4d4u,0xd0d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd7c0c0d7u,0xc0c0d0d0u,0xd4d4d4d4u,0xd0d4ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xc0c0eac0u,0xc0ead0d0u,0xd0d0d0d0u,0xc0d0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xeac0eaeau,0xc0eac0c0u,0xc0c0c0c0u,
-  0xc0c0d5d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd5c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xd5d5c0d5u,0xd5c0d5d5u,0xc0d5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5c0c0u,
-  0xc0c0d5c0u,0xd5d5d5d5u,0xc0d5eaeau,0xd5eaccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xeaeaeaeau,0xeaeaeaeau,
-  0xeaeac0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd5c0d5d5u,0xc0c0c0c0u,0xead5eaeau,0xeaeaeaeau,0xd5d5c0eau,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xc0d5c0c0u,
-  0xd5c0ead5u,0xeaeac0d5u,0xd5c0d5eau,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5d5u,0xd5d5c0c0u,0xc0c0c0c0u,0xc0d5d5c0u,0xead5d5eau,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,
-  0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0c0ccu,0xc0c0d5d5u,0xeaead5eau,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccccu,
-  0xc0ccd5c0u,0xead5d5eau,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xd5c0d5d5u,0xd5d5c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccc0c0u,0xd5d5d5d5u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xc0d0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d4d0d4u,0xc0d0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d0d0u,0xd4c0d4d4u,
-  0xd0d0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd0c0d4d4u,0xd0d0c0c0u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,
-  0xc0c0d4d4u,0xc0d4d4d4u,0xd0d4c0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccd7d7u,0xc0d7c0c0u,0xc0c0e5d4u,0xc0d4d4d4u,0xc0d4c0d4u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xd7c0ebebu,0xd7ebd7d7u,0xd7d7d4c0u,0xd4e5d4c0u,0xd0c0d4d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xd7c0ebebu,0xebebebebu,0xd7ebd4c0u,
-  0xd4e5c0c0u,0xd4d0d4d4u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xd7c0ebebu,0xebebebebu,0xd7ebd4c0u,0xd4d4d0c0u,0xd4d0d4d4u,0xc0d4ccccu,
-  0xccccc0ccu,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccd7d7u,
-  0xd7d7d7d7u,0xc0d7c0c0u,0xc0c0d0d0u,0xd4d4d4d4u,0xd0d4ccc0u,0xc0ccc0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xeac0eaeau,0xc0ead4d0u,
-  0xd4d4d4d4u,0xd4d4ccc0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0eaeau,0xc0ead4d0u,0xd4d4d4d4u,0xd0d4c0c0u,0xc0c0d5d5u,
-  0xc0c0c0d5u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,
-  0xc0c0eac0u,0xc0ead4d0u,0xd4d4d0d4u,0xc0d0c0d4u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0c0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xc0d5c0c0u,0xc0c0d4c0u,0xd0d4c0d0u,
-  0xe5c0c0e5u,0xc0c0ead5u,0xc0d5d5eau,0xc0d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0d5d5u,0xd5d5c0c0u,0xccc0c0ccu,0xc0c0d4c0u,0xe5e5c0e5u,0xd5c0eaeau,0xd5d5eaeau,
-  0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5c0u,0xd5d5c0d5u,
-  0xccc0ccccu,0xccccc0ccu,0xe5d4c0e5u,0xd5c0eaeau,0xc0d5eaeau,0xd5eac0d5u,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5c0d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xd4c0c0e5u,
-  0xd5c0eaeau,0xc0d5eaeau,0xeaeac0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5c0d5d5u,0xc0c0ccccu,0xccccccccu,0xc0ccc0c0u,0xeac0eaeau,0xc0c0ead5u,0xeaeac0d5u,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xc0c0d5c0u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccccu,
-  0xccccccccu,0xc0ccc0c0u,0xeaeac0eau,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5c0d5u,0xc0c0ccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0d5c0u,
-  0xd5d5c0d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xd5c0c0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0c0c0u,0xd0d0c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xd0c0d0d0u,0xc0d0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xc0d0d0d0u,0xc0d0c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xd0d4d0c0u,0xc0d0c0e5u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc0c6c0c0u,0xc0c0d4d0u,0xd4d4c0d0u,0xe5c0c0e5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xd4c0d4d4u,0xd0c0d4d4u,
-  0xd4d4c0d0u,0xe5e5ebc0u,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xc0c6c6c0u,0xc6c6c0c0u,0xd4c0d4e5u,0xd0c0d4d4u,0xc0d4d0d4u,0xc0c0ebebu,0xc0d7ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xd7c0c0d7u,0xc0c0d7d7u,
-  0xd4c0e5e5u,0xc0d4c0d4u,0xd0c0d4d4u,0xc0d0d7ebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xebd7d7ebu,0xd7d7ebebu,0xc0d7e5e5u,0xc0d4d0c0u,0xd4d0d4d4u,
-  0xc0d0d7d7u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,
-  0xebd7ebebu,0xebebebebu,0xc0d7d4d4u,0xc0d4d0d0u,0xd4d0d4d4u,0xd0d4c0c0u,0xccccccccu,0xc0ccc0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd7d7ebebu,0xebebd7d7u,0xc0c0c0c0u,
-  0xc0c0d0d0u,0xd4d4d4d4u,0xd0d4ccc0u,0xccccc0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xd7c0d7d7u,0xd7d7c0c0u,0xeac0eaeau,0xc0ead4d0u,0xd4d4d4d4u,0xd4d4c0c0u,
-  0xc0c0c0c0u,0xc0c0d5d5u,0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0c0c0u,0xc0d4eaeau,0xc0ead4d0u,0xd4d4d4d4u,0xd0d4c0c0u,0xc0c0d5c0u,0xd5d5ead5u,0xd5d5c0c0u,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5c0d5u,0xd4d4eac0u,0xc0ead4d0u,
-  0xd4d4d0d4u,0xc0d0c0c0u,0xd5c0eaeau,0xd5eaeaeau,0xd5eac0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccd5c0u,0xd5d5c0c0u,0xd4c0c0d4u,0xc0c0d4c0u,0xd0d4c0d0u,0xe5c0c0d4u,0xead5eaeau,
-  0xd5eaead5u,0xeaeac0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5c0d5u,
-  0xc0c0c0d4u,0xccc0c0ccu,0xc0c0e5c0u,0xe5e5c0d4u,0xd5d5eaeau,0xd5ead5c0u,0xeaead5d5u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0d5d5u,0xd5d5c0d5u,0xc0c0ccc0u,0xccccccccu,0xccccd4c0u,
-  0xd4d4c0d4u,0xd5c0eaeau,0xd5d5d5c0u,0xeaead5eau,0xc0c0ccccu,0xccccc0ccu,0xccccc0ccu,0xd5c0d5d5u,
-  0xd5d5d5d5u,0xd5d5c0d5u,0xc0c0ccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0d5c0u,
-  0xeaead5eau,0xc0c0ccccu,0xccccc0ccu,0xccccc0ccu,0xc0c0d5c0u,0xd5d5c0d5u,0xd5c0c0d5u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xead5d5d5u,0xc0c0ccccu,0xccccc0ccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xd5c0d5d5u,
-  0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xc0c0d5d5u,0xc0d5c0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0c0u,0xc0c0d5c0u,0xc0d5c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xc0c0d5c0u,0xc0c0c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xc0d0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xc0d0e5d4u,0xc0c0c0c0u,
-  0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d4d0d4u,0xc0d0e5d4u,0xd7c0d7d7u,0xd7d7ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6c0d0u,0xd4c0d4d4u,
-  0xc0d0e5d4u,0xebc0ebebu,0xd7d7ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0c0u,0xc6c0c6c6u,0xc6c6c6c6u,0xc0c0d4c0u,0xd4d4c0d4u,0xd0d0e5c0u,0xd7c0ebd7u,0xd7ebccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd7d7u,0xc0d7ccccu,0xccccc0c0u,
-  0xc0c0d4d4u,0xd4d4c0d4u,0xd0d0c0d0u,0xc0c0c0c0u,0xd7d7ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xd7c0ebebu,0xd7ebc0c0u,0xc0c0d4d4u,0xc0d4d4d4u,0xd0d4d0c0u,0xd4d0d0d0u,
-  0xccc0c0ccu,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xd7c0ebebu,
-  0xebebd7d7u,0xc0d7e5d4u,0xc0d4d4d0u,0xc0d0d0d0u,0xd4d4d0d4u,0xc0d0ccccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xd7c0ebebu,0xebebebebu,0xc0d7e5d4u,0xc0d4d0c0u,
-  0xd0c0d0d0u,0xd4d4d4d4u,0xd0d0ccc0u,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd7d7u,0xd7d7d7d7u,0xc0d7e5d4u,0xc0d4c0c0u,0xd0d0d4d0u,0xd4d4d4d4u,0xd0d4c0c0u,
-  0xccccc0ccu,0xc0c0d5d5u,0xead5c0d5u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,
-  0xc0c0d4c0u,0xc0c0c0d4u,0xd0c0d4d4u,0xd4d4d4d4u,0xc0d0d4d4u,0xccc0c0c0u,0xd5c0eaeau,0xead5d5eau,
-  0xc0d5c0c0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd4c0d4d4u,0xd0c0d4d0u,
-  0xd4d4d0d4u,0xc0d0d4e5u,0xc0d4c0c0u,0xd5d5eaeau,0xd5d5eaeau,0xd5eac0d5u,0xccc0c0ccu,0xc0ccc0c0u,
-  0xc0c0ccccu,0xccccccccu,0xc0c0d5d5u,0xd4c0d4d4u,0xc0d4d4d0u,0xd4d4d0d0u,0xd4c0e5e5u,0xc0c0d5d5u,
-  0xead5eaeau,0xd5d5ead5u,0xeaead5d5u,0xc0c0c0ccu,0xc0c0d5d5u,0xd5d5c0c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xc0d5d4d4u,0xc0c0d0d0u,0xd0d4d0d0u,0xd4c0d4e5u,0xd5c0d5d5u,0xeaead5eau,0xc0c0d5d5u,0xeaead5eau,
-  0xc0d5c0c0u,0xc0c0d5c0u,0xd5d5d5d5u,0xc0c0d5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xc0ccd0d0u,0xd0d0c0c0u,
-  0xc0ccc0d4u,0xd5c0ead5u,0xeaead5d5u,0xc0c0d5c0u,0xd5d5d5d5u,0xc0d5c0c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xc0c0ccccu,0xc0ccc0c0u,0xc0c0ccccu,0xccccc0c0u,0xc0c0ead5u,0xd5eac0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0c0ccu,0xc0c0c0c0u,0xccc0c0ccu,
-  0xc0ccc0c0u,0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0ccc0c0u,0xc0c0d5d5u,0xd5d5c0d5u,
-  0xc0d5c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccc0c0u,0xc0c0d5c0u,0xd5d5c0d5u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0c0u,
-  0xc0c0c0c0u,0xd5d5c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xc0c0c0c0u,0xc0d5c0c0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5d5d5d5u,0xd5d5c0d5u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5c0c0u,0xd5c0d5d5u,
-  0xc0c0d5c0u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccc0ccu,0xc0d5d5d5u,0xc0d5ffc0u,0xc0ebd5c0u,0xd7c0c0d7u,0xc0d5ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xd5c0d5c0u,
-  0xeac0ffc0u,0xebffc0c6u,0xebc0d7ebu,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xd5c0c0c0u,0xeaebffc0u,0xebffd7ebu,0xebebd7ebu,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xd5c6ffeau,0xeaebffd5u,0xebffd7ebu,0xebebd7ebu,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xffc6ebffu,0xffebffffu,
-  0xebebd7ebu,0xd7ebc0d7u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xebc6ebebu,0xebebc6c6u,0xebebd7d7u,0xc0d7c0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xc6ccebebu,0xc6ebebd7u,0xd7ebc6d7u,0xd0c0c0d4u,0xd0d0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc6c6u,0xebebd7ebu,0xc6d7c0c6u,
-  0xd4d4d0c0u,0xd0d4c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc6c6d0c0u,0xd4d0d0c0u,0xd4d4c0d0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xd4c0c6c0u,0xc6c6c0c0u,0xc0c0d4c0u,0xc0d4d4c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xccccccccu,0xd4c0c0c0u,0xc0c0c0eau,0xd0d0d0c0u,
-  0xd4c0e5e5u,0xd4d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xebc0ebebu,0xc0c0c0c0u,0xd4c0eac0u,0xeaeac0eau,0xd0d0c0c0u,0xe5d4e5e5u,0xd4e5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xebebebebu,0xc0ebc0ebu,0xd4d4eac0u,
-  0xeaeac0eau,0xd0d0c0d0u,0xe5e5e5e5u,0xc0d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccc0ccu,0xebd7ebebu,0xc0ebc0ebu,0xd4d4eac0u,0xeaeaeaeau,0xd0c0c0d0u,0xe5d4c0d4u,
-  0xd7c0c0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xebd7ebebu,
-  0xebc0c0d7u,0xd4d4eac0u,0xeaeaeaeau,0xd0c0c0d0u,0xd4d4d7c0u,0xebd7c0ebu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xd7d7ebebu,0xc0c0c0c0u,0xd4d4eac0u,0xeaeaeaeau,
-  0xd0c0d0d0u,0xc0c0c0ccu,0xd7d7ebebu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0c0c0c0u,0xccccd0c0u,0xc0d4eaeau,0xeaeaeaeau,0xd0c0d0d0u,0xccc0ccccu,0xd7c0ebd7u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccd0c0u,
-  0xc0d4eaeau,0xeaeaeaeau,0xc0ead0d0u,0xc0d0c0ccu,0xd7d7ebebu,0xc0ebccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccd0c0u,0xc0d4eaeau,0xeaeaeaeau,0xc0ead0d0u,
-  0xd0d0c0c0u,0xebd7ebebu,0xc0ebccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xc0ccd0d0u,0xc0d0eaeau,0xeaeaeaeau,0xeaead0c0u,0xd0d0d7c0u,0xd7d7ebebu,0xc0ebccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xeac0eaeau,
-  0xeaeaeaeau,0xeaeac0eau,0xc0c0c0c0u,0xd7d7d7d7u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xc0d5eac0u,0xeaeaeaeau,0xeaeac0c0u,0xd5d5d5d5u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xd5c0ead5u,0xd5d5c0d5u,0xc0c0c0c0u,0xc0c0d5d5u,0xeaead5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xd5c0eaeau,0xd5ead5d5u,0xccc0ccccu,
-  0xc0ccead5u,0xeaead5eau,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5eaeau,0xd5ead5d5u,0xccc0ccccu,0xc0ccead5u,0xeaead5eau,0xd5d5c0d5u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xd5d5ead5u,
-  0xd5ead5d5u,0xc0d5ccccu,0xc0ccead5u,0xeaead5eau,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccd5c0u,
-  0xeaead5d5u,0xd5d5d5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0c0u,
-  0xd5d5ead5u,0xeaead5eau,0xd5d5d5d5u,0xc0d5ccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0ccd5d5u,0xead5eaeau,0xeaead5d5u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccd5c0u,0xd5d5d5d5u,0xead5eaeau,0xd5ead5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xd5d5d5d5u,
-  0xeaeaeaeau,0xeaead5d5u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xc0ccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0c0d0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd4d0d0d4u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd4c0d4d4u,0xd0c0d4d0u,0xc0d4d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xe5d4e5e5u,
-  0xc0d4d4d0u,0xd4d4d0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd4c0e5e5u,0xd4e5d4c0u,0xd0d4c0d0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6c0c6u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd7c0u,0xc0d7d4c0u,0xd4e5d4c0u,0xd0d4c0d0u,0xc0eac0c0u,0xc0c0c0c0u,0xc0c0d7c0u,0xd7d7c0d7u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xd7ebc0d7u,0xd4d4d4c0u,
-  0xd0d0eac0u,0xeaeaeaeau,0xd4c0c0e5u,0xd7d7ebd7u,0xebebd7d7u,0xccc0c0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd7c0ebebu,0xd7ebc0c0u,0xc0c0d4d0u,0xc0d0eaeau,0xeaeaeaeau,0xd4c0c0e5u,
-  0xebd7ebebu,0xebebd7ebu,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0ebebu,
-  0xd7d7d7d7u,0xd4c0d4d0u,0xeac0eaeau,0xeaeaeaeau,0xd4c0c0e5u,0xd7d7ebebu,0xebebd7d7u,0xccc0c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0ebebu,0xebebebebu,0xc0d7d0d4u,0xeac0eaeau,
-  0xeaeac0eau,0xd4d4c0d4u,0xd7d7d7d7u,0xd7d7c0d7u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xd7c0ebebu,0xebebebebu,0xd7ebc0c0u,0xeaeaeaeau,0xeaeac0eau,0xd4d4ccc0u,0xc0c0c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xebebebebu,
-  0xd7ebc0c0u,0xeaeaeaeau,0xeaeac0eau,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xebd7ebebu,0xc0d7c0d4u,0xeaeaeaeau,0xeaeac0eau,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd7c0d7d7u,0xd0c0c0c0u,0xeaeaeaeau,0xeaeac0eau,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd0c0c0c0u,
-  0xeaeaeaeau,0xeaeac0eau,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0eac0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xc0c0d5d5u,0xc0c0c0c0u,0xc0c0d5d5u,0xead5d5eau,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xd5c0d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xeaeac0eau,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0d5c0u,0xc0c0d5d5u,0xc0c0c0c0u,0xd5c0ead5u,0xeaeac0d5u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d5d5u,0xc0d5c0d5u,
-  0xc0c0c0c0u,0xc0c0d5c0u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5c0c0u,0xc0c0d5c0u,0xd5d5c0d5u,0xd5d5c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccd5c0u,0xd5d5c0c0u,0xc0c0d5d5u,0xeaeaeaeau,0xd5ead5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5c0c0c0u,0xc0c0ead5u,
-  0xeaeaeaeau,0xeaead5eau,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0d5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd0c0u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd0c0d4d0u,0xc0d0d0d0u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4c0u,
-  0xd0c0d4d4u,0xd4d4d0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd4c0e5e5u,0xc0d4d4d0u,0xd4d4c0d4u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6c0c6u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0e5d4u,0xd4e5d0c0u,0xd4d4c0d0u,0xeaeac0c0u,0xc0c0c0c0u,0xc0c0d7c0u,0xd7d7c0d7u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd7d7d4c0u,0xe5e5c0d4u,
-  0xd4d4eac0u,0xeaeaeaeau,0xd4c0c0e5u,0xd7d7ebd7u,0xebebd7d7u,0xccc0c0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccd7c0u,0xebebc0d7u,0xe5d4c0d4u,0xd0d4eac0u,0xeaeaeaeau,0xd4c0c0e5u,
-  0xebd7ebebu,0xebebd7ebu,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,
-  0xebebd7ebu,0xd4c0d0c0u,0xc0d4eaeau,0xeaeaeaeau,0xd4c0c0e5u,0xd7d7ebebu,0xebebd7d7u,0xccc0c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xd7ebd7d7u,0xc0c0d4d0u,0xc0d4eaeau,
-  0xeaeac0eau,0xd4d4c0d4u,0xd7d7d7d7u,0xd7d7c0d7u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccebd7u,0xebebd7ebu,0xc0d7d4d4u,0xc0d0eaeau,0xeaeac0eau,0xd4d4ccc0u,0xc0c0c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xebebebebu,
-  0xc0d7d4d4u,0xeac0eaeau,0xeaeac0eau,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xebebebebu,0xc0d7d4d4u,0xeac0eaeau,0xeaeac0eau,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xc0c0d4d4u,0xeac0c0eau,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0d4u,
-  0xc0c0d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xd5d5eaeau,0xeaeac0c0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xc0c0c0d5u,0xc0c0d5c0u,0xead5eaeau,0xd5eaccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5c0c0d5u,0xc0c0d5d5u,0xeaeaeaeau,
-  0xc0eaccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0c0u,0xd5d5c0c0u,0xd5c0ead5u,0xc0d5c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5c0c0u,
-  0xd5c0d5d5u,0xd5c0d5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ead5u,0xeaeaeaeau,0xd5eac0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xc0c0d5d5u,0xeaeaeaeau,0xeaeac0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,0xc0d5d5c0u,
-  0xead5eaeau,0xd5eac0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5c0d5d5u,0xd5d5c0c0u,0xd5d5d5d5u,0xd5d5c0c0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccc0ccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4d4u,0xc0c0c0c0u,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0cce5d4u,0xc0d4d0d0u,0xd0c0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0e5c0u,0xd4e5c0c0u,0xd4d0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd7d7c0d7u,0xd4e5d4c0u,0xd4c0d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd7d7u,0xebebc0d7u,
-  0xd4e5d4c0u,0xc0d4d4d4u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0ebebu,0xebebc0d7u,0xc0d4d4d0u,0xd4d4d4c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6c0c6u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xd7d7d7d7u,0xd7d7c0c0u,0xd0c0d4d0u,0xd0d4c0c0u,0xeaeac0c0u,0xc0c0c0c0u,0xc0c0d7c0u,0xd7d7c0d7u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xebd7ebebu,0xc0d7ccccu,0xd0c0d4d4u,
-  0xc0d0eaeau,0xeaeaeaeau,0xd4c0c0e5u,0xd7d7ebd7u,0xebebd7d7u,0xccc0c0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xebd7ebebu,0xc0d7c0ccu,0xd4d0d4d4u,0xc0d0eaeau,0xeaeaeaeau,0xd4c0c0e5u,
-  0xebd7ebebu,0xebebd7ebu,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xebd7ebebu,
-  0xc0d7d0c0u,0xd4d4d0d4u,0xeac0eaeau,0xeaeaeaeau,0xd4c0c0e5u,0xd7d7ebebu,0xebebd7d7u,0xccc0c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0d7d7u,0xc0c0d4d0u,0xd4d4d0d4u,0xeac0eaeau,
-  0xeaeaeaeau,0xd4c0c0d4u,0xd7d7d7d7u,0xd7d7c0d7u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0c0u,0xd0c0d4d4u,0xd4d4d0d0u,0xeac0eaeau,0xc0eac0c0u,0xc0c0ccc0u,0xc0c0c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d4d4u,
-  0xd4d4c0d0u,0xeaeaeaeau,0xc0c0d5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd0d0u,0xd4d4c0d0u,0xeaeac0eau,0xc0c0ead5u,
-  0xd5eaccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd0c0u,0xd4d0c0d0u,0xeaeac0c0u,0xd5c0ead5u,0xeaeac0c0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xd0c0c0d0u,
-  0xc0c0c0c0u,0xd5d5eaeau,0xeaead5d5u,0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0d4d4c0u,0xccc0c0c0u,0xd5d5eaeau,0xeaead5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,
-  0xd5d5c0d5u,0xd4c0c0d4u,0xccccc0c0u,0xd5d5eaeau,0xd5d5eaeau,0xeaeac0d5u,0xc0c0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xccccc0c0u,
-  0xd5d5d5d5u,0xeaeaeaeau,0xd5eac0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccc0c0u,0xc0c0ead5u,0xeaead5eau,0xc0c0c0c0u,
-  0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5d5u,0xc0c0d5c0u,
-  0xc0d5ccc0u,0xccccc0c0u,0xd5c0eaeau,0xd5eac0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5c0d5d5u,0xd5d5c0d5u,0xc0c0ccc0u,0xccccc0ccu,0xd5d5d5eau,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xd5c0d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xccccc0ccu,0xd5d5c0d5u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,
-  0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xd5c0d5d5u,0xc0d5c0c0u,0xccccccccu,0xc0ccc0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccc0ccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4d4u,0xc0c0c0c0u,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xd4c0d4d4u,0xc0d4c0d0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0e5e5u,0xd4d4c0c0u,0xd4d0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccd7c0u,0xd7d7e5c0u,0xd4e5d4c0u,0xd4c0d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd7c0ebd7u,0xebebc0d7u,
-  0xd4e5d4c0u,0xc0d4d4d4u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccd7c0u,0xd7d7ebebu,0xd7ebc0d7u,0xc0d4d4d0u,0xd4d4d4c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6c0c6u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,
-  0xd7ebebd7u,0xc0d7c0c0u,0xc0c0d0d0u,0xd4d4c0d0u,0xeaeac0c0u,0xc0c0c0c0u,0xc0c0d7c0u,0xd7d7c0d7u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xebebd7d7u,0xccc0ccccu,0xd0c0d4d0u,
-  0xd0d4eac0u,0xeaeac0eau,0xd4c0c0e5u,0xd7d7ebd7u,0xebebd7d7u,0xccc0c0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccebd7u,0xebebc0d7u,0xccccc0ccu,0xd4d0d4d4u,0xc0d0eaeau,0xeaeaeaeau,0xd4c0c0e5u,
-  0xebd7ebebu,0xebebd7ebu,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebd7u,0xebebc0d7u,
-  0xccccc0ccu,0xd4d0d4d4u,0xeac0eaeau,0xeaeaeaeau,0xd4c0c0e5u,0xd7d7ebebu,0xebebd7d7u,0xccc0c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xd7d7ccc0u,0xccccd0c0u,0xd4d4d0d4u,0xeac0eaeau,
-  0xeaeaeaeau,0xd4c0c0d4u,0xd7d7d7d7u,0xd7d7c0d7u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0ccc0u,0xc0c0d4d0u,0xd4d4c0d4u,0xeaeaeaeau,0xeaeaeaeau,0xd4c0ccc0u,0xc0c0c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xd5d5c0d5u,0xc0d4d4d0u,
-  0xd4d4c0d4u,0xeaeaeaeau,0xeaeac0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5c0d5u,0xd4d4d0c0u,0xd4d4c0d4u,0xeaeaeaeau,0xc0ead5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd4c0c0d4u,0xd0d0eac0u,0xeaeaeaeau,0xc0ead5d5u,0xeaeac0d5u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0d4u,0xc0c0c0ccu,
-  0xc0c0eaeau,0xd5c0ead5u,0xeaead5eau,0xc0c0c0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccc0c0u,0xd5c0ead5u,0xeaead5d5u,
-  0xd5d5d5d5u,0xd5d5ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xd5c0ead5u,0xd5ead5d5u,0xead5d5eau,0xc0d5ccc0u,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xd5c0ead5u,0xd5d5ead5u,0xeaead5d5u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0ead5u,0xd5d5eaeau,0xd5eac0c0u,
-  0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd5c0ead5u,0xd5d5eaeau,0xc0d5c0c0u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,
-  0xd5d5d5eau,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd5c0u,0xd5d5c0c0u,0xc0c0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xd5c0d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xc0d5c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccc0ccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d4d4u,0xc0d4c0c0u,0xc0d0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d7d7u,
-  0xc0d7e5d4u,0xd4e5d4c0u,0xd0d4c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd7c0u,0xd7d7ebebu,0xd7ebe5c0u,0xd4e5c0c0u,0xd4d4c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xd7c0ebd7u,0xd7ebebebu,0xd7d7e5c0u,0xd4e5d0c0u,0xd4c0d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xebd7ebebu,0xebebd7d7u,0xc0c0d4c0u,
-  0xc0d4d0c0u,0xc0d0d4d4u,0xc0c0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xebd7ebebu,0xd7ebc0c0u,0xccccc0c0u,0xc0c0d4d0u,0xd4d4c0c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6c0c6u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xebd7ebebu,
-  0xc0d7ccccu,0xccccc0ccu,0xd4c0d4d4u,0xc0c0eaeau,0xc0eac0c0u,0xc0c0c0c0u,0xc0c0d7c0u,0xd7d7c0d7u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd7c0d7d7u,0xc0d7ccccu,0xc0ccd0c0u,0xd4d4c0d4u,
-  0xeaeaeaeau,0xeaead0c0u,0xd4c0c0e5u,0xd7d7ebd7u,0xebebd7d7u,0xccc0c0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0c0u,0xccc0c0ccu,0xd0c0d4d0u,0xd4d4eac0u,0xeaeaeaeau,0xeaead0c0u,0xd4c0c0e5u,
-  0xebd7ebebu,0xebebd7ebu,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd0c0u,
-  0xd4d0d4d4u,0xc0d4eaeau,0xeaeaeaeau,0xeaead0c0u,0xd4c0c0e5u,0xd7d7ebebu,0xebebd7d7u,0xccc0c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xccccd0c0u,0xd4d4d4d4u,0xc0d4eaeau,0xeaeaeaeau,
-  0xeaead0c0u,0xd4c0c0d4u,0xd7d7d7d7u,0xd7d7c0d7u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xccc0d0c0u,0xd4d4d0d4u,0xeac0eaeau,0xeaeaeaeau,0xeaead0c0u,0xd4c0ccc0u,0xc0c0c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xc0d5c0ccu,0xd4d0d0d4u,
-  0xeac0eaeau,0xeaeaeaeau,0xc0eac0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xd0d0d0d4u,0xeac0eaeau,0xeaeaeaeau,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5d4c0u,0xd0c0d0d0u,0xeac0eaeau,0xeaeac0eau,0xd5d5d5eau,0xd5d5c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d4c0u,0xc0d4c0c0u,0xeaeaeaeau,
-  0xeaeac0eau,0xead5eaeau,0xd5d5d5c0u,0xd5d5d5d5u,0xc0d5c0c0u,0xccccc0ccu,0xccccccccu,0xccccd5c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xd4d4ccc0u,0xc0c0eaeau,0xeaead5c0u,0xead5eaeau,0xd5ead5d5u,
-  0xead5eaeau,0xc0d5c0c0u,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd4c0ccc0u,0xccccc0c0u,0xc0c0d5c0u,0xead5eaeau,0xeaead5d5u,0xeaead5eau,0xc0c0ccc0u,0xccccc0ccu,
-  0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0c0ccccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5eaeau,0xd5eaead5u,0xeaeac0d5u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xd5c0ead5u,0xd5d5eaeau,0xd5eac0c0u,
-  0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd5c0d5d5u,0xead5eaeau,0xc0d5c0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5d5d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,
-  0xd5d5d5eau,0xc0c0c0c0u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5c0d5u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xd5d5c0d5u,0xc0c0c0c0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,
-  0xc0c0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd0d0u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d0d0u,0xc0d4d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xd4d0d4d0u,0xd4d4d0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd0c0u,0xc0c0c0c0u,0xd0d4c0c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6c0c6u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd4d4d4d4u,0xd4c0d0d4u,0xc0d0c0c0u,0xc0c0c0c0u,0xc0c0d7c0u,0xd7d7c0d7u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4c0u,0xe5e5d4e5u,
-  0xc0c0c0c0u,0xd7c0c0d7u,0xd4c0c0e5u,0xd7d7ebd7u,0xebebd7d7u,0xccc0c0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0cce5d4u,0xd4e5c0d4u,0xd7d7d7d7u,0xebd7d7ebu,0xc0d7c0e5u,
-  0xebd7ebebu,0xebebd7ebu,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccd4c0u,0xc0d4d7c0u,0xebebebebu,0xebebebebu,0xc0d7c0e5u,0xd7d7ebebu,0xebebd7d7u,0xccc0c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d7d7u,0xebd7ebebu,
-  0xebebebebu,0xc0d7c0d4u,0xd7d7d7d7u,0xd7d7c0d7u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccd4d0u,0xc0c0c0c0u,0xd7d7d7d7u,0xd7d7d7d7u,0xd4c0ccc0u,0xc0c0c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4d0u,
-  0xd4d4d4d4u,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd0c0u,0xd4d4d4d4u,0xc0d4d5c0u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd0d0d4d4u,0xc0d4d5d5u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xc0c0d0d0u,
-  0xd0d0d5c0u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5c0c0u,0xc0c0d5c0u,0xd5d5d5d5u,0xd5d5ccc0u,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,
-  0xd5d5ead5u,0xd5ead5d5u,0xd5d5c0d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5ead5u,0xeaeaeaeau,0xd5d5c0d5u,
-  0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xd5c0d5d5u,0xd5d5eaeau,0xeaead5eau,0xd5d5d5c0u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0ead5u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xc0d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0ead5u,0xd5ead5d5u,0xd5d5c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xd5c0d5d5u,0xeaeaeaeau,0xd5d5c0d5u,0xc0c0d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xeaeaeaeau,0xd5eac0d5u,
-  0xc0ccd5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccd5c0u,0xead5eaeau,0xd5eac0d5u,0xccccd5c0u,0xd5d5d5d5u,0xc0d5ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0ccc0u,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd0d0u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d4d0u,0xc0d4d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xd4d0d4d4u,0xd4d4d0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd0c0u,0xc0d4c0c0u,0xd4d4c0c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6c0c6u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd0c0u,0xd4c0d4d4u,0xd4c0d4d4u,0xd0d0c0c0u,0xc0c0c0c0u,0xc0c0d7c0u,0xd7d7c0d7u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xe5d4d4e5u,
-  0xc0c0d0d0u,0xc0d0c0eau,0xd4d0c0e5u,0xd7d7ebd7u,0xebebd7d7u,0xccc0c0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4c0u,0xe5e5c0d4u,0xd7d7c0c0u,0xc0d0c0eau,0xd4d0c0e5u,
-  0xebd7ebebu,0xebebd7ebu,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0d0u,0xd4d4d7c0u,0xebebd7d7u,0xc0c0c0c0u,0xd4d0c0e5u,0xd7d7ebebu,0xebebd7d7u,0xccc0c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d0d4u,0xc0c0d7d7u,0xebebebebu,
-  0xd7d7c0d7u,0xd4c0c0d4u,0xd7d7d7d7u,0xd7d7c0d7u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd0c0d4d4u,0xd4d4c0c0u,0xd7d7ebebu,0xebebc0d7u,0xc0ccccc0u,0xc0c0c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d4d4u,
-  0xd4d4d0d4u,0xc0c0d7d7u,0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d4d4u,0xd4d4d0d4u,0xc0d0c0c0u,0xd7d7c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0c0u,0xc0c0d0d0u,0xd0d0d0d0u,0xc0d0eaeau,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xc0d5c0c0u,0xc0c0c0c0u,
-  0xc0c0eaeau,0xeaeac0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5c0c0u,0xd5d5c0d5u,0xc0c0c0c0u,0xc0c0d5c0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0eaeau,
-  0xc0ead5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xd5c0d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xead5eaeau,0xeaeaeaeau,0xeaead5eau,0xc0c0c0c0u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd5eaead5u,0xeaeaeaeau,0xeaeac0d5u,0xc0c0d5c0u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5eac0c0u,0xead5eaeau,
-  0xd5d5c0c0u,0xc0c0d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccd5c0u,0xeaead5d5u,0xc0c0c0d5u,0xc0c0c0c0u,0xd5c0d5d5u,0xc0d5c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,
-  0xeaead5eau,0xc0d5c0c0u,0xc0ccc0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xeaead5d5u,0xc0c0ccccu,0xc0ccc0c0u,
-  0xd5c0d5d5u,0xd5d5d5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd5c0u,0xd5d5c0d5u,0xccc0ccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5ccc0u,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0ccc0u,
-  0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd0d0u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd0d0u,0xc0d4d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xd0c0d4d0u,0xd4d4d0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d4d0u,0xd0d4c0c0u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6c0c6u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd0d0d4d4u,0xc0d4d4d4u,0xc0d4c0c0u,0xc0c0c0c0u,0xc0c0d7c0u,0xd7d7c0d7u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0d4d4d4u,
-  0xc0d4e5d4u,0xc0d4c0c0u,0xc0c0d7d7u,0xc0d7ebd7u,0xebebd7d7u,0xccc0c0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd4c0u,0xd0d0d4c0u,0xd4c0d4e5u,0xd7c0d7d7u,0xd7d7ebebu,
-  0xd7ebebc0u,0xebebd7ebu,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccd4d0u,0xd4d4c0d0u,0xd4c0d4e5u,0xd7c0ebebu,0xebebebebu,0xd7ebebc0u,0xebebd7d7u,0xccc0c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xccccccccu,0xc0ccd4d4u,0xd4d4d0d0u,0xd4c0d4d4u,
-  0xd7c0ebebu,0xebebebebu,0xd7ebd7c0u,0xd7d7c0d7u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0ccccu,0xd0c0d4d4u,0xd4d4d0d4u,0xc0d0c0c0u,0xc0c0d7d7u,0xd7d7d7d7u,0xc0d7c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0ccc0u,0xd4c0d4d4u,
-  0xd4d4d4d4u,0xc0d0eaeau,0xeaeac0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xc0d5d5c0u,0xc0d5c0c0u,0xd0c0d4d4u,0xd4d4d4d4u,0xc0d0eaeau,0xc0eac0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xc0d5d5d5u,
-  0xc0d5c0c0u,0xc0d4d0d0u,0xd4d4d4d4u,0xc0d0eaeau,0xc0c0d5c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xc0eaead5u,0xc0d5c0c0u,0xe5e5c0c0u,0xd0d0d4d4u,
-  0xc0c0c0c0u,0xc0c0d5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,
-  0xd5c0ead5u,0xd5eaead5u,0xd5eac0c0u,0xe5e5d4e5u,0xc0c0c0c0u,0xccccc0c0u,0xd5c0d5d5u,0xc0d5ccc0u,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5eaeau,0xc0eaead5u,0xd5eac0c0u,
-  0xe5e5c0d4u,0xccccccccu,0xccccc0c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccc0ccu,0xead5eaeau,0xc0eaead5u,0xd5eac0c0u,0xd4e5ccc0u,0xccccccccu,0xccccd5c0u,
-  0xd5d5c0d5u,0xd5d5d5d5u,0xc0d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xead5eaeau,
-  0xc0d5eac0u,0xeaeac0c0u,0xc0c0ccccu,0xccccccccu,0xc0ccd5c0u,0xd5d5d5c0u,0xd5d5d5d5u,0xd5d5c0d5u,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xeaeac0eau,0xc0c0ccccu,
-  0xccccccccu,0xc0ccc0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,
-  0xd5d5c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xd5c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0d0u,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0d0d4u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd4d0d4d4u,0xc0d0c0c0u,0xc0c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xd4d0d4d4u,0xd0d4d4c0u,0xd4d4c6c0u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd0c0u,0xc0d4d4d4u,0xd0d4d4c0u,0xd4e5c0c0u,
-  0xc6c0c6c6u,0xc0c0c0c6u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccd4d0u,0xd0d4c0c0u,0xc0d4e5d4u,0xd4e5d7c0u,0xc0d7c0c0u,0xd7d7d7c0u,0xd7d7c0d7u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd4d0u,0xd4d4d0d0u,
-  0xc0c0e5d4u,0xc0e5ebd7u,0xd7ebd7d7u,0xebebc0d7u,0xebebd7d7u,0xccc0c0ccu,0xccccccccu,0xccccccccu,
-  0xccccc0c0u,0xc0c0ccccu,0xccccccccu,0xd0c0d4d4u,0xd4d4d0d0u,0xc0d0d4d4u,0xc0d4ebd7u,0xebebebebu,
-  0xebebc0d7u,0xebebd7ebu,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xccc0ccccu,
-  0xd0c0d4d4u,0xd4d4d0d4u,0xc0d0c0c0u,0xc0c0d7c0u,0xebd7ebebu,0xd7ebc0d7u,0xebebd7d7u,0xccc0c0ccu,
-  0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xc0d5c0c0u,0xc0c0c0c0u,0xd4c0d4d4u,0xd4d4d4d4u,0xc0d0eaeau,
-  0xeaeac0c0u,0xd7c0d7d7u,0xd7d7d7c0u,0xd7d7c0d7u,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0ead5u,
-  0xd5d5d5d5u,0xc0c0c0c0u,0xd0c0d4d4u,0xd4d4d4d4u,0xc0d0eaeau,0xc0eac0d4u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0eaeau,0xd5eaeaeau,0xd5eac0c0u,0xc0c0d0d0u,
-  0xd4d4d4d4u,0xc0d0eaeau,0xd4c0c0d4u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0c0u,0xead5eaeau,0xd5d5eaeau,0xeaeac0d5u,0xe5d4c0c0u,0xd0d0d4d4u,0xc0c0c0c0u,0xd4d4c0c0u,
-  0xd5c0d5d5u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xead5d5eau,0xd5c0eaeau,
-  0xd5eac0d5u,0xe5d4e5e5u,0xc0c0c0c0u,0xccccc0c0u,0xc0d4c0c0u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xc0ccd5c0u,0xeaead5eau,0xd5c0ead5u,0xd5eac0c0u,0xd4d4d4d4u,0xccc0ccccu,
-  0xccccccccu,0xc0c0c0c0u,0xd5d5d5d5u,0xc0d5c0c0u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xc0ccd5c0u,
-  0xeaead5eau,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5c0c0u,0xccccc0ccu,0xccccccccu,0xc0ccd5c0u,0xead5c0d5u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5c0c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xccccc0ccu,
-  0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xc0c0d5c0u,0xd5d5c0d5u,0xc0c0c0c0u,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0d5c0u,0xd5d5c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0d5d5u,0xc0d5c0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0d5d5u,0xc0c0c0c0u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5c0u,0xc0c0c0c0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,
-  0xc0c0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xd5c0d5d5u,
-  0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,0xd7d7c0c0u,
-  0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d7c0u,0xebebebd7u,0xebebffffu,
-  0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd0d0c6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd0c0u,0xd0c0c0d0u,
-  0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd0d0u,0xc0d4d0d4u,0xc6c0d7c6u,0xebd7ebebu,0xc6d7d7ebu,
-  0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccd4d0u,0xd4d4c0c0u,0xc0d0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0c0d0u,0xd4d4d4d4u,0xc0c0c6c0u,
-  0xc6c6c6c6u,0xc6c6c0c0u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd0d0c0d0u,0xd4d4d4d4u,0xc0d4c0c0u,0xc0c0c0c0u,0xc0c0d7d7u,0xc0d7c0d7u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd0c0u,0xd4d0d0d0u,
-  0xd0c0d4d4u,0xc0d4d4d4u,0xc0d4c0c0u,0xd7c0ebebu,0xd7ebd7c0u,0xccc0c0ccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xc0ccd0d0u,0xd4d4d0d4u,0xc0d0d4d0u,0xc0d0e5d4u,0xc0d4d7d7u,
-  0xebd7ebebu,0xd7ebd7c0u,0xccc0c0ccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xd0c0d4d0u,0xd4d4d0d4u,0xd0d0d0c0u,0xc0c0e5d4u,0xc0d4ebd7u,0xebebebebu,0xd7ebd7c0u,0xccc0c0ccu,
-  0xccccccccu,0xc0c0c0c0u,0xead5d5d5u,0xc0d5c0c0u,0xccccc0ccu,0xd0c0d4d4u,0xd4d4d4d4u,0xd0d0c0d0u,
-  0xc0c0e5d4u,0xc0d4d7d7u,0xd7d7d7d7u,0xc0d7c0d7u,0xccccc0ccu,0xccccc0ccu,0xc0c0d5d5u,0xeaeaead5u,
-  0xd5eac0c0u,0xccc0d4c0u,0xc0d4d4d0u,0xd4d4d4d4u,0xd0d4c0c0u,0xc0d4d4c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0ccc0u,0xccccc0ccu,0xccccc0c0u,0xd5d5eaeau,0xd5eaead5u,0xd5eac0d5u,0xc0c0d4d4u,0xc0e5d0d0u,
-  0xd4d4d4d4u,0xd0d0d4c0u,0xd4d4c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0ccd5c0u,
-  0xead5eaeau,0xd5d5ead5u,0xeaead5d5u,0xc0d5e5c0u,0xd4e5d0c0u,0xd4d0d4d4u,0xc0d0d4d4u,0xd4d4d5c0u,
-  0xc0d5ccc0u,0xccccccccu,0xc0ccc0c0u,0xc0c0c0ccu,0xc0c0d5d5u,0xeaead5eau,0xc0d5d5c0u,0xeaead5eau,
-  0xd5d5d4c0u,0xd4e5d0c0u,0xd0d0d0d4u,0xc0d0d4c0u,0xc0d4d5d5u,0xd5d5c0d5u,0xc0c0c0c0u,0xd5c0d5d5u,
-  0xc0d5c0c0u,0xc0c0d5d5u,0xd5d5d5d5u,0xc0c0d5c0u,0xead5eaeau,0xd5d5c0c0u,0xc0d4c0ccu,0xd0c0d0d0u,
-  0xc0d0c0ccu,0xc0c0d5c0u,0xd5d5d5d5u,0xc0d5d5c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xd5c0eaeau,0xc0d5c0c0u,0xccc0ccccu,0xc0ccc0c0u,0xc0c0ccccu,0xc0ccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5c0d5u,0xc0c0c0c0u,0xccccc0c0u,0xc0c0c0c0u,0xccccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,0xc0c0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0d5u,0xd5d5d5d5u,
-  0xc0d5c0c0u,0xc0c0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xccc0c0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xd5c0c0d5u,0xc0c0c0c0u,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0d5u,0xc0c0c0c0u,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccc0u,
-  0xccccc0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0ccc0u,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5c0d5d5u,
-  0xd5d5d5d5u,0xd5d5c0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5c0c0u,
-  0xd5c0d5d5u,0xc0d5ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd5c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0d5ccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d7c0u,
-  0xd7d7c0c0u,0xd7c0ffebu,0xc0ead5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d7c0u,0xebebd7c0u,0xebd7ffffu,0xc0ead5c0u,
-  0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0d7c0u,0xebebd7d7u,0xebebffffu,0xc0eac0ebu,0xccc0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd7c0u,0xebebebd7u,
-  0xebebffffu,0xd5ead7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc6c0u,0xd7c6ebd7u,0xebebffebu,0xffffebebu,0xccc6ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xd0c0c0d0u,0xc6c6d7d7u,0xebebc6ebu,0xebc6ebebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd0c0c0d0u,0xd0d0d4d4u,0xc6c0d7c6u,0xebd7ebebu,
-  0xc6d7d7ebu,0xccc6ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd0d0d4d4u,0xd0c0d4d4u,0xc6c0c6c6u,0xd7c6ebd7u,0xebebc6d7u,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd0d0d4d4u,0xd4c0d4d4u,
-  0xc6c0c6c6u,0xc6c6c6c6u,0xc6c6ccc6u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccd4c0u,0xc0c0d4d4u,0xc0c0c0c0u,0xc6c0c0c6u,0xc0c0c0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd4c0e5d4u,
-  0xd4e5d4c0u,0xd0c0c0d0u,0xc0eaeac0u,0xc0eac0d4u,0xe5c0c0c0u,0xc0c0c0c0u,0xc0c0c0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd4c0e5e5u,0xe5e5c0d4u,0xd0c0c0d0u,0xeaeaeaeau,
-  0xc0eac0d4u,0xe5d4d7c0u,0xebd7ebebu,0xd7d7c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0e5d4u,0xe5e5c0e5u,0xd0d0c0d0u,0xeaeaeaeau,0xc0eac0d4u,0xe5d4d7c0u,0xebebebebu,
-  0xd7ebc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd7d7c0c0u,0xe5d4c0d4u,
-  0xd0d0eac0u,0xeaeaeaeau,0xc0eac0d4u,0xe5d4d7c0u,0xebebebebu,0xd7d7c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xebebd7d7u,0xd4c0c0d4u,0xd0d0eac0u,0xeaeaeaeau,0xc0eac0d4u,
-  0xe5d4d7c0u,0xd7d7d7d7u,0xd7d7c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccebc0u,
-  0xd7ebc0d7u,0xc0ccd0c0u,0xd0d0eac0u,0xeaeaeaeau,0xd0c0c0d4u,0xd4d4c0c0u,0xc0c0d7d7u,0xc0d7c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccebc0u,0xd7d7ccc0u,0xccccd0c0u,0xd0d0eac0u,
-  0xeaeaeaeau,0xd0c0c0d4u,0xc0c0ccccu,0xccccc0c0u,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccebebu,0xd7ebc0d7u,0xc0ccd0d0u,0xc0d0eaeau,0xeaeaeaeau,0xd0c0c0d4u,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebebu,0xebebc0d7u,
-  0xd0c0d0d0u,0xc0d0eaeau,0xeaeaeaeau,0xd0c0c0d4u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccebebu,0xd7ebd7d7u,0xd0c0d0d0u,0xeac0eaeau,0xeaeaeaeau,
-  0xc0c0d0d0u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd7c0u,0xd7d7c0d7u,0xc0c0c0c0u,0xeaeaeaeau,0xeaeaeaeau,0xeaeac0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d5c0u,0xd5d5c0d5u,
-  0xeac0eaeau,0xeaeaeaeau,0xc0c0d5d5u,0xc0d5ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xead5d5eau,0xc0d5c0c0u,0xc0c0c0c0u,0xd5d5ead5u,
-  0xd5d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xd5c0d5d5u,0xeaeaeaeau,0xc0d5ccccu,0xccccd5c0u,0xd5d5eaeau,0xd5eaccc0u,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xeaeaeaeau,0xc0d5ccccu,
-  0xccccd5c0u,0xd5d5eaeau,0xd5eac0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xeaeaeaeau,0xc0d5ccccu,0xc0ccd5d5u,0xd5d5eaeau,0xd5d5c0d5u,
-  0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5d5d5u,
-  0xead5d5eau,0xccc0ccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccc0u,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xc0ccd5d5u,
-  0xd5d5d5d5u,0xeaeaeaeau,0xd5d5c0d5u,0xccc0c0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,
-  0xd5d5eaeau,0xeaead5d5u,0xd5d5d5d5u,0xccc0ccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xead5eaeau,0xeaead5d5u,
-  0xc0d5c0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xead5eaeau,0xeaead5eau,0xd5d5c0d5u,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xc0d0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xd4d4c0d0u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d4d4d4u,0xd0d0d4c0u,0xd4d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d0d0u,0xd4c0d4d4u,
-  0xc0d0e5d4u,0xe5e5c0d4u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xc0c0c0c0u,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd0d0d4d4u,0xd4c0e5e5u,0xd4e5c0c0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xd7d7d7d7u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0c0eau,0xd0d0d4d4u,0xd4c0d4e5u,0xc0c0d7d7u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7d7c0d7u,0xd4e5eac0u,0xeaeaeaeau,0xd0c0d4d0u,0xd4c0c0d4u,
-  0xd7d7ebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebebebebu,
-  0xebebc0d7u,0xd4e5eac0u,0xeaeaeaeau,0xc0ead4d0u,0xc0d0c0c0u,0xd7c0ebebu,0xd7ebccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7ebc0d7u,0xd4e5eac0u,0xeaeaeaeau,
-  0xeaead4c0u,0xd4d0d7c0u,0xd7d7ebd7u,0xd7ebccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xd7d7c0d7u,0xd4d4c0d4u,0xeaeaeaeau,0xeaead0c0u,0xc0d4ebd7u,0xebebebebu,
-  0xd7ebccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xd4c0c0d4u,0xeaeaeaeau,0xeaeac0eau,0xd7c0ebebu,0xebebebebu,0xd7ebccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xeaeaeaeau,0xeaeac0eau,
-  0xd7c0ebebu,0xebebebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xeaeaeaeau,0xeaeac0eau,0xc0d4ebd7u,0xebebd7d7u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xeaeaeaeau,0xeaeac0eau,0xd0c0d7c0u,0xd7d7c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xeaeaeaeau,0xeaeac0eau,0xd0c0c0c0u,
-  0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xcccceac0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xeaead5d5u,
-  0xc0d5c0c0u,0xc0c0d5c0u,0xc0d5c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xeaead5eau,0xd5d5c0c0u,0xc0c0d5d5u,0xd5d5c0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xead5eaeau,0xd5d5c0c0u,0xc0c0d5c0u,0xc0d5d5c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0d5d5d5u,0xc0d5c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0c0d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xd5c0d5d5u,0xc0d5ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,
-  0xd5d5eaeau,0xeaead5eau,0xc0d5c0c0u,0xd5c0d5d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5c0u,0xeaeaeaeau,0xeaeaeaeau,0xc0d5c0c0u,
-  0xd5c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d0d4d0u,0xd0d0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d0d0u,0xd4c0d4d4u,
-  0xd0d4d4c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xc0c0c0c0u,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd4d4d4d4u,0xc0d0e5d4u,0xd4e5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xd7d7d7d7u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xeac0c0eau,0xd4d0d0d4u,0xd4c0e5e5u,0xc0d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7d7c0d7u,0xd4e5eac0u,0xeaeaeaeau,0xd4c0c0d4u,0xe5d4d4e5u,
-  0xd7c0c0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebebebebu,
-  0xebebc0d7u,0xd4e5eac0u,0xeaeaeaeau,0xd0c0c0d4u,0xe5d4c0d4u,0xebd7d7ebu,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7ebc0d7u,0xd4e5eac0u,0xeaeaeaeau,
-  0xc0ead0d4u,0xd4c0d7c0u,0xebebebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xd7d7c0d7u,0xd4d4c0d4u,0xeaeaeaeau,0xc0ead4d4u,0xc0d0d7c0u,0xd7d7ebebu,
-  0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xd4c0c0d4u,0xeaeaeaeau,0xc0ead4d0u,0xc0d4d7d7u,0xebebebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xeaeaeaeau,0xeaead4c0u,
-  0xc0d4ebd7u,0xebebebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xeaeaeaeau,0xeaead4c0u,0xc0d4ebd7u,0xebebd7ebu,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xc0c0c0c0u,0xeaead4c0u,0xc0d4d7c0u,0xd7d7c0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xc0c0c0c0u,0xc0d4c0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xeac0eaeau,0xd5eac0d5u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0eaeau,
-  0xeaead5d5u,0xc0c0c0c0u,0xc0d5c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0eaeau,0xeaead5eau,0xc0d5c0c0u,0xd5d5c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0c0u,0xc0c0ead5u,0xd5d5c0c0u,0xd5c0c0d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5d5c0u,
-  0xd5d5c0c0u,0xd5c0d5d5u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0eaeau,0xeaeaeaeau,0xc0d5c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xead5eaeau,0xeaead5eau,0xc0d5d5c0u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5d5eaeau,0xeaead5d5u,0xc0c0d5d5u,
-  0xd5d5c0d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xd5c0d5d5u,0xd5d5c0d5u,0xd5c0d5d5u,0xd5d5c0c0u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccc0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xc0c0d4c0u,0xc0d4ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0d0c0u,0xc0d0e5d4u,0xc0d4ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd4d0c0d0u,0xd4c0e5e5u,0xc0c0ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xd4d4d4c0u,0xd4c0c0e5u,0xd7d7c0d7u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d4d0u,0xc0d4d4d4u,
-  0xd4c0c0e5u,0xebd7d7ebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xc0c0c0c0u,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0d4c0u,0xd4c0d4d4u,0xc0d0c0d4u,0xebd7ebebu,0xd7ebccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xd7d7d7d7u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xeac0c0eau,0xd0c0d4d4u,0xd0d0c0c0u,0xd7c0d7d7u,0xd7d7c0d7u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7d7c0d7u,0xd4e5eac0u,0xeaeaeaeau,0xc0ead4d0u,0xd0d4ccc0u,
-  0xc0ccebd7u,0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebebebebu,
-  0xebebc0d7u,0xd4e5eac0u,0xeaeaeaeau,0xc0ead4d0u,0xd4d4c0d0u,0xc0ccebd7u,0xebebc0d7u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7ebc0d7u,0xd4e5eac0u,0xeaeaeaeau,
-  0xeaead0c0u,0xd4d4d0d4u,0xc0c0ebd7u,0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xd7d7c0d7u,0xd4d4eac0u,0xeaeaeaeau,0xeaead0c0u,0xd4d4d4d4u,0xc0d0d7c0u,
-  0xd7d7ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xc0c0c0c0u,0xc0c0eaeau,0xeaead0c0u,0xd4d0d4d4u,0xd0d4c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xc0d5eac0u,0xeaeac0eau,
-  0xd4d0d4d4u,0xd0d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd5c0eaeau,0xc0d5c0c0u,0xeaeac0eau,0xd4d0d0d4u,0xc0d0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xeac0eaeau,
-  0xd5d5c0c0u,0xeac0c0eau,0xd4d0d0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xead5eaeau,0xd5eac0d5u,0xc0c0c0c0u,0xd0d0c0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xead5eaeau,0xd5eac0d5u,0xccc0d4c0u,0xc0c0c0d4u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xead5eaeau,0xd5eaead5u,0xd5eac0d5u,
-  0xccc0c0ccu,0xd4d4c0c0u,0xd5d5d5d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccc0c0u,0xd5c0eaeau,0xeaead5eau,0xd5d5c0d5u,0xccc0c0ccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xc0c0d5c0u,
-  0xeaeaeaeau,0xc0d5c0c0u,0xccc0c0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xd5c0eaeau,0xd5eac0c0u,0xccc0ccccu,
-  0xc0c0d5d5u,0xc0c0d5c0u,0xc0d5c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xc0c0d5c0u,0xd5eac0d5u,0xccccccccu,0xc0c0c0c0u,0xd5d5d5d5u,0xd5d5c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,
-  0xd5d5c0d5u,0xccccc0ccu,0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0ccc0u,0xccccc0ccu,0xd5c0d5d5u,
-  0xd5d5d5d5u,0xc0d5c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccc0c0u,0xc0c0ccccu,0xccccc0ccu,0xc0c0d5d5u,0xd5d5c0c0u,0xc0c0c0c0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccc0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xc0c0d4c0u,0xc0d4ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xc0d0d4d4u,0xd4d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd4d0c0d0u,0xd4c0e5d4u,0xc0e5c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xd4d4d4c0u,0xd4c0e5e5u,0xd7c0d7d7u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d4d0u,0xc0d4d4d4u,
-  0xd4c0c0e5u,0xebd7ebebu,0xd7d7c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xc0c0c0c0u,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0d4c0u,0xd4c0d4d4u,0xc0d0c0d4u,0xd7d7ebebu,0xd7ebd7d7u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xd7d7d7d7u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xeac0c0eau,0xd4d0d0d4u,0xc0d0c0c0u,0xc0c0ebd7u,0xd7d7ebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7d7c0d7u,0xd4e5c0c0u,0xeaeaeaeau,0xd0c0d4d4u,0xd0d0ccc0u,
-  0xccccd7c0u,0xebd7ebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebebebebu,
-  0xebebc0d7u,0xd4e5eac0u,0xeaeaeaeau,0xc0ead4d0u,0xd4d4c0d0u,0xccccc0ccu,0xebd7ebebu,0xc0d7ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7ebc0d7u,0xd4e5eac0u,0xeaeaeaeau,
-  0xeaead4c0u,0xd4d4c0d0u,0xccccc0ccu,0xebd7ebebu,0xc0d7ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xd7d7c0d7u,0xd4d4eac0u,0xeaeaeaeau,0xeaead0c0u,0xd4d4d0d4u,0xccc0ccccu,
-  0xd7c0d7d7u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xd4c0eac0u,0xeaeaeaeau,0xeaeac0eau,0xd4d4d4d4u,0xc0d0ccc0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xeac0eaeau,0xeaeac0eau,
-  0xd4d4d4d4u,0xc0d0c0d4u,0xd5d5d5d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xc0d5eaeau,0xeaeac0eau,0xd4d4d0d4u,0xd4c0c0d4u,0xd5d5d5d5u,
-  0xd5d5c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xead5d5eau,
-  0xc0d5eaeau,0xeaeaeaeau,0xd0c0c0d0u,0xd4d4d5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xc0c0d5c0u,0xeaeaeaeau,0xd5d5eac0u,0xc0eac0c0u,0xc0ccc0c0u,
-  0xc0d4d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xd5c0d5d5u,
-  0xd5d5d5d5u,0xead5eaeau,0xd5d5c0c0u,0xccc0ccccu,0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0d5d5u,0xeaead5d5u,0xd5d5eaeau,0xd5d5ccc0u,
-  0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5c0u,0xead5eaeau,0xd5d5ead5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccd5c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xd5c0eaeau,
-  0xd5eaead5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0c0ead5u,0xd5eaead5u,0xd5d5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0d5c0u,0xd5ead5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,
-  0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd5c0d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccc0c0u,0xc0c0d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0d5d5u,
-  0xd5d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0ccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccc0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0d0u,0xc0c0d4d4u,0xc0d4c0c0u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0d4d4u,0xd4c0e5e5u,0xc0d4d7d7u,0xc0d7c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd4d0c0d4u,0xd4c0e5e5u,0xd7c0ebebu,
-  0xd7ebd7d7u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xd4d4d0c0u,0xd4c0e5e5u,0xd7c0ebd7u,0xd7ebebebu,0xd7d7ccc0u,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d4c0u,0xc0d4d0d0u,
-  0xc0c0d4d4u,0xc0c0d7c0u,0xebd7ebebu,0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xc0c0c0c0u,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd4c0d4d4u,0xc0d0c0c0u,0xccc0c0ccu,0xd7c0ebebu,
-  0xebebc0d7u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xd7d7d7d7u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0eaeau,0xc0ead4c0u,0xd4d4c0c0u,0xccccccccu,0xc0ccebd7u,0xebebc0d7u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7d7c0d7u,0xd4e5d0c0u,0xeac0eaeau,0xeaeac0eau,0xd4d4d0d4u,
-  0xc0c0ccccu,0xc0ccd7d7u,0xd7d7ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebebebebu,
-  0xebebc0d7u,0xd4e5d0c0u,0xeac0eaeau,0xeaeaeaeau,0xd4c0d4d4u,0xd0d0c0c0u,0xccccc0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7ebc0d7u,0xd4e5d0c0u,0xeac0eaeau,
-  0xeaeaeaeau,0xc0ead4d4u,0xd4d4d0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xd7d7c0d7u,0xd4d4d0c0u,0xeac0eaeau,0xeaeaeaeau,0xc0ead4d4u,0xd4d4d0d4u,
-  0xccc0c0ccu,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xd4c0d0c0u,0xeac0eaeau,0xeaeaeaeau,0xeaead0c0u,0xd4d4d0d4u,0xccc0d5c0u,0xd5d5c0d5u,0xccc0ccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0eaeau,0xeaeaeaeau,
-  0xeaead0c0u,0xd4d4c0d0u,0xc0ccd5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5eac0u,0xeaeaeaeau,0xeaead0c0u,0xd0d4c0d0u,0xd5c0d5d5u,
-  0xd5d5d5d5u,0xd5d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xd5c0d5d5u,
-  0xd5eac0d5u,0xeaeaeaeau,0xeaead0c0u,0xd0d0d4c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,
-  0xccccc0ccu,0xccccc0ccu,0xc0c0d5d5u,0xd5d5d5d5u,0xd5c0ead5u,0xeaeac0d5u,0xeaeaeaeau,0xeaeac0eau,
-  0xc0c0d4d4u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xc0c0ead5u,
-  0xeaead5d5u,0xd5d5eaeau,0xeaead5d5u,0xeac0eaeau,0xc0eaccc0u,0xd4c0c0d4u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xc0c0d5c0u,0xeaead5eau,0xead5eaeau,0xeaead5d5u,
-  0xc0c0c0c0u,0xccc0ccccu,0xd4c0d5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,
-  0xccccccccu,0xc0c0c0c0u,0xead5eaeau,0xd5d5eaeau,0xd5eac0d5u,0xccc0ccccu,0xccccccccu,0xc0ccd5c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xd5c0eaeau,
-  0xd5eaead5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5c0u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xc0c0ead5u,0xeaead5d5u,0xd5d5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0c0u,0xc0c0d5c0u,0xd5ead5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccd5c0u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xd5c0c0d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xc0d0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d4d0d4u,0xd0d0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d0d0u,0xd4c0d4d4u,
-  0xd4d0c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xc0c0c0c0u,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd0c0c0d4u,0xc0c0d0c0u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xd7d7d7d7u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0d0d0u,0xd4d4d4c0u,0xd4d4c0d4u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7d7c0d7u,0xd4e5c0c0u,0xd7d7c0c0u,0xc0c0d4c0u,0xe5e5d4e5u,
-  0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebebebebu,
-  0xebebc0d7u,0xc0e5d7d7u,0xebebd7d7u,0xd7d7c0d7u,0xd4d4e5e5u,0xc0d4ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7ebc0d7u,0xc0e5ebd7u,0xebebebebu,
-  0xebebd7ebu,0xc0c0d4d4u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xd7d7c0d7u,0xc0d4ebd7u,0xebebebebu,0xebebd7d7u,0xc0d7c0c0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xd4c0d7c0u,0xd7d7d7d7u,0xd7d7c0d7u,0xc0c0d4c0u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0d4c0u,
-  0xd4d4d4d4u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xc0c0d4d4u,0xd4d4d0d4u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0d5d5u,
-  0xd5d5d5d5u,0xc0d5d4d4u,0xd0d4c0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd0c0d0d0u,0xc0d0d5c0u,
-  0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xd5c0d5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0d5u,
-  0xd5d5d5d5u,0xd5d5eaeau,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0d5u,0xd5d5ead5u,0xeaeaeaeau,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccd5c0u,0xd5d5d5d5u,0xd5c0d5d5u,0xeaeaeaeau,0xd5ead5d5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xc0d5d5d5u,
-  0xd5d5d5d5u,0xd5d5ead5u,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xd5c0d5d5u,0xd5d5eaeau,0xd5d5ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,
-  0xd5d5d5d5u,0xc0d5c0c0u,0xd5d5ead5u,0xeaead5eau,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xc0d5c0ccu,0xd5d5eaeau,
-  0xeaead5eau,0xc0d5ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xccc0c0ccu,0xd5d5eaeau,0xeaead5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xc0d0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d4d4d4u,0xd0d0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d0d0u,0xd4c0d4d4u,
-  0xd4d4c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xc0c0c0c0u,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd4c0c0d4u,0xc0c0d0d4u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xd7d7d7d7u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xd0c0d4d0u,0xd4d4d4c0u,0xd4d4d0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7d7c0d7u,0xd4e5c0d0u,0xc0ead0d0u,0xc0d0d4c0u,0xe5e5c0d4u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebebebebu,
-  0xebebc0d7u,0xd4e5c0d0u,0xc0eac0d0u,0xd7c0c0d7u,0xe5d4d4e5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7ebc0d7u,0xd4e5c0d0u,0xc0c0d7c0u,
-  0xebd7d7ebu,0xd4c0c0d4u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xd7d7c0d7u,0xd4d4c0c0u,0xd7d7ebd7u,0xebebd7ebu,0xc0d7d0c0u,0xd0d4ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xc0c0c0ccu,0xebd7ebebu,0xd7ebc0d7u,0xd4c0d4d4u,0xd0d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xebd7d7ebu,0xc0d7d0c0u,
-  0xd4d4d4d4u,0xd0d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xd7c0c0d7u,0xc0c0d0d0u,0xd4d4d4d4u,0xd0d4ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xc0c0eac0u,0xc0ead0d0u,0xd0d0d0d0u,0xc0d0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xeac0eaeau,0xc0eac0c0u,0xc0c0c0c0u,
-  0xc0c0d5d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccd5c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xd5d5c0d5u,0xd5c0d5d5u,0xc0d5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5c0c0u,
-  0xc0c0d5c0u,0xd5d5d5d5u,0xc0d5eaeau,0xd5eaccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd5d5c0d5u,0xc0c0d5c0u,0xeaeaeaeau,0xeaeaeaeau,
-  0xeaeac0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd5c0d5d5u,0xc0c0c0c0u,0xead5eaeau,0xeaeaeaeau,0xd5d5c0eau,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xc0d5c0c0u,
-  0xd5c0ead5u,0xeaeac0d5u,0xd5c0d5eau,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5d5u,0xd5d5c0c0u,0xc0c0c0c0u,0xc0d5d5c0u,0xead5d5eau,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,
-  0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0c0ccu,0xc0c0d5d5u,0xeaead5eau,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccccu,
-  0xc0ccd5c0u,0xead5d5eau,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xd5c0d5d5u,0xd5d5c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccc0c0u,0xd5d5d5d5u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xc0d0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d4d0d4u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6d0d0u,0xd4c0d4d4u,
-  0xd0d0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xc0c0c0c0u,0xc6c6c6c6u,0xc6c6c6c6u,0xc0c0c0c0u,0xd0c0d4d4u,0xd0d0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xd7d7d7d7u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0d4d4u,0xc0d4d4d4u,0xd0d4c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xc0d7d7d7u,0xc0d7c0c0u,0xc0c0e5d4u,0xc0d4d4d4u,0xc0d4c0d4u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebebebebu,
-  0xd7c0ebebu,0xd7ebd7d7u,0xd7d7d4c0u,0xd4e5d4c0u,0xd0c0d4d0u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebd7ebebu,0xd7c0ebebu,0xebebebebu,0xd7ebd4c0u,
-  0xd4e5c0c0u,0xd4d0d4d4u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xd7c0ebebu,0xebebebebu,0xd7ebd4c0u,0xd4d4d0c0u,0xd4d0d4d4u,0xc0d4ccccu,
-  0xccccc0ccu,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0d7d7u,
-  0xd7d7d7d7u,0xc0d7c0c0u,0xc0c0d0d0u,0xd4d4d4d4u,0xd0d4ccc0u,0xc0ccc0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xeac0eaeau,0xc0ead4d0u,
-  0xd4d4d4d4u,0xd4d4ccc0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0eaeau,0xc0ead4d0u,0xd4d4d4d4u,0xd0d4c0c0u,0xc0c0d5d5u,
-  0xc0c0c0d5u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,
-  0xc0c0eac0u,0xc0ead4d0u,0xd4d4d0d4u,0xc0d0c0d4u,0xc0c0d5d5u,0xc0d5d5d5u,0xc0c0ccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xc0d5c0c0u,0xc0c0d4c0u,0xd0d4c0d0u,
-  0xe5c0c0e5u,0xc0c0ead5u,0xc0d5d5eau,0xc0d5ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xc0c0d5d5u,0xd5d5c0c0u,0xccc0c0ccu,0xc0c0d4c0u,0xe5e5c0e5u,0xd5c0eaeau,0xd5d5eaeau,
-  0xd5d5c0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0d5c0u,0xd5d5c0d5u,
-  0xccc0ccccu,0xccccc0ccu,0xe5d4c0e5u,0xd5c0eaeau,0xc0d5eaeau,0xd5eac0d5u,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xc0c0d5d5u,0xd5d5c0d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xd4c0c0e5u,
-  0xd5c0eaeau,0xc0d5eaeau,0xeaeac0d5u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5c0d5d5u,0xc0c0ccccu,0xccccccccu,0xc0ccc0c0u,0xeac0eaeau,0xc0c0ead5u,0xeaeac0d5u,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xc0c0d5c0u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccccu,
-  0xccccccccu,0xc0ccc0c0u,0xeaeac0eau,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5c0d5u,0xc0c0ccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0d5c0u,
-  0xd5d5c0d5u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xd5c0c0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xd0d4ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc0c6c0c0u,0xc0c0d4d0u,0xd4d4c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xd4c0d4d4u,0xd0c0d4d4u,
-  0xd4d4c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c6c6c0u,0xc6c6c0c0u,0xd4c0d4e5u,0xd0c0d4d4u,0xc0d4d0d4u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xd7d7d7d7u,0xd7c0c0d7u,0xc0c0d7d7u,
-  0xd4c0e5e5u,0xc0d4c0d4u,0xd0c0d4d4u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccd7c0u,0xebd7c0ebu,0xebd7d7ebu,0xd7d7ebebu,0xc0d7e5e5u,0xc0d4d0c0u,0xd4d0d4d4u,
-  0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebebc0ebu,
-  0xebd7ebebu,0xebebebebu,0xc0d7d4d4u,0xc0d4d0d0u,0xd4d0d4d4u,0xd0d4ccc0u,0xccccccccu,0xc0ccc0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xebd7c0ebu,0xd7d7ebebu,0xebebd7d7u,0xc0c0c0c0u,
-  0xc0c0d0d0u,0xd4d4d4d4u,0xd0d4ccc0u,0xccccc0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccc0ccu,
-  0xccccc0ccu,0xd7d7d7d7u,0xd7c0d7d7u,0xd7d7c0c0u,0xeac0eaeau,0xc0ead4d0u,0xd4d4d4d4u,0xd4d4c0c0u,
-  0xc0c0c0c0u,0xc0c0d5d5u,0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0d4eaeau,0xc0ead4d0u,0xd4d4d4d4u,0xd0d4c0c0u,0xc0c0d5c0u,0xd5d5ead5u,0xd5d5c0c0u,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5d5c0d5u,0xd4d4eac0u,0xc0ead4d0u,
-  0xd4d4d0d4u,0xc0d0c0c0u,0xd5c0eaeau,0xd5eaeaeau,0xd5eac0c0u,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccd5c0u,0xd5d5c0c0u,0xd4c0c0d4u,0xc0c0d4c0u,0xd0d4c0d0u,0xe5c0c0d4u,0xead5eaeau,
-  0xd5eaead5u,0xeaeac0d5u,0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccd5c0u,0xd5d5c0d5u,
-  0xc0c0c0d4u,0xccc0c0ccu,0xc0c0e5c0u,0xe5e5c0d4u,0xd5d5eaeau,0xd5ead5c0u,0xeaead5d5u,0xccc0ccccu,
-  0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0d5d5u,0xd5d5c0d5u,0xc0c0ccc0u,0xccccccccu,0xccccd4c0u,
-  0xd4d4c0d4u,0xd5c0eaeau,0xd5d5d5c0u,0xeaead5eau,0xc0c0ccccu,0xccccc0ccu,0xccccc0ccu,0xd5c0d5d5u,
-  0xd5d5d5d5u,0xd5d5c0d5u,0xc0c0ccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0d5c0u,
-  0xeaead5eau,0xc0c0ccccu,0xccccc0ccu,0xccccc0ccu,0xc0c0d5c0u,0xd5d5c0d5u,0xd5c0c0d5u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xead5d5d5u,0xc0c0ccccu,0xccccc0ccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xd5d5d5d5u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0ccccu,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xd5c0d5d5u,
-  0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xccc0ccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,0xc0c0d5d5u,0xc0d5c0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0c0u,0xc0c0d5c0u,0xc0d5c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xc0c0d5c0u,0xc0c0c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,0xd5d5d5d5u,
-  0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5c0c0u,
-  0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,0xebffd7d7u,
-  0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,0xd7d7c6c6u,
-  0xd0c0c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0d0c0u,0xccc0ccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,0xc6ebebd7u,
-  0xebebd7d7u,0xc6c6d0c0u,0xc0d4d0d4u,0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc0c6c0d0u,0xd4c0d4d4u,
-  0xc0d0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xc0c0c0c0u,0xc6c0c6c6u,0xc6c6c6c6u,0xc0c0d4c0u,0xd4d4c0d4u,0xd0d0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xc0d7d7d7u,0xc0d7c0c0u,0xc0c0c0c0u,
-  0xc0c0d4d4u,0xd4d4c0d4u,0xd0d0c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccd7c0u,0xd7c0ebebu,0xd7ebc0c0u,0xc0c0d4d4u,0xc0d4d4d4u,0xd0d4d0c0u,0xd4d0d0d0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xd7c0ebebu,
-  0xebebd7d7u,0xc0d7e5d4u,0xc0d4d4d0u,0xc0d0d0d0u,0xd4d4d0d4u,0xc0d0ccccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccc0ccu,0xccccd7c0u,0xd7c0ebebu,0xebebebebu,0xc0d7e5d4u,0xc0d4d0c0u,
-  0xd0c0d0d0u,0xd4d4d4d4u,0xd0d0ccc0u,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccc0ccu,
-  0xccccc0ccu,0xc0d7d7d7u,0xd7d7d7d7u,0xc0d7e5d4u,0xc0d4c0c0u,0xd0d0d4d0u,0xd4d4d4d4u,0xd0d4c0c0u,
-  0xccccc0ccu,0xc0c0d5d5u,0xead5c0d5u,0xc0c0ccc0u,0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0d4c0u,0xc0c0c0d4u,0xd0c0d4d4u,0xd4d4d4d4u,0xc0d0d4d4u,0xccc0c0c0u,0xd5c0eaeau,0xead5d5eau,
-  0xc0d5c0c0u,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd4c0d4d4u,0xd0c0d4d0u,
-  0xd4d4d0d4u,0xc0d0d4e5u,0xc0d4c0c0u,0xd5d5eaeau,0xd5d5eaeau,0xd5eac0d5u,0xccc0c0ccu,0xc0ccc0c0u,
-  0xc0c0ccccu,0xccccccccu,0xc0c0d5d5u,0xd4c0d4d4u,0xc0d4d4d0u,0xd4d4d0d0u,0xd4c0e5e5u,0xc0c0d5d5u,
-  0xead5eaeau,0xd5d5ead5u,0xeaead5d5u,0xc0c0c0ccu,0xc0c0d5d5u,0xd5d5c0c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xc0d5d4d4u,0xc0c0d0d0u,0xd0d4d0d0u,0xd4c0d4e5u,0xd5c0d5d5u,0xeaead5eau,0xc0c0d5d5u,0xeaead5eau,
-  0xc0d5c0c0u,0xc0c0d5c0u,0xd5d5d5d5u,0xc0c0d5d5u,0xd5d5d5d5u,0xc0c0c0c0u,0xc0ccd0d0u,0xd0d0c0c0u,
-  0xc0ccc0d4u,0xd5c0ead5u,0xeaead5d5u,0xc0c0d5c0u,0xd5d5d5d5u,0xc0d5c0c0u,0xc0c0c0c0u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xc0c0ccccu,0xc0ccc0c0u,0xc0c0ccccu,0xccccc0c0u,0xc0c0ead5u,0xd5eac0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0c0ccu,0xc0c0c0c0u,0xccc0c0ccu,
-  0xc0ccc0c0u,0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0ccc0c0u,0xc0c0d5d5u,0xd5d5c0d5u,
-  0xc0d5c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccc0c0u,0xc0c0d5c0u,0xd5d5c0d5u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0c0u,
-  0xc0c0c0c0u,0xd5d5c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0ccu,0xc0c0c0c0u,0xc0d5c0c0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccc0ccccu,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0c0d5c0u,
-  0xd5d5d5d5u,0xc0d5c0ccu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5c0c0u,0xc0c0ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccc0c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5c0u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,
-  0xd5d5c0c0u,0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0ccd5d5u,0xc0d5d5d5u,0xc0d5d5c0u,0xc0c0c0c0u,
-  0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccd5c0u,0xc0d5ffeau,0xd7ebc0c0u,0xd7c0d7d7u,0xd5c0c0d5u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd5c0u,0xc0c0ffeau,
-  0xebffd7d7u,0xebc0d7ebu,0xd5c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xc0ebffeau,0xebffd7ebu,0xebd7d7ebu,0xc0c0ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccd7c6u,0xd5ebffeau,0xebffebebu,0xebd7d7ebu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccebc6u,0xffebffffu,0xebebebebu,
-  0xd7d7c6c6u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccebc6u,0xebebc6c6u,0xebebd7ebu,0xc6d7c0c6u,0xd0d0c0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccd7c6u,
-  0xc6ebebd7u,0xebebd7d7u,0xc6c6d4c0u,0xd0d4c0d0u,0xd0d0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc6ccu,0xebd7ebebu,0xd7d7c6c6u,0xc6c6d4c0u,
-  0xd0d4d4c0u,0xd0d4c0d0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccccccu,0xc6c6c6c6u,0xc6c6c6c6u,0xc6c6d4c0u,0xd4d4d4c0u,0xd0d4c0d0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0c0c0u,0xc6c6c0c0u,0xc0c0d4c0u,0xc0d4d4c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xc0ccc0c0u,0xc0c0c0c0u,0xe5c0c0c0u,0xc0d4eaeau,0xc0c0c0eau,0xd0d0d4c0u,
-  0xd4c0e5e5u,0xd4d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd7c0ebd7u,
-  0xebebd7d7u,0xe5c0c0d4u,0xc0d4eaeau,0xeaeac0eau,0xd0d0c0c0u,0xe5d4e5e5u,0xd4e5ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd7c0ebebu,0xebebd7ebu,0xe5c0c0d4u,0xc0d4eaeau,
-  0xeaeac0eau,0xd0d0c0d0u,0xe5e5e5e5u,0xc0d4ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd7c0ebd7u,0xebebd7ebu,0xe5c0c0d4u,0xc0d4eaeau,0xeaeaeaeau,0xd0c0c0d0u,0xe5d4c0d4u,
-  0xd7c0c0d7u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd7c0d7d7u,0xd7d7d7d7u,
-  0xe5c0c0d4u,0xc0d4eaeau,0xeaeaeaeau,0xd0c0c0d0u,0xd4d4d7c0u,0xebd7c0ebu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0ccd7d7u,0xc0d7c0c0u,0xd4c0c0d4u,0xd0d4eac0u,0xeaeaeaeau,
-  0xd0c0d0d0u,0xc0c0c0ccu,0xd7d7ebebu,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccc0c0u,0xccc0ccccu,0xc0ccc0c0u,0xd0d4eac0u,0xeaeaeaeau,0xd0c0d0d0u,0xccc0ccccu,0xd7c0ebd7u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xd0d4eac0u,0xeaeaeaeau,0xc0ead0d0u,0xc0d0c0ccu,0xd7d7ebebu,0xc0ebccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd0d4eac0u,0xeaeaeaeau,0xc0ead0d0u,
-  0xd0d0c0c0u,0xebd7ebebu,0xc0ebccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,
-  0xccccccccu,0xccccd0c0u,0xc0d0eac0u,0xeaeaeaeau,0xeaead0c0u,0xd0d0d7c0u,0xd7d7ebebu,0xc0ebccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xeac0eaeau,
-  0xeaeaeaeau,0xeaeac0eau,0xc0c0c0c0u,0xd7d7d7d7u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xccccccccu,0xccccccccu,0xc0ccd5d5u,0xc0d5eac0u,0xeaeaeaeau,0xeaeac0c0u,0xd5d5d5d5u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,
-  0xd5c0ead5u,0xd5d5c0d5u,0xc0c0c0c0u,0xc0c0d5d5u,0xeaead5d5u,0xc0d5ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccccccu,0xd5c0eaeau,0xd5ead5d5u,0xccc0ccccu,
-  0xc0ccead5u,0xeaead5eau,0xd5d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xccccccccu,0xccccc0ccu,0xd5d5eaeau,0xd5ead5d5u,0xccc0ccccu,0xc0ccead5u,0xeaead5eau,0xd5d5c0d5u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccccccu,0xccccc0c0u,0xd5d5ead5u,
-  0xd5ead5d5u,0xc0d5ccccu,0xc0ccead5u,0xeaead5eau,0xd5d5d5d5u,0xccc0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0ccu,0xccccccccu,0xc0c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccd5c0u,
-  0xeaead5d5u,0xd5d5d5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xccccc0c0u,
-  0xd5d5ead5u,0xeaead5eau,0xd5d5d5d5u,0xc0d5ccccu,0xccccd5c0u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5c0d5u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0ccd5d5u,0xead5eaeau,0xeaead5d5u,0xd5d5d5d5u,
-  0xc0d5ccccu,0xccccd5c0u,0xd5d5d5d5u,0xead5eaeau,0xd5ead5d5u,0xc0d5ccc0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xc0d5ccccu,0xccccc0ccu,0xd5d5d5d5u,
-  0xeaeaeaeau,0xeaead5d5u,0xd5d5c0d5u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xd5c0d5d5u,0xd5d5d5d5u,
-  0xd5d5d5d5u,0xd5d5d5d5u,0xccc0ccccu,0xccccc0ccu,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,0xd5d5d5d5u,
-  0xccc0ccccu,0xccccccccu,0xccccc0ccu,0xc0ccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccc0ccu,
+const unsigned char img_loserboy_lz_data[] = {
+  0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,0x22,
+  0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,
+  0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,
+  0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,0x1b,0x00,
+  0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,
+  0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,
+  0x60,0x55,0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,0x1b,0x08,
+  0x22,0x22,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xc0,0x1b,0x00,0x00,0x80,0x1b,0x00,
+  0x96,0x80,0x1b,0x03,0x69,0x58,0x22,0x21,0xb4,0x1b,0x09,0x03,0x00,0x10,0x33,0x96,
+  0x61,0xa9,0x99,0x99,0xaa,0xb4,0x1b,0x0b,0x00,0x02,0x34,0x43,0x03,0x30,0x66,0x11,
+  0x19,0x99,0x99,0x91,0xb4,0x1b,0x0b,0x44,0x40,0x43,0x30,0x34,0x04,0x61,0x10,0x99,
+  0x96,0x69,0x16,0xac,0x1b,0x0d,0x02,0x22,0x77,0x74,0x43,0x04,0x30,0x44,0x11,0x03,
+  0x96,0x61,0x16,0x99,0xad,0x6b,0x80,0x1b,0x0a,0x40,0x40,0x47,0x03,0x34,0x10,0x00,
+  0x11,0x11,0x21,0x11,0xac,0x1b,0x03,0x60,0x22,0x40,0x06,0x84,0x1b,0x01,0x00,0x08,
+  0x85,0xbd,0xac,0x1b,0x09,0x96,0x02,0x06,0x69,0x40,0x44,0x80,0x33,0x88,0x88,0x80,
+  0xca,0xb0,0x1b,0x07,0x99,0x60,0x00,0x69,0x43,0x00,0x88,0x03,0xcc,0x1b,0x05,0x66,
+  0x66,0x43,0x40,0x88,0x80,0x80,0x1b,0x00,0x20,0xbc,0x1b,0x07,0x99,0x99,0x34,0x06,
+  0x88,0x80,0x08,0x88,0xbe,0x4b,0x84,0x1b,0x07,0x00,0x69,0x88,0x88,0x60,0x88,0x66,
+  0x66,0x84,0x39,0xac,0x8b,0x94,0x1b,0x01,0x69,0x99,0xb4,0x1b,0x0b,0x60,0x22,0x99,
+  0x96,0x04,0x06,0x88,0x88,0x08,0x88,0x69,0x96,0xb4,0x1b,0x05,0x02,0x22,0x66,0x60,
+  0x00,0x30,0xcc,0x1b,0x85,0x6b,0x90,0x1b,0x00,0x60,0xc0,0x1b,0x88,0x00,0x03,0x80,
+  0x00,0x06,0x05,0xb4,0xa7,0x82,0xed,0x80,0x19,0x03,0x55,0x00,0x58,0x85,0xbd,0x33,
+  0x86,0xed,0x86,0x7d,0x01,0x08,0x88,0xb7,0x47,0x01,0x02,0x22,0x86,0x7b,0x04,0x00,
+  0x00,0x85,0x50,0x05,0xc0,0x1b,0x82,0xb2,0x05,0x05,0x00,0x00,0x50,0x00,0x20,0x88,
+  0x6d,0xac,0x53,0x80,0x35,0x88,0x54,0x87,0x43,0xb4,0x1b,0x02,0x50,0x02,0x00,0x82,
+  0xee,0x03,0x88,0x88,0x55,0x58,0xbd,0x6b,0x83,0xaf,0x01,0x50,0x85,0x80,0x1b,0x00,
+  0x58,0xc1,0xa3,0x84,0x0b,0x80,0x8f,0x8b,0x43,0xbf,0xd3,0x8c,0xfb,0x80,0x11,0x98,
+  0x37,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,
+  0x22,0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,
+  0x80,0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,
+  0x22,0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,0x1b,
+  0x00,0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,
+  0x16,0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,
+  0xa9,0x60,0x55,0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,0x1b,
+  0x08,0x22,0x22,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xd0,0x1b,0x00,0x96,0x80,0x1b,
+  0x03,0x69,0x58,0x22,0x21,0xb4,0x1b,0x09,0x00,0x22,0x10,0x33,0x96,0x61,0xa9,0x99,
+  0x99,0xaa,0xbc,0x1b,0x09,0x30,0x02,0x03,0x30,0x66,0x11,0x19,0x99,0x99,0x91,0xb4,
+  0x1b,0x0b,0x02,0x22,0x43,0x30,0x33,0x03,0x61,0x10,0x99,0x96,0x69,0x16,0xb4,0x1b,
+  0x0b,0x40,0x02,0x44,0x30,0x30,0x44,0x11,0x03,0x96,0x61,0x16,0x99,0xb5,0x6b,0x0b,
+  0x77,0x40,0x43,0x04,0x04,0x44,0x10,0x00,0x11,0x11,0x21,0x11,0xb4,0x1b,0x07,0x74,
+  0x00,0x30,0x47,0x03,0x44,0x00,0x88,0x80,0x92,0xb1,0xdb,0x09,0x02,0x22,0x40,0x66,
+  0x04,0x77,0x80,0x44,0x88,0x88,0x81,0xfc,0xb0,0x1b,0x07,0x60,0x22,0x06,0x99,0x04,
+  0x74,0x80,0x34,0xc4,0x1b,0x08,0x96,0x02,0x69,0x99,0x30,0x40,0x88,0x04,0x08,0xc0,
+  0x53,0x0b,0x96,0x02,0x66,0x69,0x43,0x00,0x88,0x04,0x60,0x88,0x20,0x66,0xc4,0x37,
+  0x06,0x44,0x06,0x88,0x03,0x96,0x08,0x06,0x80,0xc1,0xb4,0x1b,0x00,0x99,0x84,0x1b,
+  0x00,0x80,0xc4,0x1b,0x01,0x60,0x22,0x8c,0x1b,0x00,0x66,0xc0,0x1b,0x09,0x02,0x22,
+  0x66,0x66,0x44,0x00,0x08,0x80,0x60,0x00,0xbc,0x6f,0x86,0x9b,0x02,0x04,0x00,0x50,
+  0x82,0x2c,0xbc,0xa7,0x84,0x1b,0x03,0x00,0x00,0x88,0x55,0x81,0x17,0xbb,0x0f,0x02,
+  0x02,0x22,0x05,0x80,0x35,0x03,0x88,0x85,0x20,0x58,0xbc,0x1b,0x03,0x00,0x22,0x05,
+  0x50,0x80,0x34,0x02,0x88,0x20,0x08,0xc0,0x1b,0x03,0x02,0x00,0x55,0x85,0x80,0x6e,
+  0x8c,0x6d,0xac,0x1b,0x00,0x50,0x83,0x26,0x83,0x0b,0x02,0x50,0x20,0x05,0xc0,0x37,
+  0x80,0x00,0x00,0x85,0x80,0x53,0x00,0x00,0xc4,0x6f,0x87,0x5d,0x80,0x1b,0x00,0x05,
+  0xc1,0x87,0x00,0x00,0x83,0x93,0x05,0x50,0x05,0x88,0x85,0x05,0x58,0xc0,0x1b,0x00,
+  0x22,0x87,0x0a,0x8b,0x97,0xb8,0x1b,0x8c,0x71,0x84,0x00,0x9c,0x6f,0x00,0x22,0xd0,
+  0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,0x22,0x20,0x22,0x00,
+  0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,
+  0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,0x55,0x55,0x84,
+  0x1b,0x03,0x05,0x55,0x22,0x20,0xb4,0x1b,0x80,0x51,0x90,0x00,0xbc,0x1b,0x00,0x50,
+  0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,0x00,
+  0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,0x60,
+  0x55,0x08,0xbc,0x6f,0x80,0x1b,0x05,0x50,0x60,0x99,0xaa,0x96,0x50,0xb8,0x1b,0x80,
+  0x0a,0x07,0x20,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xb8,0x1b,0x06,0x44,0x02,0x00,
+  0x00,0x60,0x00,0x96,0x80,0x1b,0x03,0x69,0x58,0x22,0x21,0xac,0x1b,0x0b,0x74,0x02,
+  0x33,0x04,0x10,0x30,0x96,0x61,0xa9,0x99,0x99,0xaa,0xb4,0x1b,0x0b,0x70,0x00,0x00,
+  0x47,0x03,0x43,0x66,0x11,0x19,0x99,0x99,0x91,0xac,0x1b,0x0d,0x00,0x22,0x06,0x66,
+  0x40,0x47,0x34,0x40,0x61,0x10,0x99,0x96,0x69,0x16,0xac,0x1b,0x0d,0x66,0x02,0x06,
+  0x99,0x40,0x47,0x44,0x04,0x11,0x03,0x96,0x61,0x16,0x99,0xad,0x6b,0x0d,0x99,0x60,
+  0x06,0x99,0x43,0x04,0x40,0x44,0x10,0x00,0x11,0x11,0x21,0x11,0xa4,0x1b,0x0b,0x02,
+  0x22,0x66,0x66,0x00,0x66,0x43,0x30,0x00,0x34,0x00,0x88,0xb5,0xdb,0x0f,0x02,0x22,
+  0x99,0x96,0x22,0x06,0x44,0x30,0x88,0x03,0x88,0x88,0x20,0x00,0x00,0x02,0xb4,0x1b,
+  0x03,0x02,0x06,0x44,0x43,0x84,0x1b,0x03,0x00,0x00,0x66,0x60,0xa4,0xfb,0x84,0x1b,
+  0x09,0x30,0x06,0x34,0x44,0x88,0x80,0x88,0x88,0x66,0x00,0x84,0x43,0xa8,0xa7,0x02,
+  0x60,0x43,0x00,0x8c,0x1b,0x03,0x96,0x00,0x99,0x99,0xac,0x1b,0x04,0x00,0x02,0x44,
+  0x30,0x33,0x80,0x1b,0x01,0x00,0x08,0xbc,0x37,0x81,0x4f,0x08,0x30,0x03,0x44,0x88,
+  0x88,0x55,0x00,0x00,0x05,0xac,0x6f,0x84,0x00,0x09,0x33,0x02,0x03,0x44,0x08,0x88,
+  0x85,0x00,0x20,0x58,0xac,0xa7,0x84,0x00,0x09,0x30,0x22,0x03,0x43,0x00,0x88,0x85,
+  0x50,0x00,0x88,0xbe,0xbb,0x08,0x00,0x00,0x03,0x30,0x00,0x00,0x88,0x55,0x55,0x80,
+  0xe1,0xac,0x1b,0x86,0xeb,0x03,0x40,0x04,0x00,0x20,0x84,0x1b,0xb6,0x9f,0x0d,0x50,
+  0x02,0x05,0x55,0x04,0x40,0x00,0x22,0x88,0x55,0x88,0x55,0x05,0x88,0x80,0xb6,0xa0,
+  0x1b,0x82,0x5d,0x80,0xa2,0x86,0xbd,0x81,0x19,0x00,0x58,0xa4,0x1b,0x82,0xed,0x8b,
+  0x07,0x04,0x00,0x22,0x85,0x00,0x58,0x85,0x6d,0xa0,0x1b,0x80,0x2f,0x04,0x00,0x50,
+  0x00,0x20,0x05,0x80,0x53,0x02,0x50,0x00,0x58,0x80,0x15,0xa0,0x6f,0x80,0x1b,0x01,
+  0x50,0x05,0x83,0x5b,0x02,0x02,0x22,0x58,0x84,0x59,0xa8,0xa7,0x84,0x1b,0x86,0xed,
+  0x00,0x02,0x82,0xd9,0x84,0x51,0xb0,0x1b,0x84,0x8b,0x83,0x77,0x8c,0x35,0xad,0xbf,
+  0x87,0x95,0x01,0x00,0x05,0x85,0x73,0x84,0x35,0xb0,0xfb,0x82,0xb9,0x85,0x0f,0x9e,
+  0xff,0x01,0x00,0x00,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,
+  0x1b,0x04,0x22,0x22,0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,
+  0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,
+  0x1b,0x03,0x02,0x22,0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xb4,0x1b,0x80,
+  0x51,0x90,0x00,0xbc,0x1b,0x00,0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,
+  0x55,0x50,0xc4,0x1b,0x80,0x16,0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,
+  0x22,0x60,0x55,0x00,0x66,0xa9,0x60,0x55,0x08,0xbc,0x6f,0x80,0x1b,0x05,0x50,0x60,
+  0x99,0xaa,0x96,0x50,0xb8,0x1b,0x80,0x0a,0x07,0x20,0x60,0x00,0x66,0x99,0xaa,0x99,
+  0x09,0xb8,0x1b,0x06,0x44,0x02,0x00,0x00,0x60,0x00,0x96,0x80,0x1b,0x03,0x69,0x58,
+  0x22,0x21,0xb0,0x1b,0x0a,0x40,0x03,0x04,0x10,0x33,0x96,0x61,0xa9,0x99,0x99,0xaa,
+  0xac,0x1b,0x0d,0x02,0x22,0x77,0x00,0x00,0x44,0x03,0x43,0x66,0x11,0x19,0x99,0x99,
+  0x91,0xac,0x1b,0x0d,0x60,0x02,0x70,0x66,0x40,0x47,0x34,0x40,0x61,0x10,0x99,0x96,
+  0x69,0x16,0xa4,0x1b,0x0f,0x02,0x22,0x96,0x60,0x06,0x99,0x40,0x47,0x44,0x04,0x11,
+  0x03,0x96,0x61,0x16,0x99,0xa5,0x6b,0x0f,0x60,0x22,0x99,0x66,0x06,0x69,0x43,0x04,
+  0x40,0x44,0x10,0x00,0x11,0x11,0x21,0x11,0xa4,0x1b,0x0c,0x96,0x02,0x96,0x69,0x00,
+  0x06,0x33,0x00,0x03,0x44,0x00,0x88,0x20,0x84,0x14,0xa0,0xc3,0x11,0x96,0x02,0x66,
+  0x99,0x22,0x20,0x43,0x30,0x80,0x34,0x08,0x88,0x00,0x40,0x66,0x00,0x22,0x06,0xa4,
+  0x1b,0x0f,0x06,0x99,0x02,0x22,0x44,0x43,0x88,0x03,0x88,0x88,0x60,0x40,0x99,0x66,
+  0x20,0x69,0xc0,0x1b,0x00,0x80,0x88,0x1b,0x00,0x99,0xa4,0x1b,0x07,0x60,0x22,0x20,
+  0x66,0x30,0x22,0x34,0x44,0x90,0x1b,0x02,0x96,0x20,0x66,0xa4,0xc3,0x06,0x20,0x00,
+  0x43,0x00,0x04,0x44,0x88,0x80,0x00,0x03,0x00,0x08,0x66,0x66,0xa4,0x6f,0x05,0x50,
+  0x02,0x05,0x55,0x43,0x04,0x84,0x1b,0x02,0x00,0x88,0x00,0x80,0x00,0x9c,0xa7,0x82,
+  0x43,0x04,0x50,0x05,0x55,0x30,0x44,0x84,0x1b,0x01,0x55,0x08,0x82,0x49,0xa2,0x9f,
+  0x8e,0x0b,0x03,0x04,0x40,0x80,0x33,0x88,0x1b,0x00,0x88,0xa4,0x1b,0x86,0xaf,0x80,
+  0x1b,0x01,0x05,0x02,0x80,0x50,0x02,0x85,0x50,0x58,0x80,0x55,0x01,0x22,0x00,0xac,
+  0x1b,0x00,0x20,0x80,0x4b,0x05,0x00,0x22,0x85,0x50,0x55,0x88,0x84,0x0b,0x98,0x1b,
+  0x82,0xaf,0x86,0x77,0x84,0x0b,0x80,0x1b,0x03,0x58,0x58,0x85,0x20,0x9a,0x4b,0x90,
+  0x1b,0x00,0x20,0x8c,0x1b,0x03,0x85,0x55,0x55,0x88,0x94,0x53,0x8a,0xe9,0x86,0xe7,
+  0x88,0x00,0x05,0x85,0x50,0x88,0x55,0x00,0x58,0xac,0x1b,0x84,0x6d,0x98,0x1b,0x00,
+  0x05,0x94,0xdf,0x8c,0x1b,0x8c,0x6d,0x84,0x97,0x01,0x58,0x55,0x8c,0x15,0xa0,0x1b,
+  0x88,0x6d,0x84,0x1b,0x00,0x05,0xa3,0x7f,0x84,0x1b,0x94,0x6d,0x85,0x07,0x83,0x7d,
+  0xa3,0x9b,0x01,0x55,0x50,0x94,0x6d,0x88,0x1b,0x80,0x6d,0x9c,0x1b,0x84,0x94,0x9e,
+  0x8b,0x84,0x51,0x8c,0x1b,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,
+  0xfc,0x1b,0x04,0x22,0x22,0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,
+  0x02,0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,
+  0xbc,0x1b,0x03,0x02,0x22,0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,
+  0x88,0x00,0xbc,0x1b,0x00,0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,
+  0x50,0xc4,0x1b,0x80,0x16,0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,
+  0x60,0x55,0x00,0x66,0xa9,0x60,0x55,0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,
+  0x96,0x50,0xb8,0x1b,0x80,0x0a,0x07,0x20,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xb0,
+  0x1b,0x08,0x00,0x22,0x44,0x00,0x00,0x04,0x60,0x03,0x96,0x80,0x1b,0x03,0x69,0x58,
+  0x22,0x21,0x9c,0x1b,0x0f,0x02,0x22,0x66,0x00,0x74,0x06,0x40,0x47,0x10,0x34,0x96,
+  0x61,0xa9,0x99,0x99,0xaa,0xa4,0x1b,0x0f,0x60,0x02,0x99,0x66,0x70,0x69,0x00,0x47,
+  0x03,0x44,0x66,0x11,0x19,0x99,0x99,0x91,0xa4,0x1b,0x0f,0x96,0x60,0x99,0x69,0x70,
+  0x66,0x30,0x47,0x34,0x40,0x61,0x10,0x99,0x96,0x69,0x16,0x9c,0x1b,0x11,0x02,0x22,
+  0x99,0x96,0x66,0x99,0x40,0x00,0x30,0x04,0x44,0x03,0x11,0x00,0x96,0x61,0x16,0x99,
+  0x9d,0x6b,0x84,0x1b,0x0f,0x00,0x69,0x00,0x22,0x43,0x00,0x00,0x44,0x10,0x00,0x11,
+  0x11,0x01,0x11,0x20,0x00,0xa4,0x1b,0x0f,0x22,0x06,0x02,0x22,0x44,0x40,0x88,0x00,
+  0x00,0x08,0x00,0x00,0x60,0x00,0x06,0x66,0x9c,0x6f,0x13,0x66,0x60,0x22,0x06,0x30,
+  0x02,0x04,0x44,0x88,0x88,0x30,0x88,0x07,0x40,0x96,0x66,0x66,0x99,0x02,0x20,0x94,
+  0x1b,0x06,0x00,0x02,0x02,0x20,0x43,0x30,0x80,0x90,0x1b,0x80,0x8d,0xa0,0x1b,0x07,
+  0x22,0x22,0x30,0x22,0x44,0x43,0x88,0x04,0x90,0x1b,0xac,0x37,0x00,0x00,0x80,0x1b,
+  0x00,0x44,0x8c,0x1b,0x03,0x04,0x40,0x66,0x66,0x9c,0x6f,0x82,0x41,0x06,0x55,0x30,
+  0x20,0x34,0x44,0x88,0x80,0x84,0x1b,0x03,0x20,0x40,0x00,0x00,0x9c,0xa7,0x86,0x5b,
+  0x03,0x02,0x05,0x34,0x43,0x84,0x1b,0x01,0x00,0x08,0x85,0x74,0x9c,0xdf,0x8e,0x5b,
+  0x01,0x34,0x33,0x84,0x1b,0x85,0xf3,0x9c,0x1b,0x8e,0x41,0x08,0x40,0x55,0x33,0x30,
+  0x88,0x80,0x08,0x88,0x58,0x80,0x25,0x9c,0x53,0x94,0x1b,0x00,0x00,0x80,0x89,0x03,
+  0x08,0x88,0x88,0x85,0x80,0x44,0x82,0x33,0x8c,0x1b,0x8e,0x41,0x06,0x05,0x55,0x20,
+  0x44,0x88,0x00,0x50,0x80,0x1b,0x03,0x55,0x58,0x88,0x85,0xac,0x1b,0x82,0xe9,0x04,
+  0x40,0x00,0x22,0x50,0x00,0x80,0x1b,0x02,0x88,0x58,0x88,0x94,0x53,0x94,0x1b,0x84,
+  0x9f,0x06,0x00,0x22,0x88,0x55,0x85,0x58,0x05,0xb0,0x1b,0x80,0x09,0x00,0x20,0x84,
+  0x7b,0x05,0x85,0x50,0x88,0x55,0x00,0x58,0x81,0x44,0x98,0x1b,0x87,0x1d,0x8c,0x00,
+  0x01,0x55,0x50,0x84,0x6d,0xa4,0x1b,0x8c,0xef,0x88,0x1b,0x00,0x00,0x80,0xc5,0x80,
+  0x43,0x94,0x1b,0x83,0x37,0x9e,0xdb,0x01,0x02,0x05,0x84,0x1b,0x98,0xfb,0x87,0x8b,
+  0x9e,0x8b,0x00,0x00,0xd3,0x9b,0x90,0x13,0xd0,0x1b,0x85,0xaf,0x94,0x23,0x00,0x22,
+  0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,0x22,0x20,0x22,
+  0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,0x15,0xc0,
+  0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,0x55,0x55,
+  0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,0x1b,0x00,0x50,0x9c,
+  0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,0x00,0x00,
+  0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,0x60,0x55,
+  0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,0x1b,0x08,0x22,0x22,
+  0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xcc,0x37,0x01,0x00,0x96,0x80,0x1b,0x03,0x69,
+  0x58,0x22,0x21,0xb4,0x1b,0x09,0x00,0x22,0x10,0x33,0x96,0x61,0xa9,0x99,0x99,0xaa,
+  0xbc,0x1b,0x09,0x33,0x02,0x03,0x30,0x66,0x11,0x19,0x99,0x99,0x91,0xc0,0x1b,0x08,
+  0x30,0x34,0x04,0x61,0x10,0x99,0x96,0x69,0x16,0xb4,0x1b,0x0b,0x02,0x22,0x43,0x43,
+  0x30,0x44,0x11,0x03,0x96,0x61,0x16,0x99,0xb5,0x6b,0x00,0x30,0x80,0x0d,0x07,0x00,
+  0x34,0x10,0x00,0x11,0x11,0x21,0x11,0xb4,0x1b,0x07,0x00,0x22,0x44,0x44,0x34,0x40,
+  0x00,0x03,0x85,0xbd,0xb4,0x1b,0x07,0x40,0x02,0x47,0x77,0x00,0x00,0x06,0x60,0x80,
+  0x24,0xb8,0x1b,0x09,0x74,0x02,0x04,0x47,0x66,0x66,0x69,0x96,0x22,0x06,0xc4,0x37,
+  0x02,0x60,0x04,0x99,0x80,0x00,0xc4,0x1b,0x05,0x00,0x22,0x66,0x00,0x99,0x96,0xcc,
+  0x1b,0x04,0x43,0x02,0x00,0x00,0x66,0x80,0x00,0xc4,0x6f,0x03,0x43,0x02,0x44,0x44,
+  0x80,0xc5,0x00,0x00,0x82,0x88,0xb8,0x1b,0x00,0x30,0x80,0xc3,0x01,0x50,0x04,0x86,
+  0x0f,0xc4,0x6f,0x02,0x44,0x33,0x55,0x80,0x1b,0x00,0x20,0x82,0x81,0xb4,0x1b,0x05,
+  0x50,0x02,0x33,0x00,0x50,0x33,0xc4,0x1b,0x82,0x7f,0x82,0x2a,0x80,0x02,0xc0,0x1b,
+  0x06,0x50,0x22,0x85,0x55,0x55,0x58,0x05,0x8a,0x7f,0xb4,0x1b,0x05,0x55,0x02,0x85,
+  0x55,0x88,0x88,0xd0,0x1b,0x04,0x50,0x88,0x55,0x58,0x88,0x82,0xf0,0x82,0xd3,0xb4,
+  0x1b,0x00,0x85,0x84,0x16,0x87,0x0a,0xcc,0x1b,0x00,0x58,0x80,0x88,0x80,0x21,0xc8,
+  0x53,0x84,0x6d,0x80,0x1e,0xc4,0x8b,0x80,0x1b,0x00,0x58,0x87,0x99,0xbc,0x1b,0x05,
+  0x50,0x22,0x88,0x85,0x05,0x58,0x87,0x2d,0xc9,0x33,0x02,0x00,0x20,0x00,0x88,0x11,
+  0x98,0x8b,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,
+  0x22,0x22,0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,
+  0x20,0x80,0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,
+  0x02,0x22,0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,
+  0x1b,0x00,0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,
+  0x80,0x16,0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,
+  0x66,0xa9,0x60,0x55,0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,
+  0x1b,0x08,0x22,0x22,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xcc,0x37,0x01,0x00,0x96,
+  0x80,0x1b,0x03,0x69,0x58,0x22,0x21,0xb4,0x1b,0x09,0x00,0x22,0x10,0x33,0x96,0x61,
+  0xa9,0x99,0x99,0xaa,0xbc,0x1b,0x09,0x33,0x02,0x03,0x30,0x66,0x11,0x19,0x99,0x99,
+  0x91,0xbc,0x1b,0x09,0x43,0x30,0x34,0x04,0x61,0x10,0x99,0x96,0x69,0x16,0xb4,0x1b,
+  0x0b,0x02,0x22,0x44,0x43,0x30,0x44,0x11,0x03,0x96,0x61,0x16,0x99,0xb5,0x6b,0x0b,
+  0x30,0x22,0x00,0x04,0x00,0x44,0x10,0x00,0x11,0x11,0x21,0x11,0xbc,0x1b,0x05,0x44,
+  0x40,0x44,0x40,0x00,0x33,0x80,0x92,0xb9,0xdb,0x09,0x00,0x22,0x47,0x74,0x33,0x00,
+  0x08,0x03,0x20,0x96,0xbc,0x1b,0x05,0x40,0x02,0x04,0x77,0x00,0x66,0xcc,0x1b,0x09,
+  0x03,0x02,0x60,0x44,0x66,0x99,0x00,0x00,0x20,0x66,0xbc,0x1b,0x07,0x34,0x30,0x66,
+  0x00,0x99,0x99,0x06,0x66,0xc4,0x6f,0x06,0x44,0x30,0x00,0x44,0x99,0x66,0x06,0x80,
+  0xbf,0xc4,0x1b,0x03,0x34,0x44,0x66,0x00,0xdc,0x1b,0x02,0x00,0x03,0x00,0x88,0x6d,
+  0xac,0x1b,0x07,0x00,0x22,0x33,0x00,0x33,0x33,0x88,0x03,0x94,0x11,0xa4,0x1b,0x06,
+  0x50,0x02,0x00,0x05,0x00,0x00,0x88,0x80,0x02,0xbc,0x1b,0x00,0x55,0x82,0xb6,0x00,
+  0x05,0x80,0x04,0x01,0x50,0x00,0x82,0xf8,0xb0,0x1b,0x03,0x88,0x50,0x55,0x08,0x82,
+  0x63,0x82,0xd7,0xb4,0x1b,0x06,0x02,0x22,0x88,0x85,0x88,0x88,0x58,0x80,0x52,0x86,
+  0xd3,0xb4,0x1b,0x06,0x85,0x58,0x88,0x88,0x05,0x88,0x50,0x80,0x38,0xb4,0x6f,0x06,
+  0x50,0x22,0x00,0x58,0x88,0x85,0x00,0x88,0x54,0xbc,0x1b,0x01,0x55,0x88,0x80,0xa6,
+  0x80,0x6d,0x01,0x00,0x05,0xb4,0x53,0x01,0x50,0x22,0x80,0x6b,0x02,0x05,0x00,0x02,
+  0x87,0x45,0x01,0x22,0x05,0xbc,0x37,0x80,0x0c,0x88,0x1b,0x00,0x20,0xb8,0x1b,0x84,
+  0x9f,0x01,0x00,0x02,0x84,0x55,0x00,0x20,0x88,0x71,0xa4,0xa7,0x87,0xc7,0x87,0xeb,
+  0x81,0xbf,0x99,0xa3,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,
+  0x1b,0x04,0x22,0x22,0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,
+  0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,
+  0x1b,0x03,0x02,0x22,0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,
+  0x00,0xbc,0x1b,0x00,0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,
+  0xc4,0x1b,0x80,0x16,0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,
+  0x55,0x00,0x66,0xa9,0x60,0x55,0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,
+  0x50,0xc0,0x1b,0x08,0x22,0x22,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xcc,0x37,0x01,
+  0x00,0x96,0x80,0x1b,0x03,0x69,0x58,0x22,0x21,0xb4,0x1b,0x09,0x00,0x22,0x10,0x33,
+  0x96,0x61,0xa9,0x99,0x99,0xaa,0xbc,0x1b,0x09,0x33,0x00,0x03,0x30,0x66,0x11,0x19,
+  0x99,0x99,0x91,0xb4,0x1b,0x00,0x02,0x80,0x1b,0x07,0x34,0x04,0x61,0x10,0x99,0x96,
+  0x69,0x16,0xb4,0x1b,0x0b,0x00,0x22,0x43,0x30,0x30,0x44,0x11,0x03,0x96,0x61,0x16,
+  0x99,0xb5,0x6b,0x84,0x1b,0x07,0x00,0x34,0x10,0x00,0x11,0x11,0x21,0x11,0xbc,0x1b,
+  0x05,0x44,0x33,0x44,0x04,0x00,0x04,0x80,0x13,0x00,0x20,0xc0,0x1b,0x01,0x04,0x74,
+  0x80,0x1b,0x03,0x66,0x00,0x22,0x06,0xb4,0x1b,0x0b,0x40,0x22,0x40,0x33,0x47,0x40,
+  0x66,0x60,0x99,0x66,0x20,0x69,0xb4,0x1b,0x09,0x43,0x02,0x03,0x44,0x47,0x40,0x99,
+  0x60,0x99,0x99,0xac,0x1b,0x08,0x00,0x02,0x22,0x22,0x44,0x02,0x33,0x44,0x44,0xc4,
+  0x1b,0x82,0x5e,0x09,0x44,0x30,0x34,0x44,0x00,0x03,0x66,0x00,0x66,0x66,0xa4,0x6f,
+  0x84,0x07,0x09,0x20,0x00,0x44,0x40,0x44,0x44,0x88,0x03,0x00,0x88,0xac,0xa7,0x07,
+  0x00,0x22,0x50,0x05,0x00,0x05,0x44,0x30,0x88,0x1b,0x00,0x08,0x86,0x81,0x9c,0x1b,
+  0x02,0x50,0x02,0x55,0x80,0x1b,0x01,0x33,0x04,0x84,0x1b,0x00,0x50,0x80,0x41,0xa4,
+  0x1b,0x09,0x55,0x00,0x85,0x08,0x00,0x05,0x00,0x77,0x44,0x33,0x82,0x9f,0x02,0x00,
+  0x20,0x05,0x9c,0x1b,0x0a,0x02,0x22,0x85,0x50,0x85,0x58,0x00,0x58,0x47,0x77,0x00,
+  0x80,0x0e,0x01,0x55,0x50,0xac,0x1b,0x01,0x88,0x55,0x80,0x37,0x02,0x58,0x04,0x77,
+  0x8a,0xf3,0x00,0x55,0xa4,0x8b,0x80,0x1b,0x00,0x85,0x84,0x1b,0x01,0x20,0x47,0x8e,
+  0x69,0x83,0x0f,0x80,0x39,0x9c,0x1b,0x03,0x80,0x05,0x00,0x88,0x80,0x34,0x80,0x95,
+  0x82,0xf2,0x86,0xf3,0x9c,0xc3,0x80,0x00,0x00,0x08,0x88,0x1b,0x01,0x00,0x02,0x8b,
+  0x2b,0xab,0x47,0x88,0x09,0x80,0x65,0x80,0x1b,0x82,0xba,0xac,0x1b,0x99,0xa7,0x84,
+  0x1b,0x88,0xe1,0xc4,0x1b,0x01,0x00,0x50,0x85,0x5b,0xd0,0x1b,0x84,0xe4,0xd3,0xd3,
+  0x8c,0x35,0x8c,0x1b,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,
+  0x1b,0x04,0x22,0x22,0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,
+  0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,
+  0x1b,0x03,0x02,0x22,0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,
+  0x00,0xbc,0x1b,0x00,0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,
+  0xc4,0x1b,0x80,0x16,0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,
+  0x55,0x00,0x66,0xa9,0x60,0x55,0x08,0xbc,0x6f,0x08,0x00,0x02,0x60,0x50,0x60,0x99,
+  0xaa,0x96,0x50,0xb8,0x1b,0x0a,0x00,0x22,0x03,0x30,0x60,0x00,0x66,0x99,0xaa,0x99,
+  0x09,0xb8,0x1b,0x06,0x33,0x00,0x00,0x33,0x60,0x00,0x96,0x80,0x1b,0x03,0x69,0x58,
+  0x22,0x21,0xa4,0x1b,0x0d,0x02,0x22,0x33,0x03,0x03,0x03,0x10,0x33,0x96,0x61,0xa9,
+  0x99,0x99,0xaa,0xb8,0x1b,0x0a,0x07,0x34,0x30,0x03,0x30,0x66,0x11,0x19,0x99,0x99,
+  0x91,0xac,0x1b,0x81,0x7f,0x0a,0x77,0x44,0x43,0x00,0x03,0x61,0x00,0x99,0x96,0x69,
+  0x16,0xac,0x1b,0x0d,0x96,0x02,0x07,0x70,0x44,0x43,0x40,0x34,0x10,0x44,0x96,0x61,
+  0x16,0x99,0xad,0x6b,0x0c,0x96,0x02,0x30,0x09,0x44,0x04,0x40,0x34,0x00,0x47,0x11,
+  0x10,0x21,0xb1,0xa3,0x0d,0x66,0x02,0x43,0x09,0x00,0x34,0x74,0x04,0x60,0x47,0x00,
+  0x06,0x20,0x66,0xac,0x1b,0x0c,0x60,0x22,0x43,0x06,0x33,0x44,0x74,0x00,0x96,0x07,
+  0x66,0x69,0x06,0xa0,0x53,0x80,0x04,0x0c,0x00,0x02,0x22,0x44,0x30,0x33,0x44,0x44,
+  0x03,0x96,0x04,0x99,0x99,0xa8,0x1b,0x00,0x02,0x80,0x07,0x07,0x20,0x44,0x30,0x34,
+  0x44,0x00,0x03,0x60,0x80,0xa7,0x01,0x06,0x69,0x9c,0x1b,0x0f,0x50,0x00,0x00,0x05,
+  0x00,0x00,0x44,0x40,0x44,0x44,0x88,0x03,0x00,0x88,0x66,0x60,0x9c,0x6f,0x02,0x02,
+  0x22,0x85,0x86,0x23,0x02,0x00,0x44,0x30,0x84,0x1b,0x01,0x04,0x08,0x80,0x13,0x98,
+  0xa7,0x09,0x02,0x22,0x88,0x50,0x88,0x58,0x00,0x58,0x33,0x00,0x88,0x1b,0x00,0x40,
+  0x82,0x2d,0x9a,0x83,0x0a,0x00,0x22,0x88,0x85,0x88,0x55,0x05,0x88,0x00,0x74,0x44,
+  0x81,0x6e,0x01,0x00,0x44,0x81,0xf5,0x00,0x20,0x94,0x1b,0x09,0x50,0x22,0x58,0x85,
+  0x88,0x50,0x05,0x58,0x77,0x74,0x80,0x19,0x02,0x22,0x00,0x04,0x86,0x49,0x98,0x1b,
+  0x08,0x02,0x58,0x88,0x85,0x50,0x00,0x58,0x44,0x44,0x84,0x13,0x82,0xa1,0x82,0x31,
+  0x00,0x20,0x80,0xd3,0x94,0x1b,0x80,0x31,0x84,0x34,0x88,0xcf,0x8a,0x4f,0x00,0x55,
+  0x94,0x1b,0x01,0x05,0x85,0x94,0x19,0x88,0xeb,0x84,0x1b,0x90,0x37,0x88,0xf9,0xa2,
+  0x33,0x00,0x50,0x82,0x84,0x98,0x1b,0x88,0x02,0xa4,0x1b,0x00,0x00,0x83,0x2d,0xc7,
+  0x7f,0x80,0x6f,0x81,0x25,0x85,0x5f,0xd0,0x1b,0x81,0x5d,0xc8,0x1b,0x85,0x5d,0xcb,
+  0x7f,0x8a,0x37,0x00,0x00,0xcf,0x9b,0x90,0x13,0xd0,0x1b,0x89,0xe6,0x90,0x23,0x00,
+  0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,0x22,0x20,
+  0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,0x15,
+  0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,0x55,
+  0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,0x1b,0x00,0x50,
+  0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,0x00,
+  0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,0x60,
+  0x55,0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,0x1b,0x08,0x22,
+  0x22,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xc0,0x1b,0x00,0x00,0x80,0x1b,0x00,0x96,
+  0x80,0x1b,0x03,0x69,0x58,0x22,0x21,0xac,0x1b,0x0b,0x02,0x22,0x03,0x00,0x10,0x33,
+  0x96,0x61,0xa9,0x99,0x99,0xaa,0xac,0x1b,0x0d,0x00,0x02,0x70,0x00,0x33,0x04,0x03,
+  0x30,0x66,0x11,0x19,0x99,0x99,0x91,0xac,0x1b,0x0d,0x66,0x60,0x70,0x66,0x33,0x04,
+  0x34,0x04,0x61,0x10,0x99,0x96,0x69,0x16,0xac,0x1b,0x0d,0x96,0x60,0x70,0x99,0x43,
+  0x04,0x00,0x44,0x11,0x03,0x96,0x61,0x16,0x99,0xad,0x6b,0x00,0x99,0x80,0x37,0x09,
+  0x03,0x30,0x44,0x44,0x10,0x00,0x11,0x11,0x00,0x11,0xac,0xa7,0x0f,0x06,0x60,0x00,
+  0x00,0x03,0x33,0x44,0x44,0x00,0x04,0x22,0x20,0x66,0x02,0x22,0x06,0xac,0x8b,0x0d,
+  0x30,0x22,0x33,0x43,0x44,0x30,0x44,0x04,0x00,0x04,0x99,0x60,0x20,0x69,0x94,0x1b,
+  0x80,0x05,0x80,0x07,0x0b,0x33,0x02,0x34,0x44,0x43,0x03,0x74,0x03,0x66,0x04,0x99,
+  0x96,0x94,0x1b,0x86,0x21,0x86,0x05,0x0b,0x43,0x30,0x34,0x44,0x30,0x33,0x74,0x00,
+  0x96,0x04,0x99,0x99,0x98,0x1b,0x03,0x00,0x55,0x85,0x00,0x81,0x77,0x80,0x4f,0x01,
+  0x44,0x03,0x80,0x1b,0x03,0x66,0x04,0x66,0x66,0x8c,0x6f,0x81,0xeb,0x08,0x00,0x85,
+  0x88,0x00,0x58,0x40,0x20,0x43,0x04,0x80,0x89,0x03,0x34,0x40,0x04,0x00,0x80,0x00,
+  0x8c,0xa7,0x11,0x00,0x22,0x88,0x55,0x85,0x58,0x05,0x58,0x44,0x00,0x33,0x07,0x44,
+  0x44,0x40,0x33,0x00,0x44,0x84,0x7b,0x8c,0xdf,0x13,0x50,0x02,0x88,0x85,0x85,0x55,
+  0x55,0x88,0x70,0x05,0x30,0x47,0x44,0x43,0x44,0x03,0x50,0x44,0x20,0x05,0x84,0xb5,
+  0x00,0x02,0x80,0x36,0x13,0x55,0x00,0x58,0x88,0x50,0x05,0x58,0x88,0x40,0x55,0x30,
+  0x47,0x34,0x33,0x40,0x03,0x55,0x04,0x05,0x55,0x86,0x89,0x01,0x00,0x05,0x84,0x1b,
+  0x82,0x76,0x0a,0x00,0x88,0x85,0x00,0x55,0x02,0x04,0x33,0x30,0x02,0x03,0x82,0x13,
+  0x02,0x55,0x50,0x05,0x82,0x35,0x98,0x00,0x00,0x88,0x80,0x27,0x01,0x22,0x20,0x80,
+  0x98,0x80,0x63,0x86,0x4f,0x84,0x3b,0x84,0x8b,0x90,0x03,0x91,0x21,0x00,0x00,0x88,
+  0x1b,0x80,0x4e,0xa0,0x11,0x84,0xfd,0x93,0x11,0x86,0xf5,0x00,0x05,0x84,0x8b,0xbf,
+  0x5b,0x00,0x05,0x80,0x71,0xcc,0x1b,0x89,0x27,0x80,0x51,0x80,0x48,0xc4,0x1b,0x02,
+  0x02,0x05,0x50,0xd8,0x1b,0x80,0x55,0x85,0x4b,0xc4,0x1b,0x84,0x15,0x88,0xce,0xcb,
+  0xef,0x84,0xd4,0xd8,0x1b,0x00,0x02,0x8d,0x87,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,
+  0x00,0x00,0xb4,0x13,0x02,0x00,0x00,0x20,0x88,0x13,0xbc,0x1b,0x07,0x00,0x02,0x55,
+  0x55,0x05,0x55,0x22,0x20,0xbc,0x1b,0x04,0x02,0x22,0x55,0x00,0x55,0x80,0x00,0x01,
+  0x22,0x05,0xbc,0x1b,0x01,0x50,0x22,0x84,0x19,0x03,0x55,0x55,0x20,0x55,0xbc,0x1b,
+  0x00,0x55,0x80,0x51,0x84,0x00,0x80,0x55,0xfc,0x1b,0xa8,0x1b,0x01,0x50,0x00,0x80,
+  0x70,0x00,0x50,0xc4,0x1b,0x08,0x05,0x02,0x50,0x66,0xa9,0x00,0x55,0x00,0x05,0xc0,
+  0x8b,0x09,0x60,0x02,0x00,0x99,0xaa,0x91,0x50,0x80,0x20,0x50,0xc0,0x1b,0x05,0x22,
+  0x69,0x99,0xaa,0x99,0x09,0xe0,0x1b,0x03,0xa9,0x85,0x21,0x58,0xbc,0x1b,0x09,0x00,
+  0x22,0x69,0x66,0xa9,0x99,0x99,0xaa,0x21,0xaa,0xc0,0x1b,0x08,0x02,0x66,0x00,0x19,
+  0x96,0x99,0x91,0x21,0x99,0xbc,0x1b,0x09,0x03,0x30,0x10,0x34,0x99,0x66,0x99,0x16,
+  0x22,0x19,0xb4,0x1b,0x0b,0x02,0x22,0x34,0x33,0x04,0x40,0x66,0x11,0x19,0x99,0x22,
+  0x21,0xb4,0x1b,0x07,0x00,0x22,0x34,0x43,0x33,0x40,0x01,0x10,0xc5,0xa3,0x09,0x40,
+  0x02,0x44,0x00,0x00,0x00,0x11,0x10,0x20,0x40,0xbc,0x1b,0x0a,0x74,0x40,0x30,0x47,
+  0x03,0x30,0x00,0x08,0x20,0x40,0x02,0x84,0x96,0xa8,0x1b,0x0d,0x77,0x40,0x04,0x77,
+  0x03,0x30,0x88,0x88,0x00,0x40,0x90,0x00,0x20,0x99,0xb0,0x37,0x0b,0x00,0x07,0x77,
+  0x03,0x33,0x88,0x88,0x04,0x40,0x99,0x09,0x09,0xa8,0x1b,0x80,0x0b,0x03,0x66,0x04,
+  0x74,0x80,0x90,0x1b,0x00,0x06,0xb0,0x1b,0x03,0x66,0x99,0x04,0x40,0x8c,0x1b,0x01,
+  0x90,0x96,0xac,0x1b,0x05,0x90,0x22,0x06,0x69,0x30,0x02,0x90,0x1b,0x02,0x00,0x06,
+  0x69,0xac,0x1b,0x03,0x20,0x66,0x30,0x22,0x84,0x1b,0x04,0x34,0x08,0x02,0x20,0x20,
+  0xa8,0xa7,0x07,0x99,0x02,0x06,0x69,0x33,0x02,0x88,0x03,0x84,0x1b,0xb6,0x83,0x80,
+  0x1b,0x02,0x99,0x33,0x30,0xd4,0x1b,0x01,0x66,0x69,0x80,0x1b,0x06,0x80,0x88,0x88,
+  0x33,0x08,0x22,0x03,0xac,0x1b,0x06,0x60,0x22,0x06,0x66,0x00,0x00,0x88,0x80,0x00,
+  0x01,0x00,0x88,0x81,0x5a,0xa8,0x1b,0x05,0x02,0x22,0x50,0x00,0x05,0x55,0x84,0x37,
+  0x01,0x55,0x00,0xbe,0xd7,0x08,0x55,0x02,0x58,0x85,0x00,0x05,0x00,0x00,0x85,0xc2,
+  0xd7,0x0a,0x55,0x50,0x88,0x88,0x22,0x05,0x50,0x22,0x88,0x55,0x20,0xb2,0x2f,0x83,
+  0x27,0x00,0x55,0x94,0x1b,0x00,0x05,0xb0,0x1b,0x87,0x27,0x84,0x1b,0x01,0x55,0x02,
+  0x80,0x1b,0x83,0x65,0xa4,0x1b,0x87,0x5d,0x03,0x58,0x85,0x22,0x20,0x8f,0x13,0x01,
+  0x20,0x05,0x9c,0x1b,0x00,0x00,0x93,0x5d,0x8c,0x1b,0x01,0x88,0x88,0x80,0x3e,0x00,
+  0x20,0x94,0x1b,0x02,0x55,0x00,0x88,0x80,0x12,0x98,0x1b,0x03,0x85,0x55,0x88,0x02,
+  0x80,0xb1,0x98,0x87,0x01,0x85,0x58,0x80,0x2d,0x9f,0x67,0x83,0x32,0x88,0x1b,0x97,
+  0xaf,0x84,0x1b,0x94,0x0b,0x94,0x1b,0x00,0x00,0x80,0x77,0x8c,0x00,0x8c,0xbb,0x84,
+  0x00,0x00,0x02,0x80,0x03,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,
+  0xfc,0x1b,0x04,0x22,0x22,0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,
+  0x02,0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,
+  0xbc,0x1b,0x03,0x02,0x22,0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,
+  0x88,0x00,0xbc,0x1b,0x00,0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,
+  0x50,0xc4,0x1b,0x80,0x16,0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,
+  0x60,0x55,0x00,0x66,0xa9,0x60,0x55,0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,
+  0x96,0x50,0xc0,0x1b,0x08,0x22,0x22,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xc0,0x1b,
+  0x00,0x00,0x80,0x1b,0x00,0x96,0x80,0x1b,0x03,0x69,0x58,0x22,0x21,0xb4,0x1b,0x09,
+  0x03,0x00,0x10,0x33,0x96,0x61,0xa9,0x99,0x99,0xaa,0xb4,0x1b,0x0b,0x00,0x02,0x34,
+  0x43,0x03,0x30,0x66,0x11,0x19,0x99,0x99,0x91,0xb4,0x1b,0x0b,0x44,0x40,0x43,0x30,
+  0x34,0x04,0x61,0x10,0x99,0x96,0x69,0x16,0xac,0x1b,0x0d,0x02,0x22,0x77,0x74,0x43,
+  0x04,0x30,0x44,0x11,0x03,0x96,0x61,0x16,0x99,0xad,0x6b,0x80,0x1b,0x0c,0x40,0x40,
+  0x47,0x03,0x34,0x10,0x00,0x11,0x11,0x01,0x11,0x20,0x00,0xa4,0x1b,0x03,0x60,0x22,
+  0x40,0x06,0x84,0x1b,0x07,0x00,0x08,0x00,0x00,0x60,0x00,0x06,0x66,0xa4,0x1b,0x11,
+  0x96,0x02,0x06,0x69,0x40,0x44,0x80,0x33,0x88,0x88,0x07,0x40,0x96,0x66,0x66,0x99,
+  0x02,0x20,0x9c,0x1b,0x07,0x99,0x60,0x00,0x69,0x43,0x00,0x88,0x03,0x84,0x1b,0x80,
+  0x8d,0xb0,0x1b,0x05,0x66,0x66,0x43,0x40,0x88,0x80,0x88,0x1b,0xb8,0x37,0x0b,0x99,
+  0x99,0x34,0x06,0x88,0x80,0x08,0x88,0x04,0x44,0x66,0x66,0xac,0x6f,0x84,0x1b,0x09,
+  0x00,0x69,0x88,0x88,0x08,0x88,0x20,0x44,0x00,0x00,0xac,0xa7,0x01,0x96,0x02,0x94,
+  0x1b,0x81,0x56,0xb2,0x83,0x05,0x60,0x22,0x99,0x96,0x04,0x06,0x88,0x1b,0xba,0xbb,
+  0x05,0x02,0x22,0x66,0x60,0x00,0x30,0xcc,0x1b,0x85,0x6b,0xe0,0x1b,0x88,0x00,0x01,
+  0x80,0x00,0x82,0xf8,0xb0,0x1b,0x82,0xed,0x80,0x19,0x03,0x55,0x00,0x58,0x85,0xc0,
+  0x1b,0x82,0xed,0x86,0x7d,0xbc,0x53,0x01,0x02,0x22,0x86,0x7b,0x04,0x00,0x00,0x85,
+  0x50,0x05,0xc0,0x1b,0x82,0xb2,0x06,0x05,0x00,0x00,0x50,0x00,0x20,0x05,0xbc,0x8b,
+  0x80,0x35,0x88,0x54,0x87,0x43,0xb4,0x1b,0x02,0x50,0x02,0x00,0x82,0xee,0x03,0x88,
+  0x88,0x55,0x58,0xc4,0xa7,0x02,0x00,0x50,0x85,0x80,0x1b,0x00,0x58,0xc1,0x33,0x84,
+  0x0b,0x80,0x8f,0x8b,0x43,0xd4,0xfb,0x80,0x11,0x98,0x37,0x00,0x22,0xd0,0x00,0x03,
+  0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,0x22,0x20,0x22,0x00,0x90,0x13,
+  0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,0x06,0x00,
+  0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,0x55,0x55,0x84,0x1b,0x03,
+  0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,0x1b,0x00,0x50,0x9c,0x1b,0x00,0x05,
+  0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,0x00,0x00,0x80,0x8a,0x00,
+  0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,0x60,0x55,0x08,0xc4,0x8b,
+  0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,0x1b,0x08,0x22,0x22,0x60,0x00,0x66,
+  0x99,0xaa,0x99,0x09,0xd0,0x1b,0x00,0x96,0x80,0x1b,0x03,0x69,0x58,0x22,0x21,0xb4,
+  0x1b,0x09,0x00,0x22,0x10,0x33,0x96,0x61,0xa9,0x99,0x99,0xaa,0xbc,0x1b,0x09,0x30,
+  0x02,0x03,0x30,0x66,0x11,0x19,0x99,0x99,0x91,0xb4,0x1b,0x0b,0x02,0x22,0x43,0x30,
+  0x33,0x03,0x61,0x10,0x99,0x96,0x69,0x16,0xb4,0x1b,0x0b,0x40,0x02,0x44,0x30,0x30,
+  0x44,0x11,0x03,0x96,0x61,0x16,0x99,0xb5,0x6b,0x0d,0x77,0x40,0x43,0x04,0x04,0x44,
+  0x10,0x00,0x11,0x11,0x01,0x11,0x20,0x00,0xac,0x1b,0x0d,0x74,0x00,0x30,0x47,0x03,
+  0x44,0x00,0x88,0x00,0x00,0x60,0x00,0x06,0x66,0xa4,0x1b,0x11,0x02,0x22,0x40,0x66,
+  0x04,0x77,0x80,0x44,0x88,0x88,0x07,0x40,0x96,0x66,0x66,0x99,0x02,0x20,0x9c,0x1b,
+  0x07,0x60,0x22,0x06,0x99,0x04,0x74,0x80,0x34,0x84,0x1b,0x80,0x8d,0xa8,0x1b,0x07,
+  0x96,0x02,0x69,0x99,0x30,0x40,0x88,0x04,0x88,0x1b,0xb0,0x37,0x0d,0x96,0x02,0x66,
+  0x69,0x43,0x00,0x88,0x04,0x08,0x88,0x04,0x44,0x66,0x66,0xac,0x6f,0x84,0x37,0x09,
+  0x44,0x06,0x88,0x03,0x08,0x88,0x20,0x44,0x00,0x00,0xac,0xa7,0x02,0x96,0x02,0x99,
+  0x84,0x1b,0x02,0x80,0x08,0x88,0x81,0x3a,0xb2,0x83,0x01,0x60,0x22,0x98,0x1b,0xba,
+  0xbb,0x07,0x02,0x22,0x66,0x66,0x44,0x00,0x08,0x80,0x94,0x11,0xac,0xfb,0x04,0x00,
+  0x00,0x04,0x00,0x50,0x82,0x2c,0xcc,0x1b,0x04,0x00,0x00,0x88,0x55,0x00,0xc8,0x53,
+  0x00,0x05,0x80,0x35,0x03,0x88,0x85,0x20,0x58,0xbc,0x1b,0x03,0x00,0x22,0x05,0x50,
+  0x80,0x34,0x02,0x88,0x20,0x08,0xc0,0x1b,0x03,0x02,0x00,0x55,0x85,0x80,0x6e,0x8c,
+  0xc1,0xac,0x1b,0x00,0x50,0x83,0x26,0x83,0x0b,0x02,0x50,0x20,0x05,0xc0,0x37,0x80,
+  0x00,0x00,0x85,0x80,0x53,0x00,0x00,0xc4,0x6f,0x87,0x5d,0x80,0x1b,0x01,0x05,0x88,
+  0x83,0xa0,0xb8,0x6f,0x80,0x52,0x04,0x05,0x88,0x85,0x05,0x58,0xc0,0x1b,0x00,0x22,
+  0x87,0x0a,0x8b,0x97,0xb8,0x1b,0x8c,0x71,0x84,0x00,0x9c,0x6f,0x00,0x22,0xd0,0x00,
+  0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,0x22,0x20,0x22,0x00,0x90,
+  0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,0x06,
+  0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,0x55,0x55,0x84,0x1b,
+  0x03,0x05,0x55,0x22,0x20,0xb4,0x1b,0x80,0x51,0x90,0x00,0xbc,0x1b,0x00,0x50,0x9c,
+  0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,0x00,0x00,
+  0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,0x60,0x55,
+  0x08,0xbc,0x6f,0x80,0x1b,0x05,0x50,0x60,0x99,0xaa,0x96,0x50,0xb8,0x1b,0x80,0x0a,
+  0x07,0x20,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xb8,0x1b,0x06,0x44,0x02,0x00,0x00,
+  0x60,0x00,0x96,0x80,0x1b,0x03,0x69,0x58,0x22,0x21,0xac,0x1b,0x0b,0x74,0x02,0x33,
+  0x04,0x10,0x30,0x96,0x61,0xa9,0x99,0x99,0xaa,0xb4,0x1b,0x0b,0x70,0x00,0x00,0x47,
+  0x03,0x43,0x66,0x11,0x19,0x99,0x99,0x91,0xac,0x1b,0x0d,0x00,0x22,0x06,0x66,0x40,
+  0x47,0x34,0x40,0x61,0x10,0x99,0x96,0x69,0x16,0xac,0x1b,0x0d,0x66,0x02,0x06,0x99,
+  0x40,0x47,0x44,0x04,0x11,0x03,0x96,0x61,0x16,0x99,0xad,0x6b,0x0f,0x99,0x60,0x06,
+  0x99,0x43,0x04,0x40,0x44,0x10,0x00,0x11,0x11,0x01,0x11,0x20,0x00,0x9c,0x1b,0x0b,
+  0x02,0x22,0x66,0x66,0x00,0x66,0x43,0x30,0x00,0x34,0x00,0x88,0x84,0xad,0x01,0x06,
+  0x66,0xa4,0x1b,0x11,0x99,0x96,0x22,0x06,0x44,0x30,0x88,0x03,0x88,0x88,0x07,0x40,
+  0x96,0x66,0x66,0x99,0x02,0x20,0xa4,0x1b,0x03,0x02,0x06,0x44,0x43,0x8c,0x1b,0x80,
+  0x8d,0xb0,0x1b,0x05,0x30,0x06,0x34,0x44,0x88,0x80,0x88,0x1b,0xa8,0x37,0x80,0xa7,
+  0x02,0x60,0x43,0x00,0x8c,0x1b,0x03,0x04,0x40,0x66,0x66,0xa4,0x6f,0x80,0xdf,0x03,
+  0x02,0x44,0x30,0x33,0x80,0x1b,0x01,0x00,0x08,0x80,0x30,0x00,0x00,0xa4,0xa7,0x89,
+  0x4f,0x08,0x30,0x03,0x44,0x88,0x88,0x55,0x00,0x20,0x05,0xbe,0x83,0x09,0x33,0x02,
+  0x03,0x44,0x08,0x88,0x85,0x00,0x20,0x58,0xbc,0x1b,0x09,0x30,0x22,0x03,0x43,0x00,
+  0x88,0x85,0x50,0x00,0x88,0xbc,0x1b,0x09,0x00,0x00,0x03,0x30,0x00,0x00,0x88,0x55,
+  0x55,0x88,0xb6,0xbb,0x86,0xeb,0x03,0x40,0x04,0x00,0x20,0x84,0x1b,0xb6,0x9f,0x0d,
+  0x50,0x02,0x05,0x55,0x04,0x40,0x00,0x22,0x88,0x55,0x88,0x55,0x05,0x88,0x80,0xb6,
+  0xa0,0x1b,0x82,0x5d,0x00,0x55,0x80,0xbc,0x82,0x85,0x03,0x88,0x88,0x00,0x58,0xa4,
+  0x1b,0x82,0xed,0x8b,0x07,0x04,0x00,0x22,0x85,0x00,0x58,0x81,0x6d,0xa4,0x1b,0x80,
+  0x2f,0x01,0x00,0x50,0x80,0xd9,0x80,0x53,0x02,0x50,0x00,0x58,0x80,0x15,0xa0,0x6f,
+  0x80,0x1b,0x01,0x50,0x05,0x83,0x5b,0x02,0x02,0x22,0x58,0x84,0x59,0xa8,0xa7,0x84,
+  0x1b,0x86,0xed,0x00,0x02,0x82,0xd9,0x84,0x51,0xb0,0x1b,0x84,0x8b,0x83,0x77,0x8c,
+  0x35,0xa4,0x1b,0x84,0x09,0x83,0x0a,0x81,0x49,0x84,0x84,0xb5,0x17,0x00,0x00,0x82,
+  0xb9,0x85,0x0f,0x9e,0xff,0x01,0x00,0x00,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,
+  0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,0x22,0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,
+  0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,
+  0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,
+  0x20,0xb4,0x1b,0x80,0x51,0x90,0x00,0xbc,0x1b,0x00,0x50,0x9c,0x1b,0x00,0x05,0xcc,
+  0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,0x00,0x00,0x80,0x8a,0x00,0x05,
+  0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,0x60,0x55,0x08,0xbc,0x6f,0x80,
+  0x1b,0x05,0x50,0x60,0x99,0xaa,0x96,0x50,0xb8,0x1b,0x80,0x0a,0x07,0x20,0x60,0x00,
+  0x66,0x99,0xaa,0x99,0x09,0xb8,0x1b,0x06,0x44,0x02,0x00,0x00,0x60,0x00,0x96,0x80,
+  0x1b,0x03,0x69,0x58,0x22,0x21,0xb0,0x1b,0x0a,0x40,0x03,0x04,0x10,0x33,0x96,0x61,
+  0xa9,0x99,0x99,0xaa,0xac,0x1b,0x0d,0x02,0x22,0x77,0x00,0x00,0x44,0x03,0x43,0x66,
+  0x11,0x19,0x99,0x99,0x91,0xac,0x1b,0x0d,0x60,0x02,0x70,0x66,0x40,0x47,0x34,0x40,
+  0x61,0x10,0x99,0x96,0x69,0x16,0xa4,0x1b,0x0f,0x02,0x22,0x96,0x60,0x06,0x99,0x40,
+  0x47,0x44,0x04,0x11,0x03,0x96,0x61,0x16,0x99,0xa5,0x6b,0x11,0x60,0x22,0x99,0x66,
+  0x06,0x69,0x43,0x04,0x40,0x44,0x10,0x00,0x11,0x11,0x01,0x11,0x20,0x00,0x9c,0x1b,
+  0x0b,0x96,0x02,0x96,0x69,0x00,0x06,0x33,0x00,0x03,0x44,0x00,0x88,0x84,0xad,0x01,
+  0x06,0x66,0xa4,0x1b,0x11,0x66,0x99,0x22,0x20,0x43,0x30,0x80,0x34,0x08,0x88,0x07,
+  0x40,0x96,0x66,0x66,0x99,0x02,0x20,0x9c,0x1b,0x08,0x06,0x99,0x02,0x22,0x44,0x43,
+  0x88,0x03,0x88,0x80,0x1b,0x80,0x8d,0xc4,0x1b,0x00,0x80,0x88,0x1b,0xa8,0x37,0x07,
+  0x60,0x22,0x20,0x66,0x30,0x22,0x34,0x44,0x84,0x1b,0x03,0x04,0x40,0x66,0x66,0xa4,
+  0x6f,0x08,0x02,0x22,0x20,0x00,0x43,0x00,0x04,0x44,0x88,0x80,0x00,0x03,0x20,0x40,
+  0x00,0x00,0xa4,0xa7,0x05,0x50,0x02,0x05,0x55,0x43,0x04,0x84,0x1b,0x01,0x00,0x88,
+  0x86,0x65,0x9c,0xdf,0x82,0x43,0x04,0x50,0x05,0x55,0x30,0x44,0x84,0x1b,0x01,0x55,
+  0x08,0x82,0x49,0xa0,0x1b,0x8e,0x0b,0x03,0x04,0x40,0x80,0x33,0x88,0x1b,0x00,0x88,
+  0xa4,0x1b,0x86,0xaf,0x80,0x1b,0x01,0x05,0x02,0x80,0xf8,0x02,0x85,0x50,0x58,0x80,
+  0xfd,0x00,0x22,0x98,0x6f,0x8c,0x1b,0x00,0x20,0x80,0x4b,0x05,0x00,0x22,0x85,0x50,
+  0x55,0x88,0x84,0x0b,0x98,0x1b,0x82,0xaf,0x86,0x77,0x84,0x0b,0x80,0x1b,0x03,0x58,
+  0x58,0x85,0x20,0x9a,0x4b,0x90,0x1b,0x00,0x20,0x8c,0x1b,0x03,0x85,0x55,0x55,0x88,
+  0x94,0x53,0x8a,0xe9,0x86,0xe7,0x88,0x00,0x05,0x85,0x50,0x88,0x55,0x00,0x58,0xac,
+  0x1b,0x84,0x6d,0x98,0x1b,0x00,0x05,0x96,0x4b,0x8c,0x1b,0x8c,0x6d,0x84,0x97,0x01,
+  0x58,0x55,0x8c,0x15,0xa0,0x1b,0x88,0x6d,0x84,0x1b,0x00,0x05,0xa3,0x7f,0x84,0x1b,
+  0x94,0x6d,0x85,0x07,0x83,0x7d,0xa3,0x9b,0x01,0x55,0x50,0x94,0x6d,0x88,0x1b,0x80,
+  0x6d,0x9c,0x1b,0x84,0x94,0x9e,0x8b,0x9d,0x6b,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,
+  0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,0x22,0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,
+  0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,
+  0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,0x55,0x55,0x84,0x1b,0x03,0x05,0x55,
+  0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,0x1b,0x00,0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,
+  0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,
+  0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,0x60,0x55,0x08,0xc4,0x8b,0x06,0x60,
+  0x50,0x60,0x99,0xaa,0x96,0x50,0xb8,0x1b,0x80,0x0a,0x07,0x20,0x60,0x00,0x66,0x99,
+  0xaa,0x99,0x09,0xb0,0x1b,0x08,0x00,0x22,0x44,0x00,0x00,0x04,0x60,0x03,0x96,0x80,
+  0x1b,0x03,0x69,0x58,0x22,0x21,0x9c,0x1b,0x0f,0x02,0x22,0x66,0x00,0x74,0x06,0x40,
+  0x47,0x10,0x34,0x96,0x61,0xa9,0x99,0x99,0xaa,0xa4,0x1b,0x0f,0x60,0x02,0x99,0x66,
+  0x70,0x69,0x00,0x47,0x03,0x44,0x66,0x11,0x19,0x99,0x99,0x91,0xa4,0x1b,0x0f,0x96,
+  0x60,0x99,0x69,0x70,0x66,0x30,0x47,0x34,0x40,0x61,0x10,0x99,0x96,0x69,0x16,0x9c,
+  0x1b,0x11,0x02,0x22,0x99,0x96,0x66,0x99,0x40,0x00,0x30,0x04,0x44,0x03,0x11,0x00,
+  0x96,0x61,0x16,0x99,0x9d,0x6b,0x84,0x1b,0x0f,0x00,0x69,0x00,0x22,0x43,0x00,0x00,
+  0x44,0x10,0x00,0x11,0x11,0x01,0x11,0x20,0x00,0xa4,0x1b,0x0f,0x22,0x06,0x02,0x22,
+  0x44,0x40,0x88,0x00,0x00,0x08,0x00,0x00,0x60,0x00,0x06,0x66,0x9c,0x6f,0x13,0x66,
+  0x60,0x22,0x06,0x30,0x02,0x04,0x44,0x88,0x88,0x30,0x88,0x07,0x40,0x96,0x66,0x66,
+  0x99,0x02,0x20,0x94,0x1b,0x06,0x00,0x02,0x02,0x20,0x43,0x30,0x80,0x90,0x1b,0x80,
+  0x8d,0xa0,0x1b,0x07,0x22,0x22,0x30,0x22,0x44,0x43,0x88,0x04,0x90,0x1b,0xac,0x37,
+  0x00,0x00,0x80,0x1b,0x00,0x44,0x8c,0x1b,0x03,0x04,0x40,0x66,0x66,0x9c,0x6f,0x82,
+  0x41,0x06,0x55,0x30,0x20,0x34,0x44,0x88,0x80,0x84,0x1b,0x03,0x20,0x40,0x00,0x00,
+  0x9c,0xa7,0x86,0x5b,0x03,0x02,0x05,0x34,0x43,0x84,0x1b,0x01,0x00,0x08,0x85,0x74,
+  0x9c,0xdf,0x8e,0x5b,0x01,0x34,0x33,0x84,0x1b,0x85,0xf3,0x9c,0x1b,0x8e,0x41,0x08,
+  0x40,0x55,0x33,0x30,0x88,0x80,0x08,0x88,0x58,0x80,0x25,0x9c,0x53,0x94,0x1b,0x00,
+  0x00,0x80,0x89,0x03,0x08,0x88,0x88,0x85,0x80,0x44,0x82,0x33,0x8c,0x1b,0x8e,0x41,
+  0x06,0x05,0x55,0x20,0x44,0x88,0x00,0x50,0x80,0x1b,0x03,0x55,0x58,0x88,0x85,0xac,
+  0x1b,0x82,0xe9,0x04,0x40,0x00,0x22,0x50,0x00,0x80,0x1b,0x02,0x88,0x58,0x88,0x94,
+  0x53,0x94,0x1b,0x84,0x9f,0x06,0x00,0x22,0x88,0x55,0x85,0x58,0x05,0xb0,0x1b,0x80,
+  0x09,0x00,0x20,0x84,0x7b,0x05,0x85,0x50,0x88,0x55,0x00,0x58,0x81,0x44,0x98,0x1b,
+  0x87,0x1d,0x8c,0x00,0x01,0x55,0x50,0x84,0x6d,0xa4,0x1b,0x8c,0xef,0x88,0x1b,0x00,
+  0x00,0x80,0xc5,0x80,0x43,0x94,0x1b,0x83,0x37,0x9e,0xdb,0x01,0x02,0x05,0x84,0x1b,
+  0x98,0xfb,0x87,0x8b,0x9e,0x8b,0x00,0x00,0xd3,0x9b,0x90,0x13,0xd0,0x1b,0x85,0xaf,
+  0x94,0x23,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,
+  0x22,0x22,0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,
+  0x20,0x80,0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,
+  0x02,0x22,0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,
+  0x1b,0x00,0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,
+  0x80,0x16,0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,
+  0x66,0xa9,0x60,0x55,0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,
+  0x1b,0x08,0x22,0x22,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xcc,0x37,0x01,0x00,0x96,
+  0x80,0x1b,0x03,0x69,0x58,0x22,0x21,0xb4,0x1b,0x09,0x00,0x22,0x10,0x33,0x96,0x61,
+  0xa9,0x99,0x99,0xaa,0xbc,0x1b,0x09,0x33,0x02,0x03,0x30,0x66,0x11,0x19,0x99,0x99,
+  0x91,0xc0,0x1b,0x08,0x30,0x34,0x04,0x61,0x10,0x99,0x96,0x69,0x16,0xb4,0x1b,0x0b,
+  0x02,0x22,0x43,0x43,0x30,0x44,0x11,0x03,0x96,0x61,0x16,0x99,0xb5,0x6b,0x00,0x30,
+  0x80,0x0d,0x09,0x00,0x34,0x10,0x00,0x11,0x11,0x01,0x11,0x20,0x00,0xac,0x1b,0x0d,
+  0x00,0x22,0x44,0x44,0x34,0x40,0x00,0x03,0x00,0x00,0x60,0x00,0x06,0x66,0xac,0x1b,
+  0x0f,0x40,0x02,0x47,0x77,0x00,0x00,0x06,0x60,0x07,0x40,0x96,0x66,0x66,0x99,0x02,
+  0x20,0xa4,0x1b,0x09,0x74,0x02,0x04,0x47,0x66,0x66,0x69,0x96,0x07,0x06,0x80,0x8d,
+  0xb0,0x1b,0x04,0x40,0x02,0x60,0x04,0x99,0x80,0x00,0x80,0x1b,0xb8,0x37,0x0b,0x00,
+  0x22,0x66,0x00,0x99,0x96,0x99,0x99,0x04,0x06,0x66,0x66,0xb4,0x6f,0x04,0x43,0x02,
+  0x00,0x00,0x66,0x80,0x00,0x03,0x20,0x40,0x00,0x00,0xb4,0xa7,0x03,0x43,0x02,0x44,
+  0x44,0x80,0xc5,0x00,0x00,0x82,0x88,0xba,0x83,0x00,0x30,0x80,0xc3,0x01,0x50,0x04,
+  0x86,0x0f,0xbc,0x1b,0x80,0xdf,0x01,0x33,0x55,0x80,0x1b,0x00,0x20,0x82,0x81,0xb4,
+  0x1b,0x05,0x50,0x02,0x33,0x00,0x50,0x33,0xc4,0x1b,0x82,0x7f,0x82,0x2a,0x80,0x02,
+  0xc0,0x1b,0x06,0x50,0x22,0x85,0x55,0x55,0x58,0x05,0x8a,0x7f,0xb4,0x1b,0x05,0x55,
+  0x02,0x85,0x55,0x88,0x88,0xd0,0x1b,0x04,0x50,0x88,0x55,0x58,0x88,0x82,0xf0,0x82,
+  0xd3,0xb4,0x1b,0x00,0x85,0x84,0x16,0x87,0x0a,0xcc,0x1b,0x00,0x58,0x80,0x88,0x80,
+  0x21,0xc8,0x53,0x84,0x6d,0x80,0x1e,0xc4,0x8b,0x80,0x1b,0x00,0x58,0x87,0x99,0xbc,
+  0x1b,0x05,0x50,0x22,0x88,0x85,0x05,0x58,0x87,0x2d,0xc9,0x33,0x95,0x7d,0x98,0x8b,
+  0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,0x22,
+  0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,
+  0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,
+  0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,0x1b,0x00,
+  0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,
+  0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,
+  0x60,0x55,0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,0x1b,0x08,
+  0x22,0x22,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xcc,0x37,0x01,0x00,0x96,0x80,0x1b,
+  0x03,0x69,0x58,0x22,0x21,0xb4,0x1b,0x09,0x00,0x22,0x10,0x33,0x96,0x61,0xa9,0x99,
+  0x99,0xaa,0xbc,0x1b,0x09,0x33,0x02,0x03,0x30,0x66,0x11,0x19,0x99,0x99,0x91,0xbc,
+  0x1b,0x09,0x43,0x30,0x34,0x04,0x61,0x10,0x99,0x96,0x69,0x16,0xb4,0x1b,0x0b,0x02,
+  0x22,0x44,0x43,0x30,0x44,0x11,0x03,0x96,0x61,0x16,0x99,0xb5,0x6b,0x0d,0x30,0x22,
+  0x00,0x04,0x00,0x44,0x10,0x00,0x11,0x11,0x01,0x11,0x20,0x00,0xb4,0x1b,0x0b,0x44,
+  0x40,0x44,0x40,0x00,0x33,0x00,0x00,0x60,0x00,0x06,0x66,0xac,0x1b,0x0f,0x00,0x22,
+  0x47,0x74,0x33,0x00,0x08,0x03,0x07,0x43,0x96,0x66,0x66,0x99,0x02,0x20,0xa4,0x1b,
+  0x05,0x40,0x02,0x04,0x77,0x00,0x66,0x84,0x1b,0x80,0x8d,0xb0,0x1b,0x07,0x03,0x02,
+  0x60,0x44,0x66,0x99,0x00,0x00,0x80,0x1b,0xb8,0x37,0x0b,0x34,0x30,0x66,0x00,0x99,
+  0x99,0x06,0x66,0x04,0x40,0x66,0x66,0xb4,0x6f,0x0b,0x44,0x30,0x00,0x44,0x99,0x66,
+  0x06,0x99,0x20,0x02,0x00,0x00,0xb4,0xa7,0x06,0x44,0x30,0x34,0x44,0x66,0x00,0x06,
+  0x80,0xdb,0xbe,0x83,0x84,0x1b,0x03,0x00,0x03,0x00,0x66,0xbc,0x1b,0x07,0x00,0x22,
+  0x33,0x00,0x33,0x33,0x88,0x03,0x94,0x11,0xa4,0x1b,0x06,0x50,0x02,0x00,0x05,0x00,
+  0x00,0x88,0x80,0x02,0xbc,0x1b,0x00,0x55,0x82,0xb6,0x00,0x05,0x80,0x04,0x01,0x50,
+  0x00,0x82,0xf8,0xb0,0x1b,0x03,0x88,0x50,0x55,0x08,0x82,0x63,0x82,0xd7,0xb4,0x1b,
+  0x06,0x02,0x22,0x88,0x85,0x88,0x88,0x58,0x80,0x52,0x86,0xd3,0xb4,0x1b,0x06,0x85,
+  0x58,0x88,0x88,0x05,0x88,0x50,0x80,0x38,0xb4,0x6f,0x06,0x50,0x22,0x00,0x58,0x88,
+  0x85,0x00,0x88,0x54,0xbc,0x1b,0x01,0x55,0x88,0x80,0xa6,0x80,0x6d,0x01,0x00,0x05,
+  0xb4,0x53,0x01,0x50,0x22,0x80,0x6b,0x02,0x05,0x00,0x02,0x87,0x45,0x01,0x22,0x05,
+  0xbc,0x37,0x80,0x0c,0x88,0x1b,0x00,0x20,0xb8,0x1b,0x84,0x9f,0x00,0x00,0x81,0x65,
+  0x02,0x55,0x50,0x20,0x88,0x71,0xa4,0xa7,0x87,0xc7,0x87,0xeb,0x85,0x83,0x94,0x1b,
+  0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,0x22,
+  0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,
+  0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,
+  0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,0x1b,0x00,
+  0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,
+  0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,
+  0x60,0x55,0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,0x1b,0x08,
+  0x22,0x22,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xcc,0x37,0x01,0x00,0x96,0x80,0x1b,
+  0x03,0x69,0x58,0x22,0x21,0xb4,0x1b,0x09,0x00,0x22,0x10,0x33,0x96,0x61,0xa9,0x99,
+  0x99,0xaa,0xbc,0x1b,0x09,0x33,0x02,0x03,0x30,0x66,0x11,0x19,0x99,0x99,0x91,0xc4,
+  0x1b,0x07,0x34,0x04,0x61,0x10,0x99,0x96,0x69,0x16,0xbc,0x1b,0x09,0x43,0x30,0x30,
+  0x44,0x11,0x03,0x96,0x61,0x16,0x99,0xbd,0x6b,0x0b,0x43,0x30,0x00,0x34,0x10,0x00,
+  0x11,0x11,0x01,0x11,0x20,0x00,0xac,0x1b,0x0d,0x02,0x22,0x44,0x33,0x44,0x04,0x00,
+  0x04,0x00,0x00,0x60,0x00,0x06,0x66,0xb8,0x1b,0x01,0x04,0x74,0x80,0x1b,0x07,0x66,
+  0x00,0x96,0x06,0x66,0x99,0x02,0x20,0xa4,0x1b,0x0c,0x40,0x22,0x40,0x33,0x47,0x40,
+  0x66,0x60,0x99,0x66,0x90,0x69,0x69,0xb0,0x1b,0x0b,0x43,0x02,0x03,0x44,0x47,0x40,
+  0x99,0x60,0x99,0x99,0x90,0x69,0xa4,0x37,0x80,0x7a,0x05,0x22,0x44,0x02,0x33,0x44,
+  0x44,0x88,0x1b,0x01,0x60,0x69,0xa4,0x6f,0x80,0x07,0x0c,0x00,0x44,0x30,0x34,0x44,
+  0x00,0x03,0x66,0x00,0x66,0x66,0x00,0x06,0x9c,0xa7,0x84,0x07,0x09,0x20,0x00,0x44,
+  0x40,0x44,0x44,0x88,0x03,0x00,0x88,0x80,0x13,0x00,0x20,0x9c,0xdf,0x07,0x00,0x22,
+  0x50,0x05,0x00,0x05,0x44,0x30,0x88,0x1b,0x00,0x08,0x86,0x81,0x9c,0x1b,0x02,0x50,
+  0x02,0x55,0x80,0x1b,0x01,0x33,0x04,0x84,0x1b,0x00,0x50,0x80,0x41,0xa4,0x1b,0x09,
+  0x55,0x00,0x85,0x08,0x00,0x05,0x00,0x77,0x44,0x33,0x82,0x9f,0x02,0x00,0x20,0x05,
+  0x9c,0x1b,0x0a,0x02,0x22,0x85,0x50,0x85,0x58,0x00,0x58,0x47,0x77,0x00,0x80,0x0e,
+  0x01,0x55,0x50,0xac,0x1b,0x01,0x88,0x55,0x80,0x37,0x02,0x58,0x04,0x77,0x8a,0xf3,
+  0x00,0x55,0xa4,0x8b,0x80,0x1b,0x00,0x85,0x84,0x1b,0x01,0x20,0x47,0x8e,0x69,0x83,
+  0x0f,0x80,0x39,0x9c,0x1b,0x03,0x80,0x05,0x00,0x88,0x80,0x34,0x80,0x95,0x82,0xf2,
+  0x86,0xf3,0x9c,0xc3,0x80,0x00,0x00,0x08,0x88,0x1b,0x01,0x00,0x02,0x8b,0x2b,0xab,
+  0x47,0x88,0x09,0x80,0x65,0x80,0x1b,0x82,0xba,0xac,0x1b,0x9a,0x4d,0x84,0x1b,0x88,
+  0xe1,0xc4,0x1b,0x01,0x00,0x50,0x85,0x5b,0xd0,0x1b,0x84,0xe4,0xd3,0xd3,0x8c,0x35,
+  0x8c,0x1b,0x00,0x22,0xd0,0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,
+  0x22,0x22,0x20,0x22,0x00,0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,
+  0x20,0x80,0x15,0xc0,0x1b,0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,
+  0x02,0x22,0x55,0x55,0x84,0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,
+  0x1b,0x00,0x50,0x9c,0x1b,0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,
+  0x80,0x16,0x00,0x00,0x80,0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,
+  0x66,0xa9,0x60,0x55,0x08,0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,
+  0x1b,0x08,0x22,0x22,0x60,0x00,0x66,0x99,0xaa,0x99,0x09,0xc0,0x1b,0x00,0x00,0x80,
+  0x1b,0x00,0x96,0x80,0x1b,0x03,0x69,0x58,0x22,0x21,0xb4,0x1b,0x09,0x03,0x02,0x10,
+  0x33,0x96,0x61,0xa9,0x99,0x99,0xaa,0xbc,0x1b,0x09,0x34,0x30,0x03,0x30,0x66,0x11,
+  0x19,0x99,0x99,0x91,0xb4,0x1b,0x0b,0x02,0x22,0x44,0x43,0x00,0x03,0x61,0x00,0x99,
+  0x96,0x69,0x16,0xc4,0x1b,0x07,0x40,0x34,0x10,0x44,0x96,0x61,0x16,0x99,0xb5,0x6b,
+  0x0d,0x30,0x22,0x44,0x04,0x40,0x34,0x00,0x47,0x11,0x10,0x01,0x00,0x20,0x00,0xac,
+  0x1b,0x0d,0x43,0x02,0x00,0x34,0x74,0x04,0x60,0x47,0x00,0x06,0x60,0x66,0x06,0x66,
+  0xb4,0x1b,0x0d,0x33,0x44,0x74,0x00,0x96,0x07,0x66,0x69,0x06,0x99,0x66,0x99,0x02,
+  0x20,0x8c,0x1b,0x80,0x04,0x80,0x02,0x0c,0x44,0x30,0x33,0x44,0x44,0x03,0x96,0x04,
+  0x99,0x99,0x06,0x99,0x69,0x9c,0x1b,0x00,0x02,0x80,0x07,0x07,0x20,0x44,0x30,0x34,
+  0x44,0x00,0x03,0x60,0x80,0xa7,0x01,0x06,0x69,0x9c,0x37,0x0f,0x50,0x00,0x00,0x05,
+  0x00,0x00,0x44,0x40,0x44,0x44,0x88,0x03,0x00,0x88,0x66,0x60,0x9c,0x6f,0x02,0x02,
+  0x22,0x85,0x86,0x23,0x02,0x00,0x44,0x30,0x84,0x1b,0x02,0x04,0x08,0x00,0x80,0x00,
+  0x94,0xa7,0x09,0x02,0x22,0x88,0x50,0x88,0x58,0x00,0x58,0x33,0x00,0x88,0x1b,0x00,
+  0x40,0x82,0x2d,0x9a,0x83,0x0b,0x00,0x22,0x88,0x85,0x88,0x55,0x05,0x88,0x00,0x74,
+  0x44,0x33,0x80,0x32,0x00,0x44,0x81,0xf5,0x00,0x20,0x94,0x1b,0x09,0x50,0x22,0x58,
+  0x85,0x88,0x50,0x05,0x58,0x77,0x74,0x80,0x19,0x02,0x22,0x00,0x04,0x86,0x49,0x98,
+  0x1b,0x08,0x02,0x58,0x88,0x85,0x50,0x00,0x58,0x44,0x44,0x84,0x13,0x82,0xa1,0x82,
+  0x31,0x94,0x6f,0x84,0x1b,0x84,0x7f,0x94,0xcf,0x8a,0x4f,0x00,0x55,0x94,0x1b,0x01,
+  0x05,0x85,0x94,0x19,0x88,0xeb,0x84,0x1b,0x90,0x37,0x88,0xf9,0x9d,0xfb,0x01,0x02,
+  0x50,0x82,0x84,0x98,0x1b,0x88,0x02,0xa4,0x1b,0x00,0x00,0x83,0x2d,0xc7,0x7f,0x80,
+  0x6f,0x81,0x25,0x80,0x06,0xd4,0x1b,0x81,0x5d,0xc8,0x1b,0x85,0x5d,0xcb,0x7f,0x84,
+  0x1b,0x85,0x4d,0xcc,0x1b,0x88,0x13,0xd0,0x1b,0x84,0x71,0x94,0x23,0x00,0x22,0xd0,
+  0x00,0x03,0x02,0x22,0x00,0x00,0xfc,0x1b,0xfc,0x1b,0x04,0x22,0x22,0x20,0x22,0x00,
+  0x90,0x13,0xbc,0x1b,0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,
+  0x06,0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,0x55,0x55,0x84,
+  0x1b,0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,0x1b,0x00,0x50,0x9c,0x1b,
+  0x00,0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,0x00,0x00,0x80,
+  0x8a,0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,0x60,0x55,0x08,
+  0xc4,0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,0x1b,0x08,0x22,0x22,0x60,
+  0x00,0x66,0x99,0xaa,0x99,0x09,0xd0,0x1b,0x00,0x96,0x80,0x1b,0x03,0x69,0x58,0x22,
+  0x21,0xbc,0x53,0x07,0x10,0x33,0x96,0x61,0xa9,0x99,0x99,0xaa,0xbc,0x1b,0x09,0x30,
+  0x22,0x03,0x30,0x66,0x11,0x19,0x99,0x99,0x91,0xbc,0x1b,0x09,0x33,0x02,0x34,0x04,
+  0x61,0x10,0x99,0x96,0x69,0x16,0xbc,0x1b,0x09,0x43,0x02,0x00,0x44,0x11,0x03,0x96,
+  0x61,0x16,0x99,0xbd,0x6b,0x0b,0x03,0x30,0x44,0x44,0x10,0x00,0x11,0x11,0x00,0x11,
+  0x20,0x00,0xac,0x1b,0x0d,0x02,0x22,0x03,0x33,0x44,0x44,0x00,0x04,0x00,0x00,0x66,
+  0x00,0x06,0x06,0xac,0x1b,0x0f,0x30,0x22,0x33,0x43,0x44,0x30,0x44,0x04,0x00,0x04,
+  0x99,0x60,0x60,0x69,0x02,0x20,0x8c,0x1b,0x80,0x05,0x80,0x07,0x80,0x89,0x08,0x44,
+  0x43,0x03,0x74,0x03,0x66,0x04,0x99,0x96,0x94,0x1b,0x86,0x21,0x86,0x05,0x0b,0x43,
+  0x30,0x34,0x44,0x30,0x33,0x74,0x00,0x96,0x04,0x99,0x99,0x98,0x1b,0x03,0x00,0x55,
+  0x85,0x00,0x81,0x77,0x80,0x4f,0x01,0x44,0x03,0x80,0x1b,0x03,0x66,0x04,0x66,0x66,
+  0x8c,0x6f,0x81,0xeb,0x08,0x00,0x85,0x88,0x00,0x58,0x40,0x20,0x43,0x04,0x80,0x89,
+  0x01,0x34,0x40,0x80,0x8b,0x84,0x47,0x84,0x1b,0x11,0x00,0x22,0x88,0x55,0x85,0x58,
+  0x05,0x58,0x44,0x00,0x33,0x07,0x44,0x44,0x40,0x33,0x00,0x44,0x84,0x7b,0x8c,0xdf,
+  0x13,0x50,0x02,0x88,0x85,0x85,0x55,0x55,0x88,0x70,0x05,0x30,0x47,0x44,0x43,0x44,
+  0x03,0x50,0x44,0x20,0x05,0x80,0x67,0x01,0x02,0x02,0x80,0x36,0x13,0x55,0x00,0x58,
+  0x88,0x50,0x05,0x58,0x88,0x40,0x55,0x30,0x47,0x34,0x33,0x40,0x03,0x55,0x04,0x05,
+  0x55,0x86,0x89,0x01,0x00,0x05,0x84,0x1b,0x82,0x76,0x0a,0x00,0x88,0x85,0x00,0x55,
+  0x02,0x04,0x33,0x30,0x02,0x03,0x82,0x13,0x02,0x55,0x50,0x05,0x82,0x35,0x98,0x00,
+  0x00,0x88,0x80,0x27,0x00,0x22,0x88,0x80,0x00,0x50,0x82,0xd7,0x86,0xa1,0x88,0x16,
+  0x88,0x8f,0x88,0x08,0x8e,0xd9,0x88,0x1b,0x80,0x4e,0xa0,0x11,0x84,0xfd,0x93,0x11,
+  0x86,0xf5,0x00,0x05,0x84,0x8b,0xbf,0x5b,0x00,0x05,0x80,0x71,0xcc,0x1b,0x89,0x27,
+  0x80,0x51,0x95,0x6b,0xb0,0x1b,0x02,0x02,0x05,0x50,0xd8,0x1b,0x80,0x55,0x85,0x4b,
+  0xc4,0x1b,0x84,0x15,0xb5,0xf7,0xa4,0x71,0x80,0x58,0xd4,0x1b,0x00,0x02,0x8e,0xd7,
+  0x00,0x22,0xa8,0x00,0x05,0x20,0x22,0x00,0x22,0x00,0x00,0x84,0x09,0x00,0x02,0x90,
+  0x07,0x9c,0x00,0x06,0x00,0x22,0x55,0x02,0x55,0x55,0x20,0x80,0x15,0xc0,0x1b,0x06,
+  0x00,0x55,0x50,0x55,0x55,0x00,0x55,0xbc,0x1b,0x03,0x02,0x22,0x55,0x55,0x84,0x1b,
+  0x03,0x05,0x55,0x22,0x20,0xc8,0x1b,0x88,0x00,0xbc,0x1b,0x00,0x50,0x9c,0x1b,0x00,
+  0x05,0xcc,0x1b,0x03,0x00,0x05,0x55,0x50,0xc4,0x1b,0x80,0x16,0x00,0x00,0x80,0x8a,
+  0x00,0x05,0xbc,0x1b,0x09,0x02,0x22,0x60,0x55,0x00,0x66,0xa9,0x60,0x55,0x08,0xc4,
+  0x8b,0x06,0x60,0x50,0x60,0x99,0xaa,0x96,0x50,0xc0,0x1b,0x08,0x22,0x22,0x60,0x00,
+  0x66,0x99,0xaa,0x99,0x09,0xcc,0x1b,0x01,0x22,0x96,0x80,0x1b,0x03,0x69,0x58,0x22,
+  0x21,0xbc,0x1b,0x07,0x10,0x02,0x96,0x61,0xa9,0x99,0x99,0xaa,0xbc,0x1b,0x09,0x00,
+  0x02,0x03,0x30,0x66,0x11,0x19,0x99,0x99,0x91,0xbc,0x1b,0x09,0x03,0x30,0x44,0x33,
+  0x61,0x10,0x99,0x96,0x69,0x16,0xb4,0x1b,0x0b,0x02,0x22,0x44,0x33,0x44,0x30,0x11,
+  0x10,0x96,0x61,0x16,0x99,0xb5,0x6b,0x00,0x00,0x84,0x1b,0x06,0x40,0x11,0x10,0x11,
+  0x11,0x21,0x11,0xb4,0x1b,0x07,0x40,0x02,0x44,0x00,0x00,0x00,0x01,0x10,0x80,0x13,
+  0xb9,0xbf,0x0e,0x74,0x40,0x40,0x47,0x03,0x30,0x80,0x08,0x04,0x08,0x00,0x70,0x00,
+  0x00,0x02,0x80,0x27,0x9c,0x1b,0x0f,0x77,0x40,0x04,0x77,0x03,0x30,0x88,0x88,0x04,
+  0x08,0x60,0x74,0x99,0x96,0x00,0x66,0xa8,0x37,0x04,0x00,0x07,0x77,0x03,0x33,0x90,
+  0x1b,0x02,0x99,0x00,0x69,0x9c,0x1b,0x80,0x5f,0x03,0x66,0x04,0x74,0x80,0x9c,0x1b,
+  0xa0,0x37,0x05,0x02,0x22,0x66,0x99,0x04,0x40,0x94,0x1b,0x01,0x66,0x66,0xa4,0x1b,
+  0x05,0x90,0x22,0x06,0x69,0x30,0x02,0x88,0x1b,0x06,0x30,0x00,0x44,0x66,0x00,0x02,
+  0x06,0xa4,0x1b,0x03,0x20,0x66,0x30,0x22,0x8c,0x1b,0x84,0xbe,0x01,0x02,0x20,0x9c,
+  0x1b,0x07,0x99,0x02,0x06,0x69,0x33,0x02,0x88,0x03,0x88,0x1b,0xb2,0xbb,0x80,0x1b,
+  0x02,0x99,0x33,0x30,0xd4,0x1b,0x01,0x66,0x69,0x80,0x1b,0x04,0x80,0x88,0x88,0x33,
+  0x00,0x82,0xfa,0xa8,0x1b,0x02,0x60,0x22,0x06,0x80,0x99,0x00,0x88,0x80,0x00,0x01,
+  0x00,0x88,0xb5,0x33,0x02,0x02,0x22,0x50,0x82,0x7c,0x84,0x37,0x03,0x55,0x00,0x22,
+  0x05,0xb5,0x4f,0x0a,0x55,0x02,0x58,0x85,0x00,0x05,0x00,0x00,0x85,0x55,0x20,0xbb,
+  0x0f,0x0b,0x55,0x50,0x88,0x88,0x22,0x05,0x50,0x22,0x88,0x55,0x20,0x58,0xb4,0x53,
+  0x01,0x55,0x55,0x94,0x1b,0x00,0x05,0xb0,0x1b,0x86,0xef,0x84,0x1b,0x01,0x55,0x02,
+  0x80,0x1b,0xb3,0x2b,0x82,0xe9,0x04,0x55,0x58,0x85,0x22,0x20,0x87,0x9b,0x83,0x9d,
+  0xa2,0xf3,0x83,0xaf,0x93,0x5b,0x84,0x1b,0x01,0x88,0x88,0x80,0x3e,0x99,0x33,0x02,
+  0x55,0x00,0x88,0x80,0x12,0x98,0x1b,0x03,0x85,0x55,0x88,0x02,0x80,0xb1,0x98,0x87,
+  0x01,0x85,0x58,0x80,0x2d,0x84,0xc9,0x8c,0x41,0x83,0x4e,0x88,0x1b,0x97,0x93,0x84,
+  0x1b,0x94,0x0b,0x94,0x1b,0x82,0x58,0x90,0x00,0x8c,0xbb,0x84,0x00,0x86,0x4b,
+};
+
+const unsigned int img_loserboy_lz_data_index[] = {
+  0,433,861,1364,1877,2398,2802,3236,3700,4191,4713,5205,5643,6092,6600,7113,
+  7634,8064,8528,9010,9485,9984,
+};
+
+const unsigned char img_loserboy_lz_shifted_data[] = {
+  0x00,0x22,0xfc,0x00,0xfc,0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,
+  0x20,0xcc,0x1b,0x05,0x50,0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,
+  0x00,0x55,0x55,0x05,0x55,0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,
+  0x00,0xc8,0x1b,0x88,0x00,0x00,0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,0x55,
+  0x55,0x20,0x55,0xcc,0x1b,0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,
+  0x50,0xc0,0x37,0x09,0x22,0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,
+  0x80,0x1b,0x05,0x00,0x09,0x96,0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,0x69,0x96,
+  0xa9,0x96,0x90,0x8a,0xbc,0xc3,0x85,0x2f,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,
+  0xb4,0x1b,0x0b,0x30,0x02,0x03,0x30,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xb0,
+  0x4f,0x0a,0x22,0x44,0x30,0x33,0x03,0x61,0x10,0x99,0x96,0x99,0x11,0xb4,0x1b,0x0b,
+  0x44,0x02,0x33,0x04,0x40,0x44,0x11,0x03,0x99,0x66,0x91,0x69,0xb4,0x53,0x0d,0x77,
+  0x40,0x30,0x47,0x04,0x44,0x10,0x33,0x66,0x11,0x69,0x99,0x22,0x21,0xac,0x1b,0x08,
+  0x74,0x00,0x04,0x77,0x33,0x44,0x00,0x00,0x11,0x80,0x00,0xb8,0xa3,0x02,0x66,0x04,
+  0x74,0x80,0x1b,0x00,0x80,0x81,0xdb,0xb0,0x00,0x0b,0x60,0x22,0x66,0x99,0x04,0x40,
+  0x03,0x34,0x88,0x88,0x20,0x08,0xb4,0x1b,0x06,0x96,0x02,0x06,0x99,0x30,0x00,0x80,
+  0xd0,0x1b,0x08,0x66,0x69,0x34,0x06,0x88,0x04,0x88,0x88,0x22,0xc0,0x1b,0x07,0x99,
+  0x99,0x40,0x69,0x88,0x03,0x88,0x88,0xbe,0x4b,0x84,0x1b,0x09,0x06,0x99,0x88,0x80,
+  0x08,0x88,0x66,0x66,0x22,0x06,0xb4,0x8b,0x94,0x1b,0x01,0x99,0x96,0xb4,0x1b,0x03,
+  0x02,0x22,0x99,0x66,0x80,0x53,0x04,0x80,0x88,0x88,0x99,0x60,0xb4,0x1b,0x05,0x22,
+  0x22,0x66,0x00,0x03,0x06,0xd4,0x1b,0x03,0x00,0x22,0x03,0x00,0x84,0x1b,0x01,0x96,
+  0x00,0xc0,0x1b,0x01,0x02,0x00,0x88,0x00,0x01,0x60,0x58,0xb4,0xa7,0x82,0xed,0x05,
+  0x00,0x00,0x05,0x50,0x00,0x88,0xc2,0xf1,0x86,0xed,0x86,0x7d,0x01,0x88,0x85,0xbe,
+  0xef,0x86,0x7b,0x05,0x00,0x05,0x55,0x00,0x58,0x88,0xbc,0x1b,0x02,0x50,0x00,0x50,
+  0x80,0x38,0x80,0x00,0xc2,0x99,0x01,0x50,0x02,0x80,0x34,0x87,0x43,0x00,0x50,0xc0,
+  0x53,0x02,0x22,0x05,0x55,0x80,0x89,0x02,0x85,0x55,0x88,0xc7,0x27,0x01,0x05,0x00,
+  0x80,0x1b,0x80,0x00,0x00,0x20,0xc6,0xb7,0x84,0x6c,0xcb,0x43,0x9c,0xfb,0x00,0x20,
+  0x9a,0x13,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,
+  0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,
+  0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,
+  0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,
+  0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,
+  0xcc,0x37,0x06,0x02,0x66,0x60,0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,
+  0x60,0x96,0x60,0x08,0xaa,0x20,0x50,0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,
+  0x00,0x09,0xc0,0x1b,0x00,0x00,0x80,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xbc,0x35,
+  0x09,0x33,0x03,0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,0xb1,0x49,0x0a,0x22,0x43,
+  0x00,0x30,0x34,0x11,0x03,0x99,0x66,0x91,0x19,0xb4,0x1b,0x0b,0x40,0x22,0x30,0x44,
+  0x04,0x43,0x10,0x34,0x96,0x61,0x16,0x99,0xb4,0x53,0x0d,0x74,0x02,0x04,0x77,0x44,
+  0x43,0x03,0x30,0x61,0x11,0x99,0x96,0x22,0x16,0xb0,0x37,0x0c,0x02,0x47,0x77,0x34,
+  0x40,0x00,0x03,0x11,0x10,0x11,0x11,0x22,0x21,0xac,0x1b,0x07,0x06,0x60,0x47,0x40,
+  0x34,0x40,0x08,0x03,0x81,0xdb,0xb1,0xbd,0x0b,0x02,0x22,0x69,0x96,0x44,0x06,0x33,
+  0x40,0x88,0x80,0x00,0x88,0xb4,0xbf,0x09,0x60,0x22,0x69,0x99,0x00,0x00,0x03,0x43,
+  0x88,0x88,0xc4,0x1b,0x04,0x66,0x99,0x40,0x66,0x80,0x80,0x1b,0x00,0x20,0xc0,0x1b,
+  0x05,0x99,0x99,0x06,0x99,0x80,0x34,0x80,0x37,0x00,0x08,0xb6,0x11,0x84,0x1b,0x01,
+  0x69,0x99,0x80,0x50,0x04,0x88,0x66,0x60,0x20,0x66,0xb4,0x8b,0x01,0x99,0x96,0x8c,
+  0x1b,0x02,0x99,0x60,0x20,0xb9,0x4d,0x09,0x96,0x60,0x06,0x99,0x88,0x04,0x88,0x88,
+  0x96,0x08,0xbc,0x1b,0x03,0x60,0x02,0x30,0x66,0x84,0x37,0xc4,0x1b,0x03,0x02,0x22,
+  0x30,0x00,0x84,0x1b,0x00,0x60,0xc0,0x1b,0x82,0xea,0x88,0x00,0x03,0x05,0x80,0x22,
+  0x06,0xbd,0xd7,0x07,0x00,0x55,0x00,0x00,0x85,0x55,0x00,0x58,0xb5,0x33,0x86,0xed,
+  0x86,0x7d,0x03,0x88,0x55,0x22,0x08,0xb8,0x35,0x01,0x02,0x00,0x83,0x0a,0x80,0x1b,
+  0x01,0x85,0x22,0xba,0xef,0x03,0x00,0x02,0x05,0x55,0x82,0x9b,0x02,0x00,0x05,0x50,
+  0xbf,0x43,0x01,0x00,0x22,0x83,0x5b,0x80,0x38,0x01,0x55,0x05,0xbf,0x43,0x00,0x02,
+  0x86,0xd3,0x80,0x6d,0x01,0x58,0x88,0xca,0xb7,0x80,0xa8,0x01,0x88,0x85,0x81,0x6b,
+  0x00,0x58,0xc2,0x9b,0x00,0x02,0x88,0x53,0xcb,0x0b,0x94,0xfb,0x82,0x13,0x90,0x00,
+  0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,
+  0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,0x55,
+  0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,0x84,0x1a,0x02,0x55,0x00,
+  0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,0x00,0x01,0x55,0x02,0x8c,0x1b,
+  0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,
+  0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,0x05,0x00,0x06,0x8a,0x96,0x05,
+  0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,0x8a,0xa9,0x05,0xc8,0xdf,0x07,
+  0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,0xc0,0x37,0x03,0x02,0x96,0x00,0x99,0x80,
+  0x1b,0x01,0x16,0x95,0xbc,0x35,0x09,0x30,0x30,0x11,0x03,0x99,0x66,0xaa,0x99,0x19,
+  0x9a,0xb4,0x1b,0x0b,0x30,0x00,0x03,0x44,0x10,0x33,0x96,0x61,0x11,0x99,0x19,0x99,
+  0xb4,0x35,0x0b,0x04,0x44,0x44,0x33,0x03,0x40,0x66,0x11,0x69,0x99,0x16,0x91,0xac,
+  0x1b,0x0d,0x40,0x22,0x47,0x77,0x44,0x30,0x33,0x04,0x11,0x10,0x99,0x66,0x21,0x69,
+  0xb4,0xbf,0x0b,0x77,0x74,0x44,0x04,0x00,0x33,0x11,0x00,0x11,0x11,0x22,0x11,0xac,
+  0x1b,0x09,0x66,0x02,0x74,0x00,0x44,0x04,0x80,0x33,0x00,0x00,0xbd,0xbd,0x09,0x99,
+  0x60,0x40,0x66,0x34,0x04,0x88,0x03,0x08,0x88,0xb5,0x2f,0x09,0x02,0x22,0x99,0x96,
+  0x00,0x06,0x34,0x30,0x88,0x80,0xc4,0x1b,0x07,0x69,0x96,0x06,0x66,0x04,0x34,0x88,
+  0x88,0x80,0x1b,0xb8,0xf7,0x09,0x99,0x96,0x69,0x99,0x03,0x40,0x88,0x88,0x00,0x88,
+  0xb6,0x4b,0x84,0x1b,0x09,0x99,0x99,0x80,0x06,0x88,0x88,0x66,0x08,0x06,0x66,0xbc,
+  0x8b,0x8c,0x1b,0x02,0x96,0x08,0x06,0xb1,0x15,0x84,0xc3,0x02,0x69,0x99,0x80,0x80,
+  0x53,0x01,0x60,0x88,0xbc,0x1b,0x05,0x00,0x22,0x06,0x66,0x80,0x03,0xcc,0x1b,0x80,
+  0x1d,0x00,0x00,0x84,0x1b,0x03,0x00,0x88,0x06,0x96,0xc6,0xb7,0x84,0x00,0x03,0x58,
+  0x00,0x20,0x60,0xbd,0xd7,0x01,0x05,0x50,0x82,0x61,0x02,0x50,0x05,0x88,0xb5,0x33,
+  0x8e,0xed,0x04,0x00,0x00,0x85,0x55,0x20,0xb8,0xfb,0x03,0x00,0x22,0x05,0x00,0x84,
+  0x37,0x03,0x88,0x55,0x20,0x58,0xbc,0x1b,0x02,0x55,0x50,0x00,0x84,0x53,0xc1,0x85,
+  0x00,0x02,0x84,0x1b,0x03,0x05,0x55,0x00,0x50,0xcb,0x43,0x80,0x6c,0x04,0x05,0x85,
+  0x50,0x88,0x88,0xc7,0x27,0x04,0x00,0x02,0x00,0x05,0x88,0x84,0x1b,0xb9,0xa3,0x84,
+  0x71,0x84,0x6d,0xcf,0x43,0x94,0xfb,0x82,0x13,0x90,0x1b,0x00,0x22,0xfc,0x00,0xfc,
+  0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,
+  0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,0x55,
+  0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xc8,0x1b,0x88,0x00,
+  0x00,0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,0x55,0x55,0x20,0x55,0xcc,0x1b,
+  0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,
+  0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,
+  0x96,0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,0x8a,0xc4,
+  0xc3,0x88,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,0xbc,0x8b,0x09,0x03,0x30,0x66,0x11,
+  0x99,0x99,0x9a,0xaa,0x22,0x19,0xb8,0x35,0x08,0x22,0x33,0x03,0x61,0x10,0x99,0x96,
+  0x99,0x11,0xbc,0x1b,0x09,0x33,0x00,0x30,0x34,0x11,0x03,0x99,0x66,0x91,0x69,0xb4,
+  0x53,0x0d,0x00,0x22,0x43,0x04,0x04,0x44,0x10,0x33,0x66,0x11,0x69,0x99,0x22,0x21,
+  0xac,0x1b,0x08,0x74,0x02,0x30,0x47,0x44,0x44,0x00,0x00,0x11,0x80,0x00,0xb4,0x51,
+  0x08,0x40,0x02,0x04,0x77,0x34,0x43,0x08,0x80,0x20,0xc0,0xbf,0x09,0x06,0x60,0x47,
+  0x74,0x04,0x40,0x88,0x88,0x22,0x08,0xbc,0xbf,0x04,0x69,0x96,0x47,0x40,0x03,0xc8,
+  0x1b,0x09,0x60,0x22,0x99,0x99,0x04,0x06,0x80,0x43,0x88,0x88,0xbc,0x53,0x0b,0x60,
+  0x22,0x66,0x99,0x30,0x06,0x80,0x44,0x08,0x88,0x06,0x66,0xc4,0x37,0x05,0x40,0x66,
+  0x80,0x34,0x60,0x88,0x80,0xc1,0xb2,0x2d,0x88,0x1b,0x02,0x69,0x88,0x04,0xc4,0x1b,
+  0x03,0x02,0x22,0x99,0x96,0x90,0x1b,0x00,0x96,0xbe,0x65,0x07,0x66,0x60,0x40,0x06,
+  0x88,0x04,0x00,0x00,0xbc,0x6f,0x85,0x9f,0x02,0x40,0x00,0x00,0x82,0x2c,0xc4,0xfb,
+  0x07,0x00,0x02,0x00,0x00,0x85,0x50,0x08,0x88,0xc6,0xb7,0x00,0x50,0x80,0x35,0x03,
+  0x88,0x55,0x05,0x88,0xc7,0x09,0x06,0x55,0x00,0x50,0x00,0x88,0x85,0x00,0xc0,0x1b,
+  0x00,0x00,0x82,0x63,0x82,0x80,0x00,0x58,0xcc,0x6d,0x83,0x08,0x03,0x00,0x55,0x05,
+  0x00,0xc2,0x99,0x84,0x89,0x80,0x53,0x00,0x88,0x80,0x6f,0xb8,0x8b,0x87,0x5d,0x05,
+  0x50,0x05,0x88,0x85,0x58,0x88,0xbe,0x7f,0x00,0x00,0x83,0x43,0x04,0x00,0x55,0x88,
+  0x55,0x55,0xc0,0x1b,0x84,0xa7,0x80,0x71,0x00,0x50,0x83,0x97,0xd0,0xfb,0x84,0x00,
+  0x9c,0x6f,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,
+  0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,
+  0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,
+  0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,
+  0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,
+  0xcc,0x37,0x06,0x02,0x66,0x60,0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,
+  0x60,0x96,0x60,0x08,0xaa,0x20,0x50,0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,
+  0x00,0x09,0xd0,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xbc,0x1b,0x09,0x33,0x00,0x61,
+  0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,0xb9,0x4b,0x08,0x22,0x30,0x30,0x11,0x03,0x99,
+  0x66,0x91,0x19,0xbc,0x1b,0x09,0x30,0x02,0x03,0x43,0x10,0x33,0x96,0x61,0x16,0x99,
+  0xb4,0x53,0x80,0x35,0x0a,0x40,0x44,0x44,0x03,0x30,0x61,0x11,0x99,0x96,0x22,0x16,
+  0xac,0x1b,0x0d,0x40,0x22,0x04,0x77,0x44,0x43,0x00,0x04,0x11,0x10,0x11,0x11,0x22,
+  0x21,0xb4,0xa3,0x05,0x47,0x74,0x44,0x30,0x88,0x03,0x81,0xdb,0xb8,0x00,0x09,0x66,
+  0x02,0x77,0x40,0x44,0x04,0x88,0x80,0x20,0x88,0xbc,0x1b,0x04,0x99,0x60,0x74,0x06,
+  0x34,0xc8,0x1b,0x0b,0x02,0x22,0x99,0x96,0x40,0x69,0x04,0x30,0x88,0x88,0x00,0x08,
+  0xbc,0x1b,0x09,0x69,0x96,0x00,0x66,0x04,0x43,0x88,0x88,0x66,0x60,0xb6,0x2d,0x84,
+  0x37,0x05,0x06,0x69,0x03,0x44,0x08,0x88,0x80,0xc1,0x00,0x06,0xc0,0x1b,0x01,0x99,
+  0x80,0xc8,0x1b,0x84,0x8b,0x90,0x1b,0x00,0x66,0xbc,0x1b,0x07,0x66,0x02,0x00,0x66,
+  0x80,0x44,0x00,0x08,0xbc,0x6f,0x84,0xfb,0x03,0x00,0x00,0x00,0x04,0x86,0x15,0xc5,
+  0xbb,0x05,0x00,0x00,0x55,0x00,0x88,0x88,0xc6,0xb7,0x07,0x00,0x02,0x00,0x05,0x85,
+  0x50,0x58,0x88,0xc6,0xef,0x06,0x50,0x00,0x00,0x05,0x88,0x55,0x08,0xc0,0x1b,0x03,
+  0x02,0x22,0x55,0x00,0x80,0x6a,0x00,0x85,0xc5,0x69,0x00,0x00,0x82,0x9b,0x02,0x50,
+  0x00,0x50,0x86,0x99,0xcc,0xa5,0x02,0x00,0x88,0x85,0x80,0x6f,0xb8,0x39,0x87,0x5d,
+  0x05,0x00,0x55,0x88,0x55,0x88,0x88,0xbf,0x43,0x84,0x6f,0x01,0x05,0x55,0x84,0xa7,
+  0xc7,0x5f,0x8b,0x95,0x80,0x03,0x00,0x20,0xc8,0x8d,0x84,0x71,0xa7,0xed,0x00,0x22,
+  0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,
+  0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,
+  0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc4,
+  0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,0x00,0x01,0x55,0x02,0x8c,0x1b,0x03,0x55,
+  0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,
+  0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,
+  0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,0x8a,0xa9,0x05,0xc8,0xdf,0x07,0x96,0x00,
+  0x96,0x69,0x8a,0xa9,0x00,0x90,0xcc,0x1b,0x00,0x99,0x80,0x1b,0x01,0x16,0x95,0xbc,
+  0x1b,0x09,0x30,0x02,0x11,0x03,0x99,0x66,0xaa,0x99,0x19,0x9a,0xbc,0x1b,0x09,0x03,
+  0x00,0x10,0x33,0x96,0x61,0x11,0x99,0x19,0x99,0xbc,0x89,0x09,0x34,0x33,0x03,0x30,
+  0x66,0x11,0x69,0x99,0x16,0x91,0xb4,0x1b,0x0b,0x04,0x00,0x44,0x43,0x33,0x04,0x11,
+  0x10,0x99,0x66,0x21,0x69,0xb4,0x87,0x0b,0x47,0x74,0x44,0x30,0x00,0x44,0x11,0x00,
+  0x11,0x11,0x22,0x11,0xb4,0x1b,0x07,0x77,0x40,0x43,0x04,0x80,0x34,0x00,0x08,0xbd,
+  0x13,0x09,0x60,0x22,0x74,0x06,0x40,0x47,0x88,0x04,0x08,0x88,0xbc,0xa3,0x03,0x96,
+  0x02,0x40,0x69,0x80,0x1b,0x00,0x03,0xc4,0x1b,0x09,0x99,0x60,0x06,0x99,0x43,0x04,
+  0x88,0x80,0x00,0x88,0xbc,0x53,0x80,0x1b,0x08,0x66,0x44,0x30,0x88,0x80,0x66,0x08,
+  0x22,0x06,0xbc,0x1b,0x08,0x66,0x99,0x34,0x40,0x88,0x80,0x99,0x60,0x20,0xb0,0xc1,
+  0x84,0x1b,0x05,0x69,0x99,0x04,0x40,0x88,0x88,0xc4,0x1b,0x01,0x96,0x02,0x8c,0x1b,
+  0x00,0x96,0xc0,0x1b,0x09,0x60,0x22,0x06,0x66,0x04,0x40,0x00,0x88,0x66,0x00,0xbc,
+  0x6f,0x86,0x9b,0x01,0x00,0x40,0x86,0x2c,0xbc,0xa7,0x84,0x1b,0x05,0x50,0x00,0x88,
+  0x85,0x20,0x08,0xc6,0x0f,0x06,0x00,0x50,0x55,0x00,0x88,0x88,0x22,0xc2,0xd3,0x00,
+  0x00,0x82,0x63,0x01,0x85,0x50,0x80,0x1b,0xc2,0x2b,0x04,0x50,0x00,0x00,0x05,0x58,
+  0x80,0x6e,0xc4,0x6d,0x80,0x16,0x00,0x05,0x87,0x0d,0xbc,0x37,0x88,0xa5,0x01,0x00,
+  0x88,0x80,0x53,0xbf,0x43,0x84,0x1b,0x00,0x05,0x88,0x6f,0x01,0x00,0x58,0xc4,0x6f,
+  0x87,0x0a,0x80,0x1b,0xc3,0x43,0x00,0x00,0x83,0x27,0x83,0xb2,0x01,0x55,0x00,0xc0,
+  0xc3,0x8c,0x71,0x01,0x00,0x00,0x9f,0xed,0x00,0x22,0xfc,0x00,0xfc,0x00,0xe8,0x00,
+  0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,0x55,0x55,
+  0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,0x55,0xc4,0x39,0x01,
+  0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xbc,0x51,0x80,0x1b,0x88,0x00,0x00,
+  0x22,0xb8,0x55,0x80,0x1b,0x90,0x00,0x01,0x20,0x55,0xcc,0x1b,0x80,0x70,0x00,0x00,
+  0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,0x22,0x05,0x50,0x06,
+  0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,0x96,0xa9,0x66,0x00,
+  0xb8,0x1b,0x00,0x02,0x80,0xde,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,0x8a,0xb4,
+  0xc3,0x05,0x40,0x22,0x00,0x04,0x00,0x00,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,
+  0xb4,0x1b,0x0b,0x30,0x47,0x03,0x03,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xb5,
+  0x2f,0x09,0x04,0x77,0x34,0x30,0x61,0x10,0x99,0x96,0x99,0x11,0xac,0x1b,0x0d,0x02,
+  0x22,0x66,0x60,0x04,0x70,0x44,0x04,0x11,0x03,0x99,0x66,0x91,0x69,0xac,0x53,0x0f,
+  0x60,0x22,0x69,0x96,0x04,0x70,0x40,0x44,0x10,0x34,0x66,0x11,0x69,0x99,0x22,0x21,
+  0xa4,0x1b,0x0a,0x96,0x02,0x69,0x99,0x30,0x40,0x04,0x44,0x00,0x04,0x11,0x80,0x00,
+  0xac,0x6d,0x09,0x66,0x60,0x06,0x66,0x33,0x00,0x03,0x44,0x08,0x80,0xbd,0xdb,0x0b,
+  0x99,0x60,0x20,0x69,0x43,0x02,0x80,0x34,0x88,0x88,0x00,0x08,0x80,0xdc,0xa8,0x1d,
+  0x84,0x1b,0x01,0x44,0x30,0x8c,0x1b,0x03,0x66,0x00,0x22,0x06,0xac,0x1b,0x0d,0x00,
+  0x69,0x44,0x43,0x88,0x03,0x88,0x88,0x60,0x08,0x99,0x66,0x20,0x69,0xa8,0x6f,0x04,
+  0x02,0x30,0x06,0x44,0x44,0x90,0x1b,0x00,0x99,0xac,0x1b,0x04,0x00,0x22,0x43,0x00,
+  0x34,0x80,0x1b,0x03,0x00,0x88,0x60,0x00,0xb4,0x37,0x03,0x22,0x22,0x43,0x02,0x80,
+  0x1b,0x04,0x80,0x50,0x08,0x00,0x55,0xb4,0x6f,0x05,0x22,0x22,0x30,0x22,0x34,0x43,
+  0x80,0x1b,0x02,0x00,0x05,0x88,0xb4,0xa7,0x85,0x35,0x07,0x34,0x33,0x08,0x80,0x55,
+  0x00,0x08,0x88,0xbe,0x81,0x09,0x00,0x02,0x33,0x00,0x00,0x00,0x85,0x50,0x58,0x88,
+  0xb6,0xbb,0x86,0xeb,0x03,0x00,0x40,0x02,0x04,0x84,0x1b,0xb6,0x9f,0x00,0x00,0x82,
+  0x47,0x0a,0x44,0x00,0x02,0x20,0x85,0x50,0x85,0x58,0x58,0x88,0x20,0xa8,0x1b,0x01,
+  0x50,0x02,0x87,0x07,0x06,0x02,0x20,0x55,0x50,0x88,0x85,0x05,0xb0,0x1b,0x8f,0x07,
+  0x03,0x02,0x20,0x50,0x00,0x81,0x35,0x00,0x05,0xa4,0x1b,0x83,0x3f,0x07,0x00,0x00,
+  0x05,0x00,0x55,0x02,0x22,0x85,0x84,0xc3,0x00,0x00,0xa4,0x6f,0x82,0xb5,0x86,0xce,
+  0x80,0x11,0x00,0x85,0x80,0xe0,0xad,0xa5,0x90,0x1b,0x83,0x5b,0x00,0x55,0x80,0x40,
+  0xac,0x6d,0x84,0x53,0x8f,0x77,0x01,0x00,0x02,0xbd,0xdb,0x01,0x00,0x00,0x80,0x52,
+  0x84,0x1b,0x84,0x02,0xb5,0x15,0x84,0xfb,0xb0,0x15,0x00,0x22,0xfc,0x00,0xfc,0x00,
+  0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,0x00,
+  0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,
+  0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc0,0x1b,0x88,0x35,0x80,0x1b,
+  0x00,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,
+  0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,0x00,
+  0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,0xc5,
+  0x12,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xb1,0x11,0x04,0x22,0x00,0x44,
+  0x00,0x00,0x80,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xb4,0x1b,0x0b,0x04,0x74,0x30,
+  0x33,0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,0xb5,0x2f,0x09,0x47,0x70,0x43,0x00,
+  0x11,0x03,0x99,0x66,0x91,0x19,0xb4,0x1b,0x0b,0x66,0x00,0x47,0x06,0x40,0x40,0x10,
+  0x34,0x96,0x61,0x16,0x99,0xac,0x53,0x0f,0x02,0x22,0x99,0x66,0x47,0x06,0x04,0x40,
+  0x03,0x44,0x61,0x11,0x99,0x96,0x22,0x16,0xa4,0x1b,0x0f,0x60,0x22,0x99,0x99,0x04,
+  0x06,0x44,0x43,0x00,0x40,0x11,0x10,0x11,0x11,0x22,0x21,0xa8,0x51,0x08,0x02,0x66,
+  0x66,0x30,0x00,0x34,0x43,0x88,0x00,0xbd,0xdb,0x0d,0x96,0x02,0x06,0x99,0x30,0x22,
+  0x03,0x44,0x88,0x88,0x00,0x88,0x02,0x20,0xac,0x1d,0x84,0x1b,0x01,0x43,0x02,0x8c,
+  0x1b,0x03,0x60,0x00,0x20,0x66,0xb4,0x1b,0x03,0x44,0x30,0x80,0x34,0x84,0x1b,0x02,
+  0x96,0x66,0x06,0xa8,0xc3,0x05,0x60,0x22,0x00,0x66,0x44,0x43,0x8c,0x1b,0x01,0x99,
+  0x96,0xac,0x1b,0x08,0x02,0x22,0x30,0x00,0x44,0x44,0x80,0x33,0x08,0x80,0x8c,0xb4,
+  0x37,0x0b,0x22,0x22,0x30,0x22,0x44,0x44,0x88,0x03,0x00,0x88,0x05,0x55,0xb4,0x6f,
+  0x84,0x39,0x01,0x44,0x33,0x80,0x1b,0x02,0x08,0x58,0x85,0xb4,0xa7,0x84,0x00,0x07,
+  0x43,0x30,0x88,0x03,0x50,0x00,0x88,0x85,0xbc,0x19,0x00,0x00,0x80,0x71,0x03,0x00,
+  0x03,0x55,0x00,0x80,0x8d,0xba,0xbb,0x05,0x00,0x00,0x04,0x00,0x20,0x40,0x84,0x1b,
+  0xb6,0x9f,0x00,0x02,0x82,0x47,0x03,0x40,0x05,0x22,0x04,0x82,0xa1,0x00,0x88,0x80,
+  0x39,0xa8,0x1b,0x01,0x00,0x22,0x8b,0x07,0x00,0x00,0x80,0x37,0x01,0x55,0x58,0x80,
+  0xc7,0xae,0x45,0x8f,0x07,0x00,0x00,0x80,0x8b,0x01,0x00,0x58,0xac,0x1b,0x80,0x14,
+  0x06,0x55,0x05,0x50,0x22,0x20,0x50,0x00,0x84,0x35,0x00,0x20,0xac,0x37,0x87,0x5b,
+  0x04,0x05,0x22,0x20,0x55,0x02,0x88,0x35,0xb8,0x1b,0x82,0xcd,0x00,0x00,0x80,0x1b,
+  0x00,0x05,0xac,0x51,0x84,0x53,0x90,0x6f,0x88,0x02,0xb0,0x1b,0x00,0x02,0x8b,0x21,
+  0x00,0x00,0x82,0xa5,0xb9,0x15,0x84,0x13,0x80,0x15,0xa9,0x0f,0x00,0x22,0xfc,0x00,
+  0xfc,0x00,0xf4,0x00,0x04,0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,
+  0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,
+  0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc0,0x1b,0x00,
+  0x02,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,0x00,0x00,0x55,0x90,0x1b,0x03,0x55,0x55,
+  0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,
+  0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,
+  0x08,0x00,0x22,0x96,0x05,0x66,0x09,0x8a,0xa9,0x05,0xb8,0xdf,0x0b,0x00,0x02,0x02,
+  0x22,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,0xb4,0x1b,0x06,0x04,0x40,0x00,0x00,
+  0x96,0x00,0x99,0x80,0x1b,0x01,0x16,0x95,0xb4,0x1b,0x0b,0x47,0x40,0x03,0x30,0x11,
+  0x03,0x99,0x66,0xaa,0x99,0x19,0x9a,0xb5,0x2f,0x0b,0x77,0x00,0x30,0x04,0x10,0x34,
+  0x96,0x61,0x11,0x99,0x19,0x99,0xac,0x1b,0x0d,0x60,0x02,0x70,0x66,0x04,0x04,0x03,
+  0x44,0x66,0x11,0x69,0x99,0x16,0x91,0xac,0x1b,0x0d,0x96,0x60,0x70,0x69,0x44,0x04,
+  0x34,0x40,0x11,0x10,0x99,0x66,0x21,0x69,0xac,0x51,0x0d,0x99,0x96,0x40,0x69,0x44,
+  0x30,0x04,0x04,0x11,0x00,0x11,0x11,0x22,0x11,0xa8,0x51,0x0a,0x22,0x66,0x66,0x00,
+  0x06,0x44,0x33,0x80,0x03,0x00,0x08,0xb5,0xdb,0x0d,0x60,0x22,0x69,0x99,0x02,0x20,
+  0x34,0x43,0x88,0x80,0x08,0x88,0x22,0x00,0xac,0x1d,0x84,0x1b,0x03,0x30,0x20,0x34,
+  0x44,0x84,0x1b,0x03,0x00,0x00,0x06,0x66,0xb4,0x1b,0x0b,0x43,0x00,0x03,0x44,0x88,
+  0x88,0x08,0x88,0x66,0x60,0x69,0x99,0xa5,0x6b,0x05,0x02,0x22,0x06,0x66,0x44,0x30,
+  0x8c,0x1b,0x00,0x99,0xb0,0x1b,0x81,0x4d,0x05,0x00,0x44,0x43,0x03,0x34,0x88,0x80,
+  0x51,0xb4,0x37,0x84,0x39,0x07,0x44,0x43,0x80,0x34,0x08,0x88,0x55,0x50,0xb4,0x6f,
+  0x84,0x00,0x06,0x43,0x30,0x80,0x34,0x00,0x88,0x88,0x82,0x50,0xbe,0xa1,0x01,0x33,
+  0x02,0x80,0x1b,0x80,0x38,0x01,0x20,0x08,0xc6,0x9b,0x07,0x00,0x33,0x50,0x00,0x88,
+  0x85,0x05,0x58,0xb6,0xbb,0x0b,0x00,0x02,0x40,0x00,0x04,0x00,0x50,0x02,0x88,0x85,
+  0x55,0x58,0xb6,0x9f,0x86,0x5e,0x09,0x20,0x44,0x50,0x02,0x58,0x85,0x88,0x85,0x00,
+  0x58,0xac,0xdf,0x87,0x07,0x00,0x20,0x80,0x37,0x01,0x85,0x55,0x80,0xc7,0x00,0x05,
+  0xa4,0x1b,0x01,0x00,0x22,0x8f,0x07,0x04,0x00,0x02,0x88,0x50,0x05,0x80,0xe3,0xa8,
+  0x1b,0x04,0x02,0x05,0x50,0x55,0x00,0x80,0x8e,0x80,0x6f,0x01,0x00,0x05,0x80,0x1b,
+  0xa8,0x89,0x8b,0x21,0x00,0x00,0x80,0xdc,0x01,0x85,0x00,0xb1,0x87,0x84,0x1b,0x80,
+  0x53,0x80,0x1b,0x00,0x00,0x80,0x94,0xb1,0x4d,0x83,0x93,0x84,0x6f,0x84,0xe5,0xb5,
+  0x15,0x84,0x6a,0x84,0x37,0x85,0x73,0xbf,0x0b,0x81,0x15,0x80,0x20,0xa4,0x11,0x00,
+  0x22,0xfc,0x00,0xfc,0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,
+  0xcc,0x1b,0x05,0x50,0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,
+  0x55,0x55,0x05,0x55,0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,
+  0xbc,0x51,0x80,0x1b,0x88,0x00,0x00,0x22,0xb8,0x55,0x80,0x1b,0x90,0x00,0x01,0x20,
+  0x55,0xcc,0x1b,0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,
+  0x37,0x09,0x22,0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,
+  0x05,0x00,0x09,0x96,0xa9,0x66,0x00,0xb8,0x1b,0x00,0x02,0x80,0xde,0x07,0x00,0x02,
+  0x69,0x96,0xa9,0x96,0x90,0x8a,0xb4,0xc3,0x05,0x40,0x22,0x00,0x04,0x00,0x00,0x80,
+  0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,0xac,0x1b,0x0d,0x44,0x02,0x30,0x44,0x03,0x30,
+  0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xac,0x1b,0x0b,0x70,0x00,0x04,0x47,0x34,
+  0x30,0x61,0x10,0x99,0x96,0x99,0x11,0xac,0x1b,0x0d,0x00,0x22,0x06,0x66,0x04,0x77,
+  0x44,0x04,0x11,0x03,0x99,0x66,0x91,0x69,0xac,0x53,0x0f,0x66,0x00,0x69,0x99,0x04,
+  0x70,0x40,0x44,0x10,0x34,0x66,0x11,0x69,0x99,0x22,0x21,0xa4,0xa3,0x0a,0x96,0x66,
+  0x66,0x99,0x30,0x40,0x04,0x44,0x00,0x04,0x11,0x80,0x00,0xa4,0x35,0x0b,0x60,0x22,
+  0x66,0x99,0x00,0x69,0x30,0x00,0x34,0x43,0x08,0x80,0x80,0xc8,0x84,0x62,0xa0,0x1b,
+  0x80,0x47,0x0c,0x06,0x33,0x02,0x03,0x44,0x88,0x88,0x04,0x00,0x60,0x00,0x20,0x66,
+  0xb0,0x1b,0x04,0x20,0x44,0x30,0x80,0x34,0x80,0x1b,0x04,0x08,0x96,0x66,0x06,0x99,
+  0xbc,0x1b,0x01,0x88,0x04,0x84,0x1b,0x01,0x99,0x96,0xa4,0x1b,0x00,0x02,0x80,0xc1,
+  0x05,0x02,0x22,0x44,0x43,0x88,0x03,0x88,0x1b,0x02,0x66,0x06,0x69,0xa8,0xdf,0x0c,
+  0x00,0x30,0x02,0x44,0x44,0x88,0x80,0x88,0x88,0x00,0x88,0x66,0x60,0xa4,0x6f,0x00,
+  0x00,0x81,0xb9,0x01,0x30,0x40,0x84,0x1b,0x02,0x08,0x88,0x00,0x80,0x00,0xa4,0xa7,
+  0x85,0xec,0x01,0x04,0x40,0x80,0x53,0x02,0x80,0x50,0x88,0x82,0x2d,0xa2,0x65,0x8e,
+  0x0b,0x09,0x44,0x05,0x03,0x30,0x88,0x88,0x50,0x88,0x58,0x85,0xa4,0x1b,0x00,0x50,
+  0x88,0x1b,0x07,0x40,0x55,0x20,0x00,0x80,0x00,0x55,0x08,0x80,0x71,0x01,0x05,0x20,
+  0x98,0x53,0x8c,0x1b,0x82,0xb1,0x84,0x41,0x01,0x00,0x58,0x80,0x55,0x84,0x0b,0x90,
+  0x6d,0x00,0x02,0x9e,0x77,0x80,0x0b,0x01,0x88,0x88,0x80,0x7e,0xac,0x1b,0x8e,0x23,
+  0x80,0x0b,0x03,0x58,0x58,0x88,0x20,0x9a,0x2f,0x8e,0xcd,0x8c,0x81,0x05,0x55,0x02,
+  0x85,0x58,0x05,0x88,0x9c,0x6f,0x84,0x1b,0x94,0x61,0x84,0x1b,0x01,0x00,0x58,0x9c,
+  0xdf,0x84,0x1b,0x96,0xad,0x02,0x50,0x22,0x85,0x87,0x63,0x98,0xc5,0x84,0x1b,0x96,
+  0x91,0x84,0xb3,0x81,0x17,0xa7,0x59,0x99,0x0b,0x02,0x02,0x22,0x05,0x80,0xe7,0xa0,
+  0x1b,0x00,0x02,0x9c,0xcf,0x83,0xd3,0xab,0x7d,0x83,0xe0,0xa4,0x0d,0x98,0x0b,0x00,
+  0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,
+  0x02,0x00,0x55,0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,
+  0x01,0x55,0x55,0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc0,
+  0x1b,0x88,0x35,0x80,0x1b,0x00,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,
+  0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,
+  0x02,0x66,0x60,0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,
+  0x08,0xaa,0x20,0x50,0xc5,0x12,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xb1,
+  0x11,0x04,0x22,0x00,0x44,0x00,0x00,0x80,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xac,
+  0x1b,0x0d,0x40,0x22,0x04,0x44,0x33,0x03,0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,
+  0xb1,0x2f,0x0a,0x02,0x44,0x77,0x43,0x00,0x11,0x03,0x99,0x66,0x91,0x19,0xac,0x1b,
+  0x0d,0x02,0x22,0x66,0x60,0x47,0x70,0x40,0x40,0x10,0x34,0x96,0x61,0x16,0x99,0xac,
+  0x53,0x0f,0x60,0x02,0x99,0x96,0x47,0x06,0x04,0x40,0x03,0x44,0x61,0x11,0x99,0x96,
+  0x22,0x16,0xa4,0x1b,0x0f,0x66,0x60,0x69,0x99,0x04,0x06,0x44,0x43,0x00,0x40,0x11,
+  0x10,0x11,0x11,0x22,0x21,0xa4,0x51,0x09,0x69,0x96,0x06,0x96,0x00,0x00,0x44,0x33,
+  0x88,0x03,0x80,0xc8,0x01,0x20,0x20,0xa1,0xa3,0x11,0x02,0x22,0x99,0x96,0x20,0x66,
+  0x30,0x22,0x34,0x43,0x88,0x80,0x40,0x08,0x00,0x00,0x06,0x66,0xac,0x1b,0x09,0x22,
+  0x06,0x43,0x02,0x03,0x44,0x88,0x88,0x40,0x88,0x84,0x5f,0x9d,0xf9,0x94,0x1b,0x00,
+  0x80,0x88,0x1b,0x00,0x99,0xa8,0x1b,0x84,0x8b,0x05,0x22,0x20,0x44,0x30,0x80,0x34,
+  0x84,0x1b,0x02,0x96,0x60,0x66,0xa8,0x1b,0x0c,0x00,0x02,0x00,0x20,0x44,0x43,0x88,
+  0x04,0x88,0x88,0x08,0x88,0x66,0xb0,0x6f,0x03,0x55,0x50,0x04,0x05,0x8c,0x1b,0x00,
+  0x00,0x80,0x00,0xa4,0xa7,0x0b,0x50,0x02,0x55,0x55,0x44,0x05,0x44,0x30,0x88,0x04,
+  0x08,0x88,0x82,0x65,0xaa,0x49,0x86,0x0b,0x08,0x40,0x55,0x33,0x04,0x88,0x80,0x08,
+  0x88,0x88,0xa8,0x1b,0x80,0x51,0x8a,0x3f,0x09,0x00,0x04,0x00,0x02,0x50,0x88,0x88,
+  0x85,0x00,0x58,0x80,0xff,0xa8,0x1b,0x80,0x4b,0x80,0x9b,0x03,0x50,0x00,0x88,0x85,
+  0x94,0x0b,0x88,0x6d,0x90,0x37,0x8c,0x0b,0x05,0x58,0x85,0x85,0x55,0x05,0x58,0xac,
+  0x1b,0x8e,0x3f,0x80,0x0b,0x00,0x85,0x80,0x55,0x9a,0x4b,0x00,0x55,0x80,0xa5,0x94,
+  0x9d,0x84,0x1b,0x00,0x58,0x80,0xc7,0xb0,0x1b,0x88,0x45,0x84,0x1b,0x01,0x05,0x88,
+  0x9c,0xdf,0x84,0x1b,0x96,0xad,0x84,0x97,0x01,0x00,0x58,0x9f,0x47,0x84,0x1b,0x96,
+  0xad,0x88,0x1b,0x00,0x05,0x9d,0x4d,0x84,0x1b,0x9c,0xef,0x82,0xf7,0xa5,0x31,0x80,
+  0x2b,0x9c,0x29,0x01,0x05,0x50,0xad,0xf5,0xa4,0x29,0x01,0x00,0x02,0x94,0x27,0x00,
+  0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,
+  0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,0x55,0x80,
+  0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,0x84,0x1a,0x02,0x55,0x00,0x55,
+  0xc0,0x1b,0x00,0x02,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,0x00,0x00,0x55,0x90,0x1b,
+  0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,
+  0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,0x05,0x00,0x06,0x8a,0x96,0x05,
+  0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,0x8a,0xa9,0x05,0xb8,0xdf,0x0b,
+  0x00,0x02,0x02,0x22,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,0xb4,0x1b,0x06,0x04,
+  0x40,0x00,0x00,0x96,0x00,0x99,0x80,0x1b,0x01,0x16,0x95,0xb5,0x13,0x0b,0x44,0x44,
+  0x30,0x30,0x11,0x03,0x99,0x66,0xaa,0x99,0x19,0x9a,0xb4,0x6b,0x0b,0x47,0x70,0x30,
+  0x04,0x10,0x34,0x96,0x61,0x11,0x99,0x19,0x99,0xac,0x1b,0x0d,0x66,0x00,0x77,0x06,
+  0x04,0x04,0x03,0x44,0x66,0x11,0x69,0x99,0x16,0x91,0xac,0x35,0x0d,0x99,0x66,0x70,
+  0x69,0x44,0x04,0x34,0x40,0x11,0x10,0x99,0x66,0x21,0x69,0xa8,0x35,0x0e,0x02,0x99,
+  0x96,0x40,0x66,0x44,0x30,0x04,0x04,0x11,0x00,0x11,0x11,0x22,0x11,0xa4,0x1b,0x0b,
+  0x99,0x60,0x69,0x66,0x00,0x00,0x43,0x30,0x80,0x34,0x00,0x08,0x81,0xa8,0x00,0x02,
+  0xac,0x1b,0x01,0x06,0x69,0x80,0xa9,0x08,0x33,0x88,0x03,0x00,0x88,0x00,0x04,0x66,
+  0x60,0xa5,0x33,0x11,0x99,0x60,0x20,0x69,0x30,0x22,0x34,0x44,0x88,0x80,0x08,0x88,
+  0x66,0x04,0x99,0x96,0x22,0x06,0xb4,0x1b,0x09,0x04,0x44,0x88,0x88,0x08,0x88,0x96,
+  0x04,0x99,0x99,0xa4,0x1b,0x06,0x66,0x02,0x22,0x06,0x43,0x02,0x03,0x88,0x1b,0x02,
+  0x66,0x04,0x69,0xa8,0x1b,0x00,0x00,0x82,0x60,0x02,0x44,0x30,0x80,0x80,0x1b,0x05,
+  0x88,0x88,0x60,0x00,0x66,0x66,0xa4,0x6f,0x03,0x55,0x00,0x40,0x55,0x8c,0x1b,0x02,
+  0x00,0x08,0x00,0x80,0x00,0xa4,0x35,0x05,0x55,0x55,0x40,0x55,0x43,0x04,0x84,0x1b,
+  0x02,0x55,0x50,0x20,0xaa,0x2d,0x86,0x0b,0x0b,0x05,0x55,0x30,0x44,0x88,0x03,0x88,
+  0x88,0x85,0x50,0x20,0x58,0xa8,0x1b,0x00,0x50,0x8a,0x27,0x08,0x40,0x00,0x20,0x08,
+  0x80,0x88,0x55,0x05,0x88,0x80,0x53,0x98,0x6f,0x8c,0x1b,0x00,0x22,0x82,0xb1,0x05,
+  0x00,0x02,0x88,0x55,0x55,0x58,0x8c,0x0b,0x8d,0xb9,0x9e,0x77,0x01,0x02,0x22,0x80,
+  0x1b,0x02,0x55,0x55,0x88,0x96,0xf5,0x8c,0x1b,0x8e,0xaf,0x03,0x02,0x22,0x58,0x55,
+  0x80,0x55,0x00,0x58,0x94,0x53,0x00,0x50,0x88,0x1b,0x8c,0x9d,0x88,0x1b,0x02,0x85,
+  0x00,0x05,0xac,0x1b,0x8c,0x61,0x84,0x1b,0x01,0x58,0x85,0x9c,0xdf,0x90,0x1b,0x90,
+  0x29,0x83,0x63,0x00,0x85,0x9f,0x81,0x84,0x1b,0x9f,0x1d,0x01,0x55,0x50,0x83,0x45,
+  0xa8,0x1b,0x9d,0x0b,0x82,0xf7,0x98,0x6d,0x8c,0xa7,0x94,0xcf,0x88,0x1b,0xaa,0xd5,
+  0xa5,0x07,0x80,0x18,0x90,0x1b,0x00,0x22,0xfc,0x00,0xfc,0x00,0xe8,0x00,0x00,0x02,
+  0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,0x55,0x55,0x00,0x05,
+  0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,0x55,0xc4,0x39,0x01,0x55,0x50,
+  0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xc8,0x1b,0x88,0x00,0x00,0x22,0xb8,0x55,0x01,
+  0x02,0x22,0x8c,0x19,0x03,0x55,0x55,0x20,0x55,0xcc,0x1b,0x80,0x70,0x00,0x00,0xcc,
+  0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,0x22,0x05,0x50,0x06,0x66,
+  0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,0x96,0xa9,0x66,0x00,0xb8,
+  0x1b,0x00,0x02,0x80,0xde,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,0x8a,0xac,0xc3,
+  0x07,0x02,0x22,0x40,0x00,0x00,0x44,0x00,0x30,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,
+  0x16,0xa4,0x1b,0x0f,0x60,0x00,0x40,0x66,0x04,0x77,0x03,0x44,0x66,0x11,0x99,0x99,
+  0x9a,0xaa,0x22,0x19,0xa1,0x2b,0x0e,0x22,0x96,0x66,0x06,0x99,0x04,0x77,0x34,0x40,
+  0x61,0x10,0x99,0x96,0x99,0x11,0xa4,0x1b,0x0f,0x66,0x02,0x96,0x99,0x06,0x69,0x04,
+  0x77,0x44,0x03,0x11,0x03,0x99,0x66,0x91,0x69,0xa4,0x53,0x11,0x99,0x60,0x69,0x99,
+  0x00,0x06,0x00,0x44,0x40,0x33,0x10,0x04,0x66,0x11,0x69,0x99,0x22,0x21,0xa4,0x1b,
+  0x0a,0x06,0x99,0x02,0x20,0x30,0x00,0x04,0x44,0x00,0x00,0x11,0x80,0x00,0x81,0xc3,
+  0xa0,0x1b,0x0a,0x20,0x69,0x22,0x22,0x44,0x00,0x80,0x04,0x00,0x88,0x00,0x80,0x00,
+  0x01,0x66,0x66,0x9d,0xa5,0x0e,0x66,0x02,0x20,0x66,0x00,0x22,0x44,0x43,0x88,0x80,
+  0x08,0x88,0x74,0x03,0x66,0x80,0x61,0x01,0x22,0x06,0x9c,0xa7,0x02,0x22,0x00,0x33,
+  0x80,0x51,0x01,0x88,0x88,0x84,0x1b,0x02,0x99,0x60,0x99,0xa0,0x1b,0x84,0xfb,0x02,
+  0x44,0x33,0x80,0x90,0x1b,0x00,0x96,0xac,0x37,0x04,0x02,0x02,0x20,0x44,0x43,0x8c,
+  0x1b,0x00,0x44,0x80,0x53,0x9c,0x6f,0x81,0x9b,0x02,0x50,0x02,0x05,0x80,0x6d,0x00,
+  0x03,0x84,0x1b,0x03,0x04,0x03,0x00,0x02,0x9c,0xa7,0x00,0x50,0x81,0xb7,0x03,0x20,
+  0x55,0x44,0x30,0x84,0x1b,0x02,0x00,0x88,0x20,0xa9,0x67,0x01,0x55,0x02,0x86,0x5b,
+  0x00,0x43,0x88,0x1b,0x01,0x55,0x08,0xad,0xd7,0x86,0x41,0x03,0x05,0x55,0x33,0x04,
+  0x84,0x1b,0x02,0x85,0x50,0x05,0x81,0xfb,0x9c,0x53,0x8c,0x1b,0x09,0x00,0x44,0x88,
+  0x80,0x88,0x88,0x88,0x50,0x05,0x58,0x86,0x33,0x8c,0x8b,0x96,0x5d,0x04,0x04,0x40,
+  0x80,0x02,0x08,0x80,0x54,0x00,0x55,0x80,0x03,0x01,0x00,0x58,0xb0,0x1b,0x00,0x05,
+  0x87,0x0b,0x02,0x88,0x55,0x58,0x80,0x58,0x96,0xf5,0x94,0x1b,0x00,0x20,0x80,0x0f,
+  0x06,0x02,0x22,0x85,0x50,0x55,0x88,0x58,0x81,0x53,0xaa,0x95,0x00,0x05,0x8e,0x23,
+  0x04,0x55,0x00,0x85,0x58,0x05,0x98,0xc7,0x84,0x1b,0x9f,0x1d,0x01,0x55,0x02,0x84,
+  0x6d,0xa4,0x1b,0x84,0x4f,0x91,0x07,0x01,0x02,0x85,0x98,0x43,0x8c,0x1b,0x9d,0xad,
+  0x00,0x00,0x8a,0xdb,0xa0,0x0f,0xa1,0x25,0x00,0x02,0x82,0xdb,0xa4,0x0f,0xb3,0x9f,
+  0x00,0x00,0xad,0x51,0xaf,0xbb,0x94,0x51,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,
+  0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,0x00,0x55,0x22,
+  0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,0x02,0x55,
+  0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,0x55,0x20,0x55,
+  0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,
+  0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,0x00,0x08,0xa9,
+  0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,0xc5,0x12,0x03,
+  0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xb0,0xf7,0x04,0x00,0x04,0x44,0x03,0x00,
+  0x80,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xa8,0x19,0x0e,0x02,0x06,0x66,0x47,0x74,
+  0x34,0x40,0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,0xa1,0x45,0x0e,0x22,0x66,0x60,
+  0x69,0x99,0x47,0x70,0x44,0x00,0x11,0x03,0x99,0x66,0x91,0x19,0xa4,0x1b,0x04,0x60,
+  0x22,0x69,0x96,0x66,0x80,0x1b,0x07,0x40,0x30,0x10,0x34,0x96,0x61,0x16,0x99,0xa4,
+  0x53,0x11,0x96,0x02,0x99,0x99,0x00,0x66,0x04,0x40,0x03,0x30,0x00,0x44,0x61,0x11,
+  0x99,0x96,0x22,0x16,0xa4,0x1b,0x01,0x69,0x99,0x80,0x8c,0x0a,0x00,0x44,0x43,0x00,
+  0x00,0x11,0x10,0x11,0x11,0x00,0x01,0x9d,0xa5,0x02,0x96,0x02,0x06,0x80,0x61,0x05,
+  0x40,0x02,0x00,0x44,0x08,0x88,0x80,0x22,0x04,0x00,0x66,0x60,0x22,0x06,0x9c,0x6f,
+  0x11,0x06,0x66,0x02,0x22,0x44,0x30,0x88,0x04,0x88,0x88,0x40,0x30,0x66,0x07,0x99,
+  0x96,0x20,0x66,0x9c,0xa7,0x07,0x20,0x00,0x30,0x02,0x44,0x43,0x88,0x80,0x84,0x1b,
+  0x04,0x96,0x07,0x99,0x99,0x20,0xa8,0xe1,0x04,0x43,0x30,0x04,0x44,0x88,0x80,0x00,
+  0x88,0x37,0x00,0x99,0x9c,0x37,0x82,0x02,0x01,0x00,0x44,0x9c,0x1b,0x02,0x04,0x66,
+  0x66,0x9c,0x6f,0x07,0x55,0x00,0x20,0x55,0x44,0x30,0x80,0x34,0x8c,0x1b,0x00,0x00,
+  0x85,0x58,0x90,0xa7,0x01,0x02,0x22,0x85,0xd1,0x01,0x43,0x02,0x84,0x1b,0x84,0xa7,
+  0xa9,0x99,0x80,0x1b,0x03,0x55,0x55,0x33,0x00,0x84,0x1b,0x01,0x50,0x88,0xad,0xd7,
+  0x8e,0x41,0x09,0x30,0x40,0x80,0x33,0x88,0x88,0x55,0x08,0x55,0x58,0x84,0xe1,0x94,
+  0x53,0x8c,0x1b,0x0a,0x04,0x40,0x88,0x00,0x88,0x88,0x85,0x08,0x55,0x88,0x55,0x82,
+  0x15,0x96,0xa1,0x8e,0x5d,0x03,0x44,0x05,0x00,0x20,0x80,0x1b,0x06,0x50,0x58,0x88,
+  0x85,0x55,0x05,0x88,0xac,0x1b,0x00,0x40,0x82,0xe9,0x03,0x00,0x00,0x85,0x50,0x80,
+  0xaa,0x02,0x55,0x00,0x58,0x98,0x53,0x88,0x1b,0x83,0x05,0x88,0xcd,0x00,0x58,0x80,
+  0x3c,0x01,0x00,0x05,0xa4,0x1b,0x02,0x00,0x55,0x20,0x88,0x45,0x04,0x50,0x02,0x55,
+  0x85,0x58,0xa0,0xc7,0x84,0x1b,0x94,0x5f,0x01,0x50,0x22,0x84,0x6d,0xa4,0x1b,0x8c,
+  0x4f,0x8d,0x3d,0x80,0x43,0x00,0x58,0x8c,0x43,0x8c,0x1b,0x00,0x22,0x9b,0x37,0x81,
+  0x23,0x82,0xdb,0x9f,0x63,0x00,0x00,0x81,0xa2,0xa1,0x09,0xa0,0xf9,0xbb,0x9f,0x00,
+  0x02,0xad,0x51,0xaf,0xbb,0x94,0x51,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,
+  0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,
+  0x1d,0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,
+  0x22,0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,
+  0xb8,0x00,0x01,0x55,0x02,0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,
+  0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,
+  0x66,0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,
+  0x09,0x8a,0xa9,0x05,0xb8,0xdf,0x0b,0x00,0x02,0x02,0x22,0x96,0x00,0x96,0x69,0x8a,
+  0xa9,0x00,0x90,0xb4,0x19,0x06,0x44,0x40,0x30,0x00,0x96,0x00,0x99,0x80,0x1b,0x01,
+  0x16,0x95,0xac,0x4d,0x0d,0x66,0x60,0x77,0x40,0x44,0x04,0x11,0x03,0x99,0x66,0xaa,
+  0x99,0x19,0x9a,0xa4,0x1b,0x0f,0x66,0x00,0x99,0x96,0x77,0x06,0x40,0x04,0x10,0x34,
+  0x96,0x61,0x11,0x99,0x19,0x99,0xa5,0x47,0x02,0x99,0x66,0x69,0x80,0x1b,0x09,0x03,
+  0x04,0x03,0x44,0x66,0x11,0x69,0x99,0x16,0x91,0x9c,0x1b,0x11,0x60,0x22,0x99,0x99,
+  0x06,0x69,0x44,0x00,0x33,0x00,0x04,0x40,0x11,0x10,0x99,0x66,0x21,0x69,0xac,0x1b,
+  0x01,0x20,0x06,0x80,0x8d,0x05,0x30,0x00,0x04,0x11,0x00,0x11,0x80,0x02,0x9d,0xa5,
+  0x04,0x60,0x22,0x69,0x99,0x22,0x81,0xd2,0x04,0x04,0x44,0x88,0x80,0x00,0x80,0x00,
+  0x03,0x66,0x00,0x20,0x66,0x9c,0x6f,0x10,0x66,0x66,0x22,0x20,0x43,0x00,0x80,0x44,
+  0x88,0x88,0x03,0x08,0x60,0x74,0x99,0x66,0x06,0xa0,0x55,0x80,0x2c,0x04,0x22,0x44,
+  0x33,0x88,0x04,0x90,0x1b,0x01,0x99,0x06,0xa0,0xa9,0x04,0x22,0x22,0x33,0x02,0x44,
+  0x80,0x51,0x90,0x1b,0x00,0x96,0x9c,0x37,0x00,0x02,0x80,0x6c,0x00,0x43,0x9c,0x1b,
+  0x02,0x44,0x66,0x66,0x9c,0x6f,0x06,0x50,0x02,0x05,0x55,0x43,0x02,0x03,0x80,0x6d,
+  0x84,0x1b,0x01,0x02,0x04,0x80,0x60,0x98,0xa7,0x81,0xb1,0x02,0x55,0x30,0x20,0x8c,
+  0x1b,0x80,0x17,0xa1,0xbb,0x00,0x02,0x8a,0x25,0x07,0x30,0x05,0x03,0x43,0x88,0x88,
+  0x08,0x88,0xad,0xf3,0x8e,0x41,0x0b,0x04,0x05,0x03,0x33,0x88,0x88,0x50,0x88,0x55,
+  0x85,0x00,0x05,0x9c,0x53,0x8c,0x1b,0x03,0x44,0x05,0x80,0x00,0x84,0x1b,0x01,0x58,
+  0x88,0x82,0x66,0x00,0x55,0x96,0xdb,0x8e,0x41,0x08,0x40,0x55,0x02,0x04,0x88,0x80,
+  0x55,0x08,0x88,0x80,0x55,0x01,0x58,0x88,0xac,0x1b,0x82,0x93,0x03,0x04,0x00,0x02,
+  0x55,0x80,0x3b,0x03,0x85,0x58,0x05,0x88,0x94,0x53,0x98,0x1b,0x80,0x83,0x07,0x50,
+  0x02,0x88,0x85,0x88,0x55,0x00,0x58,0xa4,0x1b,0x00,0x05,0x82,0x95,0x8d,0xff,0x02,
+  0x58,0x55,0x88,0x80,0x8d,0x94,0xab,0x84,0x1b,0x97,0x1d,0x84,0xcf,0x00,0x58,0xa0,
+  0xe3,0x00,0x55,0x81,0x15,0x94,0x0b,0x80,0x1b,0x02,0x50,0x05,0x85,0x8c,0x43,0x8c,
+  0x1b,0x00,0x20,0xa3,0x1b,0x86,0xf2,0x9f,0x9d,0x80,0x08,0xa2,0xab,0x01,0x50,0x02,
+  0x80,0x6d,0xd3,0xb9,0x81,0x12,0xa9,0x51,0xaf,0xbb,0x94,0x51,0x00,0x22,0xfc,0x00,
+  0xfc,0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,
+  0x50,0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,
+  0x55,0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xc8,0x1b,0x88,
+  0x00,0x00,0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,0x55,0x55,0x20,0x55,0xcc,
+  0x1b,0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,
+  0x22,0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,
+  0x09,0x96,0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,0x8a,
+  0xc4,0xc3,0x01,0x00,0x00,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,0xbc,0x8b,0x09,
+  0x03,0x30,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xb4,0x1b,0x09,0x30,0x22,0x33,
+  0x03,0x61,0x10,0x99,0x96,0x99,0x11,0xbc,0x1b,0x09,0x33,0x02,0x40,0x43,0x11,0x03,
+  0x99,0x66,0x91,0x69,0xbc,0x53,0x0b,0x34,0x30,0x04,0x44,0x10,0x33,0x66,0x11,0x69,
+  0x99,0x22,0x21,0xb4,0x6d,0x06,0x00,0x03,0x03,0x40,0x00,0x00,0x11,0x80,0x00,0xbc,
+  0x89,0x05,0x44,0x40,0x44,0x04,0x00,0x33,0x81,0xdb,0xbc,0xbf,0x07,0x22,0x77,0x74,
+  0x00,0x04,0x66,0x00,0x20,0xc0,0x1b,0x09,0x40,0x22,0x44,0x77,0x66,0x60,0x99,0x66,
+  0x20,0x66,0xc4,0x37,0x01,0x00,0x44,0x80,0xbf,0x02,0x99,0x20,0x69,0xc6,0x2b,0x03,
+  0x60,0x00,0x99,0x66,0xcc,0x1b,0x01,0x30,0x22,0x80,0x6d,0x04,0x60,0x66,0x66,0x20,
+  0x06,0xc4,0x1b,0x03,0x44,0x44,0x00,0x04,0x80,0xa5,0xc0,0x8b,0x80,0xc3,0x02,0x43,
+  0x00,0x44,0xc6,0x0f,0x84,0x1b,0x02,0x43,0x30,0x50,0x80,0x1b,0x82,0x81,0xc0,0xa7,
+  0x03,0x30,0x05,0x03,0x33,0xcc,0x1b,0x82,0xce,0x82,0x2d,0xc4,0x1b,0x8a,0x63,0x00,
+  0x88,0x80,0x03,0x82,0xf4,0xb4,0x1b,0x00,0x50,0x80,0x1b,0x03,0x88,0x88,0x55,0x58,
+  0xc4,0x1b,0x02,0x55,0x02,0x85,0x80,0x1b,0x86,0xf0,0xbe,0x47,0x01,0x55,0x02,0x80,
+  0x33,0x8a,0xf2,0xc8,0x1b,0x84,0x35,0x80,0x8b,0xc4,0x53,0x04,0x88,0x85,0x55,0x58,
+  0x50,0xc8,0x1b,0x01,0x50,0x22,0x80,0x1b,0x00,0x88,0x87,0x99,0xc7,0x0b,0x80,0xc0,
+  0x01,0x88,0x02,0xc8,0x1b,0x86,0xd3,0x86,0x0d,0xa5,0x6b,0x00,0x22,0xfc,0x00,0xfc,
+  0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,
+  0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,
+  0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,
+  0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,
+  0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,
+  0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,
+  0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xc0,0x1b,0x80,0x37,0x05,
+  0x99,0x96,0x58,0xaa,0x21,0x69,0xbc,0x1b,0x09,0x33,0x00,0x61,0x10,0x99,0x96,0xaa,
+  0xa9,0x21,0x99,0xb9,0x4b,0x08,0x22,0x30,0x33,0x11,0x03,0x99,0x66,0x91,0x19,0xbc,
+  0x1b,0x09,0x30,0x22,0x04,0x33,0x10,0x34,0x96,0x61,0x16,0x99,0xbc,0x53,0x0b,0x43,
+  0x02,0x44,0x43,0x03,0x30,0x61,0x11,0x99,0x96,0x22,0x16,0xb8,0x89,0x0a,0x30,0x34,
+  0x00,0x00,0x00,0x11,0x10,0x11,0x11,0x22,0x21,0xb4,0x1b,0x04,0x44,0x00,0x40,0x44,
+  0x03,0x80,0x1e,0xbd,0xbd,0x09,0x02,0x22,0x77,0x40,0x00,0x47,0x60,0x00,0x00,0x06,
+  0xc1,0xf1,0x07,0x22,0x47,0x74,0x66,0x04,0x96,0x66,0x06,0xc0,0xdb,0x03,0x02,0x22,
+  0x04,0x40,0x80,0xf9,0x01,0x99,0x06,0xb8,0xbf,0x88,0x8b,0x02,0x00,0x96,0x66,0xcc,
+  0x1b,0x06,0x02,0x22,0x00,0x43,0x66,0x00,0x66,0x80,0x02,0xc4,0x1b,0x06,0x44,0x43,
+  0x00,0x44,0x00,0x00,0x20,0xca,0x81,0x04,0x44,0x30,0x04,0x44,0x55,0x81,0xd9,0xc4,
+  0x1b,0x01,0x33,0x00,0x80,0x1b,0x86,0x81,0xc0,0xdf,0x03,0x00,0x50,0x33,0x33,0x86,
+  0x31,0xbc,0x1b,0x00,0x50,0x82,0x7f,0x01,0x00,0x00,0xcc,0x1b,0x03,0x55,0x50,0x58,
+  0x85,0x86,0x7e,0xbc,0x6f,0x07,0x02,0x22,0x55,0x55,0x88,0x85,0x55,0x88,0xc4,0x1b,
+  0x00,0x50,0x84,0x1b,0x04,0x88,0x55,0x58,0x55,0x50,0xbe,0x63,0x80,0x1b,0x80,0x51,
+  0x00,0x05,0xca,0xef,0x01,0x50,0x22,0x84,0x6d,0x87,0x45,0xc4,0x53,0x00,0x88,0x80,
+  0x54,0x82,0xec,0xc0,0x1b,0x00,0x02,0x80,0x1b,0x02,0x58,0x88,0x02,0xc8,0x1b,0x06,
+  0x22,0x22,0x85,0x50,0x58,0x88,0x22,0x83,0x28,0xc4,0x1b,0x83,0xe6,0x82,0x0d,0x01,
+  0x00,0x02,0x9d,0x6b,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,0x00,0x02,
+  0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,0x02,
+  0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,0x84,
+  0x1a,0x02,0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,0x00,0x01,
+  0x55,0x02,0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,0x1b,0x07,
+  0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,0x05,0x00,
+  0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,0x8a,0xa9,
+  0x05,0xc8,0xdf,0x07,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,0xc8,0x37,0x01,0x00,
+  0x99,0x80,0x1b,0x01,0x16,0x95,0xbc,0x1b,0x09,0x30,0x02,0x11,0x03,0x99,0x66,0xaa,
+  0x99,0x19,0x9a,0xbc,0x1b,0x09,0x03,0x30,0x10,0x33,0x96,0x61,0x11,0x99,0x19,0x99,
+  0xbc,0x6d,0x09,0x43,0x33,0x03,0x40,0x66,0x11,0x69,0x99,0x16,0x91,0xb8,0x51,0x0a,
+  0x22,0x44,0x34,0x33,0x04,0x11,0x10,0x99,0x66,0x21,0x69,0xb8,0x51,0x0a,0x02,0x40,
+  0x00,0x00,0x03,0x11,0x00,0x11,0x11,0x22,0x11,0xb4,0x1b,0x07,0x40,0x02,0x04,0x44,
+  0x33,0x44,0x00,0x00,0xc5,0xbd,0x07,0x74,0x00,0x04,0x77,0x00,0x00,0x00,0x66,0xbd,
+  0x2f,0x09,0x22,0x22,0x77,0x40,0x60,0x44,0x66,0x66,0x66,0x99,0xc4,0x1b,0x01,0x44,
+  0x00,0x80,0xf9,0x01,0x99,0x69,0xc8,0x1b,0x03,0x00,0x02,0x66,0x60,0xd4,0x1b,0x06,
+  0x04,0x30,0x60,0x00,0x66,0x66,0x06,0xc8,0x6f,0x02,0x44,0x30,0x04,0x80,0xa5,0x80,
+  0xa7,0xc0,0x00,0x03,0x43,0x02,0x44,0x44,0x82,0x46,0xc1,0xf3,0x85,0x69,0x01,0x44,
+  0x43,0x81,0xf3,0x01,0x55,0x22,0xc2,0x81,0x05,0x05,0x00,0x33,0x30,0x55,0x03,0xc4,
+  0x1b,0x00,0x00,0x82,0x7f,0x01,0x00,0x05,0x88,0x53,0xb8,0x1b,0x02,0x55,0x02,0x88,
+  0x82,0x63,0x80,0x52,0xc6,0x63,0x04,0x50,0x88,0x55,0x58,0x88,0xc4,0x1b,0x00,0x02,
+  0x80,0x51,0x05,0x88,0x85,0x55,0x88,0x55,0x05,0xbe,0xd3,0x02,0x02,0x22,0x58,0x8e,
+  0xd0,0x87,0x45,0xb8,0x1b,0x84,0x6d,0x80,0x8b,0xc8,0x53,0x00,0x85,0x80,0x6d,0x80,
+  0xa4,0x84,0xdf,0xb8,0x8b,0x04,0x85,0x50,0x88,0x88,0x20,0xd0,0x1b,0x80,0xc3,0x84,
+  0x1b,0x83,0x2d,0xbc,0x1b,0x87,0xb3,0x90,0x02,0x90,0x00,0x00,0x22,0xfc,0x00,0xfc,
+  0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,
+  0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,0x55,
+  0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xc8,0x1b,0x88,0x00,
+  0x00,0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,0x55,0x55,0x20,0x55,0xcc,0x1b,
+  0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,
+  0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,
+  0x96,0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,0x8a,0xc4,
+  0xc3,0x01,0x00,0x00,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,0xbc,0x8b,0x09,0x03,
+  0x30,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xb4,0x1b,0x09,0x30,0x22,0x33,0x03,
+  0x61,0x10,0x99,0x96,0x99,0x11,0xbc,0x1b,0x09,0x33,0x02,0x40,0x44,0x11,0x03,0x99,
+  0x66,0x91,0x69,0xbc,0x53,0x0b,0x44,0x30,0x04,0x44,0x10,0x33,0x66,0x11,0x69,0x99,
+  0x22,0x21,0xb4,0x6d,0x06,0x00,0x43,0x04,0x40,0x00,0x00,0x11,0x80,0x00,0xbc,0x89,
+  0x06,0x44,0x03,0x44,0x04,0x03,0x34,0x20,0xc0,0xbf,0x09,0x02,0x22,0x77,0x40,0x30,
+  0x04,0x80,0x33,0x09,0x60,0xc0,0xdb,0x06,0x22,0x47,0x74,0x06,0x60,0x80,0x30,0xc4,
+  0x1b,0x08,0x30,0x22,0x04,0x40,0x69,0x96,0x00,0x06,0x06,0xc0,0x1b,0x07,0x43,0x02,
+  0x60,0x03,0x99,0x96,0x66,0x69,0xc4,0x6f,0x05,0x43,0x02,0x04,0x44,0x96,0x60,0x80,
+  0xbf,0xc2,0x2b,0x07,0x43,0x02,0x44,0x44,0x60,0x03,0x69,0x96,0xd4,0x1b,0x01,0x00,
+  0x33,0x80,0x6d,0xb8,0x1b,0x09,0x02,0x22,0x30,0x00,0x33,0x33,0x80,0x33,0x00,0x08,
+  0xbc,0x1b,0x02,0x00,0x22,0x00,0x82,0x0f,0x03,0x80,0x00,0x08,0x88,0xbc,0x1b,0x01,
+  0x50,0x02,0x82,0x98,0x01,0x50,0x00,0x80,0x00,0xbd,0xf3,0x03,0x85,0x02,0x50,0x88,
+  0x86,0xed,0x00,0x55,0xc0,0x1b,0x02,0x88,0x50,0x88,0x80,0x00,0x80,0x1b,0x00,0x50,
+  0xbe,0x0f,0x06,0x55,0x80,0x88,0x88,0x58,0x88,0x00,0x80,0x1c,0xb4,0x6f,0x08,0x02,
+  0x22,0x05,0x85,0x88,0x50,0x05,0x58,0x50,0xc8,0x1b,0x04,0x58,0x85,0x50,0x05,0x00,
+  0x84,0xaa,0xbb,0x27,0x03,0x02,0x22,0x88,0x85,0x80,0x18,0x00,0x20,0x86,0xf0,0xb6,
+  0xd3,0x84,0x37,0x03,0x20,0x05,0x00,0x22,0x8b,0x0c,0xb8,0x1b,0x87,0x73,0x80,0xff,
+  0x80,0x3c,0x80,0x71,0xba,0xb5,0x8a,0x31,0x88,0x00,0x94,0x13,0x00,0x22,0xfc,0x00,
+  0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,
+  0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,0x01,0x55,0x55,
+  0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,
+  0x02,0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,
+  0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,0x02,0x66,0x60,
+  0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,0x08,0xaa,0x20,
+  0x50,0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xc0,0x1b,0x80,0x37,
+  0x05,0x99,0x96,0x58,0xaa,0x21,0x69,0xbc,0x1b,0x09,0x33,0x00,0x61,0x10,0x99,0x96,
+  0xaa,0xa9,0x21,0x99,0xb9,0x4b,0x08,0x22,0x30,0x33,0x11,0x03,0x99,0x66,0x91,0x19,
+  0xbc,0x1b,0x09,0x30,0x22,0x04,0x43,0x10,0x34,0x96,0x61,0x16,0x99,0xbc,0x53,0x0b,
+  0x43,0x02,0x44,0x44,0x03,0x30,0x61,0x11,0x99,0x96,0x22,0x16,0xb4,0x1b,0x0b,0x04,
+  0x30,0x44,0x00,0x00,0x00,0x11,0x10,0x11,0x11,0x22,0x21,0xb4,0x1b,0x04,0x40,0x30,
+  0x40,0x44,0x33,0x80,0x1e,0xc5,0xd7,0x07,0x74,0x00,0x00,0x47,0x03,0x33,0x96,0x08,
+  0xbd,0xd9,0x07,0x02,0x22,0x77,0x40,0x66,0x04,0x03,0x00,0xcc,0x1b,0x07,0x44,0x03,
+  0x99,0x60,0x00,0x66,0x66,0x00,0xbc,0x1b,0x09,0x30,0x22,0x00,0x34,0x99,0x66,0x66,
+  0x99,0x00,0x06,0xbc,0x6d,0x08,0x30,0x22,0x44,0x44,0x66,0x00,0x99,0x99,0x22,0xd0,
+  0x1b,0x84,0x39,0xd4,0x1b,0x01,0x03,0x34,0x80,0x6d,0xc0,0xc3,0x07,0x00,0x00,0x33,
+  0x33,0x03,0x33,0x00,0x88,0xbc,0x1b,0x03,0x02,0x22,0x05,0x50,0x81,0x14,0x01,0x00,
+  0x88,0xc0,0x1b,0x01,0x00,0x22,0x82,0x5e,0x00,0x00,0x82,0x2d,0x00,0x00,0xbd,0xf3,
+  0x03,0x50,0x22,0x08,0x88,0x86,0xed,0x01,0x50,0x00,0xbe,0x2b,0x02,0x85,0x02,0x88,
+  0x80,0x00,0x03,0x00,0x58,0x55,0x00,0xbe,0xd3,0x03,0x58,0x02,0x88,0x85,0x80,0x1b,
+  0x82,0x9c,0xbc,0x6f,0x06,0x58,0x50,0x85,0x00,0x55,0x88,0x00,0x83,0x29,0xbc,0x1b,
+  0x00,0x88,0x83,0x40,0x00,0x00,0x80,0xaa,0x02,0x05,0x55,0x20,0xc0,0x1b,0x03,0x05,
+  0x58,0x02,0x00,0x87,0x61,0xbe,0xd3,0x84,0x37,0x00,0x02,0x8b,0x7d,0x80,0x1b,0xb1,
+  0x87,0x04,0x55,0x50,0x20,0x05,0x02,0x81,0x1b,0x84,0x1d,0xb4,0x1b,0x01,0x00,0x02,
+  0x84,0x11,0x85,0x19,0x82,0x13,0x90,0x1b,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,
+  0x04,0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,
+  0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,
+  0x50,0x22,0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,
+  0x55,0xb8,0x00,0x01,0x55,0x02,0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,
+  0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,
+  0x22,0x66,0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,
+  0x66,0x09,0x8a,0xa9,0x05,0xc8,0xdf,0x07,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,
+  0xc8,0x37,0x01,0x00,0x99,0x80,0x1b,0x01,0x16,0x95,0xbc,0x1b,0x09,0x30,0x02,0x11,
+  0x03,0x99,0x66,0xaa,0x99,0x19,0x9a,0xbc,0x1b,0x09,0x03,0x30,0x10,0x33,0x96,0x61,
+  0x11,0x99,0x19,0x99,0xbc,0x6d,0x09,0x44,0x33,0x03,0x40,0x66,0x11,0x69,0x99,0x16,
+  0x91,0xb8,0x51,0x0a,0x22,0x44,0x44,0x33,0x04,0x11,0x10,0x99,0x66,0x21,0x69,0xb4,
+  0x1b,0x0b,0x43,0x02,0x40,0x00,0x00,0x04,0x11,0x00,0x11,0x11,0x22,0x11,0xb8,0x6d,
+  0x06,0x02,0x04,0x44,0x34,0x44,0x00,0x03,0xbd,0x13,0x0b,0x22,0x22,0x40,0x02,0x04,
+  0x77,0x33,0x30,0x60,0x80,0x22,0x09,0xbc,0x1b,0x05,0x74,0x00,0x60,0x47,0x30,0x06,
+  0xcc,0x1b,0x09,0x40,0x30,0x96,0x04,0x06,0x69,0x60,0x00,0x22,0x06,0xbc,0xc1,0x07,
+  0x03,0x43,0x96,0x60,0x69,0x99,0x00,0x66,0xbc,0x6f,0x80,0xdd,0x05,0x43,0x60,0x04,
+  0x99,0x96,0x20,0xb8,0xbf,0x8c,0x1b,0x03,0x03,0x44,0x96,0x60,0xd4,0x1b,0x04,0x33,
+  0x44,0x60,0x00,0x20,0xb8,0x6d,0x81,0x83,0x06,0x02,0x33,0x30,0x33,0x33,0x08,0x80,
+  0xc6,0xb9,0x82,0x26,0x80,0x00,0x03,0x88,0x80,0x20,0x08,0xbc,0x51,0x02,0x55,0x50,
+  0x50,0x82,0x2a,0x01,0x00,0x00,0xbd,0xf3,0x03,0x02,0x22,0x88,0x85,0x86,0xed,0x80,
+  0x1b,0xba,0x9b,0x02,0x50,0x22,0x88,0x80,0x00,0x02,0x05,0x88,0x50,0x82,0x80,0xb4,
+  0x1b,0x09,0x80,0x22,0x88,0x55,0x88,0x88,0x00,0x58,0x55,0x00,0xbf,0x0b,0x05,0x85,
+  0x02,0x50,0x05,0x58,0x88,0x80,0x50,0x00,0x50,0xc4,0x1b,0x02,0x05,0x58,0x00,0x84,
+  0x50,0x80,0x71,0xbc,0x1b,0x02,0x55,0x88,0x20,0x80,0xc3,0xc7,0x0b,0x84,0x37,0x00,
+  0x22,0x80,0x1c,0x88,0x1b,0xb0,0x39,0x87,0x09,0x81,0x1b,0x88,0x39,0x00,0x22,0xb0,
+  0x71,0x80,0x2a,0x84,0x02,0x00,0x02,0x84,0x1d,0x94,0x37,0x00,0x22,0xfc,0x00,0xfc,
+  0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,
+  0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,0x55,
+  0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xc8,0x1b,0x88,0x00,
+  0x00,0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,0x55,0x55,0x20,0x55,0xcc,0x1b,
+  0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,
+  0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,
+  0x96,0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,0x8a,0xc4,
+  0xc3,0x01,0x00,0x00,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,0xbc,0x8b,0x09,0x03,
+  0x30,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xb4,0x1b,0x09,0x30,0x02,0x33,0x03,
+  0x61,0x10,0x99,0x96,0x99,0x11,0xc0,0x1b,0x08,0x00,0x40,0x43,0x11,0x03,0x99,0x66,
+  0x91,0x69,0xb4,0x53,0x0d,0x02,0x22,0x33,0x00,0x04,0x44,0x10,0x33,0x66,0x11,0x69,
+  0x99,0x22,0x21,0xbc,0x1b,0x04,0x03,0x44,0x00,0x00,0x11,0x80,0x00,0xbc,0x89,0x04,
+  0x43,0x30,0x40,0x44,0x00,0x80,0x1d,0xbc,0xc1,0x03,0x02,0x22,0x40,0x40,0x80,0x1b,
+  0x04,0x47,0x60,0x00,0x20,0x66,0xc0,0xc1,0x08,0x34,0x74,0x04,0x66,0x04,0x96,0x66,
+  0x06,0x99,0xb8,0xa5,0x08,0x22,0x34,0x44,0x74,0x00,0x96,0x04,0x99,0x99,0xac,0x1b,
+  0x80,0x60,0x01,0x20,0x40,0x80,0x1b,0x01,0x44,0x03,0xc0,0x1b,0x0c,0x02,0x20,0x00,
+  0x43,0x02,0x44,0x44,0x00,0x33,0x60,0x00,0x66,0x66,0xac,0x6f,0x00,0x00,0x80,0x00,
+  0x00,0x44,0x80,0x1b,0x03,0x80,0x34,0x08,0x88,0xac,0xa7,0x82,0x93,0x04,0x50,0x00,
+  0x55,0x43,0x00,0x84,0x1b,0x00,0x00,0x84,0x1b,0xa8,0x6d,0x00,0x50,0x82,0x09,0x80,
+  0xdc,0x00,0x43,0x80,0x1b,0x00,0x08,0xae,0x9d,0x0e,0x50,0x02,0x50,0x85,0x00,0x58,
+  0x07,0x70,0x43,0x30,0x00,0x04,0x50,0x00,0x00,0xaa,0x0f,0x80,0x34,0x08,0x88,0x05,
+  0x88,0x77,0x70,0x00,0x04,0x02,0x20,0x82,0x30,0xa8,0x1b,0x02,0x85,0x50,0x50,0x80,
+  0x1b,0x03,0x47,0x70,0x22,0x20,0x82,0x4d,0x00,0x50,0x80,0x53,0xa0,0x71,0x00,0x88,
+  0x88,0x1b,0x01,0x04,0x70,0x92,0x85,0x80,0x97,0xa4,0x1b,0x04,0x00,0x58,0x08,0x88,
+  0x20,0x80,0x2d,0x01,0x00,0x22,0x8a,0xf2,0xa3,0x0f,0x05,0x00,0x02,0x00,0x00,0x88,
+  0x80,0x8c,0x1b,0x8a,0xba,0x00,0x05,0xaf,0x2b,0x8c,0xf1,0x80,0x1b,0x01,0x50,0x05,
+  0x80,0x8e,0xc7,0x47,0x84,0x1b,0x01,0x00,0x05,0xac,0xfd,0x9c,0x1b,0x80,0x18,0x00,
+  0x00,0x84,0x5d,0xc4,0x1b,0x85,0x59,0xd7,0xd3,0xa4,0x35,0x00,0x22,0xfc,0x00,0xfc,
+  0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,
+  0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,
+  0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,
+  0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,
+  0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,
+  0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,
+  0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xc0,0x1b,0x80,0x37,0x05,
+  0x99,0x96,0x58,0xaa,0x21,0x69,0xbc,0x1b,0x09,0x33,0x00,0x61,0x10,0x99,0x96,0xaa,
+  0xa9,0x21,0x99,0xbc,0x51,0x07,0x30,0x33,0x11,0x03,0x99,0x66,0x91,0x19,0xc0,0x1b,
+  0x08,0x02,0x04,0x33,0x10,0x34,0x96,0x61,0x16,0x99,0xbc,0x53,0x0b,0x30,0x00,0x44,
+  0x43,0x03,0x30,0x61,0x11,0x99,0x96,0x22,0x16,0xbc,0x1b,0x09,0x34,0x43,0x00,0x00,
+  0x11,0x10,0x11,0x11,0x22,0x21,0xbc,0x89,0x06,0x04,0x44,0x04,0x44,0x00,0x00,0x20,
+  0xc1,0xa1,0x00,0x04,0x84,0x1b,0x04,0x74,0x00,0x00,0x06,0x66,0xc0,0xc1,0x08,0x40,
+  0x40,0x40,0x60,0x47,0x66,0x66,0x69,0x99,0xb5,0xf7,0x09,0x02,0x22,0x44,0x43,0x40,
+  0x03,0x60,0x47,0x99,0x99,0xac,0x1b,0x00,0x02,0x84,0xc0,0x06,0x22,0x44,0x44,0x40,
+  0x33,0x60,0x44,0xb4,0x1b,0x82,0x5a,0x01,0x00,0x30,0x80,0x1b,0x05,0x03,0x34,0x00,
+  0x00,0x66,0x66,0xac,0x6f,0x05,0x00,0x02,0x00,0x00,0x40,0x20,0x80,0x1b,0x02,0x44,
+  0x88,0x88,0xb4,0xa7,0x03,0x05,0x00,0x05,0x50,0x80,0xf9,0x80,0x1b,0x00,0x08,0x80,
+  0x1b,0xac,0x6d,0x00,0x05,0x81,0xeb,0x09,0x04,0x00,0x44,0x33,0x03,0x44,0x00,0x88,
+  0x00,0x50,0xac,0x6d,0x08,0x08,0x55,0x05,0x85,0x77,0x00,0x33,0x00,0x00,0x80,0xf9,
+  0x82,0x0f,0xa0,0x1b,0x04,0x50,0x02,0x58,0x85,0x58,0x80,0x1b,0x03,0x00,0x47,0x22,
+  0x00,0x8a,0x47,0xa0,0x1b,0x03,0x55,0x02,0x08,0x88,0x84,0x1b,0x01,0x22,0x04,0x80,
+  0x0b,0x02,0x00,0x00,0x55,0xa4,0x8b,0x00,0x85,0x88,0x1b,0x00,0x47,0x88,0x83,0x82,
+  0x85,0x00,0x05,0xa4,0x39,0x05,0x85,0x02,0x05,0x88,0x88,0x80,0x80,0x9f,0x80,0x95,
+  0x80,0x1b,0x82,0xa3,0x00,0x22,0x9a,0xf3,0x84,0xf9,0x80,0xba,0x00,0x08,0x84,0x1b,
+  0x87,0x2b,0x83,0x47,0xa8,0xe1,0x01,0x00,0x02,0x84,0x65,0x80,0x37,0x84,0x1b,0xcb,
+  0x81,0x84,0x1b,0x00,0x00,0x84,0x1b,0xc3,0x7f,0x84,0x53,0x84,0x00,0xcb,0xb5,0x80,
+  0x79,0xdf,0xd3,0xa4,0x35,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,0x00,
+  0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,
+  0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,
+  0x84,0x1a,0x02,0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,0x00,
+  0x01,0x55,0x02,0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,0x1b,
+  0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,0x05,
+  0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,0x8a,
+  0xa9,0x05,0xc8,0xdf,0x07,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,0xc8,0x37,0x01,
+  0x00,0x99,0x80,0x1b,0x01,0x16,0x95,0xbc,0x1b,0x09,0x30,0x02,0x11,0x03,0x99,0x66,
+  0xaa,0x99,0x19,0x9a,0xbc,0x51,0x09,0x03,0x30,0x10,0x33,0x96,0x61,0x11,0x99,0x19,
+  0x99,0xbc,0x51,0x09,0x43,0x30,0x03,0x40,0x66,0x11,0x69,0x99,0x16,0x91,0xb8,0x1b,
+  0x0a,0x02,0x44,0x33,0x33,0x04,0x11,0x10,0x99,0x66,0x21,0x69,0xc4,0x1b,0x07,0x00,
+  0x03,0x11,0x00,0x11,0x11,0x22,0x11,0xbc,0x89,0x04,0x44,0x43,0x44,0x40,0x00,0x80,
+  0x00,0xbc,0xa5,0x04,0x40,0x02,0x44,0x40,0x47,0x80,0x1b,0x01,0x66,0x60,0xbd,0x31,
+  0x0b,0x34,0x02,0x04,0x03,0x04,0x74,0x66,0x66,0x99,0x96,0x22,0x06,0xb4,0x1b,0x09,
+  0x44,0x30,0x00,0x34,0x04,0x74,0x99,0x96,0x99,0x99,0xac,0x1b,0x86,0x3f,0x05,0x44,
+  0x40,0x03,0x34,0x04,0x44,0xb4,0x1b,0x86,0x27,0x05,0x02,0x20,0x44,0x43,0x33,0x44,
+  0x84,0x6d,0x01,0x66,0x66,0xa4,0x6f,0x00,0x00,0x84,0x1b,0x08,0x00,0x44,0x44,0x34,
+  0x44,0x88,0x80,0x00,0x08,0xac,0xa7,0x01,0x50,0x02,0x81,0xec,0x02,0x00,0x44,0x43,
+  0x88,0x1b,0x80,0x28,0xa9,0xef,0x81,0xeb,0x07,0x40,0x00,0x43,0x30,0x34,0x44,0x08,
+  0x80,0x81,0xbb,0xa0,0x1b,0x0b,0x02,0x22,0x85,0x50,0x58,0x50,0x70,0x00,0x30,0x07,
+  0x04,0x43,0x82,0x2b,0x00,0x50,0xa4,0x1b,0x0a,0x00,0x22,0x88,0x55,0x88,0x55,0x70,
+  0x05,0x04,0x77,0x20,0x80,0x76,0x82,0x47,0xa0,0x1b,0x09,0x50,0x22,0x88,0x85,0x88,
+  0x50,0x70,0x05,0x20,0x47,0x84,0x79,0x00,0x05,0x80,0x7a,0xa8,0x1b,0x00,0x88,0x84,
+  0x1b,0x01,0x22,0x04,0x86,0x69,0x00,0x50,0x86,0x9d,0x98,0x1d,0x07,0x50,0x22,0x58,
+  0x88,0x88,0x00,0x00,0x08,0x84,0xd5,0x80,0x95,0x82,0xf6,0x00,0x20,0x9a,0xd7,0x84,
+  0xf9,0x80,0xba,0x00,0x88,0x84,0x1b,0x86,0xb7,0x01,0x05,0x55,0xaf,0x65,0x84,0xfd,
+  0x88,0x43,0x80,0x1b,0x01,0x00,0x05,0xcf,0x81,0x01,0x50,0x00,0x88,0x8b,0xc8,0x1b,
+  0x81,0x1e,0x00,0x05,0x80,0x1b,0xb9,0xbf,0x90,0x1b,0x00,0x00,0xd7,0xd3,0x81,0x72,
+  0x98,0x35,0x00,0x22,0xfc,0x00,0xfc,0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,
+  0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,
+  0x02,0x55,0x00,0x55,0x55,0x05,0x55,0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,
+  0x01,0x22,0x00,0xc8,0x1b,0x88,0x00,0x00,0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,
+  0x03,0x55,0x55,0x20,0x55,0xcc,0x1b,0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,
+  0x50,0x05,0x50,0xc0,0x37,0x09,0x22,0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,
+  0xbc,0x6f,0x08,0x00,0x22,0x05,0x00,0x09,0x96,0xa9,0x66,0x00,0xb8,0x1b,0x0b,0x02,
+  0x22,0x33,0x00,0x00,0x00,0x69,0x96,0xa9,0x96,0x90,0x8a,0xb4,0xc3,0x02,0x30,0x02,
+  0x03,0x80,0x1c,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,0xb0,0x1b,0x0c,0x30,0x30,
+  0x33,0x03,0x30,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xb0,0x1b,0x0a,0x70,0x43,
+  0x03,0x33,0x03,0x61,0x10,0x99,0x96,0x99,0x11,0xac,0x1b,0x0d,0x02,0x22,0x07,0x70,
+  0x44,0x30,0x00,0x34,0x10,0x00,0x99,0x66,0x91,0x69,0xac,0x53,0x0f,0x60,0x22,0x77,
+  0x09,0x44,0x30,0x03,0x44,0x04,0x44,0x66,0x11,0x69,0x99,0x22,0x21,0xac,0x1b,0x03,
+  0x00,0x99,0x40,0x43,0x80,0x1b,0x04,0x74,0x11,0x00,0x10,0x01,0xac,0x6d,0x0d,0x60,
+  0x22,0x30,0x96,0x03,0x44,0x40,0x40,0x04,0x77,0x00,0x66,0x06,0x60,0xb4,0xdd,0x0b,
+  0x30,0x66,0x34,0x44,0x40,0x03,0x60,0x77,0x66,0x99,0x69,0x96,0x9d,0xbf,0x02,0x02,
+  0x22,0x20,0x80,0xeb,0x01,0x43,0x00,0x80,0x1b,0x04,0x33,0x60,0x44,0x99,0x99,0x80,
+  0x6f,0x98,0x1b,0x00,0x00,0x86,0x23,0x05,0x00,0x43,0x02,0x44,0x44,0x00,0x80,0xfd,
+  0x02,0x99,0x66,0x66,0xa4,0x1b,0x01,0x02,0x00,0x81,0x7f,0x0b,0x44,0x00,0x44,0x44,
+  0x80,0x34,0x08,0x88,0x66,0x00,0x06,0x66,0xa1,0xed,0x05,0x00,0x55,0x58,0x00,0x05,
+  0x43,0x88,0x1b,0x03,0x40,0x88,0x00,0x00,0x84,0x61,0x94,0x00,0x0f,0x85,0x00,0x85,
+  0x88,0x05,0x88,0x30,0x00,0x44,0x43,0x80,0x34,0x44,0x08,0x55,0x50,0xa4,0x89,0x0e,
+  0x88,0x50,0x85,0x58,0x58,0x88,0x07,0x40,0x43,0x30,0x00,0x04,0x04,0x40,0x55,0x81,
+  0xaa,0xa0,0x1b,0x0c,0x55,0x85,0x05,0x55,0x88,0x77,0x40,0x00,0x07,0x02,0x20,0x00,
+  0x40,0x80,0x37,0x98,0x1b,0x0b,0x00,0x22,0x88,0x85,0x55,0x05,0x05,0x88,0x44,0x40,
+  0x22,0x04,0x8a,0xa1,0x00,0x50,0x84,0x99,0x9c,0x1b,0x01,0x00,0x05,0x81,0xd6,0x8a,
+  0xeb,0x00,0x00,0x8a,0x87,0x96,0xbd,0x02,0x00,0x22,0x58,0x80,0x27,0x97,0x05,0x80,
+  0x6c,0x00,0x50,0x80,0x39,0x00,0x05,0x94,0x0d,0xa7,0x1d,0x84,0x0d,0x86,0x6d,0x8c,
+  0x11,0x8d,0x31,0xa4,0x1b,0x00,0x05,0x98,0x6f,0xb6,0x6b,0x00,0x50,0x80,0x38,0xa4,
+  0x2d,0xb0,0x1b,0x00,0x05,0xc7,0x2b,0x84,0x61,0x80,0x96,0x90,0x89,0xc8,0x1b,0xc8,
+  0x35,0x88,0x55,0xa9,0x6b,0xb4,0x71,0x94,0x51,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,
+  0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,0x00,0x55,
+  0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,0x02,
+  0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,0x55,0x20,
+  0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,0xcc,
+  0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,0x00,0x08,
+  0xa9,0xbc,0x6f,0x00,0x02,0x80,0xc1,0x07,0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,
+  0xb4,0x1b,0x07,0x30,0x00,0x00,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xb4,
+  0xf7,0x02,0x33,0x33,0x00,0x80,0x37,0x05,0x99,0x96,0x58,0xaa,0x21,0x69,0xac,0x1b,
+  0x0d,0x03,0x02,0x03,0x33,0x33,0x03,0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,0xac,
+  0x1b,0x0b,0x07,0x02,0x30,0x33,0x30,0x34,0x11,0x03,0x99,0x66,0x91,0x19,0xb4,0x1b,
+  0x0b,0x77,0x00,0x43,0x00,0x03,0x44,0x00,0x00,0x96,0x61,0x16,0x99,0xac,0x53,0x09,
+  0x02,0x22,0x70,0x96,0x43,0x07,0x34,0x44,0x44,0x40,0x84,0x55,0x01,0x22,0x16,0xac,
+  0x1b,0x0d,0x09,0x96,0x04,0x30,0x34,0x44,0x47,0x40,0x10,0x00,0x00,0x11,0x22,0x21,
+  0xb0,0x1b,0x0a,0x66,0x34,0x43,0x04,0x00,0x47,0x74,0x06,0x60,0x66,0x00,0xb5,0xbf,
+  0x0d,0x06,0x60,0x44,0x43,0x00,0x33,0x07,0x74,0x69,0x96,0x99,0x66,0x22,0x06,0xa0,
+  0xdb,0x81,0xcb,0x0b,0x30,0x02,0x44,0x44,0x03,0x33,0x04,0x44,0x99,0x96,0x99,0x99,
+  0x9c,0x1b,0x00,0x02,0x80,0x1b,0x03,0x20,0x00,0x30,0x22,0x80,0x1b,0x00,0x34,0x80,
+  0xa7,0x01,0x60,0x69,0xa0,0x1b,0x07,0x00,0x22,0x05,0x50,0x00,0x00,0x40,0x00,0x80,
+  0x1b,0x06,0x44,0x88,0x88,0x60,0x00,0x66,0x66,0x9c,0x6f,0x06,0x50,0x02,0x55,0x85,
+  0x00,0x55,0x30,0x88,0x1b,0x03,0x08,0x88,0x00,0x04,0x84,0x61,0x9c,0x1b,0x0e,0x58,
+  0x88,0x58,0x88,0x00,0x00,0x44,0x33,0x03,0x44,0x40,0x88,0x55,0x04,0x22,0xa2,0x2d,
+  0x80,0x34,0x04,0x88,0x88,0x88,0x74,0x05,0x81,0x6a,0x04,0x44,0x44,0x00,0x50,0x00,
+  0xa5,0xbd,0x04,0x85,0x50,0x50,0x58,0x58,0x80,0x1b,0x02,0x00,0x77,0x22,0x80,0x50,
+  0x00,0x55,0xa0,0x1b,0x02,0x02,0x22,0x88,0x84,0x1b,0x04,0x85,0x44,0x00,0x20,0x44,
+  0x84,0x97,0x00,0x55,0x82,0x2d,0x80,0x71,0x88,0x8d,0x84,0x1b,0x02,0x00,0x58,0x00,
+  0x80,0x00,0x86,0xb1,0x00,0x02,0x80,0x1b,0x9e,0xbd,0x00,0x02,0x80,0x53,0x82,0x41,
+  0x93,0x05,0x88,0x1b,0x00,0x00,0x82,0xf5,0x90,0x0d,0xa7,0x1d,0x84,0x0d,0x86,0x6d,
+  0x94,0x11,0xa4,0xcf,0x90,0x1b,0xb9,0x6d,0x94,0x1b,0x88,0x8b,0xc7,0x63,0x80,0x1b,
+  0x02,0x00,0x55,0x20,0xd3,0x81,0x80,0x1b,0x00,0x50,0xd7,0x9d,0x88,0xcd,0xc0,0x6d,
+  0x88,0x1b,0x00,0x02,0xcc,0x6d,0x8c,0x71,0x94,0x51,0x00,0x22,0xfc,0x00,0xfc,0x00,
+  0xf4,0x00,0x04,0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,
+  0x55,0x22,0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,
+  0x1b,0x02,0x50,0x22,0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,
+  0x55,0x80,0x55,0xb8,0x00,0x01,0x55,0x02,0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,
+  0x1b,0x84,0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,
+  0x09,0x50,0x22,0x66,0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x00,
+  0x96,0x05,0x66,0x09,0x8a,0xa9,0x05,0xb8,0xdf,0x0b,0x00,0x02,0x00,0x33,0x96,0x00,
+  0x96,0x69,0x8a,0xa9,0x00,0x90,0xb4,0xf7,0x06,0x33,0x30,0x00,0x03,0x96,0x00,0x99,
+  0x80,0x1b,0x01,0x16,0x95,0xac,0x1b,0x00,0x30,0x80,0x1b,0x09,0x30,0x30,0x11,0x03,
+  0x99,0x66,0xaa,0x99,0x19,0x9a,0xac,0x1b,0x0d,0x70,0x22,0x03,0x30,0x03,0x43,0x10,
+  0x33,0x96,0x61,0x11,0x99,0x19,0x99,0xb0,0x1b,0x0c,0x02,0x30,0x07,0x34,0x44,0x00,
+  0x00,0x66,0x10,0x69,0x99,0x16,0x91,0xac,0x1b,0x0d,0x09,0x60,0x30,0x77,0x44,0x44,
+  0x44,0x03,0x11,0x04,0x99,0x66,0x21,0x69,0xac,0x1b,0x0d,0x99,0x60,0x43,0x00,0x44,
+  0x40,0x74,0x03,0x00,0x04,0x01,0x11,0x22,0x10,0xac,0x1b,0x0d,0x96,0x60,0x44,0x30,
+  0x40,0x03,0x77,0x40,0x66,0x04,0x60,0x00,0x22,0x06,0xac,0x1b,0x0c,0x66,0x02,0x44,
+  0x30,0x03,0x34,0x77,0x40,0x99,0x60,0x96,0x66,0x20,0xa0,0x53,0x02,0x00,0x02,0x22,
+  0x82,0x08,0x04,0x44,0x43,0x33,0x34,0x44,0x80,0x1b,0x01,0x99,0x99,0xa8,0x1b,0x80,
+  0x00,0x00,0x02,0x84,0x1b,0x84,0xa7,0x00,0x00,0x80,0x1b,0x00,0x66,0x9d,0x11,0x81,
+  0x96,0x80,0x00,0x09,0x44,0x44,0x34,0x44,0x88,0x80,0x00,0x08,0x66,0x66,0x9c,0x6f,
+  0x02,0x00,0x22,0x58,0x81,0xe9,0x80,0x1b,0x00,0x43,0x88,0x1b,0x02,0x40,0x00,0x00,
+  0x9d,0xa1,0x10,0x00,0x22,0x88,0x85,0x88,0x85,0x00,0x05,0x43,0x30,0x34,0x44,0x08,
+  0x80,0x50,0x44,0x20,0xa2,0x11,0x0b,0x50,0x02,0x58,0x88,0x88,0x85,0x40,0x58,0x30,
+  0x07,0x04,0x43,0x80,0x34,0x00,0x04,0xa6,0x2d,0x02,0x55,0x02,0x05,0x84,0x1b,0x08,
+  0x55,0x07,0x77,0x20,0x00,0x40,0x02,0x50,0x00,0xa4,0x1b,0x80,0x4e,0x06,0x88,0x88,
+  0x55,0x40,0x05,0x04,0x44,0x84,0x97,0x00,0x50,0x82,0x2d,0x80,0x71,0x91,0xdd,0x84,
+  0x1b,0x84,0xa7,0x8e,0xeb,0x84,0x1b,0x9e,0xbd,0x80,0x26,0x00,0x58,0x94,0x19,0x84,
+  0x1b,0x03,0x50,0x05,0x05,0x55,0x94,0x0d,0x9c,0x17,0x8c,0x0d,0x86,0x84,0x98,0x1b,
+  0x81,0x31,0xb0,0x1b,0x00,0x05,0xc7,0x2d,0x88,0x1b,0x00,0x50,0xa4,0xfd,0xac,0x1b,
+  0x00,0x05,0x84,0x1b,0xc8,0x00,0x02,0x00,0x02,0x05,0xa8,0x7f,0xb2,0xa5,0x98,0xdd,
+  0xb8,0x1b,0x80,0x55,0xcc,0x6d,0x8b,0xd7,0x90,0x35,0x00,0x22,0xfc,0x00,0xfc,0x00,
+  0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,
+  0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,0x55,0xc4,
+  0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xc8,0x1b,0x88,0x00,0x00,
+  0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,0x55,0x55,0x20,0x55,0xcc,0x1b,0x80,
+  0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,0x22,
+  0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,0x96,
+  0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,0x8a,0xbc,0xc3,
+  0x85,0x2f,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,0xb4,0x1b,0x0b,0x30,0x00,0x03,
+  0x30,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xa8,0x4d,0x80,0x33,0x09,0x30,0x47,
+  0x33,0x03,0x61,0x10,0x99,0x96,0x99,0x11,0xac,0x1b,0x0d,0x66,0x02,0x06,0x66,0x30,
+  0x47,0x40,0x43,0x11,0x03,0x99,0x66,0x91,0x69,0xac,0x53,0x08,0x66,0x02,0x09,0x99,
+  0x30,0x47,0x04,0x44,0x10,0x80,0x55,0x03,0x69,0x99,0x22,0x21,0xa4,0x1b,0x0d,0x96,
+  0x02,0x06,0x69,0x33,0x07,0x44,0x40,0x00,0x04,0x11,0x11,0x01,0x11,0xac,0xa7,0x05,
+  0x66,0x02,0x00,0x00,0x33,0x30,0x80,0x1b,0x06,0x44,0x22,0x00,0x60,0x22,0x20,0x66,
+  0xac,0x8b,0x0d,0x02,0x20,0x34,0x33,0x43,0x03,0x40,0x44,0x00,0x44,0x96,0x00,0x06,
+  0x99,0x9c,0xf1,0x00,0x20,0x80,0x43,0x0b,0x30,0x22,0x44,0x43,0x30,0x33,0x40,0x34,
+  0x60,0x47,0x99,0x66,0x94,0x1b,0x84,0xf1,0x82,0x23,0x08,0x22,0x33,0x02,0x44,0x44,
+  0x03,0x33,0x40,0x03,0x80,0x1b,0x00,0x99,0x94,0x1b,0x04,0x00,0x02,0x58,0x50,0x00,
+  0x82,0x05,0x0b,0x43,0x00,0x44,0x44,0x33,0x34,0x40,0x00,0x60,0x47,0x66,0x66,0x94,
+  0x6f,0x09,0x50,0x00,0x58,0x85,0x05,0x88,0x02,0x00,0x30,0x44,0x80,0x37,0x01,0x44,
+  0x00,0x80,0xa9,0x80,0x45,0x88,0xa7,0x11,0x02,0x22,0x85,0x50,0x55,0x88,0x55,0x88,
+  0x40,0x00,0x30,0x74,0x44,0x43,0x03,0x34,0x04,0x44,0x84,0x7b,0x94,0x9f,0x0a,0x88,
+  0x55,0x55,0x58,0x58,0x88,0x00,0x55,0x04,0x77,0x44,0x80,0x89,0x01,0x04,0x44,0x80,
+  0x5f,0x80,0x15,0x84,0x21,0x11,0x50,0x02,0x88,0x85,0x00,0x55,0x88,0x85,0x05,0x55,
+  0x04,0x74,0x43,0x33,0x00,0x33,0x50,0x44,0x85,0xfb,0x84,0x02,0x84,0x1b,0x86,0xab,
+  0x09,0x88,0x55,0x05,0x58,0x20,0x40,0x33,0x00,0x20,0x33,0x80,0x14,0x86,0x31,0x8a,
+  0xbf,0x00,0x00,0x81,0x0f,0x05,0x00,0x00,0x85,0x00,0x00,0x58,0x8a,0xec,0x80,0x03,
+  0x8e,0x69,0x84,0xd5,0x84,0xdd,0x80,0xfa,0x84,0xe1,0x8a,0xcb,0x80,0x1b,0x82,0xa3,
+  0x00,0x05,0x88,0x1b,0x9d,0xbd,0x9a,0x6b,0x88,0x55,0x9c,0xad,0xa4,0x00,0x81,0x08,
+  0x80,0x02,0xcc,0x1b,0x83,0x2f,0x00,0x50,0x80,0x89,0xcc,0x1b,0x80,0x55,0x95,0x19,
+  0xc3,0x83,0x98,0x99,0xc0,0x39,0x89,0x97,0xd0,0x1b,0x89,0xcf,0xd0,0x1b,0x88,0x02,
+  0x01,0x22,0x22,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,
+  0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,
+  0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,
+  0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,
+  0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,
+  0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,
+  0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,
+  0x1b,0x00,0x09,0xc0,0x1b,0x00,0x00,0x80,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xb8,
+  0x19,0x0a,0x02,0x33,0x03,0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,0xa9,0x47,0x80,
+  0x33,0x09,0x04,0x70,0x30,0x33,0x11,0x03,0x99,0x66,0x91,0x19,0xac,0x1b,0x0d,0x60,
+  0x22,0x66,0x66,0x04,0x70,0x04,0x33,0x10,0x34,0x96,0x61,0x16,0x99,0xac,0x53,0x0f,
+  0x60,0x22,0x99,0x96,0x04,0x70,0x44,0x43,0x03,0x00,0x61,0x11,0x99,0x96,0x22,0x16,
+  0xb0,0x37,0x0b,0x99,0x30,0x70,0x44,0x03,0x00,0x44,0x11,0x10,0x11,0x11,0x20,0xa9,
+  0x87,0x0f,0x60,0x22,0x00,0x06,0x33,0x00,0x44,0x03,0x04,0x44,0x20,0x00,0x02,0x22,
+  0x06,0x66,0xac,0x8b,0x0d,0x22,0x00,0x43,0x30,0x30,0x33,0x04,0x44,0x04,0x44,0x60,
+  0x00,0x69,0x99,0x95,0xdd,0x82,0x04,0x80,0x43,0x0b,0x02,0x22,0x44,0x33,0x03,0x34,
+  0x03,0x43,0x04,0x74,0x96,0x66,0xa0,0x1b,0x80,0x00,0x0d,0x22,0x20,0x30,0x22,0x44,
+  0x43,0x33,0x34,0x00,0x30,0x04,0x74,0x99,0x96,0x94,0x1b,0x02,0x00,0x22,0x85,0x85,
+  0x93,0x0c,0x00,0x30,0x02,0x44,0x44,0x33,0x44,0x00,0x03,0x04,0x74,0x66,0x66,0x94,
+  0x6f,0x13,0x00,0x02,0x88,0x55,0x58,0x85,0x20,0x00,0x04,0x40,0x44,0x43,0x34,0x44,
+  0x04,0x00,0x00,0x40,0x00,0x00,0x94,0xa7,0x04,0x55,0x00,0x58,0x88,0x58,0x80,0x3a,
+  0x00,0x07,0x80,0x36,0x02,0x33,0x44,0x44,0x80,0x19,0x9c,0x9f,0x13,0x85,0x50,0x55,
+  0x88,0x88,0x85,0x05,0x55,0x47,0x70,0x43,0x30,0x03,0x44,0x44,0x44,0x05,0x50,0x22,
+  0x20,0x85,0x41,0x84,0x6d,0x0f,0x88,0x55,0x05,0x58,0x88,0x50,0x55,0x58,0x47,0x40,
+  0x33,0x30,0x03,0x34,0x04,0x40,0x82,0x9f,0x00,0x05,0x8a,0x15,0x80,0x58,0x86,0xab,
+  0x84,0x3b,0x00,0x04,0x80,0x8d,0x04,0x03,0x33,0x00,0x02,0x55,0x82,0x13,0x82,0x1b,
+  0x88,0x1b,0x84,0xc1,0x80,0x27,0x00,0x88,0x85,0x0f,0x00,0x00,0x80,0x03,0x8e,0x6b,
+  0x01,0x00,0x05,0x84,0xc5,0x86,0xff,0x88,0xe1,0x88,0x83,0x80,0x1b,0x8a,0xd9,0x84,
+  0xf1,0x9d,0xbd,0x94,0x0b,0x86,0xf5,0x00,0x05,0x84,0x1b,0xc0,0x00,0x80,0x71,0x00,
+  0x05,0xd8,0x1b,0x80,0x55,0x01,0x00,0x55,0xad,0xa5,0x9c,0xf1,0x03,0x50,0x00,0x00,
+  0x05,0xcc,0x1b,0x89,0x7b,0x00,0x05,0xd7,0x9f,0x01,0x00,0x02,0x9c,0x99,0xbc,0x71,
+  0xcc,0x89,0x8c,0x71,0x8c,0x6d,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,
+  0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,
+  0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,
+  0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,
+  0x00,0x01,0x55,0x02,0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,
+  0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,
+  0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,
+  0x8a,0xa9,0x05,0xc8,0xdf,0x07,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,0xc0,0x37,
+  0x03,0x02,0x96,0x00,0x99,0x80,0x1b,0x01,0x16,0x95,0xbc,0x51,0x09,0x30,0x30,0x11,
+  0x03,0x99,0x66,0xaa,0x99,0x19,0x9a,0xb0,0x19,0x0c,0x00,0x47,0x00,0x03,0x30,0x10,
+  0x33,0x96,0x61,0x11,0x99,0x19,0x99,0xac,0x69,0x0d,0x66,0x66,0x47,0x06,0x43,0x30,
+  0x03,0x40,0x66,0x11,0x69,0x99,0x16,0x91,0xac,0x1b,0x0d,0x99,0x66,0x47,0x09,0x44,
+  0x30,0x30,0x04,0x11,0x10,0x99,0x66,0x21,0x69,0xac,0x1b,0x0d,0x69,0x96,0x07,0x06,
+  0x40,0x33,0x04,0x44,0x11,0x00,0x11,0x11,0x00,0x01,0xb1,0x9d,0x07,0x66,0x30,0x00,
+  0x40,0x33,0x44,0x44,0x00,0x80,0xdb,0x01,0x66,0x60,0xad,0x17,0x0f,0x20,0x00,0x33,
+  0x02,0x03,0x34,0x44,0x43,0x44,0x40,0x00,0x00,0x99,0x96,0x22,0x06,0x9d,0xd1,0x84,
+  0x27,0x0b,0x43,0x30,0x33,0x44,0x34,0x30,0x47,0x40,0x66,0x60,0x99,0x99,0x94,0x1b,
+  0x01,0x00,0x02,0x80,0x1b,0x0b,0x00,0x02,0x22,0x44,0x33,0x33,0x44,0x03,0x03,0x47,
+  0x40,0x99,0x98,0x1b,0x06,0x02,0x22,0x50,0x00,0x55,0x58,0x20,0x80,0x1e,0x05,0x44,
+  0x43,0x34,0x44,0x00,0x33,0x84,0x37,0x01,0x66,0x66,0x8c,0x6f,0x11,0x00,0x22,0x85,
+  0x50,0x88,0x58,0x00,0x05,0x44,0x02,0x44,0x30,0x44,0x44,0x40,0x03,0x04,0x00,0x84,
+  0x00,0x91,0x97,0x03,0x02,0x88,0x85,0x88,0x82,0x21,0x09,0x74,0x40,0x43,0x30,0x34,
+  0x44,0x44,0x03,0x00,0x04,0x9c,0xa3,0x0b,0x55,0x00,0x58,0x88,0x88,0x55,0x55,0x58,
+  0x77,0x00,0x33,0x04,0x80,0x1b,0x02,0x40,0x55,0x04,0x86,0x81,0x84,0x9d,0x00,0x02,
+  0x80,0x51,0x0c,0x55,0x88,0x85,0x00,0x55,0x88,0x74,0x05,0x33,0x04,0x33,0x43,0x44,
+  0x81,0xf5,0x00,0x00,0x8e,0x15,0x80,0x9d,0x86,0xab,0x84,0x3b,0x07,0x40,0x05,0x00,
+  0x20,0x33,0x33,0x00,0x20,0x80,0x5e,0x80,0x0f,0x86,0xbf,0x84,0xdb,0x84,0x00,0x01,
+  0x58,0x85,0x84,0x7f,0x84,0x49,0x88,0x1b,0x86,0xa1,0x84,0x0f,0x82,0xff,0x84,0xe1,
+  0x97,0x05,0x80,0x52,0x88,0x38,0x9e,0xf7,0x84,0xfd,0x95,0x09,0x8e,0x87,0xbe,0x69,
+  0x84,0xef,0x01,0x50,0x50,0xd4,0x1b,0x85,0x27,0x00,0x05,0x84,0x1b,0xc8,0x00,0x80,
+  0x9a,0xdc,0x1b,0x02,0x02,0x00,0x50,0xd7,0x9f,0x80,0x96,0x98,0x99,0xc7,0xa1,0xc4,
+  0x89,0x98,0xd1,0x80,0x00,0x00,0x22,0xfc,0x00,0x98,0x00,0x03,0x00,0x02,0x00,0x00,
+  0xd0,0x19,0x04,0x22,0x55,0x50,0x55,0x55,0x80,0x06,0xc0,0x00,0x02,0x50,0x00,0x55,
+  0x80,0x00,0x01,0x20,0x55,0xbc,0x19,0x01,0x02,0x22,0x84,0x19,0x02,0x55,0x55,0x05,
+  0xc0,0x1b,0x00,0x50,0x90,0x1b,0x80,0x55,0x00,0x20,0xfc,0x1b,0xa4,0x1b,0x04,0x00,
+  0x05,0x05,0x55,0x55,0x80,0x73,0xc4,0x1b,0x06,0x06,0x60,0x90,0x05,0x50,0x0a,0x50,
+  0xc0,0x1b,0x09,0x00,0x22,0x09,0x96,0xa9,0x10,0x08,0x0a,0x05,0x05,0xc4,0xa7,0x06,
+  0x99,0x96,0xa9,0x96,0x98,0x0a,0x05,0xc0,0xdf,0x90,0x1b,0x02,0x5a,0x15,0x8a,0xc4,
+  0x1b,0x07,0x96,0x60,0x99,0x96,0x9a,0xaa,0x1a,0xa9,0xc5,0x31,0x07,0x60,0x00,0x99,
+  0x66,0x99,0x11,0x19,0x99,0xbc,0x1b,0x08,0x33,0x02,0x03,0x40,0x96,0x61,0x91,0x69,
+  0x21,0xc0,0x1b,0x09,0x43,0x30,0x44,0x03,0x61,0x10,0x99,0x96,0x22,0x11,0xbc,0x6d,
+  0x05,0x44,0x30,0x34,0x03,0x11,0x03,0xc5,0xa3,0x09,0x00,0x22,0x40,0x04,0x00,0x04,
+  0x11,0x00,0x04,0x01,0xbc,0x1b,0x08,0x44,0x02,0x04,0x77,0x33,0x03,0x00,0x80,0x04,
+  0x80,0x37,0x00,0x20,0xb0,0x3b,0x0c,0x74,0x02,0x47,0x77,0x33,0x00,0x88,0x80,0x04,
+  0x08,0x00,0x00,0x09,0xb0,0x8d,0x0d,0x40,0x02,0x77,0x77,0x33,0x30,0x88,0x80,0x44,
+  0x08,0x90,0x90,0x99,0x99,0xad,0x51,0x07,0x06,0x60,0x47,0x40,0x03,0x30,0x88,0x88,
+  0x84,0x1b,0x00,0x69,0xb0,0x1b,0x03,0x69,0x90,0x44,0x06,0x8c,0x1b,0x01,0x09,0x60,
+  0xac,0x1b,0x07,0x02,0x22,0x66,0x99,0x00,0x20,0x03,0x33,0x84,0x1b,0x02,0x00,0x00,
+  0x66,0xb0,0x1b,0x03,0x06,0x69,0x02,0x22,0x84,0x1b,0x02,0x40,0x88,0x22,0xb0,0xe3,
+  0x00,0x90,0x80,0x37,0x02,0x30,0x20,0x80,0x90,0x1b,0xac,0xa5,0x05,0x90,0x22,0x69,
+  0x99,0x33,0x00,0xd4,0x1b,0x0b,0x66,0x99,0x33,0x06,0x88,0x03,0x88,0x88,0x30,0x88,
+  0x20,0x33,0xb5,0x4d,0x02,0x66,0x66,0x00,0x80,0xf9,0x03,0x88,0x88,0x08,0x88,0xb5,
+  0x15,0x81,0x4f,0x82,0x5f,0x05,0x88,0x00,0x88,0x88,0x50,0x08,0xbe,0xd7,0x02,0x50,
+  0x22,0x88,0x82,0x7e,0x80,0x21,0x02,0x50,0x05,0x58,0xb4,0x1b,0x0b,0x55,0x02,0x88,
+  0x85,0x20,0x58,0x02,0x22,0x85,0x55,0x05,0x88,0xb8,0x1b,0x00,0x50,0x94,0x1b,0x01,
+  0x55,0x88,0xad,0x31,0x87,0x27,0x84,0x1b,0x00,0x50,0x84,0x1b,0x00,0x58,0xaf,0x65,
+  0x01,0x50,0x02,0x80,0x1b,0x02,0x55,0x22,0x05,0x8f,0x13,0x00,0x00,0xa0,0x8d,0x80,
+  0x35,0x83,0x93,0x83,0x07,0x88,0x1b,0x01,0x88,0x85,0xa4,0x39,0x01,0x50,0x02,0x80,
+  0x0e,0x00,0x88,0x98,0x1b,0x80,0x0b,0x9c,0xc7,0x80,0x87,0x01,0x55,0x88,0x84,0x1b,
+  0x00,0x20,0x97,0x67,0x97,0x9f,0x97,0xaf,0x84,0x1b,0xb7,0xbb,0x00,0x02,0x81,0x13,
+  0x8c,0x00,0x84,0xbb,0x8c,0x09,0x85,0x37,0x00,0x22,0xfc,0x00,0x98,0x00,0x05,0x00,
+  0x22,0x00,0x00,0x22,0x20,0xc4,0x19,0x07,0x02,0x22,0x55,0x00,0x55,0x55,0x20,0x05,
+  0xc8,0x35,0x01,0x02,0x55,0x80,0x00,0x01,0x05,0x55,0xc4,0x1b,0x01,0x55,0x50,0x84,
+  0x1b,0x01,0x55,0x55,0xbc,0x55,0x80,0x51,0x90,0x00,0x00,0x22,0xb8,0x55,0xec,0x1b,
+  0x80,0x88,0x01,0x50,0x50,0x80,0x04,0xc4,0x1b,0x05,0x66,0x05,0x00,0x50,0x00,0xa9,
+  0x80,0x8b,0xc0,0x1b,0x07,0x99,0x60,0x91,0x00,0x80,0xaa,0x50,0x50,0xc4,0xe1,0x03,
+  0x99,0x60,0x99,0x69,0x80,0x1b,0x00,0x09,0xd4,0x1b,0x05,0x85,0xaa,0x58,0xa9,0x22,
+  0x21,0xbc,0x1b,0x07,0x66,0x00,0x99,0x69,0xaa,0xa9,0xaa,0x99,0xbc,0x1b,0x80,0xa7,
+  0x05,0x00,0x96,0x66,0x91,0x19,0x99,0xc0,0x1b,0x09,0x30,0x22,0x34,0x03,0x66,0x10,
+  0x16,0x99,0x19,0x99,0xbc,0x51,0x09,0x33,0x02,0x40,0x34,0x11,0x04,0x99,0x66,0x21,
+  0x19,0xbc,0x1b,0x07,0x43,0x00,0x40,0x34,0x10,0x33,0x00,0x01,0xc5,0x4d,0x07,0x00,
+  0x40,0x00,0x44,0x10,0x00,0x40,0x11,0xbc,0x1b,0x08,0x40,0x22,0x47,0x74,0x30,0x30,
+  0x08,0x03,0x40,0x81,0xdb,0x01,0x00,0x02,0xb4,0x1b,0x0b,0x77,0x77,0x30,0x04,0x88,
+  0x03,0x40,0x88,0x00,0x00,0x99,0x90,0xac,0x3b,0x05,0x00,0x22,0x77,0x74,0x33,0x07,
+  0x84,0x1b,0x01,0x09,0x04,0x80,0xc5,0x00,0x09,0xa8,0xf7,0x06,0x02,0x74,0x00,0x33,
+  0x04,0x88,0x80,0x90,0x1b,0x00,0x06,0xa9,0x2f,0x02,0x02,0x40,0x66,0x8c,0x1b,0x01,
+  0x96,0x04,0x80,0x53,0xa8,0x1b,0x05,0x69,0x90,0x02,0x06,0x33,0x30,0x84,0x1b,0x02,
+  0x00,0x04,0x69,0xb0,0x1b,0x00,0x66,0x80,0x7f,0x84,0x1b,0x03,0x08,0x88,0x20,0x34,
+  0x80,0xa7,0xa0,0x8b,0x09,0x02,0x22,0x69,0x99,0x02,0x06,0x03,0x33,0x88,0x88,0x84,
+  0x1b,0xb9,0xd7,0x01,0x99,0x30,0xd8,0x1b,0x04,0x69,0x99,0x30,0x66,0x80,0x88,0x1b,
+  0x01,0x03,0x33,0xb9,0xbb,0x05,0x60,0x00,0x06,0x88,0x00,0x88,0x80,0x00,0x82,0xf5,
+  0xbe,0xd3,0x02,0x50,0x80,0x05,0x80,0x19,0x00,0x88,0xbe,0xd7,0x07,0x02,0x22,0x85,
+  0x55,0x05,0x58,0x00,0x00,0x83,0x11,0x00,0x85,0xb5,0x6d,0x05,0x50,0x22,0x88,0x55,
+  0x05,0x88,0x86,0xf7,0x01,0x58,0x88,0xb4,0x1b,0x01,0x55,0x02,0xa0,0x1b,0xb2,0x9f,
+  0x01,0x55,0x50,0x84,0x1b,0x8a,0xf7,0x00,0x88,0xaf,0x65,0x00,0x00,0x80,0x13,0x03,
+  0x85,0x55,0x20,0x58,0x8f,0x13,0x80,0x8d,0xa0,0x55,0x87,0x93,0x83,0x95,0x00,0x55,
+  0x84,0x1b,0x00,0x88,0xa8,0x39,0x84,0x35,0x00,0x88,0x80,0x12,0x8c,0x1b,0x00,0x85,
+  0x80,0x0b,0x9c,0xc7,0x01,0x55,0x02,0x84,0x0f,0x03,0x55,0x58,0x22,0x05,0xa3,0x67,
+  0x90,0x55,0x9b,0xaf,0x80,0x49,0xb7,0xbb,0x00,0x00,0x90,0x00,0x80,0x5c,0x81,0x1f,
+  0x90,0x0b,0x00,0x22,0x00,0x22,0xfc,0x00,0x98,0x00,0x05,0x02,0x22,0x00,0x00,0x22,
+  0x00,0xcc,0x1b,0x05,0x50,0x00,0x55,0x55,0x00,0x55,0xc4,0x19,0x04,0x00,0x22,0x55,
+  0x50,0x55,0x80,0x00,0x01,0x22,0x20,0xbc,0x1b,0x01,0x55,0x02,0x84,0x19,0x80,0x1b,
+  0x00,0x05,0xc0,0x1b,0x88,0x35,0x02,0x55,0x55,0x20,0xc0,0x55,0xe4,0x1b,0x05,0x05,
+  0x50,0x55,0x00,0x00,0x05,0xcc,0x1b,0x09,0x60,0x50,0x05,0x06,0x0a,0x90,0x55,0x50,
+  0x20,0x50,0xbc,0x1b,0x07,0x96,0x00,0x10,0x09,0x0a,0xa9,0x05,0x08,0xc4,0x8b,0x07,
+  0x96,0x02,0x96,0x99,0x0a,0xa9,0x00,0x98,0xd4,0x1b,0x05,0x5a,0xa9,0x8a,0x98,0x22,
+  0x15,0xc0,0x6f,0x08,0x02,0x96,0x96,0xaa,0x99,0xa9,0x9a,0x22,0x1a,0xc1,0x17,0x08,
+  0x00,0x66,0x60,0x11,0x99,0x99,0x99,0x22,0x19,0xbd,0x67,0x09,0x40,0x33,0x61,0x03,
+  0x69,0x96,0x99,0x91,0x22,0x21,0xb4,0x1b,0x09,0x30,0x22,0x03,0x43,0x10,0x44,0x96,
+  0x61,0x11,0x99,0xbc,0x51,0x07,0x30,0x02,0x03,0x44,0x03,0x34,0x00,0x11,0xc5,0xa3,
+  0x09,0x04,0x00,0x04,0x40,0x00,0x00,0x01,0x11,0x22,0x04,0xbc,0x6d,0x05,0x77,0x44,
+  0x03,0x04,0x80,0x33,0x81,0xdb,0x00,0x04,0x80,0x38,0xa9,0xa5,0x80,0x1b,0x0c,0x74,
+  0x00,0x47,0x80,0x33,0x08,0x88,0x00,0x04,0x99,0x00,0x22,0x09,0xb0,0x1b,0x02,0x40,
+  0x30,0x77,0x84,0x1b,0x04,0x90,0x44,0x99,0x90,0x20,0xa8,0x8f,0x07,0x60,0x22,0x40,
+  0x06,0x30,0x47,0x88,0x03,0x90,0x1b,0x00,0x69,0xa4,0x1b,0x05,0x90,0x22,0x06,0x69,
+  0x30,0x44,0x84,0x1b,0x03,0x60,0x44,0x99,0x09,0xac,0x1b,0x05,0x99,0x02,0x20,0x66,
+  0x33,0x00,0x84,0x1b,0x05,0x00,0x44,0x99,0x00,0x20,0x66,0xa4,0x1b,0x0b,0x69,0x02,
+  0x22,0x06,0x33,0x02,0x88,0x03,0x88,0x88,0x03,0x40,0x80,0xa7,0xa8,0xe3,0x80,0x63,
+  0x04,0x66,0x33,0x30,0x88,0x80,0x84,0x1b,0xb4,0xdf,0x05,0x99,0x90,0x00,0x69,0x33,
+  0x33,0xd4,0x1b,0x04,0x06,0x66,0x03,0x33,0x88,0x80,0x00,0x01,0x33,0x30,0xb6,0x9f,
+  0x05,0x66,0x02,0x00,0x66,0x80,0x00,0x84,0x1b,0x01,0x00,0x08,0xb4,0x1b,0x82,0xd3,
+  0x08,0x00,0x00,0x55,0x88,0x88,0x08,0x88,0x55,0x50,0xbe,0xd7,0x82,0x9d,0x05,0x88,
+  0x00,0x00,0x50,0x00,0x58,0xba,0xd7,0x0b,0x02,0x22,0x85,0x55,0x58,0x88,0x22,0x20,
+  0x55,0x02,0x88,0x85,0xb4,0x1b,0x00,0x50,0xa0,0x1b,0xb6,0xbb,0x01,0x55,0x02,0x90,
+  0x1b,0x02,0x50,0x58,0x85,0xaf,0x65,0x00,0x02,0x8b,0x0b,0x01,0x05,0x88,0x97,0x13,
+  0xa5,0x17,0x00,0x50,0x8b,0x5d,0x00,0x05,0x80,0x2f,0x01,0x55,0x50,0x84,0x3f,0x9c,
+  0x39,0x84,0x35,0x00,0x88,0x80,0x12,0x8c,0x1b,0x00,0x55,0x80,0xc9,0x01,0x55,0x58,
+  0x94,0xc7,0x01,0x50,0x22,0x88,0x0f,0x00,0x88,0x84,0x83,0x97,0x67,0x94,0xab,0x97,
+  0xaf,0x88,0x1b,0xb3,0xbb,0x02,0x00,0x02,0x00,0x88,0x00,0x00,0x20,0x89,0x9c,0x8c,
+  0x0b,0x01,0x22,0x20,0x00,0x22,0xfc,0x00,0xfc,0x00,0xe8,0x00,0x00,0x02,0x80,0x01,
+  0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,
+  0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,0x55,0xc4,0x39,0x01,0x55,0x50,0x80,0x18,
+  0x80,0x00,0x01,0x22,0x00,0xc8,0x1b,0x88,0x00,0x00,0x22,0xb8,0x55,0x01,0x02,0x22,
+  0x8c,0x19,0x03,0x55,0x55,0x20,0x55,0xcc,0x1b,0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,
+  0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,0x22,0x05,0x50,0x06,0x66,0x96,0x00,
+  0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,0x96,0xa9,0x66,0x00,0xc8,0x1b,0x07,
+  0x00,0x02,0x69,0x96,0xa9,0x96,0x90,0x8a,0xbc,0xc3,0x85,0x2f,0x80,0x1b,0x04,0x99,
+  0x95,0x8a,0x22,0x16,0xb4,0x1b,0x0b,0x30,0x02,0x03,0x30,0x66,0x11,0x99,0x99,0x9a,
+  0xaa,0x22,0x19,0xb0,0x4f,0x0a,0x22,0x44,0x30,0x33,0x03,0x61,0x10,0x99,0x96,0x99,
+  0x11,0xb4,0x1b,0x0b,0x44,0x02,0x33,0x04,0x40,0x44,0x11,0x03,0x99,0x66,0x91,0x69,
+  0xb4,0x53,0x0d,0x77,0x40,0x30,0x47,0x04,0x44,0x10,0x33,0x66,0x11,0x69,0x99,0x22,
+  0x21,0xac,0x1b,0x08,0x74,0x00,0x04,0x77,0x33,0x44,0x00,0x00,0x11,0x80,0x00,0x81,
+  0xc3,0xac,0xa3,0x02,0x66,0x04,0x74,0x80,0x1b,0x01,0x80,0x00,0x80,0x00,0x01,0x66,
+  0x66,0xa5,0xa5,0x0d,0x60,0x22,0x66,0x99,0x04,0x40,0x03,0x34,0x88,0x88,0x74,0x08,
+  0x66,0x60,0x80,0x55,0x00,0x06,0x9c,0x1b,0x06,0x96,0x02,0x06,0x99,0x30,0x00,0x80,
+  0x88,0x1b,0x02,0x99,0x60,0x99,0xb0,0x1b,0x05,0x66,0x69,0x34,0x06,0x88,0x04,0x84,
+  0x1b,0x00,0x96,0xb8,0x37,0x0b,0x99,0x99,0x40,0x69,0x88,0x03,0x88,0x88,0x44,0x40,
+  0x66,0x60,0xac,0x6f,0x84,0x1b,0x09,0x06,0x99,0x88,0x80,0x88,0x88,0x04,0x40,0x00,
+  0x02,0xac,0xa7,0x01,0x60,0x22,0x94,0x1b,0x00,0x20,0xc1,0x67,0x01,0x99,0x66,0x80,
+  0x53,0x80,0x1b,0xc6,0x63,0x03,0x66,0x00,0x03,0x06,0xd4,0x1b,0x03,0x00,0x22,0x03,
+  0x00,0xd8,0x1b,0x80,0x81,0x84,0x00,0x01,0x22,0x08,0xc2,0xed,0x05,0x00,0x00,0x05,
+  0x50,0x00,0x88,0xc2,0x9b,0x86,0xed,0x86,0x7d,0x01,0x88,0x85,0xbc,0x53,0x86,0x7b,
+  0x04,0x00,0x05,0x55,0x00,0x58,0xc0,0x6f,0x02,0x50,0x00,0x50,0x80,0x38,0x80,0x00,
+  0xc2,0x99,0x01,0x50,0x02,0x80,0x34,0x87,0x43,0x00,0x50,0xc0,0x53,0x02,0x22,0x05,
+  0x55,0x80,0x89,0x02,0x85,0x55,0x88,0xc7,0x27,0x01,0x05,0x00,0x80,0x1b,0x80,0x00,
+  0x00,0x20,0xc6,0xb7,0x84,0x6c,0xcb,0x43,0x9c,0xfb,0x9d,0x6b,0x00,0x22,0xfc,0x00,
+  0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,
+  0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,0x01,0x55,0x55,
+  0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,
+  0x02,0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,
+  0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,0x02,0x66,0x60,
+  0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,0x08,0xaa,0x20,
+  0x50,0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xc0,0x1b,0x00,0x00,
+  0x80,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xbc,0x35,0x09,0x33,0x03,0x61,0x10,0x99,
+  0x96,0xaa,0xa9,0x21,0x99,0xb1,0x49,0x0a,0x22,0x43,0x00,0x30,0x34,0x11,0x03,0x99,
+  0x66,0x91,0x19,0xb4,0x1b,0x0b,0x40,0x22,0x30,0x44,0x04,0x43,0x10,0x34,0x96,0x61,
+  0x16,0x99,0xb4,0x53,0x0d,0x74,0x02,0x04,0x77,0x44,0x43,0x03,0x30,0x61,0x11,0x99,
+  0x96,0x22,0x16,0xb0,0x37,0x0c,0x02,0x47,0x77,0x34,0x40,0x00,0x03,0x11,0x10,0x11,
+  0x11,0x00,0x01,0xad,0xa5,0x08,0x06,0x60,0x47,0x40,0x34,0x40,0x08,0x03,0x00,0x80,
+  0x00,0x03,0x66,0x60,0x22,0x06,0xa4,0x89,0x0f,0x69,0x96,0x44,0x06,0x33,0x40,0x88,
+  0x80,0x40,0x88,0x66,0x07,0x99,0x96,0x20,0x66,0x9c,0x1b,0x10,0x60,0x22,0x69,0x99,
+  0x00,0x00,0x03,0x43,0x88,0x88,0x40,0x88,0x96,0x07,0x99,0x99,0x20,0xa0,0x8d,0x06,
+  0x60,0x22,0x66,0x99,0x40,0x66,0x80,0x88,0x1b,0x80,0x37,0x00,0x99,0xac,0x37,0x0d,
+  0x99,0x99,0x06,0x99,0x80,0x34,0x88,0x88,0x44,0x08,0x66,0x04,0x66,0x66,0xa4,0x6f,
+  0x84,0x1b,0x03,0x69,0x99,0x88,0x00,0x84,0x1b,0x00,0x00,0x86,0x6b,0xa0,0xa7,0x03,
+  0x02,0x22,0x99,0x96,0x8c,0x1b,0x01,0x00,0x08,0xbd,0x67,0x08,0x96,0x60,0x06,0x99,
+  0x88,0x04,0x88,0x88,0x22,0xc0,0x1b,0x03,0x60,0x02,0x30,0x66,0x84,0x37,0xc4,0x1b,
+  0x03,0x02,0x22,0x30,0x00,0xd4,0x1b,0x82,0xea,0x88,0x00,0x01,0x20,0x80,0xc5,0xd7,
+  0x07,0x00,0x55,0x00,0x00,0x85,0x55,0x20,0x58,0xc6,0xed,0x86,0x7d,0x01,0x88,0x55,
+  0xbc,0x53,0x02,0x00,0x02,0x00,0x83,0x0a,0x80,0x1b,0x01,0x85,0x22,0xba,0xef,0x03,
+  0x00,0x02,0x05,0x55,0x82,0x9b,0x02,0x00,0x05,0x50,0xbf,0x43,0x01,0x00,0x22,0x83,
+  0x5b,0x80,0x38,0x01,0x55,0x05,0xbf,0x43,0x00,0x02,0x86,0xd3,0x80,0x6d,0x01,0x58,
+  0x88,0xca,0xb7,0x80,0xa8,0x01,0x88,0x85,0x81,0x33,0xb8,0xa7,0x88,0x8d,0x84,0x53,
+  0xcb,0x0b,0x94,0xfb,0x81,0x83,0x90,0x00,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,
+  0x04,0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,
+  0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,
+  0x50,0x22,0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,
+  0x55,0xb8,0x00,0x01,0x55,0x02,0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,
+  0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,
+  0x22,0x66,0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,
+  0x66,0x09,0x8a,0xa9,0x05,0xc8,0xdf,0x07,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,
+  0xc0,0x37,0x03,0x02,0x96,0x00,0x99,0x80,0x1b,0x01,0x16,0x95,0xbc,0x35,0x09,0x30,
+  0x30,0x11,0x03,0x99,0x66,0xaa,0x99,0x19,0x9a,0xb4,0x1b,0x0b,0x30,0x00,0x03,0x44,
+  0x10,0x33,0x96,0x61,0x11,0x99,0x19,0x99,0xb4,0x35,0x0b,0x04,0x44,0x44,0x33,0x03,
+  0x40,0x66,0x11,0x69,0x99,0x16,0x91,0xac,0x1b,0x0d,0x40,0x22,0x47,0x77,0x44,0x30,
+  0x33,0x04,0x11,0x10,0x99,0x66,0x21,0x69,0xb4,0xbf,0x08,0x77,0x74,0x44,0x04,0x00,
+  0x33,0x11,0x00,0x11,0x80,0x02,0xad,0xa5,0x08,0x66,0x02,0x74,0x00,0x44,0x04,0x80,
+  0x33,0x00,0x80,0x00,0x03,0x66,0x00,0x20,0x66,0xa4,0x1b,0x0e,0x99,0x60,0x40,0x66,
+  0x34,0x04,0x88,0x03,0x08,0x88,0x60,0x74,0x99,0x66,0x06,0xa0,0x55,0x09,0x02,0x22,
+  0x99,0x96,0x00,0x06,0x34,0x30,0x88,0x80,0x88,0x1b,0x01,0x99,0x06,0xa0,0xa9,0x09,
+  0x02,0x22,0x69,0x96,0x06,0x66,0x04,0x34,0x88,0x88,0x88,0x1b,0x00,0x96,0xb4,0x37,
+  0x0b,0x69,0x99,0x03,0x40,0x88,0x88,0x40,0x88,0x60,0x44,0x66,0x66,0xa4,0x6f,0x84,
+  0x1b,0x03,0x99,0x99,0x80,0x06,0x84,0x1b,0x03,0x02,0x04,0x00,0x00,0xac,0xa7,0x01,
+  0x99,0x60,0x8c,0x1b,0x01,0x00,0x88,0xbd,0xbb,0x04,0x66,0x02,0x69,0x99,0x80,0x80,
+  0x53,0x01,0x20,0x88,0xc5,0xbb,0x03,0x06,0x66,0x80,0x03,0xcc,0x1b,0x80,0x1d,0x00,
+  0x00,0xd4,0x1b,0x86,0xb7,0x84,0x00,0x00,0x08,0xc1,0xf3,0x03,0x00,0x02,0x05,0x50,
+  0x82,0x61,0x01,0x50,0x05,0xb8,0x37,0x8e,0xed,0x03,0x00,0x00,0x85,0x55,0xbc,0x53,
+  0x03,0x00,0x22,0x05,0x00,0x84,0x37,0x03,0x88,0x55,0x20,0x58,0xbc,0x1b,0x02,0x55,
+  0x50,0x00,0x84,0x53,0xb0,0xf5,0x8c,0x53,0x80,0x1b,0x03,0x05,0x55,0x00,0x50,0xcb,
+  0x43,0x80,0x6c,0x04,0x05,0x85,0x50,0x88,0x88,0xc7,0x27,0x04,0x00,0x02,0x00,0x05,
+  0x88,0x84,0x1b,0xc1,0x33,0x80,0x68,0x80,0x6d,0xcf,0x43,0x94,0xfb,0x81,0x83,0x90,
+  0x1b,0x00,0x22,0xfc,0x00,0xfc,0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,
+  0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,
+  0x55,0x00,0x55,0x55,0x05,0x55,0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,
+  0x22,0x00,0xc8,0x1b,0x88,0x00,0x00,0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,
+  0x55,0x55,0x20,0x55,0xcc,0x1b,0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,
+  0x05,0x50,0xc0,0x37,0x09,0x22,0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,
+  0x6f,0x80,0x1b,0x05,0x00,0x09,0x96,0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,0x69,
+  0x96,0xa9,0x96,0x90,0x8a,0xc4,0xc3,0x88,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,0xbc,
+  0x8b,0x09,0x03,0x30,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xb8,0x35,0x08,0x22,
+  0x33,0x03,0x61,0x10,0x99,0x96,0x99,0x11,0xbc,0x1b,0x09,0x33,0x00,0x30,0x34,0x11,
+  0x03,0x99,0x66,0x91,0x69,0xb4,0x53,0x0d,0x00,0x22,0x43,0x04,0x04,0x44,0x10,0x33,
+  0x66,0x11,0x69,0x99,0x22,0x21,0xac,0x1b,0x08,0x74,0x02,0x30,0x47,0x44,0x44,0x00,
+  0x00,0x11,0x80,0x00,0x81,0xc3,0xa8,0x00,0x08,0x40,0x02,0x04,0x77,0x34,0x43,0x08,
+  0x80,0x00,0x80,0x00,0x01,0x66,0x66,0xad,0xa5,0x0b,0x06,0x60,0x47,0x74,0x04,0x40,
+  0x88,0x88,0x74,0x08,0x66,0x60,0x80,0x55,0x00,0x06,0xa4,0xbf,0x04,0x69,0x96,0x47,
+  0x40,0x03,0x88,0x1b,0x02,0x99,0x60,0x99,0xa8,0x1b,0x07,0x60,0x22,0x99,0x99,0x04,
+  0x06,0x80,0x43,0x84,0x1b,0x00,0x96,0xb0,0x37,0x0d,0x60,0x22,0x66,0x99,0x30,0x06,
+  0x80,0x44,0x88,0x88,0x44,0x40,0x66,0x60,0xac,0x6f,0x84,0x37,0x09,0x40,0x66,0x80,
+  0x34,0x88,0x88,0x04,0x40,0x00,0x02,0xac,0xa7,0x88,0x1b,0x05,0x69,0x88,0x04,0x88,
+  0x88,0x20,0xb9,0x67,0x03,0x02,0x22,0x99,0x96,0x8c,0x1b,0xc6,0x63,0x05,0x66,0x60,
+  0x40,0x06,0x88,0x04,0xce,0xb9,0x02,0x00,0x02,0x40,0x80,0xf5,0x82,0x63,0xc8,0x1b,
+  0x04,0x00,0x00,0x85,0x50,0x08,0xc8,0x53,0x00,0x50,0x80,0x35,0x03,0x88,0x55,0x05,
+  0x88,0xc7,0x09,0x06,0x55,0x00,0x50,0x00,0x88,0x85,0x00,0xc0,0x1b,0x00,0x00,0x82,
+  0x63,0x82,0x80,0x00,0x58,0xbc,0xc1,0x84,0x6d,0x83,0x08,0x03,0x00,0x55,0x05,0x00,
+  0xc2,0x99,0x84,0x89,0x80,0x53,0x00,0x88,0x80,0x6f,0xb8,0x8b,0x87,0x5d,0x05,0x50,
+  0x05,0x88,0x85,0x58,0x88,0xbe,0x7f,0x00,0x00,0x83,0x43,0x04,0x00,0x55,0x88,0x55,
+  0x55,0xc0,0x1b,0x84,0xa7,0x80,0x71,0x00,0x50,0x83,0x97,0xc8,0x8d,0x86,0x0d,0xa5,
+  0x33,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,
+  0x1a,0x07,0x02,0x00,0x55,0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,
+  0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,
+  0x05,0xc4,0x1b,0x88,0x1a,0x02,0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,
+  0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,
+  0x37,0x06,0x02,0x66,0x60,0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,
+  0x96,0x60,0x08,0xaa,0x20,0x50,0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,
+  0x09,0xd0,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xbc,0x1b,0x09,0x33,0x00,0x61,0x10,
+  0x99,0x96,0xaa,0xa9,0x21,0x99,0xb9,0x4b,0x08,0x22,0x30,0x30,0x11,0x03,0x99,0x66,
+  0x91,0x19,0xbc,0x1b,0x09,0x30,0x02,0x03,0x43,0x10,0x33,0x96,0x61,0x16,0x99,0xb4,
+  0x53,0x80,0x35,0x0a,0x40,0x44,0x44,0x03,0x30,0x61,0x11,0x99,0x96,0x22,0x16,0xac,
+  0x1b,0x0d,0x40,0x22,0x04,0x77,0x44,0x43,0x00,0x04,0x11,0x10,0x11,0x11,0x00,0x01,
+  0xad,0xa5,0x08,0x00,0x22,0x47,0x74,0x44,0x30,0x88,0x03,0x00,0x80,0x00,0x03,0x66,
+  0x60,0x22,0x06,0xa4,0x1b,0x0f,0x66,0x02,0x77,0x40,0x44,0x04,0x88,0x80,0x40,0x88,
+  0x66,0x07,0x99,0x96,0x20,0x66,0xa4,0x1b,0x04,0x99,0x60,0x74,0x06,0x34,0x88,0x1b,
+  0x04,0x96,0x07,0x99,0x99,0x20,0xa0,0x8d,0x09,0x02,0x22,0x99,0x96,0x40,0x69,0x04,
+  0x30,0x88,0x88,0x88,0x37,0x00,0x99,0xa4,0x37,0x0f,0x02,0x22,0x69,0x96,0x00,0x66,
+  0x04,0x43,0x88,0x88,0x44,0x08,0x66,0x04,0x66,0x66,0xa4,0x6f,0x84,0x37,0x03,0x06,
+  0x69,0x03,0x44,0x84,0x1b,0x00,0x00,0x86,0x6b,0xa0,0xa7,0x88,0x1b,0x01,0x99,0x80,
+  0x80,0x1b,0x01,0x00,0x08,0xbd,0x4b,0x01,0x99,0x60,0x8c,0x1b,0x00,0x22,0xc0,0x1b,
+  0x05,0x66,0x02,0x00,0x66,0x80,0x44,0x80,0x35,0xc2,0x7f,0x82,0xce,0x05,0x00,0x00,
+  0x04,0x55,0x50,0x22,0xc2,0x7f,0x84,0x1b,0x01,0x55,0x00,0x80,0x53,0xc4,0x37,0x06,
+  0x02,0x00,0x05,0x85,0x50,0x58,0x88,0xc6,0xef,0x06,0x50,0x00,0x00,0x05,0x88,0x55,
+  0x08,0xc0,0x1b,0x03,0x02,0x22,0x55,0x00,0x82,0x80,0x00,0x85,0x80,0xd9,0xc0,0x6d,
+  0x04,0x55,0x50,0x50,0x00,0x50,0x86,0x99,0xb8,0x37,0x88,0xa5,0x02,0x00,0x88,0x85,
+  0x80,0x6f,0xb8,0x39,0x87,0x5d,0x05,0x00,0x55,0x88,0x55,0x88,0x88,0xbf,0x43,0x84,
+  0x6f,0x01,0x05,0x55,0x84,0xa7,0xc7,0x5f,0x8b,0x95,0x80,0x03,0x00,0x20,0xd5,0x17,
+  0x80,0x00,0x9c,0x6f,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,0x00,0x02,
+  0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,0x02,
+  0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,0x84,
+  0x1a,0x02,0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,0x00,0x01,
+  0x55,0x02,0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,0x1b,0x07,
+  0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,0x05,0x00,
+  0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,0x8a,0xa9,
+  0x05,0xc8,0xdf,0x07,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,0xcc,0x1b,0x00,0x99,
+  0x80,0x1b,0x01,0x16,0x95,0xbc,0x1b,0x09,0x30,0x02,0x11,0x03,0x99,0x66,0xaa,0x99,
+  0x19,0x9a,0xbc,0x1b,0x09,0x03,0x00,0x10,0x33,0x96,0x61,0x11,0x99,0x19,0x99,0xbc,
+  0x89,0x09,0x34,0x33,0x03,0x30,0x66,0x11,0x69,0x99,0x16,0x91,0xb4,0x1b,0x0b,0x04,
+  0x00,0x44,0x43,0x33,0x04,0x11,0x10,0x99,0x66,0x21,0x69,0xb4,0x87,0x08,0x47,0x74,
+  0x44,0x30,0x00,0x44,0x11,0x00,0x11,0x80,0x02,0xad,0xa5,0x0f,0x02,0x22,0x77,0x40,
+  0x43,0x04,0x80,0x34,0x00,0x08,0x00,0x00,0x66,0x00,0x20,0x66,0xa4,0x1b,0x0e,0x60,
+  0x22,0x74,0x06,0x40,0x47,0x88,0x04,0x08,0x88,0x60,0x74,0x99,0x66,0x06,0xa8,0x55,
+  0x03,0x96,0x02,0x40,0x69,0x80,0x1b,0x00,0x03,0x88,0x1b,0x01,0x99,0x06,0xa8,0xa9,
+  0x07,0x99,0x60,0x06,0x99,0x43,0x04,0x88,0x80,0x88,0x1b,0x00,0x96,0xac,0x37,0x80,
+  0x1b,0x0a,0x66,0x44,0x30,0x88,0x80,0x40,0x88,0x60,0x44,0x66,0x66,0xac,0x6f,0x05,
+  0x99,0x60,0x66,0x99,0x34,0x40,0x84,0x1b,0x03,0x02,0x04,0x00,0x00,0xac,0xa7,0x09,
+  0x99,0x60,0x69,0x99,0x04,0x40,0x88,0x88,0x00,0x88,0xbd,0xbb,0x01,0x96,0x02,0x8c,
+  0x1b,0x01,0x20,0x88,0xbd,0x4b,0x07,0x60,0x22,0x06,0x66,0x04,0x40,0x00,0x88,0xc6,
+  0xb9,0x86,0x9b,0x04,0x00,0x40,0x55,0x00,0x20,0xc2,0x63,0x84,0x1b,0x05,0x50,0x00,
+  0x88,0x85,0x20,0x08,0xc6,0x0f,0x06,0x00,0x50,0x55,0x00,0x88,0x88,0x22,0xc2,0xd3,
+  0x00,0x00,0x82,0x63,0x01,0x85,0x50,0x80,0x1b,0xc0,0x6f,0x04,0x50,0x00,0x00,0x05,
+  0x58,0x82,0x9b,0xbc,0xc1,0x01,0x02,0x22,0x80,0x16,0x00,0x05,0x87,0x0d,0xbc,0x37,
+  0x88,0xa5,0x01,0x00,0x88,0x80,0x53,0xbf,0x43,0x84,0x1b,0x00,0x05,0x88,0x6f,0x01,
+  0x00,0x58,0xc4,0x6f,0x87,0x0a,0x80,0x1b,0xc0,0xdf,0x00,0x00,0x83,0x27,0x83,0xb2,
+  0x01,0x55,0x00,0xc0,0xc3,0x8c,0x71,0x01,0x00,0x00,0x9d,0x33,0x00,0x22,0xfc,0x00,
+  0xfc,0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,
+  0x50,0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,
+  0x55,0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xbc,0x51,0x80,
+  0x1b,0x88,0x00,0x00,0x22,0xb8,0x55,0x80,0x1b,0x90,0x00,0x01,0x20,0x55,0xcc,0x1b,
+  0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,
+  0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,
+  0x96,0xa9,0x66,0x00,0xb8,0x1b,0x00,0x02,0x80,0xde,0x07,0x00,0x02,0x69,0x96,0xa9,
+  0x96,0x90,0x8a,0xb4,0xc3,0x05,0x40,0x22,0x00,0x04,0x00,0x00,0x80,0x1b,0x04,0x99,
+  0x95,0x8a,0x22,0x16,0xb4,0x1b,0x0b,0x30,0x47,0x03,0x03,0x66,0x11,0x99,0x99,0x9a,
+  0xaa,0x22,0x19,0xb5,0x2f,0x09,0x04,0x77,0x34,0x30,0x61,0x10,0x99,0x96,0x99,0x11,
+  0xac,0x1b,0x0d,0x02,0x22,0x66,0x60,0x04,0x70,0x44,0x04,0x11,0x03,0x99,0x66,0x91,
+  0x69,0xac,0x53,0x0f,0x60,0x22,0x69,0x96,0x04,0x70,0x40,0x44,0x10,0x34,0x66,0x11,
+  0x69,0x99,0x22,0x21,0xa4,0x1b,0x0a,0x96,0x02,0x69,0x99,0x30,0x40,0x04,0x44,0x00,
+  0x04,0x11,0x80,0x00,0x81,0xc3,0xa0,0x00,0x0a,0x66,0x60,0x06,0x66,0x33,0x00,0x03,
+  0x44,0x08,0x80,0x00,0x80,0x00,0x01,0x66,0x66,0xa5,0xa5,0x0d,0x99,0x60,0x20,0x69,
+  0x43,0x02,0x80,0x34,0x88,0x88,0x74,0x08,0x66,0x60,0x80,0x55,0x00,0x06,0xac,0x1b,
+  0x01,0x44,0x30,0x8c,0x1b,0x02,0x99,0x60,0x99,0xb0,0x1b,0x05,0x00,0x69,0x44,0x43,
+  0x88,0x03,0x84,0x1b,0x00,0x96,0xb0,0x37,0x05,0x66,0x02,0x30,0x06,0x44,0x44,0x84,
+  0x1b,0x00,0x44,0x80,0x53,0xac,0x6f,0x04,0x00,0x22,0x43,0x00,0x34,0x80,0x1b,0x01,
+  0x00,0x88,0x80,0x8a,0x00,0x02,0xac,0xa7,0x03,0x22,0x22,0x43,0x02,0x80,0x1b,0x03,
+  0x80,0x50,0x08,0x00,0xc1,0xbb,0x03,0x30,0x22,0x34,0x43,0x80,0x1b,0x02,0x00,0x05,
+  0x88,0xc6,0x9b,0x07,0x34,0x33,0x08,0x80,0x55,0x00,0x08,0x88,0xbe,0x81,0x02,0x00,
+  0x02,0x33,0x80,0x6a,0x03,0x85,0x50,0x58,0x88,0xb6,0xbb,0x86,0xeb,0x03,0x00,0x40,
+  0x02,0x04,0x84,0x1b,0xb6,0x9f,0x00,0x00,0x82,0x47,0x0a,0x44,0x00,0x02,0x20,0x85,
+  0x50,0x85,0x58,0x58,0x88,0x20,0xa8,0x1b,0x01,0x50,0x02,0x87,0x07,0x06,0x02,0x20,
+  0x55,0x50,0x88,0x85,0x05,0xb0,0x1b,0x8f,0x07,0x04,0x02,0x20,0x50,0x00,0x88,0x80,
+  0x6f,0xa4,0x1b,0x83,0x3f,0x07,0x00,0x00,0x05,0x00,0x55,0x02,0x22,0x85,0x80,0xc3,
+  0x80,0xf9,0xa8,0x1b,0x8a,0xce,0x80,0x11,0x00,0x85,0x80,0xe0,0xaf,0x81,0x90,0x1b,
+  0x83,0x5b,0x00,0x55,0x80,0x40,0xac,0x6d,0x84,0x53,0x8f,0x77,0x89,0x4b,0xb0,0xfb,
+  0x01,0x00,0x00,0x80,0x52,0x84,0x1b,0x84,0x02,0xb5,0x15,0x84,0xfb,0xb0,0x15,0x00,
+  0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,
+  0x02,0x00,0x55,0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,
+  0x01,0x55,0x55,0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc0,
+  0x1b,0x88,0x35,0x80,0x1b,0x00,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,
+  0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,
+  0x02,0x66,0x60,0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,
+  0x08,0xaa,0x20,0x50,0xc5,0x12,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xb1,
+  0x11,0x04,0x22,0x00,0x44,0x00,0x00,0x80,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xb4,
+  0x1b,0x0b,0x04,0x74,0x30,0x33,0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,0xb5,0x2f,
+  0x09,0x47,0x70,0x43,0x00,0x11,0x03,0x99,0x66,0x91,0x19,0xb4,0x1b,0x0b,0x66,0x00,
+  0x47,0x06,0x40,0x40,0x10,0x34,0x96,0x61,0x16,0x99,0xac,0x53,0x0f,0x02,0x22,0x99,
+  0x66,0x47,0x06,0x04,0x40,0x03,0x44,0x61,0x11,0x99,0x96,0x22,0x16,0xa4,0x1b,0x0f,
+  0x60,0x22,0x99,0x99,0x04,0x06,0x44,0x43,0x00,0x40,0x11,0x10,0x11,0x11,0x00,0x01,
+  0xa5,0xa5,0x09,0x66,0x02,0x66,0x66,0x30,0x00,0x34,0x43,0x88,0x00,0x84,0x00,0x03,
+  0x66,0x60,0x22,0x06,0x9c,0x1b,0x11,0x96,0x02,0x06,0x99,0x30,0x22,0x03,0x44,0x88,
+  0x88,0x40,0x88,0x66,0x07,0x99,0x96,0x20,0x66,0xac,0x1b,0x01,0x43,0x02,0x8c,0x1b,
+  0x04,0x96,0x07,0x99,0x99,0x20,0xa0,0x8d,0x84,0x1b,0x03,0x44,0x30,0x80,0x34,0x90,
+  0x37,0x00,0x99,0xa4,0x37,0x05,0x60,0x22,0x00,0x66,0x44,0x43,0x90,0x1b,0x02,0x04,
+  0x66,0x66,0xa4,0x6f,0x08,0x02,0x22,0x30,0x00,0x44,0x44,0x80,0x33,0x08,0x84,0x8c,
+  0x85,0x58,0xaa,0x4d,0x07,0x30,0x22,0x44,0x44,0x88,0x03,0x00,0x88,0x81,0xbb,0xba,
+  0x65,0x03,0x02,0x22,0x44,0x33,0x80,0x1b,0x02,0x08,0x58,0x85,0xc6,0x81,0x07,0x43,
+  0x30,0x88,0x03,0x50,0x00,0x88,0x85,0xbe,0x81,0x00,0x00,0x80,0x71,0x05,0x00,0x03,
+  0x55,0x00,0x88,0x88,0xbe,0xbb,0x05,0x00,0x00,0x04,0x00,0x20,0x40,0x84,0x1b,0xb6,
+  0x9f,0x00,0x02,0x82,0x47,0x03,0x40,0x05,0x22,0x04,0x82,0xa1,0x00,0x88,0x80,0x39,
+  0xa8,0x1b,0x01,0x00,0x22,0x8b,0x07,0x00,0x00,0x80,0x37,0x01,0x55,0x58,0x80,0xc7,
+  0xae,0x45,0x8f,0x07,0x00,0x00,0x80,0x8b,0x01,0x00,0x58,0xac,0x1b,0x80,0x14,0x06,
+  0x55,0x05,0x50,0x22,0x20,0x50,0x00,0x84,0x35,0x00,0x20,0xac,0x37,0x87,0x5b,0x04,
+  0x05,0x22,0x20,0x55,0x02,0x88,0x35,0xb8,0x1b,0x81,0x11,0x00,0x00,0x80,0x1b,0x00,
+  0x05,0xac,0x51,0x84,0x53,0x90,0x6f,0x88,0x02,0xb0,0x1b,0x00,0x02,0x8b,0x21,0x00,
+  0x00,0x82,0xa5,0xb9,0x15,0x84,0x13,0xb5,0x7d,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,
+  0x00,0x04,0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,
+  0x22,0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,
+  0x02,0x50,0x22,0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc0,0x1b,0x00,0x02,0x88,0x1a,
+  0x00,0x55,0x80,0x55,0xb8,0x00,0x00,0x55,0x90,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,
+  0x1b,0x84,0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,
+  0x09,0x50,0x22,0x66,0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,
+  0x96,0x05,0x66,0x09,0x8a,0xa9,0x05,0xb8,0xdf,0x0b,0x00,0x02,0x02,0x22,0x96,0x00,
+  0x96,0x69,0x8a,0xa9,0x00,0x90,0xb4,0x1b,0x06,0x04,0x40,0x00,0x00,0x96,0x00,0x99,
+  0x80,0x1b,0x01,0x16,0x95,0xb4,0x1b,0x0b,0x47,0x40,0x03,0x30,0x11,0x03,0x99,0x66,
+  0xaa,0x99,0x19,0x9a,0xb5,0x2f,0x0b,0x77,0x00,0x30,0x04,0x10,0x34,0x96,0x61,0x11,
+  0x99,0x19,0x99,0xac,0x1b,0x0d,0x60,0x02,0x70,0x66,0x04,0x04,0x03,0x44,0x66,0x11,
+  0x69,0x99,0x16,0x91,0xac,0x1b,0x0d,0x96,0x60,0x70,0x69,0x44,0x04,0x34,0x40,0x11,
+  0x10,0x99,0x66,0x21,0x69,0xac,0x51,0x0a,0x99,0x96,0x40,0x69,0x44,0x30,0x04,0x04,
+  0x11,0x00,0x11,0x80,0x02,0xa5,0xa5,0x11,0x60,0x22,0x66,0x66,0x00,0x06,0x44,0x33,
+  0x80,0x03,0x00,0x08,0x00,0x00,0x66,0x00,0x20,0x66,0xa4,0x1b,0x0e,0x69,0x99,0x02,
+  0x20,0x34,0x43,0x88,0x80,0x08,0x88,0x60,0x74,0x99,0x66,0x06,0xa0,0x55,0x84,0x1b,
+  0x03,0x30,0x20,0x34,0x44,0x90,0x1b,0x01,0x99,0x06,0xa0,0xa9,0x84,0x1b,0x05,0x43,
+  0x00,0x03,0x44,0x88,0x88,0x88,0x1b,0x00,0x96,0xa4,0x37,0x05,0x02,0x22,0x06,0x66,
+  0x44,0x30,0x90,0x1b,0x02,0x44,0x66,0x66,0xa4,0x6f,0x81,0x4d,0x0c,0x00,0x44,0x43,
+  0x03,0x34,0x88,0x88,0x00,0x00,0x02,0x00,0x00,0x00,0xae,0x4d,0x07,0x02,0x22,0x44,
+  0x43,0x80,0x34,0x08,0x88,0x81,0xbb,0xc2,0x65,0x06,0x43,0x30,0x80,0x34,0x00,0x88,
+  0x88,0x82,0x50,0xbc,0x1b,0x01,0x33,0x02,0x80,0x1b,0x80,0x38,0x01,0x20,0x08,0xc6,
+  0x9b,0x07,0x00,0x33,0x50,0x00,0x88,0x85,0x05,0x58,0xb4,0x55,0x0b,0x00,0x02,0x40,
+  0x00,0x04,0x00,0x50,0x02,0x88,0x85,0x55,0x58,0xb6,0x9f,0x86,0x5e,0x09,0x20,0x44,
+  0x50,0x02,0x58,0x85,0x88,0x85,0x00,0x58,0xa6,0x4b,0x01,0x02,0x22,0x87,0x07,0x00,
+  0x20,0x80,0x37,0x01,0x85,0x55,0x80,0xc7,0x00,0x05,0xa4,0x1b,0x01,0x00,0x22,0x8f,
+  0x07,0x04,0x00,0x02,0x88,0x50,0x05,0x80,0xe3,0xa8,0x1b,0x03,0x02,0x05,0x50,0x55,
+  0x80,0xf1,0x80,0x1b,0x02,0x85,0x00,0x05,0x80,0x1b,0xa8,0x89,0x8b,0x21,0x00,0x00,
+  0x80,0xdc,0x02,0x85,0x00,0x00,0xaf,0x81,0x84,0x1b,0x80,0x53,0x80,0x1b,0x00,0x00,
+  0x80,0x94,0xae,0xd5,0x80,0x1b,0x00,0x50,0x84,0x6f,0x84,0xe5,0xb7,0xb7,0x84,0x6a,
+  0x84,0x37,0x85,0x73,0xbf,0x0b,0x81,0x15,0xb1,0x7d,0x00,0x22,0xfc,0x00,0xfc,0x00,
+  0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,
+  0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,0x55,0xc4,
+  0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xbc,0x51,0x80,0x1b,0x88,
+  0x00,0x00,0x22,0xb8,0x55,0x80,0x1b,0x90,0x00,0x01,0x20,0x55,0xcc,0x1b,0x80,0x70,
+  0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,0x22,0x05,
+  0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,0x96,0xa9,
+  0x66,0x00,0xb8,0x1b,0x00,0x02,0x80,0xde,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,
+  0x8a,0xb4,0xc3,0x05,0x40,0x22,0x00,0x04,0x00,0x00,0x80,0x1b,0x04,0x99,0x95,0x8a,
+  0x22,0x16,0xac,0x1b,0x0d,0x44,0x02,0x30,0x44,0x03,0x30,0x66,0x11,0x99,0x99,0x9a,
+  0xaa,0x22,0x19,0xac,0x1b,0x0b,0x70,0x00,0x04,0x47,0x34,0x30,0x61,0x10,0x99,0x96,
+  0x99,0x11,0xac,0x1b,0x0d,0x00,0x22,0x06,0x66,0x04,0x77,0x44,0x04,0x11,0x03,0x99,
+  0x66,0x91,0x69,0xac,0x53,0x0f,0x66,0x00,0x69,0x99,0x04,0x70,0x40,0x44,0x10,0x34,
+  0x66,0x11,0x69,0x99,0x22,0x21,0xa4,0xa3,0x0a,0x96,0x66,0x66,0x99,0x30,0x40,0x04,
+  0x44,0x00,0x04,0x11,0x80,0x00,0x81,0xc3,0x98,0x00,0x0c,0x60,0x22,0x66,0x99,0x00,
+  0x69,0x30,0x00,0x34,0x43,0x08,0x80,0x00,0x80,0x00,0x01,0x66,0x66,0x9d,0xa5,0x01,
+  0x60,0x22,0x80,0x47,0x0a,0x06,0x33,0x02,0x03,0x44,0x88,0x88,0x74,0x00,0x66,0x60,
+  0x84,0x0d,0xa8,0x1b,0x04,0x20,0x44,0x30,0x80,0x34,0x80,0x1b,0x03,0x08,0x99,0x60,
+  0x99,0xc0,0x1b,0x01,0x88,0x04,0x84,0x1b,0x00,0x96,0xa8,0x37,0x00,0x02,0x80,0xc1,
+  0x0b,0x02,0x22,0x44,0x43,0x88,0x03,0x88,0x88,0x44,0x08,0x66,0x60,0xa4,0x6f,0x85,
+  0x4a,0x0b,0x30,0x02,0x44,0x44,0x88,0x80,0x88,0x88,0x04,0x08,0x00,0x02,0xa4,0xa7,
+  0x00,0x00,0x81,0xb9,0x01,0x30,0x40,0x84,0x1b,0x01,0x08,0x88,0xa4,0x17,0x8a,0x43,
+  0x81,0xec,0x01,0x04,0x40,0x80,0x53,0x02,0x80,0x50,0x88,0x82,0x2d,0xa0,0x4f,0x8e,
+  0x0b,0x09,0x44,0x05,0x03,0x30,0x88,0x88,0x50,0x88,0x58,0x85,0xa4,0x1b,0x00,0x50,
+  0x88,0x1b,0x0c,0x40,0x55,0x20,0x00,0x80,0x00,0x55,0x08,0x88,0x88,0x00,0x05,0x20,
+  0x98,0x57,0x8c,0x1b,0x82,0xb1,0x84,0x41,0x01,0x00,0x58,0x80,0x55,0x84,0x0b,0x90,
+  0x6d,0x00,0x02,0x9e,0x77,0x80,0x0b,0x01,0x88,0x88,0x80,0x7e,0xac,0x1b,0x8e,0x23,
+  0x80,0x0b,0x03,0x58,0x58,0x88,0x20,0x9a,0x2f,0x8e,0xcd,0x8c,0x81,0x05,0x55,0x02,
+  0x85,0x58,0x05,0x88,0x9c,0x6f,0x84,0x1b,0x94,0x61,0x84,0x1b,0x01,0x00,0x58,0x9e,
+  0x4b,0x84,0x1b,0x96,0xad,0x02,0x50,0x22,0x85,0x87,0x63,0x98,0xc5,0x84,0x1b,0x96,
+  0x91,0x84,0xb3,0xa5,0x19,0x88,0x1b,0x90,0x29,0x02,0x02,0x22,0x05,0x80,0xe7,0xa0,
+  0x1b,0x00,0x02,0x9c,0xcf,0x83,0xd3,0xab,0x7d,0x83,0xe0,0xa4,0x0d,0x98,0x0b,0x00,
+  0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,
+  0x02,0x00,0x55,0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,
+  0x01,0x55,0x55,0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc0,
+  0x1b,0x88,0x35,0x80,0x1b,0x00,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,
+  0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,
+  0x02,0x66,0x60,0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,
+  0x08,0xaa,0x20,0x50,0xc5,0x12,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xb1,
+  0x11,0x04,0x22,0x00,0x44,0x00,0x00,0x80,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xac,
+  0x1b,0x0d,0x40,0x22,0x04,0x44,0x33,0x03,0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,
+  0xb1,0x2f,0x0a,0x02,0x44,0x77,0x43,0x00,0x11,0x03,0x99,0x66,0x91,0x19,0xac,0x1b,
+  0x0d,0x02,0x22,0x66,0x60,0x47,0x70,0x40,0x40,0x10,0x34,0x96,0x61,0x16,0x99,0xac,
+  0x53,0x0f,0x60,0x02,0x99,0x96,0x47,0x06,0x04,0x40,0x03,0x44,0x61,0x11,0x99,0x96,
+  0x22,0x16,0xa4,0x1b,0x0f,0x66,0x60,0x69,0x99,0x04,0x06,0x44,0x43,0x00,0x40,0x11,
+  0x10,0x11,0x11,0x00,0x01,0x9d,0xa5,0x0c,0x02,0x22,0x69,0x96,0x06,0x96,0x00,0x00,
+  0x44,0x33,0x88,0x03,0x00,0x80,0x00,0x03,0x66,0x60,0x22,0x06,0x9c,0x1b,0x0d,0x99,
+  0x96,0x20,0x66,0x30,0x22,0x34,0x43,0x88,0x80,0x40,0x08,0x66,0x07,0x84,0x0d,0xa4,
+  0x1b,0x0e,0x22,0x06,0x43,0x02,0x03,0x44,0x88,0x88,0x40,0x88,0x96,0x07,0x99,0x99,
+  0x20,0x98,0x8d,0x94,0x1b,0x00,0x80,0x88,0x1b,0x80,0x37,0x00,0x99,0x9c,0x37,0x84,
+  0x8b,0x05,0x22,0x20,0x44,0x30,0x80,0x34,0x88,0x1b,0x02,0x04,0x66,0x66,0x9c,0x6f,
+  0x84,0xf9,0x05,0x00,0x20,0x44,0x43,0x88,0x04,0x84,0x1b,0x00,0x00,0x85,0x58,0xa0,
+  0xa7,0x03,0x55,0x50,0x04,0x05,0x8c,0x1b,0xa4,0x17,0x8d,0x9b,0x09,0x55,0x55,0x44,
+  0x05,0x44,0x30,0x88,0x04,0x08,0x88,0x82,0x65,0xaa,0x49,0x86,0x0b,0x08,0x40,0x55,
+  0x33,0x04,0x88,0x80,0x08,0x88,0x88,0xa8,0x1b,0x80,0x51,0x8a,0x3f,0x09,0x00,0x04,
+  0x00,0x02,0x50,0x88,0x88,0x85,0x00,0x58,0x80,0x57,0xa8,0x1b,0x80,0x4b,0x80,0x67,
+  0x03,0x50,0x00,0x88,0x85,0x94,0x0b,0x88,0x6d,0x90,0x37,0x8c,0x0b,0x05,0x58,0x85,
+  0x85,0x55,0x05,0x58,0xac,0x1b,0x8e,0x3f,0x80,0x0b,0x00,0x85,0x80,0x55,0x9a,0x4b,
+  0x00,0x55,0x80,0xa5,0x94,0x9d,0x84,0x1b,0x00,0x58,0x84,0xc7,0xac,0x1b,0x88,0x45,
+  0x84,0x1b,0x02,0x05,0x88,0x20,0xa8,0x1b,0x96,0xad,0x84,0x97,0x01,0x00,0x58,0x9f,
+  0x47,0x84,0x1b,0x96,0xad,0x88,0x1b,0x00,0x05,0x9d,0x19,0x84,0x1b,0x9c,0xef,0x82,
+  0xf7,0xa3,0x7d,0x84,0xa7,0x9c,0x29,0x01,0x05,0x50,0x9c,0x6d,0x8a,0xb5,0xa0,0x0d,
+  0x01,0x00,0x02,0x94,0x27,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,0x00,
+  0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,
+  0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,
+  0x84,0x1a,0x02,0x55,0x00,0x55,0xc0,0x1b,0x00,0x02,0x88,0x1a,0x00,0x55,0x80,0x55,
+  0xb8,0x00,0x00,0x55,0x90,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,
+  0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,
+  0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,
+  0x8a,0xa9,0x05,0xb8,0xdf,0x0b,0x00,0x02,0x02,0x22,0x96,0x00,0x96,0x69,0x8a,0xa9,
+  0x00,0x90,0xb4,0x1b,0x06,0x04,0x40,0x00,0x00,0x96,0x00,0x99,0x80,0x1b,0x01,0x16,
+  0x95,0xb5,0x13,0x0b,0x44,0x44,0x30,0x30,0x11,0x03,0x99,0x66,0xaa,0x99,0x19,0x9a,
+  0xb4,0x6b,0x0b,0x47,0x70,0x30,0x04,0x10,0x34,0x96,0x61,0x11,0x99,0x19,0x99,0xac,
+  0x1b,0x0d,0x66,0x00,0x77,0x06,0x04,0x04,0x03,0x44,0x66,0x11,0x69,0x99,0x16,0x91,
+  0xac,0x35,0x0d,0x99,0x66,0x70,0x69,0x44,0x04,0x34,0x40,0x11,0x10,0x99,0x66,0x21,
+  0x69,0xa8,0x35,0x0b,0x02,0x99,0x96,0x40,0x66,0x44,0x30,0x04,0x04,0x11,0x00,0x11,
+  0x80,0x02,0xa5,0xa5,0x11,0x99,0x60,0x69,0x66,0x00,0x00,0x43,0x30,0x80,0x34,0x00,
+  0x08,0x00,0x00,0x66,0x00,0x20,0x66,0xa4,0x1b,0x01,0x06,0x69,0x80,0xa9,0x09,0x33,
+  0x88,0x03,0x00,0x88,0x60,0x74,0x99,0x66,0x06,0xa0,0x55,0x0a,0x99,0x60,0x20,0x69,
+  0x30,0x22,0x34,0x44,0x88,0x80,0x08,0x84,0x1b,0x01,0x99,0x06,0xa0,0xa9,0x8c,0x1b,
+  0x03,0x04,0x44,0x88,0x88,0x88,0x1b,0x00,0x96,0xa4,0x37,0x06,0x66,0x02,0x22,0x06,
+  0x43,0x02,0x03,0x8c,0x1b,0x02,0x44,0x66,0x66,0xa4,0x6f,0x00,0x00,0x82,0x60,0x02,
+  0x44,0x30,0x80,0x88,0x1b,0x03,0x02,0x04,0x00,0x00,0xa4,0xa7,0x03,0x55,0x00,0x40,
+  0x55,0x8c,0x1b,0x01,0x00,0x08,0xae,0x65,0x07,0x00,0x22,0x55,0x55,0x40,0x55,0x43,
+  0x04,0x84,0x1b,0x02,0x55,0x50,0x20,0xaa,0x2d,0x86,0x0b,0x0b,0x05,0x55,0x30,0x44,
+  0x88,0x03,0x88,0x88,0x85,0x50,0x20,0x58,0xa8,0x1b,0x00,0x50,0x8a,0x27,0x08,0x40,
+  0x00,0x20,0x08,0x80,0x88,0x55,0x05,0x88,0x80,0x6f,0x9a,0x13,0x8c,0x1b,0x00,0x22,
+  0x82,0xb1,0x05,0x00,0x02,0x88,0x55,0x55,0x58,0x8c,0x0b,0x8d,0xb9,0x9e,0x77,0x01,
+  0x02,0x22,0x80,0x1b,0x02,0x55,0x55,0x88,0x94,0x8f,0x8c,0x1b,0x8e,0xaf,0x03,0x02,
+  0x22,0x58,0x55,0x80,0x55,0x00,0x58,0x94,0x53,0x00,0x50,0x88,0x1b,0x8c,0x9d,0x88,
+  0x1b,0x02,0x85,0x00,0x05,0xac,0x1b,0x8c,0x61,0x84,0x1b,0x01,0x58,0x85,0x80,0x8b,
+  0x9a,0x95,0xa6,0xe5,0x83,0x63,0x00,0x85,0x9f,0x81,0x84,0x1b,0x9f,0x1d,0x01,0x55,
+  0x50,0x83,0x45,0xa8,0x1b,0x9d,0x0b,0x82,0xf7,0x98,0x6d,0x8c,0xa7,0x94,0xcf,0x88,
+  0x1b,0xad,0x4f,0xa1,0x07,0x80,0x18,0x90,0x1b,0x00,0x22,0xfc,0x00,0xfc,0x00,0xe8,
+  0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,0x55,
+  0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,0x55,0xc4,0x39,
+  0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xc8,0x1b,0x88,0x00,0x00,0x22,
+  0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,0x55,0x55,0x20,0x55,0xcc,0x1b,0x80,0x70,
+  0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,0x22,0x05,
+  0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,0x96,0xa9,
+  0x66,0x00,0xb8,0x1b,0x00,0x02,0x80,0xde,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,
+  0x8a,0xac,0xc3,0x07,0x02,0x22,0x40,0x00,0x00,0x44,0x00,0x30,0x80,0x1b,0x04,0x99,
+  0x95,0x8a,0x22,0x16,0xa4,0x1b,0x0f,0x60,0x00,0x40,0x66,0x04,0x77,0x03,0x44,0x66,
+  0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xa1,0x2b,0x0e,0x22,0x96,0x66,0x06,0x99,0x04,
+  0x77,0x34,0x40,0x61,0x10,0x99,0x96,0x99,0x11,0xa4,0x1b,0x0f,0x66,0x02,0x96,0x99,
+  0x06,0x69,0x04,0x77,0x44,0x03,0x11,0x03,0x99,0x66,0x91,0x69,0xa4,0x53,0x11,0x99,
+  0x60,0x69,0x99,0x00,0x06,0x00,0x44,0x40,0x33,0x10,0x04,0x66,0x11,0x69,0x99,0x22,
+  0x21,0xa4,0x1b,0x0a,0x06,0x99,0x02,0x20,0x30,0x00,0x04,0x44,0x00,0x00,0x11,0x80,
+  0x00,0x81,0xc3,0xa0,0x1b,0x0a,0x20,0x69,0x22,0x22,0x44,0x00,0x80,0x04,0x00,0x88,
+  0x00,0x80,0x00,0x01,0x66,0x66,0x9d,0xa5,0x0e,0x66,0x02,0x20,0x66,0x00,0x22,0x44,
+  0x43,0x88,0x80,0x08,0x88,0x74,0x03,0x66,0x80,0x61,0x01,0x22,0x06,0x9c,0xa7,0x02,
+  0x22,0x00,0x33,0x80,0x51,0x01,0x88,0x88,0x84,0x1b,0x02,0x99,0x60,0x99,0xa0,0x1b,
+  0x84,0xfb,0x02,0x44,0x33,0x80,0x90,0x1b,0x00,0x96,0xac,0x37,0x04,0x02,0x02,0x20,
+  0x44,0x43,0x8c,0x1b,0x00,0x44,0x80,0x53,0x9c,0x6f,0x81,0x9b,0x02,0x50,0x02,0x05,
+  0x80,0x6d,0x00,0x03,0x84,0x1b,0x03,0x04,0x03,0x00,0x02,0x9c,0xa7,0x00,0x50,0x81,
+  0xb7,0x03,0x20,0x55,0x44,0x30,0x84,0x1b,0x02,0x00,0x88,0x20,0xa9,0x67,0x01,0x55,
+  0x02,0x86,0x5b,0x00,0x43,0x88,0x1b,0x01,0x55,0x08,0xad,0xd7,0x86,0x41,0x03,0x05,
+  0x55,0x33,0x04,0x84,0x1b,0x02,0x85,0x50,0x05,0x81,0xfb,0x9c,0x53,0x8c,0x1b,0x09,
+  0x00,0x44,0x88,0x80,0x88,0x88,0x88,0x50,0x05,0x58,0x86,0x33,0x8c,0x8b,0x96,0x5d,
+  0x04,0x04,0x40,0x80,0x02,0x08,0x80,0x54,0x00,0x55,0x80,0x03,0x01,0x00,0x58,0xb0,
+  0x1b,0x00,0x05,0x87,0x0b,0x02,0x88,0x55,0x58,0x80,0x58,0x96,0xf5,0x94,0x1b,0x00,
+  0x20,0x80,0x0f,0x06,0x02,0x22,0x85,0x50,0x55,0x88,0x58,0x81,0x53,0xaa,0x95,0x00,
+  0x05,0x8e,0x23,0x04,0x55,0x00,0x85,0x58,0x05,0x98,0xc7,0x84,0x1b,0x9f,0x1d,0x01,
+  0x55,0x02,0x84,0x6d,0xa4,0x1b,0x84,0x4f,0x91,0x07,0x01,0x02,0x85,0x98,0x43,0x8c,
+  0x1b,0x9d,0xad,0x00,0x00,0x8a,0xdb,0xa0,0x0f,0xa1,0x25,0x00,0x02,0x82,0xdb,0xa4,
+  0x0f,0xb3,0x9f,0x00,0x00,0xad,0x51,0xaf,0xbb,0x94,0x51,0x00,0x22,0xfc,0x00,0xfc,
+  0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,
+  0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,
+  0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,
+  0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,
+  0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,
+  0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,
+  0xc5,0x12,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xb0,0xf7,0x04,0x00,0x04,
+  0x44,0x03,0x00,0x80,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xa8,0x19,0x0e,0x02,0x06,
+  0x66,0x47,0x74,0x34,0x40,0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,0xa1,0x45,0x0e,
+  0x22,0x66,0x60,0x69,0x99,0x47,0x70,0x44,0x00,0x11,0x03,0x99,0x66,0x91,0x19,0xa4,
+  0x1b,0x04,0x60,0x22,0x69,0x96,0x66,0x80,0x1b,0x07,0x40,0x30,0x10,0x34,0x96,0x61,
+  0x16,0x99,0xa4,0x53,0x11,0x96,0x02,0x99,0x99,0x00,0x66,0x04,0x40,0x03,0x30,0x00,
+  0x44,0x61,0x11,0x99,0x96,0x22,0x16,0xa4,0x1b,0x01,0x69,0x99,0x80,0x8c,0x0a,0x00,
+  0x44,0x43,0x00,0x00,0x11,0x10,0x11,0x11,0x00,0x01,0x9d,0xa5,0x02,0x96,0x02,0x06,
+  0x80,0x61,0x05,0x40,0x02,0x00,0x44,0x08,0x88,0x80,0x22,0x04,0x00,0x66,0x60,0x22,
+  0x06,0x9c,0x6f,0x11,0x06,0x66,0x02,0x22,0x44,0x30,0x88,0x04,0x88,0x88,0x40,0x30,
+  0x66,0x07,0x99,0x96,0x20,0x66,0x9c,0xa7,0x07,0x20,0x00,0x30,0x02,0x44,0x43,0x88,
+  0x80,0x84,0x1b,0x04,0x96,0x07,0x99,0x99,0x20,0xa8,0xe1,0x04,0x43,0x30,0x04,0x44,
+  0x88,0x80,0x00,0x88,0x37,0x00,0x99,0x9c,0x37,0x82,0x02,0x01,0x00,0x44,0x9c,0x1b,
+  0x02,0x04,0x66,0x66,0x9c,0x6f,0x07,0x55,0x00,0x20,0x55,0x44,0x30,0x80,0x34,0x8c,
+  0x1b,0x00,0x00,0x85,0x58,0x90,0xa7,0x01,0x02,0x22,0x85,0xd1,0x01,0x43,0x02,0x84,
+  0x1b,0x84,0xa7,0xa9,0x99,0x80,0x1b,0x03,0x55,0x55,0x33,0x00,0x84,0x1b,0x01,0x50,
+  0x88,0xad,0xd7,0x8e,0x41,0x09,0x30,0x40,0x80,0x33,0x88,0x88,0x55,0x08,0x55,0x58,
+  0x84,0xe1,0x94,0x53,0x8c,0x1b,0x0a,0x04,0x40,0x88,0x00,0x88,0x88,0x85,0x08,0x55,
+  0x88,0x55,0x82,0x15,0x96,0xa1,0x8e,0x5d,0x03,0x44,0x05,0x00,0x20,0x80,0x1b,0x06,
+  0x50,0x58,0x88,0x85,0x55,0x05,0x88,0xac,0x1b,0x00,0x40,0x82,0xe9,0x03,0x00,0x00,
+  0x85,0x50,0x80,0xaa,0x02,0x55,0x00,0x58,0x98,0x53,0x88,0x1b,0x83,0x05,0x88,0xcd,
+  0x00,0x58,0x80,0x3c,0x01,0x00,0x05,0xa4,0x1b,0x02,0x00,0x55,0x20,0x88,0x45,0x04,
+  0x50,0x02,0x55,0x85,0x58,0xa0,0xc7,0x84,0x1b,0x94,0x5f,0x01,0x50,0x22,0x84,0x6d,
+  0xa4,0x1b,0x8c,0x4f,0x8d,0x3d,0x80,0x43,0x00,0x58,0x8c,0x43,0x8c,0x1b,0x00,0x22,
+  0x9b,0x37,0x81,0x23,0x82,0xdb,0x9f,0x63,0x00,0x00,0x81,0xa2,0xa1,0x09,0xa0,0xf9,
+  0xbb,0x9f,0x00,0x02,0xad,0x51,0xaf,0xbb,0x94,0x51,0x00,0x22,0xfc,0x00,0xfc,0x00,
+  0xf4,0x00,0x04,0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,
+  0x55,0x22,0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,
+  0x1b,0x02,0x50,0x22,0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,
+  0x55,0x80,0x55,0xb8,0x00,0x01,0x55,0x02,0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,
+  0x1b,0x84,0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,
+  0x09,0x50,0x22,0x66,0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,
+  0x96,0x05,0x66,0x09,0x8a,0xa9,0x05,0xb8,0xdf,0x0b,0x00,0x02,0x02,0x22,0x96,0x00,
+  0x96,0x69,0x8a,0xa9,0x00,0x90,0xb4,0x19,0x06,0x44,0x40,0x30,0x00,0x96,0x00,0x99,
+  0x80,0x1b,0x01,0x16,0x95,0xac,0x4d,0x0d,0x66,0x60,0x77,0x40,0x44,0x04,0x11,0x03,
+  0x99,0x66,0xaa,0x99,0x19,0x9a,0xa4,0x1b,0x0f,0x66,0x00,0x99,0x96,0x77,0x06,0x40,
+  0x04,0x10,0x34,0x96,0x61,0x11,0x99,0x19,0x99,0xa5,0x47,0x02,0x99,0x66,0x69,0x80,
+  0x1b,0x09,0x03,0x04,0x03,0x44,0x66,0x11,0x69,0x99,0x16,0x91,0x9c,0x1b,0x11,0x60,
+  0x22,0x99,0x99,0x06,0x69,0x44,0x00,0x33,0x00,0x04,0x40,0x11,0x10,0x99,0x66,0x21,
+  0x69,0xac,0x1b,0x01,0x20,0x06,0x80,0x8d,0x05,0x30,0x00,0x04,0x11,0x00,0x11,0x80,
+  0x02,0x9d,0xa5,0x04,0x60,0x22,0x69,0x99,0x22,0x81,0xd2,0x04,0x04,0x44,0x88,0x80,
+  0x00,0x80,0x00,0x03,0x66,0x00,0x20,0x66,0x9c,0x6f,0x10,0x66,0x66,0x22,0x20,0x43,
+  0x00,0x80,0x44,0x88,0x88,0x03,0x08,0x60,0x74,0x99,0x66,0x06,0xa0,0x55,0x80,0x2c,
+  0x04,0x22,0x44,0x33,0x88,0x04,0x90,0x1b,0x01,0x99,0x06,0xa0,0xa9,0x04,0x22,0x22,
+  0x33,0x02,0x44,0x80,0x51,0x90,0x1b,0x00,0x96,0x9c,0x37,0x00,0x02,0x80,0x6c,0x00,
+  0x43,0x9c,0x1b,0x02,0x44,0x66,0x66,0x9c,0x6f,0x06,0x50,0x02,0x05,0x55,0x43,0x02,
+  0x03,0x80,0x6d,0x84,0x1b,0x01,0x02,0x04,0x80,0x60,0x98,0xa7,0x81,0xb1,0x02,0x55,
+  0x30,0x20,0x8c,0x1b,0x80,0x17,0xa1,0xbb,0x00,0x02,0x8a,0x25,0x07,0x30,0x05,0x03,
+  0x43,0x88,0x88,0x08,0x88,0xad,0xf3,0x8e,0x41,0x0b,0x04,0x05,0x03,0x33,0x88,0x88,
+  0x50,0x88,0x55,0x85,0x00,0x05,0x9c,0x53,0x8c,0x1b,0x03,0x44,0x05,0x80,0x00,0x84,
+  0x1b,0x01,0x58,0x88,0x82,0x66,0x00,0x55,0x96,0xdb,0x8e,0x41,0x08,0x40,0x55,0x02,
+  0x04,0x88,0x80,0x55,0x08,0x88,0x80,0x55,0x01,0x58,0x88,0xac,0x1b,0x82,0x93,0x03,
+  0x04,0x00,0x02,0x55,0x80,0x3b,0x03,0x85,0x58,0x05,0x88,0x94,0x53,0x98,0x1b,0x80,
+  0x83,0x07,0x50,0x02,0x88,0x85,0x88,0x55,0x00,0x58,0xa4,0x1b,0x00,0x05,0x82,0x95,
+  0x8d,0xff,0x02,0x58,0x55,0x88,0x80,0x8d,0x94,0xab,0x84,0x1b,0x97,0x1d,0x84,0xcf,
+  0x00,0x58,0xa0,0xe3,0x00,0x55,0x81,0x15,0x94,0x0b,0x80,0x1b,0x02,0x50,0x05,0x85,
+  0x8c,0x43,0x8c,0x1b,0x00,0x20,0xa3,0x1b,0x86,0xf2,0x9f,0x9d,0x80,0x08,0xa2,0xab,
+  0x01,0x50,0x02,0x80,0x6d,0xd3,0xb9,0x81,0x12,0xa9,0x51,0xaf,0xbb,0x94,0x51,0x00,
+  0x22,0xfc,0x00,0xfc,0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,
+  0xcc,0x1b,0x05,0x50,0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,
+  0x55,0x55,0x05,0x55,0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,
+  0xc8,0x1b,0x88,0x00,0x00,0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,0x55,0x55,
+  0x20,0x55,0xcc,0x1b,0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,
+  0xc0,0x37,0x09,0x22,0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,
+  0x1b,0x05,0x00,0x09,0x96,0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,0x69,0x96,0xa9,
+  0x96,0x90,0x8a,0xc4,0xc3,0x01,0x00,0x00,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,
+  0xbc,0x8b,0x09,0x03,0x30,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xb4,0x1b,0x09,
+  0x30,0x22,0x33,0x03,0x61,0x10,0x99,0x96,0x99,0x11,0xbc,0x1b,0x09,0x33,0x02,0x40,
+  0x43,0x11,0x03,0x99,0x66,0x91,0x69,0xbc,0x53,0x0b,0x34,0x30,0x04,0x44,0x10,0x33,
+  0x66,0x11,0x69,0x99,0x22,0x21,0xb4,0x6d,0x06,0x00,0x03,0x03,0x40,0x00,0x00,0x11,
+  0x80,0x00,0x81,0xc3,0xb0,0x1b,0x06,0x44,0x40,0x44,0x04,0x00,0x33,0x00,0x80,0x00,
+  0x01,0x66,0x66,0xad,0xa5,0x0b,0x00,0x22,0x77,0x74,0x00,0x04,0x66,0x00,0x74,0x00,
+  0x66,0x60,0x80,0x55,0x00,0x06,0xa4,0x1b,0x0c,0x40,0x22,0x44,0x77,0x66,0x60,0x99,
+  0x66,0x70,0x66,0x99,0x60,0x99,0xb0,0x1b,0x03,0x00,0x22,0x00,0x44,0x80,0xbf,0x03,
+  0x99,0x70,0x69,0x96,0xb8,0x37,0x0b,0x02,0x22,0x60,0x00,0x99,0x66,0x99,0x99,0x40,
+  0x69,0x66,0x60,0xb4,0x6f,0x01,0x30,0x22,0x80,0x6d,0x80,0x15,0x03,0x04,0x06,0x00,
+  0x02,0xb4,0xa7,0x05,0x30,0x22,0x44,0x44,0x00,0x04,0x80,0x15,0xc1,0x67,0x80,0xc3,
+  0x02,0x43,0x00,0x44,0xc6,0x0f,0x84,0x1b,0x02,0x43,0x30,0x50,0x80,0x1b,0x82,0x81,
+  0xbd,0x9f,0x04,0x22,0x30,0x05,0x03,0x33,0xcc,0x1b,0x82,0xce,0x82,0x2d,0xc4,0x1b,
+  0x8a,0x63,0x00,0x88,0x80,0x03,0x82,0xf4,0xb4,0x1b,0x00,0x50,0x80,0x1b,0x03,0x88,
+  0x88,0x55,0x58,0xc4,0x1b,0x02,0x55,0x02,0x85,0x80,0x1b,0x86,0xf0,0xbe,0x47,0x01,
+  0x55,0x02,0x80,0x33,0x8a,0xf2,0xc8,0x1b,0x84,0x35,0x80,0x8b,0xc4,0x53,0x04,0x88,
+  0x85,0x55,0x58,0x50,0xc8,0x1b,0x01,0x50,0x22,0x80,0x1b,0x00,0x88,0x87,0x99,0xc7,
+  0x0b,0x80,0xc0,0x01,0x88,0x02,0xc8,0x1b,0x86,0xd3,0x85,0x7d,0xa5,0x6b,0x00,0x22,
+  0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,0x02,
+  0x00,0x55,0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,0x01,
+  0x55,0x55,0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc4,0x1b,
+  0x88,0x1a,0x02,0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,0x03,
+  0x05,0x55,0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,0x02,
+  0x66,0x60,0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,0x08,
+  0xaa,0x20,0x50,0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xc0,0x1b,
+  0x80,0x37,0x05,0x99,0x96,0x58,0xaa,0x21,0x69,0xbc,0x1b,0x09,0x33,0x00,0x61,0x10,
+  0x99,0x96,0xaa,0xa9,0x21,0x99,0xb9,0x4b,0x08,0x22,0x30,0x33,0x11,0x03,0x99,0x66,
+  0x91,0x19,0xbc,0x1b,0x09,0x30,0x22,0x04,0x33,0x10,0x34,0x96,0x61,0x16,0x99,0xbc,
+  0x53,0x0b,0x43,0x02,0x44,0x43,0x03,0x30,0x61,0x11,0x99,0x96,0x22,0x16,0xb8,0x89,
+  0x0a,0x30,0x34,0x00,0x00,0x00,0x11,0x10,0x11,0x11,0x00,0x01,0xb5,0xa5,0x04,0x44,
+  0x00,0x40,0x44,0x03,0x84,0x1e,0x04,0x00,0x66,0x60,0x22,0x06,0xac,0x89,0x0d,0x77,
+  0x40,0x00,0x47,0x60,0x00,0x40,0x06,0x66,0x07,0x99,0x96,0x20,0x66,0xac,0x1b,0x0c,
+  0x47,0x74,0x66,0x04,0x96,0x66,0x06,0x69,0x96,0x07,0x99,0x99,0x20,0xa8,0x8d,0x03,
+  0x02,0x22,0x04,0x40,0x80,0xf9,0x02,0x99,0x06,0x99,0x80,0x37,0x00,0x99,0xac,0x37,
+  0x80,0x8b,0x02,0x00,0x96,0x66,0x88,0x1b,0x02,0x04,0x66,0x66,0xb4,0x6f,0x08,0x00,
+  0x43,0x66,0x00,0x66,0x66,0x40,0x66,0x00,0x86,0x6b,0xa8,0xa7,0x06,0x02,0x22,0x44,
+  0x43,0x00,0x44,0x00,0x80,0x18,0xc6,0x7f,0x04,0x44,0x30,0x04,0x44,0x55,0x81,0xd9,
+  0xc4,0x1b,0x01,0x33,0x00,0x80,0x1b,0x86,0x81,0xba,0x9d,0x80,0x6f,0x02,0x50,0x33,
+  0x33,0x86,0x31,0xbc,0x1b,0x00,0x50,0x82,0x7f,0x01,0x00,0x00,0xcc,0x1b,0x03,0x55,
+  0x50,0x58,0x85,0x86,0x7e,0xbc,0x6f,0x07,0x02,0x22,0x55,0x55,0x88,0x85,0x55,0x88,
+  0xc4,0x1b,0x00,0x50,0x84,0x1b,0x04,0x88,0x55,0x58,0x55,0x50,0xbe,0x63,0x80,0x1b,
+  0x80,0x51,0x00,0x05,0xca,0xef,0x01,0x50,0x22,0x84,0x6d,0x87,0x45,0xc4,0x53,0x00,
+  0x88,0x80,0x54,0x82,0xec,0xc0,0x1b,0x00,0x02,0x80,0x1b,0x02,0x58,0x88,0x02,0xc8,
+  0x1b,0x06,0x22,0x22,0x85,0x50,0x58,0x88,0x22,0x83,0x28,0xc4,0x1b,0x83,0xe6,0x81,
+  0x7d,0x01,0x00,0x02,0x9d,0x6b,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,
+  0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,
+  0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,
+  0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,
+  0x00,0x01,0x55,0x02,0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,
+  0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,
+  0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,
+  0x8a,0xa9,0x05,0xc8,0xdf,0x07,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,0xc8,0x37,
+  0x01,0x00,0x99,0x80,0x1b,0x01,0x16,0x95,0xbc,0x1b,0x09,0x30,0x02,0x11,0x03,0x99,
+  0x66,0xaa,0x99,0x19,0x9a,0xbc,0x1b,0x09,0x03,0x30,0x10,0x33,0x96,0x61,0x11,0x99,
+  0x19,0x99,0xbc,0x6d,0x09,0x43,0x33,0x03,0x40,0x66,0x11,0x69,0x99,0x16,0x91,0xb8,
+  0x51,0x0a,0x22,0x44,0x34,0x33,0x04,0x11,0x10,0x99,0x66,0x21,0x69,0xb8,0x51,0x07,
+  0x02,0x40,0x00,0x00,0x03,0x11,0x00,0x11,0x80,0x02,0xb5,0xa5,0x06,0x40,0x02,0x04,
+  0x44,0x33,0x44,0x00,0x80,0x00,0x03,0x66,0x00,0x20,0x66,0xac,0x1b,0x03,0x74,0x00,
+  0x04,0x77,0x84,0x18,0x04,0x60,0x74,0x99,0x66,0x06,0xb0,0x55,0x0c,0x77,0x40,0x60,
+  0x44,0x66,0x66,0x66,0x99,0x60,0x70,0x99,0x99,0x06,0xb0,0xa9,0x01,0x44,0x00,0x80,
+  0xf9,0x01,0x99,0x69,0x84,0x1b,0x00,0x96,0xb4,0x37,0x03,0x00,0x02,0x66,0x60,0x88,
+  0x1b,0x02,0x40,0x66,0x66,0xb4,0x6f,0x0b,0x04,0x30,0x60,0x00,0x66,0x66,0x06,0x66,
+  0x02,0x04,0x00,0x00,0xb4,0xa7,0x02,0x44,0x30,0x04,0x88,0xa5,0xc6,0x7f,0x03,0x43,
+  0x02,0x44,0x44,0x82,0x46,0xc1,0xf3,0x85,0x69,0x01,0x44,0x43,0x81,0xf3,0x01,0x55,
+  0x22,0xc2,0x81,0x05,0x05,0x00,0x33,0x30,0x55,0x03,0xc4,0x1b,0x00,0x00,0x82,0x7f,
+  0x01,0x00,0x05,0x88,0x53,0xb8,0x1b,0x02,0x55,0x02,0x88,0x82,0x63,0x80,0x52,0xc6,
+  0x63,0x04,0x50,0x88,0x55,0x58,0x88,0xc4,0x1b,0x00,0x02,0x80,0x51,0x05,0x88,0x85,
+  0x55,0x88,0x55,0x05,0xbe,0xd3,0x02,0x02,0x22,0x58,0x8e,0xd0,0x87,0x45,0xb8,0x1b,
+  0x84,0x6d,0x80,0x8b,0xc8,0x53,0x00,0x85,0x80,0x6d,0x80,0xa4,0x84,0xdf,0xb8,0x8b,
+  0x04,0x85,0x50,0x88,0x88,0x20,0xd0,0x1b,0x80,0xc3,0x84,0x1b,0x83,0x2d,0xbc,0x1b,
+  0x87,0xb3,0x90,0x02,0x90,0x00,0x00,0x22,0xfc,0x00,0xfc,0x00,0xe8,0x00,0x00,0x02,
+  0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,0x55,0x55,0x00,0x05,
+  0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,0x55,0xc4,0x39,0x01,0x55,0x50,
+  0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xc8,0x1b,0x88,0x00,0x00,0x22,0xb8,0x55,0x01,
+  0x02,0x22,0x8c,0x19,0x03,0x55,0x55,0x20,0x55,0xcc,0x1b,0x80,0x70,0x00,0x00,0xcc,
+  0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,0x22,0x05,0x50,0x06,0x66,
+  0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,0x96,0xa9,0x66,0x00,0xc8,
+  0x1b,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,0x8a,0xc4,0xc3,0x01,0x00,0x00,0x80,
+  0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,0xbc,0x8b,0x09,0x03,0x30,0x66,0x11,0x99,0x99,
+  0x9a,0xaa,0x22,0x19,0xb4,0x1b,0x09,0x30,0x22,0x33,0x03,0x61,0x10,0x99,0x96,0x99,
+  0x11,0xbc,0x1b,0x09,0x33,0x02,0x40,0x44,0x11,0x03,0x99,0x66,0x91,0x69,0xbc,0x53,
+  0x0b,0x44,0x30,0x04,0x44,0x10,0x33,0x66,0x11,0x69,0x99,0x22,0x21,0xb4,0x6d,0x06,
+  0x00,0x43,0x04,0x40,0x00,0x00,0x11,0x80,0x00,0x81,0xc3,0xb0,0x1b,0x06,0x44,0x03,
+  0x44,0x04,0x03,0x34,0x00,0x80,0x00,0x01,0x66,0x66,0xad,0xa5,0x0b,0x02,0x22,0x77,
+  0x40,0x30,0x04,0x80,0x33,0x74,0x30,0x66,0x60,0x80,0x55,0x00,0x06,0xa8,0xdb,0x0b,
+  0x22,0x47,0x74,0x06,0x60,0x80,0x30,0x74,0x30,0x99,0x60,0x99,0xb0,0x1b,0x0a,0x30,
+  0x22,0x04,0x40,0x69,0x96,0x00,0x06,0x74,0x30,0x96,0xb8,0x37,0x0b,0x43,0x02,0x60,
+  0x03,0x99,0x96,0x66,0x69,0x44,0x00,0x66,0x60,0xb4,0x6f,0x03,0x43,0x02,0x04,0x44,
+  0x84,0x31,0x03,0x00,0x20,0x00,0x02,0xb4,0xa7,0x07,0x43,0x02,0x44,0x44,0x60,0x03,
+  0x69,0x96,0xc6,0x47,0x84,0x1b,0x03,0x00,0x33,0x06,0x60,0xbc,0x1b,0x09,0x02,0x22,
+  0x30,0x00,0x33,0x33,0x80,0x33,0x00,0x08,0xbc,0x1b,0x02,0x00,0x22,0x00,0x82,0x0f,
+  0x03,0x80,0x00,0x08,0x88,0xbc,0x1b,0x01,0x50,0x02,0x82,0x98,0x00,0x50,0x85,0x13,
+  0xbd,0xf3,0x03,0x85,0x02,0x50,0x88,0x86,0xed,0x00,0x55,0xc0,0x1b,0x02,0x88,0x50,
+  0x88,0x80,0x00,0x80,0x1b,0x00,0x50,0xbe,0x0f,0x06,0x55,0x80,0x88,0x88,0x58,0x88,
+  0x00,0x80,0x1c,0xb4,0x6f,0x08,0x02,0x22,0x05,0x85,0x88,0x50,0x05,0x58,0x50,0xc8,
+  0x1b,0x04,0x58,0x85,0x50,0x05,0x00,0x84,0xaa,0xbb,0x27,0x03,0x02,0x22,0x88,0x85,
+  0x80,0x18,0x00,0x20,0x86,0xf0,0xb6,0xd3,0x84,0x37,0x03,0x20,0x05,0x00,0x22,0x8b,
+  0x0c,0xb8,0x1b,0x87,0x73,0x80,0xff,0x80,0x3c,0x80,0x71,0xba,0xb5,0x8a,0x31,0x88,
+  0x00,0x94,0x13,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,
+  0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,
+  0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,
+  0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,
+  0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,
+  0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,
+  0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,
+  0x1b,0x00,0x09,0xc0,0x1b,0x80,0x37,0x05,0x99,0x96,0x58,0xaa,0x21,0x69,0xbc,0x1b,
+  0x09,0x33,0x00,0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,0xb9,0x4b,0x08,0x22,0x30,
+  0x33,0x11,0x03,0x99,0x66,0x91,0x19,0xbc,0x1b,0x09,0x30,0x22,0x04,0x43,0x10,0x34,
+  0x96,0x61,0x16,0x99,0xbc,0x53,0x0b,0x43,0x02,0x44,0x44,0x03,0x30,0x61,0x11,0x99,
+  0x96,0x22,0x16,0xb4,0x1b,0x0b,0x04,0x30,0x44,0x00,0x00,0x00,0x11,0x10,0x11,0x11,
+  0x00,0x01,0xb5,0xa5,0x04,0x40,0x30,0x40,0x44,0x33,0x84,0x1e,0x04,0x00,0x66,0x60,
+  0x22,0x06,0xac,0x1b,0x0d,0x74,0x00,0x00,0x47,0x03,0x33,0x43,0x08,0x66,0x07,0x99,
+  0x96,0x20,0x66,0xac,0xa5,0x0c,0x77,0x40,0x66,0x04,0x03,0x00,0x43,0x08,0x96,0x07,
+  0x99,0x99,0x20,0xa8,0x8d,0x09,0x02,0x22,0x44,0x03,0x99,0x60,0x00,0x66,0x43,0x00,
+  0x80,0x37,0x00,0x99,0xac,0x37,0x0d,0x30,0x22,0x00,0x34,0x99,0x66,0x66,0x99,0x40,
+  0x06,0x66,0x04,0x66,0x66,0xac,0x6f,0x0a,0x30,0x22,0x44,0x44,0x66,0x00,0x99,0x99,
+  0x02,0x06,0x00,0x86,0x6b,0xa8,0xa7,0x84,0x1b,0x84,0x39,0xb4,0xa1,0x94,0x1b,0x02,
+  0x03,0x34,0x66,0xca,0x9d,0x07,0x00,0x00,0x33,0x33,0x03,0x33,0x00,0x88,0xbc,0x1b,
+  0x03,0x02,0x22,0x05,0x50,0x84,0xf5,0x00,0x88,0xc0,0x1b,0x01,0x00,0x22,0x82,0x5e,
+  0x00,0x00,0x82,0x2d,0x00,0x00,0xbd,0xf3,0x03,0x50,0x22,0x08,0x88,0x86,0xed,0x01,
+  0x50,0x00,0xbe,0x2b,0x02,0x85,0x02,0x88,0x80,0x00,0x03,0x00,0x58,0x55,0x00,0xbe,
+  0xd3,0x03,0x58,0x02,0x88,0x85,0x80,0x1b,0x82,0x9c,0xbc,0x6f,0x06,0x58,0x50,0x85,
+  0x00,0x55,0x88,0x00,0x83,0x29,0xbc,0x1b,0x00,0x88,0x83,0x40,0x00,0x00,0x80,0xaa,
+  0x02,0x05,0x55,0x20,0xc0,0x1b,0x03,0x05,0x58,0x02,0x00,0x87,0x61,0xbe,0xd3,0x84,
+  0x37,0x00,0x02,0x8b,0x7d,0x80,0x1b,0xb1,0xf3,0x04,0x55,0x50,0x20,0x05,0x02,0x81,
+  0x1b,0x84,0x1d,0xb4,0x1b,0x01,0x00,0x02,0x84,0x11,0x85,0x19,0x9d,0x83,0x00,0x22,
+  0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,
+  0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,
+  0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc4,
+  0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,0x00,0x01,0x55,0x02,0x8c,0x1b,0x03,0x55,
+  0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,
+  0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,
+  0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,0x8a,0xa9,0x05,0xc8,0xdf,0x07,0x96,0x00,
+  0x96,0x69,0x8a,0xa9,0x00,0x90,0xc8,0x37,0x01,0x00,0x99,0x80,0x1b,0x01,0x16,0x95,
+  0xbc,0x1b,0x09,0x30,0x02,0x11,0x03,0x99,0x66,0xaa,0x99,0x19,0x9a,0xbc,0x1b,0x09,
+  0x03,0x30,0x10,0x33,0x96,0x61,0x11,0x99,0x19,0x99,0xbc,0x6d,0x09,0x44,0x33,0x03,
+  0x40,0x66,0x11,0x69,0x99,0x16,0x91,0xb8,0x51,0x0a,0x22,0x44,0x44,0x33,0x04,0x11,
+  0x10,0x99,0x66,0x21,0x69,0xb4,0x1b,0x08,0x43,0x02,0x40,0x00,0x00,0x04,0x11,0x00,
+  0x11,0x80,0x02,0xb5,0xa5,0x0d,0x03,0x02,0x04,0x44,0x34,0x44,0x00,0x03,0x00,0x00,
+  0x66,0x00,0x20,0x66,0xac,0x1b,0x0c,0x40,0x02,0x04,0x77,0x33,0x30,0x30,0x80,0x60,
+  0x74,0x99,0x66,0x06,0xb0,0x55,0x05,0x74,0x00,0x60,0x47,0x30,0x06,0x88,0x1b,0x01,
+  0x99,0x06,0xb0,0xa9,0x07,0x40,0x30,0x96,0x04,0x06,0x69,0x30,0x00,0x80,0x1b,0x00,
+  0x96,0xac,0x37,0x0d,0x02,0x22,0x03,0x43,0x96,0x60,0x69,0x99,0x00,0x66,0x60,0x44,
+  0x66,0x66,0xac,0x6f,0x80,0xdd,0x0a,0x43,0x60,0x04,0x99,0x96,0x20,0x69,0x02,0x00,
+  0x00,0x00,0xac,0xa7,0x84,0x1b,0x04,0x03,0x44,0x96,0x60,0x20,0xb8,0xdb,0x8c,0x1b,
+  0x05,0x33,0x44,0x60,0x00,0x20,0x06,0xc1,0x83,0x06,0x02,0x33,0x30,0x33,0x33,0x08,
+  0x80,0xc6,0xb9,0x82,0x26,0x80,0x00,0x03,0x88,0x80,0x20,0x08,0xbc,0x51,0x02,0x55,
+  0x50,0x50,0x82,0x2a,0x01,0x00,0x00,0xbd,0xf3,0x03,0x02,0x22,0x88,0x85,0x86,0xed,
+  0x80,0x1b,0xba,0x9b,0x02,0x50,0x22,0x88,0x80,0x00,0x02,0x05,0x88,0x50,0x82,0x80,
+  0xb4,0x1b,0x09,0x80,0x22,0x88,0x55,0x88,0x88,0x00,0x58,0x55,0x00,0xbf,0x0b,0x05,
+  0x85,0x02,0x50,0x05,0x58,0x88,0x80,0x50,0x00,0x50,0xc4,0x1b,0x02,0x05,0x58,0x00,
+  0x84,0x50,0x80,0x71,0xbc,0x1b,0x02,0x55,0x88,0x20,0x80,0xc3,0xc7,0x0b,0x84,0x37,
+  0x00,0x22,0x80,0x1c,0x88,0x1b,0xb0,0x39,0x87,0x09,0x81,0x1b,0x88,0x39,0x00,0x22,
+  0xb0,0x71,0x80,0x2a,0x84,0x02,0x85,0x82,0x99,0x83,0x00,0x22,0xfc,0x00,0xfc,0x00,
+  0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,
+  0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,0x55,0xc4,
+  0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xc8,0x1b,0x88,0x00,0x00,
+  0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,0x55,0x55,0x20,0x55,0xcc,0x1b,0x80,
+  0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,0x22,0x22,
+  0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,0x96,
+  0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,0x8a,0xc4,0xc3,
+  0x01,0x00,0x00,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,0xbc,0x8b,0x09,0x03,0x30,
+  0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xb4,0x1b,0x09,0x30,0x22,0x33,0x03,0x61,
+  0x10,0x99,0x96,0x99,0x11,0xc4,0x1b,0x07,0x40,0x43,0x11,0x03,0x99,0x66,0x91,0x69,
+  0xbc,0x53,0x0b,0x33,0x02,0x04,0x44,0x10,0x33,0x66,0x11,0x69,0x99,0x22,0x21,0xbc,
+  0x1b,0x04,0x03,0x44,0x00,0x00,0x11,0x80,0x00,0x81,0xc3,0xb0,0x00,0x04,0x43,0x30,
+  0x40,0x44,0x00,0x80,0x1d,0x03,0x00,0x00,0x66,0x66,0xb5,0xa5,0x01,0x40,0x40,0x80,
+  0x1b,0x04,0x47,0x60,0x00,0x60,0x66,0x80,0x55,0x00,0x06,0xb0,0xc1,0x09,0x34,0x74,
+  0x04,0x66,0x04,0x96,0x66,0x06,0x99,0x99,0xb0,0x1b,0x0b,0x30,0x22,0x34,0x44,0x74,
+  0x00,0x96,0x04,0x99,0x99,0x06,0x99,0xa4,0x37,0x80,0x7a,0x01,0x20,0x40,0x80,0x1b,
+  0x01,0x44,0x03,0x8c,0x1b,0xa4,0x6f,0x0a,0x00,0x02,0x20,0x00,0x43,0x02,0x44,0x44,
+  0x00,0x33,0x60,0x80,0x87,0x01,0x00,0x66,0xa4,0xa7,0x84,0x9b,0x00,0x44,0x80,0x1b,
+  0x03,0x80,0x34,0x08,0x88,0x80,0x17,0xa0,0x19,0x82,0x93,0x04,0x50,0x00,0x55,0x43,
+  0x00,0x84,0x1b,0x00,0x00,0x84,0x1b,0xa5,0x7d,0x01,0x22,0x50,0x82,0x09,0x80,0xdc,
+  0x00,0x43,0x80,0x1b,0x00,0x08,0xae,0x9d,0x0e,0x50,0x02,0x50,0x85,0x00,0x58,0x07,
+  0x70,0x43,0x30,0x00,0x04,0x50,0x00,0x00,0xaa,0x0f,0x80,0x34,0x08,0x88,0x05,0x88,
+  0x77,0x70,0x00,0x04,0x02,0x20,0x82,0x30,0xa8,0x1b,0x02,0x85,0x50,0x50,0x80,0x1b,
+  0x03,0x47,0x70,0x22,0x20,0x82,0x4d,0x00,0x50,0x80,0x53,0xa0,0x71,0x00,0x88,0x88,
+  0x1b,0x01,0x04,0x70,0x92,0x85,0x80,0x97,0xa4,0x1b,0x04,0x00,0x58,0x08,0x88,0x20,
+  0x80,0x2d,0x01,0x00,0x22,0x8a,0xf2,0xa3,0x0f,0x05,0x00,0x02,0x00,0x00,0x88,0x80,
+  0x8c,0x1b,0x8a,0xba,0x00,0x05,0xad,0x85,0x8c,0xf1,0x80,0x1b,0x01,0x50,0x05,0x80,
+  0x8e,0xc7,0x47,0x84,0x1b,0x01,0x00,0x05,0xbd,0xd9,0x8c,0x1b,0x80,0x18,0x00,0x00,
+  0x84,0x5d,0xc4,0x1b,0x85,0x59,0xd7,0xd3,0xa4,0x35,0x00,0x22,0xfc,0x00,0xfc,0x00,
+  0xf4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,0x00,
+  0x55,0x22,0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,
+  0x02,0x55,0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,0x55,
+  0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,
+  0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,0x00,
+  0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,0xc4,
+  0xdf,0x03,0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xc0,0x1b,0x80,0x37,0x05,0x99,
+  0x96,0x58,0xaa,0x21,0x69,0xbc,0x1b,0x09,0x33,0x00,0x61,0x10,0x99,0x96,0xaa,0xa9,
+  0x21,0x99,0xb9,0x4b,0x08,0x22,0x30,0x33,0x11,0x03,0x99,0x66,0x91,0x19,0xc4,0x1b,
+  0x07,0x04,0x33,0x10,0x34,0x96,0x61,0x16,0x99,0xbc,0x53,0x0b,0x30,0x22,0x44,0x43,
+  0x03,0x30,0x61,0x11,0x99,0x96,0x22,0x16,0xbc,0x1b,0x09,0x34,0x43,0x00,0x00,0x11,
+  0x10,0x11,0x11,0x00,0x01,0xb5,0xa5,0x06,0x33,0x02,0x04,0x44,0x04,0x44,0x00,0x80,
+  0x00,0x03,0x66,0x60,0x22,0x06,0xac,0x1b,0x00,0x04,0x84,0x1b,0x08,0x74,0x00,0x00,
+  0x06,0x66,0x99,0x96,0x20,0x66,0xb0,0x37,0x0b,0x40,0x40,0x40,0x60,0x47,0x66,0x66,
+  0x69,0x99,0x99,0x90,0x20,0xa8,0x8d,0x00,0x02,0x80,0x89,0x05,0x40,0x03,0x60,0x47,
+  0x99,0x99,0x88,0x1b,0x98,0x37,0x00,0x02,0x85,0x12,0x06,0x22,0x44,0x44,0x40,0x33,
+  0x60,0x44,0x84,0x1b,0xa4,0x6f,0x82,0x5a,0x00,0x00,0x80,0xc1,0x02,0x44,0x03,0x34,
+  0x80,0x87,0x02,0x66,0x06,0x66,0x82,0x6b,0x98,0xa7,0x05,0x00,0x02,0x00,0x00,0x40,
+  0x20,0x80,0x1b,0x05,0x44,0x88,0x88,0x00,0x00,0x20,0xaa,0x49,0x05,0x05,0x00,0x05,
+  0x50,0x30,0x00,0x84,0x1b,0x00,0x08,0x80,0x1b,0xa4,0xdb,0x02,0x02,0x22,0x05,0x81,
+  0xeb,0x09,0x04,0x00,0x44,0x33,0x03,0x44,0x00,0x88,0x00,0x50,0xa4,0x1b,0x0a,0x00,
+  0x22,0x08,0x55,0x05,0x85,0x77,0x00,0x33,0x00,0x00,0x80,0xf9,0x82,0x0f,0xa0,0x1b,
+  0x04,0x50,0x02,0x58,0x85,0x58,0x80,0x1b,0x03,0x00,0x47,0x22,0x00,0x8a,0x47,0xa0,
+  0x1b,0x03,0x55,0x02,0x08,0x88,0x84,0x1b,0x01,0x22,0x04,0x80,0x0b,0x02,0x00,0x00,
+  0x55,0xa4,0x8b,0x00,0x85,0x88,0x1b,0x00,0x47,0x88,0x83,0x82,0x85,0x00,0x05,0xa4,
+  0x39,0x05,0x85,0x02,0x05,0x88,0x88,0x80,0x80,0x9f,0x80,0x95,0x80,0x1b,0x82,0xa3,
+  0x00,0x22,0x9a,0xf3,0x84,0xf9,0x80,0xba,0x00,0x08,0x84,0x1b,0x87,0x2b,0x83,0x47,
+  0xa8,0xe1,0x01,0x00,0x02,0x84,0x65,0x80,0x37,0x84,0x1b,0xcb,0x81,0x84,0x1b,0x00,
+  0x00,0x84,0x1b,0xc3,0x7f,0x84,0x53,0x84,0x00,0xcb,0xb5,0x80,0x79,0xdf,0xd3,0xa4,
+  0x35,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,0x00,0x02,0x20,0x00,0xcc,
+  0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,
+  0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,0x84,0x1a,0x02,0x55,
+  0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,0x00,0x01,0x55,0x02,0x8c,
+  0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,
+  0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,0x05,0x00,0x06,0x8a,0x96,
+  0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,0x8a,0xa9,0x05,0xc8,0xdf,
+  0x07,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,0xc8,0x37,0x01,0x00,0x99,0x80,0x1b,
+  0x01,0x16,0x95,0xbc,0x1b,0x09,0x30,0x02,0x11,0x03,0x99,0x66,0xaa,0x99,0x19,0x9a,
+  0xbc,0x1b,0x09,0x03,0x30,0x10,0x33,0x96,0x61,0x11,0x99,0x19,0x99,0xbc,0x1b,0x09,
+  0x43,0x30,0x03,0x40,0x66,0x11,0x69,0x99,0x16,0x91,0xbc,0x89,0x09,0x44,0x33,0x33,
+  0x04,0x11,0x10,0x99,0x66,0x21,0x69,0xc4,0x1b,0x04,0x00,0x03,0x11,0x00,0x11,0x80,
+  0x02,0xb5,0xa5,0x06,0x30,0x22,0x44,0x43,0x44,0x40,0x00,0x80,0x00,0x03,0x66,0x00,
+  0x20,0x66,0xac,0x1b,0x04,0x40,0x22,0x44,0x40,0x47,0x80,0x1b,0x04,0x66,0x60,0x99,
+  0x60,0x06,0xb0,0x55,0x0c,0x34,0x02,0x04,0x03,0x04,0x74,0x66,0x66,0x99,0x96,0x99,
+  0x06,0x06,0xb0,0xa9,0x05,0x44,0x30,0x00,0x34,0x04,0x74,0x80,0x19,0x00,0x99,0x80,
+  0x1b,0xa0,0x37,0x86,0x3f,0x05,0x44,0x40,0x03,0x34,0x04,0x44,0x84,0x1b,0x01,0x66,
+  0x06,0x9c,0x6f,0x86,0x27,0x05,0x02,0x20,0x44,0x43,0x33,0x44,0x84,0x6d,0x03,0x66,
+  0x66,0x00,0x00,0x9c,0xa7,0x80,0x0a,0x0a,0x00,0x02,0x00,0x44,0x44,0x34,0x44,0x88,
+  0x80,0x00,0x08,0x80,0x19,0xa5,0xb7,0x00,0x02,0x81,0xec,0x02,0x00,0x44,0x43,0x88,
+  0x1b,0xa0,0x33,0x89,0xef,0x81,0xeb,0x07,0x40,0x00,0x43,0x30,0x34,0x44,0x08,0x80,
+  0x81,0xbb,0xa0,0x1b,0x0b,0x02,0x22,0x85,0x50,0x58,0x50,0x70,0x00,0x30,0x07,0x04,
+  0x43,0x82,0x2b,0x00,0x50,0xa4,0x1b,0x0a,0x00,0x22,0x88,0x55,0x88,0x55,0x70,0x05,
+  0x04,0x77,0x20,0x80,0x76,0x82,0x47,0xa0,0x1b,0x09,0x50,0x22,0x88,0x85,0x88,0x50,
+  0x70,0x05,0x20,0x47,0x84,0x79,0x00,0x05,0x80,0x7a,0xa8,0x1b,0x00,0x88,0x84,0x1b,
+  0x01,0x22,0x04,0x86,0x69,0x00,0x50,0x86,0x9d,0x98,0x1d,0x07,0x50,0x22,0x58,0x88,
+  0x88,0x00,0x00,0x08,0x86,0x77,0x80,0x95,0x82,0xf6,0x00,0x20,0x9a,0xd7,0x84,0xf9,
+  0x80,0xba,0x00,0x88,0x84,0x1b,0x86,0xb7,0x01,0x05,0x55,0xaf,0x65,0x84,0xfd,0x88,
+  0x43,0x80,0x1b,0x01,0x00,0x05,0xcf,0x81,0x01,0x50,0x00,0x88,0x8b,0xc8,0x1b,0x81,
+  0x1e,0x00,0x05,0x80,0x1b,0xba,0xf1,0x90,0x1b,0x00,0x00,0xd7,0xd3,0x81,0x72,0x98,
+  0x35,0x00,0x22,0xfc,0x00,0xfc,0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,
+  0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,
+  0x55,0x00,0x55,0x55,0x05,0x55,0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,
+  0x22,0x00,0xc8,0x1b,0x88,0x00,0x00,0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,
+  0x55,0x55,0x20,0x55,0xcc,0x1b,0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,
+  0x05,0x50,0xc0,0x37,0x09,0x22,0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,
+  0x6f,0x80,0x1b,0x05,0x00,0x09,0x96,0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,0x69,
+  0x96,0xa9,0x96,0x90,0x8a,0xbc,0xc3,0x85,0x2f,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,
+  0x16,0xb4,0x1b,0x0b,0x30,0x22,0x03,0x30,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,
+  0xb4,0x1b,0x09,0x43,0x02,0x33,0x03,0x61,0x10,0x99,0x96,0x99,0x11,0xbc,0x1b,0x09,
+  0x44,0x30,0x00,0x34,0x10,0x00,0x99,0x66,0x91,0x69,0xbc,0x53,0x0b,0x44,0x30,0x03,
+  0x44,0x04,0x44,0x66,0x11,0x69,0x99,0x22,0x21,0xb4,0x89,0x01,0x40,0x43,0x80,0x1b,
+  0x04,0x74,0x11,0x00,0x10,0x01,0x81,0xc3,0xb4,0x89,0x0a,0x44,0x40,0x40,0x04,0x77,
+  0x00,0x66,0x06,0x60,0x66,0x66,0xad,0xa5,0x0f,0x30,0x22,0x34,0x44,0x40,0x03,0x60,
+  0x77,0x66,0x99,0x69,0x96,0x69,0x90,0x22,0x06,0x94,0x4d,0x00,0x20,0x80,0x43,0x01,
+  0x43,0x02,0x80,0x1b,0x07,0x33,0x60,0x44,0x99,0x99,0x69,0x99,0x99,0x98,0x1b,0x00,
+  0x00,0x86,0x23,0x07,0x00,0x43,0x02,0x44,0x44,0x00,0x33,0x00,0x80,0xa7,0x80,0x39,
+  0x9c,0x1b,0x01,0x02,0x00,0x81,0x7f,0x0b,0x44,0x00,0x44,0x44,0x80,0x34,0x08,0x88,
+  0x66,0x00,0x06,0x66,0x9c,0x6f,0x81,0xb2,0x03,0x58,0x00,0x05,0x43,0x88,0x1b,0x02,
+  0x40,0x88,0x00,0x88,0x00,0x94,0x85,0x0f,0x85,0x00,0x85,0x88,0x05,0x88,0x30,0x00,
+  0x44,0x43,0x80,0x34,0x44,0x08,0x55,0x50,0x9c,0xa3,0x11,0x02,0x22,0x88,0x50,0x85,
+  0x58,0x58,0x88,0x07,0x40,0x43,0x30,0x00,0x04,0x04,0x40,0x55,0x00,0x9d,0xa1,0x80,
+  0x1b,0x0c,0x55,0x85,0x05,0x55,0x88,0x77,0x40,0x00,0x07,0x02,0x20,0x00,0x40,0x80,
+  0x37,0x98,0x1b,0x0b,0x00,0x22,0x88,0x85,0x55,0x05,0x05,0x88,0x44,0x40,0x22,0x04,
+  0x8a,0xa1,0x00,0x50,0x84,0x99,0x9c,0x1b,0x01,0x00,0x05,0x88,0x7f,0x80,0x67,0x00,
+  0x00,0x8a,0x87,0x96,0xbd,0x02,0x00,0x22,0x58,0x80,0x27,0x97,0x05,0x80,0x6c,0x00,
+  0x50,0x80,0x39,0x00,0x05,0x94,0x0d,0xa7,0x1d,0x84,0x0d,0x86,0x6d,0x8c,0x11,0x8d,
+  0x31,0xa4,0x1b,0x00,0x05,0x98,0x6f,0xb2,0x4d,0x01,0x22,0x50,0x80,0x38,0xa4,0x2d,
+  0xb0,0x1b,0x00,0x05,0xc7,0x2b,0x8e,0x6b,0x94,0x89,0xc8,0x1b,0xc8,0x35,0x88,0x55,
+  0x00,0x00,0xcc,0x6d,0x8c,0x71,0x94,0x51,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,
+  0x04,0x20,0x00,0x00,0x22,0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,0x00,0x55,0x22,
+  0x20,0xbc,0x19,0x02,0x00,0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,0x02,0x55,
+  0x02,0x50,0x84,0x1a,0x02,0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,0x55,0x20,0x55,
+  0xc0,0x1b,0x8c,0x36,0x01,0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,
+  0x04,0x00,0x05,0x00,0x50,0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,0x00,0x08,0xa9,
+  0xc4,0x6f,0x09,0x50,0x02,0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,0xc4,0xdf,0x03,
+  0x99,0x60,0x99,0x66,0x80,0x1b,0x00,0x09,0xc0,0x1b,0x00,0x00,0x80,0x1b,0x04,0x96,
+  0x58,0xaa,0x21,0x69,0xb9,0x2f,0x0a,0x22,0x33,0x03,0x61,0x10,0x99,0x96,0xaa,0xa9,
+  0x21,0x99,0xb4,0x1b,0x09,0x30,0x22,0x30,0x34,0x11,0x03,0x99,0x66,0x91,0x19,0xbc,
+  0x1b,0x09,0x43,0x02,0x03,0x44,0x00,0x00,0x96,0x61,0x16,0x99,0xbc,0x53,0x05,0x43,
+  0x02,0x34,0x44,0x44,0x40,0x84,0x55,0x01,0x22,0x16,0xb4,0x1b,0x0b,0x04,0x30,0x34,
+  0x44,0x47,0x40,0x10,0x00,0x00,0x11,0x00,0x01,0xad,0xa5,0x0f,0x02,0x22,0x34,0x43,
+  0x04,0x00,0x47,0x74,0x06,0x60,0x66,0x00,0x66,0x60,0x22,0x06,0xac,0x1b,0x0d,0x44,
+  0x43,0x00,0x33,0x07,0x74,0x69,0x96,0x99,0x66,0x99,0x06,0x20,0x66,0x9c,0xd7,0x84,
+  0xa5,0x09,0x44,0x44,0x03,0x33,0x04,0x44,0x99,0x96,0x99,0x99,0x80,0x1b,0x90,0x8d,
+  0x00,0x02,0x80,0x1b,0x01,0x20,0x00,0x88,0x1b,0x00,0x34,0x80,0xa7,0x01,0x60,0x69,
+  0x84,0x1b,0x90,0x37,0x07,0x00,0x22,0x05,0x50,0x00,0x00,0x40,0x00,0x80,0x1b,0x06,
+  0x44,0x88,0x88,0x60,0x00,0x66,0x66,0x9c,0x6f,0x06,0x50,0x02,0x55,0x85,0x00,0x55,
+  0x30,0x88,0x1b,0x04,0x08,0x88,0x00,0x04,0x00,0x80,0x00,0x94,0xa7,0x10,0x50,0x02,
+  0x58,0x88,0x58,0x88,0x00,0x00,0x44,0x33,0x03,0x44,0x40,0x88,0x55,0x04,0x22,0xa2,
+  0x2d,0x80,0x34,0x05,0x88,0x88,0x88,0x74,0x05,0x33,0x80,0x1e,0x03,0x44,0x00,0x50,
+  0x00,0xa5,0xbd,0x04,0x85,0x50,0x50,0x58,0x58,0x80,0x1b,0x02,0x00,0x77,0x22,0x80,
+  0x50,0x00,0x55,0xa0,0x1b,0x02,0x02,0x22,0x88,0x84,0x1b,0x04,0x85,0x44,0x00,0x20,
+  0x44,0x84,0x97,0x00,0x55,0x82,0x2d,0x94,0x6f,0x84,0x1b,0x01,0x00,0x58,0x88,0x7f,
+  0x80,0xe5,0x00,0x02,0x80,0x1b,0x9e,0xbd,0x00,0x02,0x80,0x53,0x82,0x41,0x93,0x05,
+  0x88,0x1b,0x00,0x00,0x82,0xf5,0x90,0x0d,0xa7,0x1d,0x84,0x0d,0x86,0x6d,0x94,0x11,
+  0x85,0x31,0xb0,0x1b,0x98,0xdf,0xad,0x71,0x00,0x00,0x8c,0x8b,0xc7,0x63,0x80,0x1b,
+  0x02,0x00,0x55,0x20,0xd3,0x81,0x80,0x1b,0x00,0x50,0xd7,0x9d,0xa5,0x4d,0xb8,0x1b,
+  0x00,0x02,0xcc,0x6d,0x8c,0x71,0x94,0x51,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,
+  0x04,0x02,0x00,0x02,0x20,0x00,0xcc,0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,
+  0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,
+  0x50,0x22,0x05,0x84,0x1a,0x02,0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,
+  0x55,0xb8,0x00,0x01,0x55,0x02,0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,
+  0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,
+  0x22,0x66,0x05,0x00,0x06,0x8a,0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,
+  0x66,0x09,0x8a,0xa9,0x05,0xc8,0xdf,0x07,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,
+  0xc0,0x37,0x03,0x02,0x96,0x00,0x99,0x80,0x1b,0x01,0x16,0x95,0xbc,0x1b,0x09,0x30,
+  0x30,0x11,0x03,0x99,0x66,0xaa,0x99,0x19,0x9a,0xbc,0x51,0x09,0x03,0x43,0x10,0x33,
+  0x96,0x61,0x11,0x99,0x19,0x99,0xb8,0x35,0x0a,0x22,0x34,0x44,0x00,0x00,0x66,0x10,
+  0x69,0x99,0x16,0x91,0xbc,0x1b,0x09,0x44,0x44,0x44,0x03,0x11,0x04,0x99,0x66,0x21,
+  0x69,0xb4,0x1b,0x0b,0x43,0x02,0x44,0x40,0x74,0x03,0x00,0x04,0x01,0x11,0x00,0x10,
+  0xb5,0xa5,0x0d,0x44,0x30,0x40,0x03,0x77,0x40,0x66,0x04,0x60,0x00,0x66,0x06,0x20,
+  0x66,0xb4,0x1b,0x0a,0x03,0x34,0x77,0x40,0x99,0x60,0x96,0x66,0x90,0x69,0x06,0x98,
+  0x55,0x01,0x00,0x02,0x81,0xf0,0x05,0x22,0x44,0x43,0x33,0x34,0x44,0x80,0x1b,0x01,
+  0x99,0x99,0x80,0x1b,0x98,0xa9,0x00,0x00,0x80,0x00,0x88,0x1b,0x84,0xa7,0x00,0x00,
+  0x80,0x1b,0x00,0x66,0x94,0x37,0x01,0x02,0x22,0x81,0x96,0x80,0x00,0x09,0x44,0x44,
+  0x34,0x44,0x88,0x80,0x00,0x08,0x66,0x66,0x9c,0x6f,0x02,0x00,0x22,0x58,0x81,0xe9,
+  0x80,0x1b,0x00,0x43,0x88,0x1b,0x00,0x40,0x84,0x27,0x94,0xa7,0x10,0x00,0x22,0x88,
+  0x85,0x88,0x85,0x00,0x05,0x43,0x30,0x34,0x44,0x08,0x80,0x50,0x44,0x20,0xa2,0x11,
+  0x0b,0x50,0x02,0x58,0x88,0x88,0x85,0x40,0x58,0x30,0x07,0x04,0x43,0x80,0x34,0x00,
+  0x04,0xa6,0x2d,0x02,0x55,0x02,0x05,0x84,0x1b,0x08,0x55,0x07,0x77,0x20,0x00,0x40,
+  0x02,0x50,0x00,0xa4,0x1b,0x80,0x4e,0x06,0x88,0x88,0x55,0x40,0x05,0x04,0x44,0x84,
+  0x97,0x00,0x50,0x82,0x2d,0x9c,0x6f,0x84,0x1b,0x84,0x7f,0x8e,0xeb,0x84,0x1b,0x9e,
+  0xbd,0x80,0x26,0x00,0x58,0x94,0x19,0x84,0x1b,0x03,0x50,0x05,0x05,0x55,0x94,0x0d,
+  0x9c,0x17,0x8c,0x0d,0x86,0x84,0x98,0x1b,0x81,0x31,0xb0,0x1b,0x00,0x05,0xc7,0x2d,
+  0x88,0x1b,0x00,0x50,0x80,0x8b,0xba,0x9f,0x8c,0x1b,0x00,0x05,0x84,0x1b,0xc8,0x00,
+  0x02,0x00,0x02,0x05,0xa8,0x7f,0xac,0x1b,0x9c,0xdd,0xbe,0xdb,0xd4,0x6d,0x8b,0xd7,
+  0x90,0x35,0x00,0x22,0xfc,0x00,0xfc,0x00,0xe8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,
+  0x00,0x22,0x20,0xcc,0x1b,0x05,0x50,0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,
+  0x02,0x55,0x00,0x55,0x55,0x05,0x55,0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,
+  0x01,0x22,0x00,0xc8,0x1b,0x88,0x00,0x00,0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,
+  0x03,0x55,0x55,0x20,0x55,0xcc,0x1b,0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,
+  0x50,0x05,0x50,0xc0,0x37,0x09,0x22,0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,
+  0xbc,0x6f,0x80,0x1b,0x05,0x00,0x09,0x96,0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,
+  0x69,0x96,0xa9,0x96,0x90,0x8a,0xc4,0xc3,0x88,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,
+  0xbc,0x1b,0x09,0x03,0x30,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xbc,0xa7,0x07,
+  0x33,0x03,0x61,0x10,0x99,0x96,0x99,0x11,0xbc,0x1b,0x09,0x30,0x22,0x40,0x43,0x11,
+  0x03,0x99,0x66,0x91,0x69,0xbc,0x53,0x04,0x30,0x22,0x04,0x44,0x10,0x80,0x55,0x03,
+  0x69,0x99,0x22,0x21,0xb4,0x1b,0x09,0x33,0x02,0x44,0x40,0x00,0x04,0x11,0x11,0x01,
+  0x11,0x81,0xc3,0xb4,0x1b,0x00,0x30,0x80,0x1b,0x06,0x44,0x00,0x00,0x60,0x00,0x60,
+  0x66,0xad,0xa5,0x0f,0x02,0x22,0x34,0x33,0x43,0x03,0x40,0x44,0x00,0x44,0x96,0x00,
+  0x06,0x99,0x22,0x06,0x94,0xd5,0x00,0x20,0x80,0x43,0x0b,0x30,0x22,0x44,0x43,0x30,
+  0x33,0x40,0x34,0x60,0x47,0x99,0x66,0x94,0x1b,0x86,0x21,0x84,0x5f,0x80,0x6d,0x04,
+  0x44,0x03,0x33,0x40,0x03,0x80,0x1b,0x00,0x99,0x94,0x1b,0x04,0x00,0x02,0x58,0x50,
+  0x00,0x82,0x05,0x0b,0x43,0x00,0x44,0x44,0x33,0x34,0x40,0x00,0x60,0x47,0x66,0x66,
+  0x94,0x6f,0x09,0x50,0x00,0x58,0x85,0x05,0x88,0x02,0x00,0x30,0x44,0x80,0x37,0x01,
+  0x44,0x00,0x80,0xa9,0x8c,0x47,0x84,0x51,0x0f,0x85,0x50,0x55,0x88,0x55,0x88,0x40,
+  0x00,0x30,0x74,0x44,0x43,0x03,0x34,0x04,0x44,0x84,0x7b,0x90,0x87,0x0b,0x22,0x88,
+  0x55,0x55,0x58,0x58,0x88,0x00,0x55,0x04,0x77,0x44,0x80,0x89,0x01,0x04,0x44,0x80,
+  0x5f,0x80,0x15,0x84,0x21,0x11,0x50,0x02,0x88,0x85,0x00,0x55,0x88,0x85,0x05,0x55,
+  0x04,0x74,0x43,0x33,0x00,0x33,0x50,0x44,0x85,0xfb,0x84,0x02,0x84,0x1b,0x86,0xab,
+  0x09,0x88,0x55,0x05,0x58,0x20,0x40,0x33,0x00,0x20,0x33,0x80,0x14,0x86,0x31,0x8a,
+  0xbf,0x01,0x00,0x02,0x84,0x79,0x03,0x85,0x00,0x00,0x58,0x8a,0xec,0x80,0x03,0x8e,
+  0x69,0x84,0x8d,0x84,0xdd,0x80,0xfa,0x84,0x99,0x88,0xb5,0x80,0x1b,0x82,0xa3,0x00,
+  0x05,0x88,0x1b,0x94,0x91,0x94,0x0b,0x82,0x6b,0x88,0x55,0x9c,0xad,0xa4,0x00,0x81,
+  0x08,0x80,0x02,0xcc,0x1b,0x83,0x2f,0x00,0x50,0x80,0x89,0xcc,0x1b,0x80,0x55,0x80,
+  0x61,0xc8,0x1b,0x83,0x83,0x98,0x99,0xc0,0x39,0x91,0x4f,0xcc,0x71,0xcc,0x89,0x8c,
+  0x71,0x8c,0x6d,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x20,0x00,0x00,0x22,
+  0x00,0xcc,0x1a,0x07,0x02,0x00,0x55,0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,
+  0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,
+  0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,
+  0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,
+  0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,
+  0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,
+  0x1b,0x00,0x09,0xd0,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xbc,0x1b,0x09,0x33,0x02,
+  0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,0xbc,0x1b,0x07,0x30,0x30,0x11,0x03,0x99,
+  0x66,0x91,0x19,0xbc,0x1b,0x09,0x02,0x22,0x04,0x33,0x10,0x34,0x96,0x61,0x16,0x99,
+  0xbc,0x53,0x0b,0x02,0x22,0x44,0x43,0x03,0x00,0x61,0x11,0x99,0x96,0x22,0x16,0xb8,
+  0x51,0x08,0x22,0x44,0x03,0x00,0x44,0x11,0x10,0x11,0x11,0x81,0xc3,0xb1,0xa5,0x06,
+  0x33,0x02,0x44,0x03,0x04,0x44,0x00,0x80,0x00,0x03,0x06,0x66,0x22,0x06,0xac,0x1b,
+  0x0d,0x43,0x30,0x30,0x33,0x04,0x44,0x04,0x44,0x60,0x00,0x69,0x99,0x20,0x60,0x94,
+  0xd5,0x80,0x43,0x84,0x6d,0x08,0x33,0x03,0x34,0x03,0x43,0x04,0x74,0x96,0x66,0xa0,
+  0x1b,0x80,0x00,0x01,0x22,0x20,0x80,0x6d,0x08,0x43,0x33,0x34,0x00,0x30,0x04,0x74,
+  0x99,0x96,0x94,0x1b,0x02,0x00,0x22,0x85,0x85,0x93,0x0c,0x00,0x30,0x02,0x44,0x44,
+  0x33,0x44,0x00,0x03,0x04,0x74,0x66,0x66,0x94,0x6f,0x11,0x00,0x02,0x88,0x55,0x58,
+  0x85,0x20,0x00,0x04,0x40,0x44,0x43,0x34,0x44,0x04,0x00,0x00,0x40,0x8c,0x47,0x89,
+  0x97,0x03,0x00,0x58,0x88,0x58,0x80,0x3a,0x00,0x07,0x80,0x36,0x02,0x33,0x44,0x44,
+  0x80,0x19,0x9c,0xef,0x14,0x85,0x50,0x55,0x88,0x88,0x85,0x05,0x55,0x47,0x70,0x43,
+  0x30,0x03,0x44,0x44,0x44,0x05,0x50,0x22,0x20,0x02,0x88,0x9d,0x11,0x00,0x22,0x88,
+  0x55,0x05,0x58,0x88,0x50,0x55,0x58,0x47,0x40,0x33,0x30,0x03,0x34,0x04,0x40,0x82,
+  0x9f,0x00,0x05,0x8a,0x15,0x02,0x20,0x00,0x22,0x86,0xab,0x84,0x3b,0x00,0x04,0x80,
+  0x8d,0x04,0x03,0x33,0x00,0x02,0x55,0x82,0x13,0x82,0x1b,0x88,0x1b,0x84,0x79,0x80,
+  0x27,0x02,0x88,0x20,0x00,0x84,0x49,0x00,0x02,0x92,0x6b,0x01,0x00,0x05,0x84,0x8d,
+  0x86,0xff,0x88,0x99,0x88,0x83,0x80,0x1b,0x8a,0xd9,0x9d,0x51,0x88,0x7b,0x90,0x0b,
+  0x86,0xf5,0x00,0x05,0x84,0x1b,0xc0,0x00,0x80,0x71,0x00,0x05,0xd8,0x1b,0x80,0x55,
+  0x01,0x00,0x55,0x80,0x88,0xc7,0x65,0x80,0x55,0x01,0x00,0x05,0xcc,0x1b,0x89,0x7b,
+  0x00,0x05,0xd7,0x9f,0x01,0x00,0x02,0xbd,0xf7,0x9c,0x71,0xcc,0x89,0x8c,0x71,0x8c,
+  0x6d,0x00,0x22,0xfc,0x00,0xfc,0x00,0xf4,0x00,0x04,0x02,0x00,0x02,0x20,0x00,0xcc,
+  0x1a,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,0x02,0x22,0x00,0x00,
+  0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,0x84,0x1a,0x02,0x55,
+  0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,0x00,0x01,0x55,0x02,0x8c,
+  0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,0x1b,0x07,0x00,0x55,0x05,
+  0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,0x05,0x00,0x06,0x8a,0x96,
+  0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,0x8a,0xa9,0x05,0xc8,0xdf,
+  0x07,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,0xcc,0x1b,0x00,0x99,0x80,0x1b,0x01,
+  0x16,0x95,0xbc,0x1b,0x09,0x30,0x22,0x11,0x03,0x99,0x66,0xaa,0x99,0x19,0x9a,0xbc,
+  0x1b,0x09,0x03,0x02,0x10,0x33,0x96,0x61,0x11,0x99,0x19,0x99,0xbc,0x1b,0x09,0x43,
+  0x30,0x03,0x40,0x66,0x11,0x69,0x99,0x16,0x91,0xbc,0x1b,0x09,0x44,0x30,0x30,0x04,
+  0x11,0x10,0x99,0x66,0x21,0x69,0xbc,0x89,0x09,0x40,0x33,0x04,0x44,0x11,0x00,0x11,
+  0x11,0x00,0x01,0xb5,0xa5,0x00,0x30,0x80,0x1b,0x02,0x44,0x44,0x00,0x80,0x00,0x03,
+  0x66,0x60,0x20,0x60,0xac,0x1b,0x0d,0x33,0x02,0x03,0x34,0x44,0x43,0x44,0x40,0x00,
+  0x00,0x99,0x96,0x06,0x06,0x9d,0xd1,0x85,0x3f,0x0b,0x43,0x30,0x33,0x44,0x34,0x30,
+  0x47,0x40,0x66,0x60,0x99,0x99,0x94,0x1b,0x01,0x00,0x02,0x80,0x1b,0x0b,0x00,0x02,
+  0x22,0x44,0x33,0x33,0x44,0x03,0x03,0x47,0x40,0x99,0x98,0x1b,0x06,0x02,0x22,0x50,
+  0x00,0x55,0x58,0x20,0x80,0x1e,0x05,0x44,0x43,0x34,0x44,0x00,0x33,0x84,0x37,0x01,
+  0x66,0x66,0x8c,0x6f,0x10,0x00,0x22,0x85,0x50,0x88,0x58,0x00,0x05,0x44,0x02,0x44,
+  0x30,0x44,0x44,0x40,0x03,0x04,0x84,0x8c,0x80,0x47,0x89,0x97,0x03,0x02,0x88,0x85,
+  0x88,0x82,0x21,0x09,0x74,0x40,0x43,0x30,0x34,0x44,0x44,0x03,0x00,0x04,0x9d,0xbb,
+  0x0b,0x55,0x00,0x58,0x88,0x88,0x55,0x55,0x58,0x77,0x00,0x33,0x04,0x80,0x1b,0x02,
+  0x40,0x55,0x04,0x84,0x33,0x84,0x9d,0x00,0x02,0x80,0x51,0x0c,0x55,0x88,0x85,0x00,
+  0x55,0x88,0x74,0x05,0x33,0x04,0x33,0x43,0x44,0x81,0xf5,0x00,0x00,0x8e,0x15,0x80,
+  0x9d,0x86,0xab,0x84,0x3b,0x07,0x40,0x05,0x00,0x20,0x33,0x33,0x00,0x20,0x80,0x5e,
+  0x80,0x0f,0x86,0xbf,0x84,0xdb,0x84,0x00,0x01,0x58,0x85,0x80,0x45,0x88,0x49,0x88,
+  0x1b,0x86,0xa1,0x84,0x0f,0x82,0xff,0x84,0xe1,0x97,0x05,0x80,0x52,0x88,0x38,0x9d,
+  0x51,0x94,0xb5,0x84,0x2b,0x8e,0x87,0xbe,0x69,0x84,0xef,0x01,0x50,0x50,0xd4,0x1b,
+  0x85,0x27,0x00,0x05,0x84,0x1b,0xc8,0x00,0x80,0x9a,0xdc,0x1b,0x02,0x02,0x00,0x50,
+  0xd7,0x9f,0x80,0x96,0x98,0x99,0xc7,0xa1,0xc4,0x89,0x98,0xd1,0x80,0x00,0x00,0x22,
+  0xa8,0x00,0x00,0x02,0x80,0x01,0x03,0x00,0x00,0x22,0x20,0xac,0x15,0x94,0x1b,0x05,
+  0x50,0x20,0x55,0x55,0x00,0x05,0xc4,0x1b,0x07,0x00,0x02,0x55,0x00,0x55,0x55,0x05,
+  0x55,0xc4,0x39,0x01,0x55,0x50,0x80,0x18,0x80,0x00,0x01,0x22,0x00,0xc8,0x1b,0x88,
+  0x00,0x00,0x22,0xb8,0x55,0x01,0x02,0x22,0x8c,0x19,0x03,0x55,0x55,0x20,0x55,0xcc,
+  0x1b,0x80,0x70,0x00,0x00,0xcc,0x1b,0x04,0x00,0x00,0x50,0x05,0x50,0xc0,0x37,0x09,
+  0x22,0x22,0x05,0x50,0x06,0x66,0x96,0x00,0x50,0x8a,0xbc,0x6f,0x80,0x1b,0x05,0x00,
+  0x09,0x96,0xa9,0x66,0x00,0xc8,0x1b,0x07,0x00,0x02,0x69,0x96,0xa9,0x96,0x90,0x8a,
+  0xc4,0xc3,0x01,0x02,0x22,0x80,0x1b,0x04,0x99,0x95,0x8a,0x22,0x16,0xc0,0x37,0x08,
+  0x22,0x66,0x11,0x99,0x99,0x9a,0xaa,0x22,0x19,0xbc,0x19,0x07,0x33,0x00,0x61,0x10,
+  0x99,0x96,0x99,0x11,0xbc,0x1b,0x09,0x33,0x02,0x43,0x30,0x11,0x04,0x99,0x66,0x91,
+  0x69,0xbc,0x53,0x0b,0x43,0x30,0x43,0x04,0x11,0x04,0x66,0x11,0x69,0x99,0x22,0x21,
+  0xb4,0x87,0x02,0x43,0x30,0x44,0x80,0x1b,0x00,0x11,0x80,0x00,0xbc,0x6d,0x08,0x40,
+  0x04,0x00,0x04,0x11,0x00,0x00,0x00,0x20,0xb8,0xc1,0x0a,0x44,0x02,0x04,0x77,0x33,
+  0x04,0x00,0x80,0x40,0x88,0x07,0xb8,0x1f,0x06,0x74,0x02,0x47,0x77,0x33,0x00,0x88,
+  0x84,0x1b,0x04,0x40,0x99,0x66,0x06,0x69,0xa4,0x1b,0x05,0x40,0x02,0x77,0x77,0x33,
+  0x30,0x90,0x1b,0x02,0x96,0x06,0x99,0xa4,0x1b,0x07,0x06,0x60,0x47,0x40,0x03,0x30,
+  0x88,0x88,0x90,0x1b,0xa8,0x37,0x03,0x69,0x90,0x44,0x06,0x94,0x1b,0x03,0x66,0x66,
+  0x06,0x66,0xa4,0xc1,0x0e,0x66,0x99,0x00,0x20,0x03,0x33,0x88,0x88,0x43,0x08,0x04,
+  0x40,0x60,0x00,0x20,0xa8,0x1b,0x03,0x06,0x69,0x02,0x22,0x8c,0x1b,0x02,0x20,0x00,
+  0x02,0x84,0xd2,0x98,0x00,0x00,0x90,0x80,0x37,0x02,0x30,0x20,0x80,0x88,0x1b,0xb6,
+  0x81,0x05,0x90,0x22,0x69,0x99,0x33,0x00,0xd4,0x1b,0x0b,0x66,0x99,0x33,0x06,0x88,
+  0x03,0x88,0x88,0x30,0x08,0x22,0x03,0xb5,0x4d,0x02,0x66,0x66,0x00,0x80,0xf9,0x03,
+  0x88,0x88,0x08,0x88,0xbd,0x33,0x00,0x00,0x82,0x7c,0x05,0x88,0x00,0x88,0x88,0x50,
+  0x08,0xbe,0x65,0x02,0x50,0x22,0x88,0x82,0x9b,0x80,0x21,0x02,0x50,0x05,0x58,0xba,
+  0xef,0x0a,0x02,0x88,0x85,0x20,0x58,0x02,0x22,0x85,0x55,0x05,0x88,0xbf,0x0b,0x94,
+  0x1b,0x01,0x55,0x88,0xac,0xa9,0x86,0xd3,0x84,0x1b,0x00,0x50,0x84,0x1b,0x00,0x58,
+  0xae,0x83,0x01,0x50,0x02,0x80,0x1b,0x83,0x3f,0x00,0x50,0x93,0x13,0xa8,0x35,0x8b,
+  0x5d,0x8c,0x1b,0x01,0x88,0x85,0xa4,0x39,0x01,0x50,0x02,0x80,0x0e,0x00,0x88,0x98,
+  0x1b,0x80,0x0b,0x9c,0xc7,0x80,0x87,0x01,0x55,0x88,0x84,0x1b,0x00,0x20,0x8c,0x53,
+  0x8b,0xd7,0xb3,0x93,0x01,0x22,0x20,0x94,0x0b,0x9c,0x1b,0x82,0x3c,0x88,0x00,0x84,
+  0xbb,0x8c,0x09,0x85,0x37,0x00,0x22,0xb4,0x00,0x04,0x20,0x00,0x00,0x22,0x00,0xb8,
+  0x15,0x88,0x00,0x07,0x02,0x00,0x55,0x55,0x00,0x55,0x22,0x20,0xbc,0x19,0x02,0x00,
+  0x22,0x50,0x80,0x1b,0x01,0x55,0x55,0xc4,0x39,0x02,0x55,0x02,0x50,0x84,0x1a,0x02,
+  0x55,0x20,0x05,0xc4,0x1b,0x88,0x1a,0x02,0x55,0x20,0x55,0xc0,0x1b,0x8c,0x36,0x01,
+  0x55,0x05,0xd0,0x1b,0x03,0x05,0x55,0x50,0x00,0xcc,0x1b,0x04,0x00,0x05,0x00,0x50,
+  0x05,0xcc,0x37,0x06,0x02,0x66,0x60,0x60,0x00,0x08,0xa9,0xc4,0x6f,0x09,0x50,0x02,
+  0x99,0x60,0x96,0x60,0x08,0xaa,0x20,0x50,0xc4,0xdf,0x03,0x99,0x60,0x99,0x66,0x80,
+  0x1b,0x00,0x09,0xc5,0x17,0x80,0x1b,0x04,0x96,0x58,0xaa,0x21,0x69,0xc1,0x31,0x08,
+  0x22,0x61,0x10,0x99,0x96,0xaa,0xa9,0x21,0x99,0xbc,0x19,0x07,0x30,0x00,0x11,0x03,
+  0x99,0x66,0x91,0x19,0xbc,0x1b,0x09,0x30,0x22,0x33,0x03,0x10,0x44,0x96,0x61,0x16,
+  0x99,0xbc,0x53,0x0b,0x33,0x02,0x30,0x44,0x10,0x44,0x61,0x11,0x99,0x96,0x22,0x16,
+  0xb8,0x1b,0x01,0x00,0x40,0x80,0x1b,0x00,0x11,0x80,0x00,0x01,0x22,0x21,0xb4,0x6d,
+  0x07,0x00,0x40,0x00,0x44,0x10,0x00,0x00,0x01,0x81,0xdd,0xb0,0x00,0x0c,0x40,0x22,
+  0x47,0x74,0x30,0x40,0x08,0x03,0x08,0x80,0x70,0x04,0x00,0x80,0x00,0xac,0x1b,0x0d,
+  0x77,0x77,0x30,0x04,0x88,0x03,0x08,0x88,0x74,0x04,0x96,0x60,0x66,0x99,0xa5,0xfb,
+  0x05,0x00,0x22,0x77,0x74,0x33,0x07,0x8c,0x1b,0x02,0x99,0x60,0x69,0xa8,0x1b,0x07,
+  0x66,0x02,0x74,0x00,0x33,0x04,0x88,0x80,0x8c,0x1b,0xac,0x37,0x03,0x99,0x02,0x40,
+  0x66,0x94,0x1b,0x03,0x66,0x60,0x66,0x66,0xa4,0x1b,0x0a,0x69,0x90,0x02,0x06,0x33,
+  0x30,0x88,0x80,0x30,0x88,0x44,0x80,0x8b,0x01,0x06,0x66,0xa4,0x8b,0x03,0x66,0x90,
+  0x22,0x20,0x8c,0x1b,0x01,0x00,0x04,0x86,0xa6,0xa4,0xdd,0x0a,0x69,0x99,0x02,0x06,
+  0x03,0x33,0x88,0x88,0x30,0x88,0x22,0x80,0x1b,0xac,0xf9,0x02,0x99,0x99,0x30,0xd8,
+  0x1b,0x04,0x69,0x99,0x30,0x66,0x80,0x80,0x1b,0x03,0x00,0x88,0x20,0x33,0xb5,0x17,
+  0x03,0x66,0x60,0x00,0x06,0x80,0x18,0x80,0x00,0xbd,0x33,0x05,0x00,0x02,0x55,0x50,
+  0x80,0x05,0x84,0x37,0xbe,0x65,0x07,0x02,0x22,0x85,0x55,0x05,0x58,0x00,0x00,0x83,
+  0x2a,0x00,0x85,0xb7,0x2b,0x05,0x50,0x22,0x88,0x55,0x05,0x88,0x86,0xa3,0x01,0x58,
+  0x88,0xb4,0x1b,0x01,0x55,0x02,0xa0,0x1b,0xb3,0x2b,0x01,0x55,0x50,0x84,0x1b,0x01,
+  0x02,0x22,0x83,0x0e,0x00,0x88,0xaf,0x47,0x00,0x00,0x80,0x13,0x03,0x85,0x55,0x20,
+  0x58,0x88,0x1b,0x86,0xf3,0xa0,0x55,0x80,0x81,0x8b,0x5b,0x84,0x1b,0x00,0x88,0xa8,
+  0x39,0x84,0x35,0x00,0x88,0x80,0x12,0x8c,0x1b,0x00,0x85,0x80,0x0b,0x9c,0xc7,0x01,
+  0x55,0x02,0x84,0x0f,0x03,0x55,0x58,0x22,0x05,0x8c,0x53,0x8b,0xd7,0x90,0x55,0x97,
+  0x93,0x84,0x9f,0x98,0x0b,0x90,0x1b,0x86,0x3b,0x8a,0x3f,0x81,0x2d,0x01,0x00,0x02,
+  0x90,0x0b,0x00,0x22,0x00,0x22,0xb4,0x00,0x04,0x02,0x00,0x02,0x20,0x00,0xb8,0x15,
+  0x88,0x00,0x06,0x20,0x02,0x55,0x50,0x05,0x55,0x22,0xc0,0x1d,0x04,0x02,0x22,0x00,
+  0x00,0x55,0x80,0x00,0x01,0x20,0x05,0xbc,0x1b,0x02,0x50,0x22,0x05,0x84,0x1a,0x02,
+  0x55,0x00,0x55,0xc4,0x1b,0x88,0x1a,0x00,0x55,0x80,0x55,0xb8,0x00,0x01,0x55,0x02,
+  0x8c,0x1b,0x03,0x55,0x55,0x22,0x20,0xcc,0x1b,0x84,0x73,0xc4,0x1b,0x07,0x00,0x55,
+  0x05,0x00,0x55,0x50,0x55,0x50,0xbc,0x1b,0x09,0x50,0x22,0x66,0x05,0x00,0x06,0x8a,
+  0x96,0x05,0x50,0xbc,0x6f,0x08,0x00,0x22,0x96,0x05,0x66,0x09,0x8a,0xa9,0x05,0xc8,
+  0xdf,0x07,0x96,0x00,0x96,0x69,0x8a,0xa9,0x00,0x90,0xc5,0x17,0x02,0x96,0x02,0x99,
+  0x80,0x1b,0x01,0x16,0x95,0xc4,0x1b,0x07,0x11,0x00,0x99,0x66,0xaa,0x99,0x19,0x9a,
+  0xc0,0x6f,0x08,0x00,0x10,0x33,0x96,0x61,0x11,0x99,0x19,0x99,0xbc,0x6d,0x09,0x30,
+  0x33,0x04,0x43,0x66,0x11,0x69,0x99,0x16,0x91,0xb4,0x1b,0x0b,0x30,0x22,0x04,0x43,
+  0x04,0x43,0x11,0x11,0x99,0x66,0x21,0x69,0xb8,0x1b,0x00,0x02,0x80,0x1b,0x01,0x44,
+  0x11,0x80,0x00,0x01,0x22,0x11,0xb4,0x1b,0x09,0x04,0x00,0x04,0x40,0x00,0x00,0x00,
+  0x11,0x00,0x00,0xb5,0x15,0x0d,0x02,0x22,0x77,0x44,0x04,0x04,0x80,0x33,0x88,0x00,
+  0x00,0x40,0x00,0x07,0xac,0x1f,0x80,0x1b,0x02,0x74,0x00,0x47,0x80,0x1b,0x08,0x88,
+  0x40,0x40,0x66,0x07,0x69,0x99,0x22,0x06,0xa8,0x1b,0x02,0x40,0x30,0x77,0x8c,0x1b,
+  0x02,0x96,0x07,0x99,0xa8,0x1b,0x07,0x60,0x22,0x40,0x06,0x30,0x47,0x88,0x03,0x8c,
+  0x1b,0xac,0x37,0x05,0x90,0x22,0x06,0x69,0x30,0x44,0x8c,0x1b,0x03,0x66,0x07,0x66,
+  0x66,0xa4,0x1b,0x0f,0x99,0x02,0x20,0x66,0x33,0x00,0x88,0x03,0x08,0x88,0x40,0x43,
+  0x00,0x04,0x66,0x60,0xa4,0x8b,0x05,0x69,0x02,0x22,0x06,0x33,0x02,0x84,0x1b,0x05,
+  0x00,0x43,0x22,0x20,0x00,0x02,0xa4,0xc3,0x01,0x99,0x90,0x80,0x37,0x06,0x30,0x88,
+  0x80,0x08,0x88,0x20,0x43,0xb4,0xf9,0x05,0x99,0x90,0x00,0x69,0x33,0x33,0xd4,0x1b,
+  0x02,0x06,0x66,0x03,0x80,0xc1,0x03,0x08,0x88,0x03,0x30,0xb4,0x1b,0x06,0x66,0x02,
+  0x00,0x66,0x80,0x00,0x88,0x80,0x00,0x01,0x00,0x08,0xb5,0x33,0x01,0x00,0x22,0x86,
+  0x7c,0x84,0x37,0xc6,0x65,0x82,0x7b,0x81,0x4c,0x04,0x50,0x00,0x58,0x55,0x22,0xb3,
+  0x0f,0x0b,0x02,0x22,0x85,0x55,0x58,0x88,0x22,0x20,0x55,0x02,0x88,0x85,0xb4,0x1b,
+  0x00,0x50,0xa0,0x1b,0x00,0x20,0xb3,0x0f,0x01,0x55,0x02,0x90,0x1b,0x02,0x50,0x58,
+  0x85,0xaf,0x47,0x00,0x02,0x84,0x6d,0x02,0x55,0x05,0x88,0x88,0x75,0x87,0x2b,0xa2,
+  0xbd,0x00,0x50,0x8b,0x25,0x87,0x5b,0x01,0x55,0x50,0x84,0x3f,0x9c,0x39,0x84,0x35,
+  0x00,0x88,0x80,0x12,0x8c,0x1b,0x00,0x55,0x80,0xc9,0x01,0x55,0x58,0x94,0xc7,0x87,
+  0x93,0x80,0x0f,0x00,0x88,0x84,0x83,0x8c,0x53,0x80,0x55,0x90,0xab,0x97,0x93,0x88,
+  0x1b,0x90,0x0b,0x94,0x1b,0x01,0x00,0x02,0x82,0x5f,0x80,0x00,0x00,0x20,0x80,0x81,
+  0x00,0x00,0x82,0xdd,0x84,0x00,0x01,0x22,0x20,
+};
+
+const unsigned int img_loserboy_lz_shifted_data_index[] = {
+  0,418,848,1275,1682,2078,2488,2970,3436,3919,4415,4895,5398,5912,6423,6940,
+  7323,7716,8107,8524,8936,9355,9803,10245,10706,11193,11674,12154,12659,13158,13653,14120,
+  14580,15060,15484,15928,16369,16801,17236,17676,18159,18633,19130,19631,20117,20617,21131,21642,
+  22159,22574,22998,23414,23859,24302,24746,25210,25681,26161,26632,27096,27554,28035,28513,28990,
+  29477,29972,
+};
+
+const unsigned char img_loserboy_palettes[] = {
+  0x00, 0x06, 0x0c, 0x10, 0x14, 0x15, 0x17, 0x25, 0x2a, 0x2b, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const unsigned char img_loserboy_palette_index[] = {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,
+};
+
+const unsigned short img_loserboy_span_index[] = {
+  0x0000,0x0000,0x0000,0x0000,0x0002,0x0005,0x0006,0x0009,0x000c,0x000f,0x0012,0x0015,
+  0x0018,0x001b,0x001d,0x0020,0x0022,0x0025,0x0027,0x0029,0x002c,0x002f,0x0032,0x0034,
+  0x0036,0x0037,0x0039,0x003c,0x003f,0x0042,0x0045,0x0046,0x0049,0x004a,0x004c,0x004f,
+  0x0050,0x0053,0x0056,0x0059,0x005b,0x005b,0x005b,0x005b,0x005d,0x0060,0x0061,0x0064,
+  0x0067,0x006a,0x006d,0x0070,0x0073,0x0076,0x0078,0x007a,0x007d,0x0080,0x0083,0x0085,
+  0x0087,0x0089,0x008c,0x008f,0x0092,0x0095,0x0097,0x0099,0x009b,0x009e,0x00a0,0x00a1,
+  0x00a4,0x00a7,0x00aa,0x00ac,0x00ad,0x00af,0x00b2,0x00b5,0x00b6,0x00b6,0x00b6,0x00b6,
+  0x00b8,0x00bb,0x00bc,0x00bf,0x00c2,0x00c5,0x00c8,0x00cb,0x00ce,0x00d1,0x00d4,0x00d7,
+  0x00da,0x00dc,0x00df,0x00e1,0x00e3,0x00e5,0x00ea,0x00ef,0x00f2,0x00f4,0x00f7,0x00f9,
+  0x00fc,0x00fe,0x0100,0x0105,0x010a,0x010e,0x0113,0x0118,0x011c,0x0121,0x0124,0x0127,
+  0x012a,0x012a,0x012a,0x012a,0x012c,0x012f,0x0130,0x0133,0x0136,0x0139,0x013c,0x013f,
+  0x0142,0x0145,0x0148,0x014b,0x014d,0x0150,0x0153,0x0155,0x0158,0x015b,0x0160,0x0165,
+  0x016a,0x016d,0x0170,0x0173,0x0175,0x0177,0x017c,0x0182,0x0186,0x018a,0x018e,0x0193,
+  0x0198,0x019e,0x01a3,0x01a8,0x01aa,0x01aa,0x01aa,0x01aa,0x01ac,0x01af,0x01b0,0x01b3,
+  0x01b6,0x01b9,0x01bc,0x01bf,0x01c2,0x01c5,0x01c8,0x01cb,0x01ce,0x01d1,0x01d3,0x01d5,
+  0x01da,0x01de,0x01e2,0x01e5,0x01e8,0x01eb,0x01f2,0x01f7,0x01f9,0x01fc,0x01fe,0x0202,
+  0x0207,0x020d,0x0213,0x0217,0x021c,0x0220,0x0224,0x0227,0x0228,0x0228,0x0228,0x0228,
+  0x022a,0x022d,0x022e,0x0231,0x0234,0x0237,0x023a,0x023d,0x0240,0x0243,0x0245,0x0248,
+  0x024b,0x024e,0x0250,0x0252,0x0255,0x0258,0x025b,0x025e,0x0261,0x0264,0x0267,0x026a,
+  0x026d,0x0270,0x0273,0x0276,0x0279,0x027c,0x027e,0x0280,0x0282,0x0284,0x0289,0x028e,
+  0x0292,0x0292,0x0292,0x0292,0x0294,0x0297,0x0298,0x029b,0x029e,0x02a1,0x02a4,0x02a7,
+  0x02aa,0x02ad,0x02af,0x02b2,0x02b5,0x02b8,0x02ba,0x02bc,0x02bf,0x02c2,0x02c5,0x02c8,
+  0x02cb,0x02cd,0x02ce,0x02cf,0x02d0,0x02d2,0x02d4,0x02d6,0x02d8,0x02db,0x02dd,0x02df,
+  0x02e2,0x02e7,0x02ec,0x02f1,0x02f5,0x02f5,0x02f5,0x02f5,0x02f7,0x02fa,0x02fb,0x02fe,
+  0x0301,0x0304,0x0307,0x030a,0x030d,0x0310,0x0312,0x0315,0x0318,0x031a,0x031d,0x031f,
+  0x0322,0x0325,0x0328,0x032b,0x032e,0x0332,0x0336,0x033b,0x033e,0x0341,0x0343,0x0348,
+  0x034d,0x0353,0x0358,0x035c,0x0361,0x0364,0x0367,0x0369,0x036c,0x036c,0x036c,0x036c,
+  0x036e,0x0371,0x0372,0x0375,0x0378,0x037b,0x037e,0x0381,0x0384,0x0387,0x038a,0x038c,
+  0x038f,0x0392,0x0395,0x0397,0x039a,0x039d,0x039f,0x03a1,0x03a5,0x03a7,0x03aa,0x03ac,
+  0x03af,0x03b4,0x03b9,0x03bd,0x03c1,0x03c5,0x03c9,0x03cc,0x03cf,0x03d1,0x03d4,0x03d7,
+  0x03d8,0x03d8,0x03d8,0x03d8,0x03da,0x03dd,0x03de,0x03e1,0x03e4,0x03e7,0x03ea,0x03ed,
+  0x03f0,0x03f3,0x03f5,0x03f8,0x03fb,0x03fe,0x0400,0x0401,0x0403,0x0405,0x0408,0x040d,
+  0x0412,0x0416,0x041b,0x041e,0x0422,0x0424,0x042a,0x042e,0x0435,0x0439,0x043c,0x043e,
+  0x0441,0x0443,0x0446,0x0448,0x0449,0x0449,0x044b,0x044e,0x0451,0x0454,0x0456,0x0458,
+  0x045a,0x045c,0x045f,0x0462,0x0465,0x0468,0x046b,0x046d,0x0470,0x0473,0x0476,0x0478,
+  0x047a,0x047b,0x047d,0x047f,0x0483,0x0486,0x048b,0x048e,0x0491,0x0494,0x0497,0x049a,
+  0x049e,0x04a2,0x04a7,0x04ab,0x04b0,0x04b4,0x04b9,0x04be,0x04c3,0x04c3,0x04c3,0x04c3,
+  0x04c5,0x04c8,0x04c9,0x04cc,0x04cf,0x04d2,0x04d5,0x04d8,0x04db,0x04de,0x04e0,0x04e3,
+  0x04e5,0x04e8,0x04ea,0x04ec,0x04ef,0x04f1,0x04f4,0x04f6,0x04f8,0x04f9,0x04fd,0x0500,
+  0x0502,0x0504,0x0506,0x0508,0x050b,0x050c,0x050e,0x0511,0x0512,0x0515,0x0518,0x051b,
+  0x051d,0x051d,0x051d,0x051d,0x051f,0x0522,0x0523,0x0526,0x0529,0x052c,0x052f,0x0532,
+  0x0535,0x0538,0x053a,0x053c,0x053f,0x0542,0x0545,0x0547,0x0549,0x054a,0x054d,0x0550,
+  0x0553,0x0555,0x055a,0x055d,0x055f,0x0561,0x0562,0x0563,0x0566,0x0569,0x056c,0x056e,
+  0x056f,0x0571,0x0574,0x0577,0x0578,0x0578,0x0578,0x0578,0x057a,0x057d,0x057e,0x0581,
+  0x0584,0x0587,0x058a,0x058d,0x0590,0x0593,0x0596,0x0599,0x059c,0x059e,0x05a1,0x05a3,
+  0x05a5,0x05a7,0x05ac,0x05b1,0x05b4,0x05b5,0x05ba,0x05bc,0x05bf,0x05c1,0x05c3,0x05c8,
+  0x05cd,0x05d1,0x05d6,0x05db,0x05df,0x05e4,0x05e7,0x05ea,0x05ed,0x05ed,0x05ed,0x05ed,
+  0x05ef,0x05f2,0x05f3,0x05f6,0x05f9,0x05fc,0x05ff,0x0602,0x0605,0x0608,0x060b,0x060e,
+  0x0610,0x0613,0x0616,0x0618,0x061b,0x061d,0x0622,0x0627,0x062c,0x062e,0x0633,0x0636,
+  0x0638,0x063a,0x063f,0x0645,0x0649,0x064d,0x0651,0x0656,0x065b,0x0661,0x0666,0x066b,
+  0x066d,0x066d,0x066d,0x066d,0x066f,0x0672,0x0673,0x0676,0x0679,0x067c,0x067f,0x0682,
+  0x0685,0x0688,0x068b,0x068e,0x0691,0x0694,0x0696,0x0698,0x069d,0x06a1,0x06a5,0x06a8,
+  0x06ab,0x06ae,0x06b5,0x06ba,0x06bc,0x06bf,0x06c1,0x06c5,0x06ca,0x06d0,0x06d6,0x06da,
+  0x06df,0x06e3,0x06e7,0x06ea,0x06eb,0x06eb,0x06eb,0x06eb,0x06ed,0x06f0,0x06f1,0x06f4,
+  0x06f7,0x06fa,0x06fd,0x0700,0x0703,0x0706,0x0708,0x070b,0x070e,0x0711,0x0713,0x0715,
+  0x0718,0x071a,0x071d,0x0720,0x0723,0x0725,0x072a,0x072d,0x0730,0x0733,0x0736,0x0739,
+  0x073c,0x073f,0x0741,0x0743,0x0745,0x0747,0x074c,0x0751,0x0755,0x0755,0x0755,0x0755,
+  0x0757,0x075a,0x075b,0x075e,0x0761,0x0764,0x0767,0x076a,0x076d,0x0770,0x0772,0x0775,
+  0x0778,0x077b,0x077d,0x077f,0x0782,0x0784,0x0787,0x078a,0x078d,0x078e,0x0792,0x0793,
+  0x0794,0x0796,0x0798,0x079a,0x079c,0x079f,0x07a1,0x07a3,0x07a6,0x07ab,0x07b0,0x07b5,
+  0x07b9,0x07b9,0x07b9,0x07b9,0x07bb,0x07be,0x07bf,0x07c2,0x07c5,0x07c8,0x07cb,0x07ce,
+  0x07d1,0x07d4,0x07d6,0x07d9,0x07dc,0x07df,0x07e2,0x07e3,0x07e5,0x07e7,0x07ea,0x07ed,
+  0x07f0,0x07f3,0x07f7,0x07fc,0x07ff,0x0802,0x0804,0x0809,0x080e,0x0814,0x0819,0x081d,
+  0x0822,0x0825,0x0828,0x082a,0x082d,0x082d,0x082d,0x082d,0x082f,0x0832,0x0833,0x0836,
+  0x0839,0x083c,0x083f,0x0842,0x0845,0x0848,0x084a,0x084d,0x0850,0x0852,0x0855,0x0857,
+  0x085a,0x085c,0x085f,0x0862,0x0867,0x0868,0x086b,0x086d,0x0870,0x0875,0x087a,0x087e,
+  0x0882,0x0886,0x088a,0x088d,0x0890,0x0892,0x0895,0x0898,0x0899,0x0899,0x0899,0x0899,
+  0x089b,0x089e,0x089f,0x08a2,0x08a5,0x08a8,0x08ab,0x08ae,0x08b1,0x08b4,0x08b6,0x08b8,
+  0x08bb,0x08be,0x08c1,0x08c3,0x08c5,0x08c7,0x08ca,0x08cf,0x08d4,0x08d7,0x08dc,0x08df,
+  0x08e3,0x08e5,0x08eb,0x08ef,0x08f6,0x08fa,0x08fd,0x08ff,0x0902,0x0904,0x0907,0x0909,
+  0x090a,0x090c,0x090f,0x0910,0x0913,0x0916,0x0919,0x091c,0x091f,0x0922,0x0925,0x0927,
+  0x092a,0x092d,0x0930,0x0932,0x0934,0x0937,0x093a,0x093c,0x093e,0x0940,0x0943,0x0946,
+  0x094b,0x094e,0x0952,0x0954,0x0957,0x095a,0x095d,0x0960,0x0964,0x0968,0x096d,0x0971,
+  0x0976,0x097a,0x097f,0x0984,0x0989,
+};
+
+const unsigned short img_loserboy_spans[] = {
+  0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x8407,0x010b,0x0106,0x8407,0x010b,0x8506,0x010b,0x0105,0x8506,
+  0x010b,0x8605,0x010b,0x0104,0x8605,0x0104,0x8505,0x010a,0x0104,0x8405,0x0109,0x0104,
+  0x8405,0x0109,0x8504,0x0109,0x8504,0x0109,0x8604,0x8604,0x010a,0x0104,0x8505,0x010a,
+  0x0104,0x8505,0x010a,0x0104,0x8505,0x010a,0x0105,0x8406,0x010a,0x8505,0x0104,0x8405,
+  0x0109,0x8504,0x0103,0x8504,0x0103,0x8404,0x0108,0x8504,0x0104,0x8405,0x0109,0x0104,
+  0x8405,0x0109,0x0104,0x8405,0x0109,0x8405,0x0109,0x0207,0x8109,0x0207,0x8109,0x010a,
+  0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x8407,0x010b,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0105,0x8506,0x010b,0x0105,
+  0x8506,0x8505,0x010a,0x8405,0x0109,0x0104,0x8405,0x0109,0x0104,0x8405,0x0109,0x0104,
+  0x8405,0x0109,0x0104,0x8405,0x0109,0x0104,0x8505,0x0104,0x8505,0x0104,0x8505,0x0104,
+  0x8405,0x0109,0x8405,0x0109,0x8405,0x0104,0x8305,0x0108,0x0104,0x8305,0x0108,0x0104,
+  0x8305,0x0108,0x8404,0x0108,0x8504,0x8504,0x0109,0x0104,0x8405,0x0109,0x0104,0x8405,
+  0x0109,0x8405,0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0205,0x8407,0x010b,0x0105,0x8506,0x010b,0x0105,
+  0x8506,0x010b,0x8605,0x010b,0x0104,0x8605,0x010b,0x0104,0x8605,0x8604,0x010a,0x0103,
+  0x8604,0x0103,0x8104,0x0105,0x8306,0x0209,0x0103,0x8104,0x0105,0x8506,0x010b,0x0103,
+  0x8704,0x010b,0x8704,0x010b,0x0104,0x8605,0x010b,0x8605,0x010b,0x0105,0x8306,0x0209,
+  0x0105,0x8406,0x8505,0x010a,0x0104,0x8205,0x0107,0x8308,0x010b,0x0104,0x8205,0x0107,
+  0x8308,0x010b,0x8304,0x0107,0x8308,0x010b,0x0103,0x8304,0x0107,0x8308,0x010b,0x0103,
+  0x8204,0x0206,0x8308,0x010b,0x0103,0x8204,0x0206,0x8308,0x0103,0x8304,0x0107,0x8208,
+  0x010a,0x0103,0x8304,0x8208,0x0103,0x8304,0x0208,0x0104,0x8105,0x0106,0x0207,0x8109,
+  0x0207,0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0205,0x8407,0x010b,0x0105,0x8506,0x010b,0x8605,0x010b,0x0104,0x8605,0x010b,
+  0x0104,0x8605,0x010b,0x0103,0x8704,0x0103,0x8604,0x010a,0x0103,0x8504,0x0309,0x0103,
+  0x8104,0x0105,0x8506,0x010b,0x0103,0x8104,0x0105,0x8506,0x010b,0x0103,0x8104,0x0105,
+  0x8506,0x010b,0x0303,0x8506,0x010b,0x0203,0x8605,0x010b,0x0103,0x8704,0x010b,0x0102,
+  0x8703,0x0102,0x8703,0x0102,0x8303,0x0106,0x8407,0x010b,0x0102,0x8203,0x0105,0x0107,
+  0x8308,0x010b,0x8302,0x0105,0x8308,0x010b,0x8302,0x0105,0x8308,0x010b,0x0101,0x8302,
+  0x8308,0x010b,0x0101,0x8202,0x0104,0x8308,0x010b,0x0101,0x8202,0x0104,0x0108,0x8209,
+  0x0101,0x8202,0x0104,0x0108,0x8109,0x010a,0x0101,0x8202,0x0108,0x8109,0x010a,0x8102,
+  0x0103,0x0108,0x8109,0x010a,0x0202,0x0208,0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,
+  0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0205,0x8407,0x010b,
+  0x0104,0x8605,0x010b,0x0103,0x8704,0x010b,0x0103,0x8704,0x010b,0x8803,0x010b,0x0102,
+  0x8803,0x0102,0x8203,0x0105,0x8506,0x010b,0x0102,0x8103,0x0204,0x8606,0x8103,0x0204,
+  0x8606,0x010c,0x0203,0x8705,0x010c,0x0104,0x8705,0x010c,0x8103,0x0104,0x8705,0x0102,
+  0x8103,0x0104,0x8405,0x0109,0x810a,0x010b,0x0102,0x8103,0x0104,0x8405,0x0109,0x8702,
+  0x0109,0x0101,0x8902,0x010b,0x0101,0x8a02,0x0101,0x8302,0x0105,0x8606,0x0101,0x8302,
+  0x0205,0x8407,0x010b,0x0101,0x8302,0x0105,0x0107,0x8308,0x010b,0x0101,0x8302,0x0105,
+  0x0107,0x8308,0x010b,0x0101,0x8202,0x8308,0x010b,0x0101,0x8102,0x0103,0x8308,0x010b,
+  0x0101,0x8102,0x0108,0x8209,0x0201,0x0108,0x8109,0x010a,0x0108,0x8109,0x010a,0x8109,
+  0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,
+  0x8407,0x010b,0x8506,0x010b,0x0105,0x8506,0x0105,0x8406,0x010a,0x0105,0x8306,0x0109,
+  0x0105,0x8306,0x0109,0x0105,0x8306,0x0109,0x0105,0x8306,0x0109,0x0105,0x8306,0x0109,
+  0x0105,0x8306,0x0109,0x0105,0x8306,0x0109,0x0105,0x8306,0x0109,0x0105,0x8306,0x0109,
+  0x0105,0x8306,0x0109,0x0104,0x8405,0x0109,0x0104,0x8405,0x0109,0x0104,0x8405,0x0109,
+  0x8504,0x0109,0x8504,0x0109,0x8504,0x0109,0x8504,0x0109,0x0104,0x8205,0x0107,0x8108,
+  0x0109,0x0104,0x8205,0x0107,0x8108,0x0109,0x8105,0x0206,0x8108,0x0109,0x0207,0x8109,
+  0x0207,0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x8506,0x010b,0x0105,0x8506,0x0105,0x8406,0x010a,0x0105,0x8306,0x0109,0x0105,0x8306,
+  0x0109,0x0105,0x8306,0x0109,0x0105,0x8306,0x0109,0x8405,0x0109,0x8405,0x8405,0x8405,
+  0x0104,0x8405,0x0104,0x8405,0x8504,0x0109,0x8504,0x0109,0x0103,0x8504,0x0109,0x0103,
+  0x8504,0x0103,0x8504,0x0103,0x8504,0x0109,0x0103,0x8204,0x0106,0x8207,0x0109,0x0103,
+  0x8104,0x0205,0x8207,0x0109,0x0103,0x8104,0x0205,0x8207,0x0109,0x0203,0x0106,0x8207,
+  0x0109,0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x8506,0x010b,0x0105,0x8506,0x010b,0x0105,0x8506,0x0105,0x8406,0x010a,0x0105,0x8406,
+  0x010a,0x0105,0x8406,0x010a,0x0105,0x8406,0x010a,0x0105,0x8406,0x010a,0x0103,0x0105,
+  0x8406,0x010a,0x8103,0x0104,0x8505,0x010a,0x0102,0x8103,0x0104,0x8505,0x010a,0x0102,
+  0x8603,0x0109,0x0102,0x8603,0x0109,0x8702,0x0109,0x0101,0x8502,0x0107,0x8108,0x0109,
+  0x0101,0x8402,0x0107,0x8208,0x010a,0x0101,0x8302,0x0105,0x0107,0x8208,0x010a,0x0101,
+  0x8302,0x0105,0x0107,0x8308,0x8302,0x0105,0x0107,0x8308,0x0103,0x8104,0x0105,0x0107,
+  0x8308,0x0107,0x8208,0x010a,0x0107,0x8208,0x010a,0x0107,0x8208,0x0107,0x8108,0x0109,
+  0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x0105,0x8506,0x010b,0x8605,0x010b,0x0104,0x8605,0x010b,0x0104,
+  0x8605,0x010b,0x0104,0x8605,0x010b,0x0104,0x8605,0x0104,0x8505,0x010a,0x0104,0x8505,
+  0x010a,0x0104,0x8605,0x0302,0x8605,0x0102,0x8103,0x0104,0x8605,0x8802,0x010a,0x0101,
+  0x8802,0x010a,0x0101,0x8802,0x0101,0x8802,0x010a,0x0101,0x8502,0x0107,0x8208,0x010a,
+  0x0101,0x8402,0x0106,0x8308,0x010b,0x0101,0x8402,0x0108,0x8309,0x0101,0x8302,0x0108,
+  0x8309,0x0101,0x8102,0x0108,0x8309,0x0201,0x0108,0x8209,0x010b,0x0108,0x8209,0x010b,
+  0x0108,0x8209,0x010b,0x0108,0x8209,0x0108,0x8109,0x010a,0x0108,0x8109,0x010a,0x0109,
+  0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x8407,0x010b,0x0106,0x8407,0x010b,0x0105,0x8506,0x010b,0x0104,
+  0x8605,0x010b,0x8704,0x010b,0x8704,0x8704,0x010b,0x8504,0x0309,0x0204,0x8506,0x010b,
+  0x8102,0x0103,0x0105,0x8506,0x010b,0x0101,0x8102,0x0103,0x8605,0x010b,0x8301,0x0104,
+  0x8605,0x010b,0x0100,0x8301,0x0104,0x8605,0x010b,0x0100,0x8801,0x0109,0x0100,0x8801,
+  0x0109,0x020b,0x8c00,0x010c,0x8500,0x0105,0x8106,0x0107,0x8408,0x010c,0x8500,0x0405,
+  0x8309,0x010c,0x0100,0x8101,0x0102,0x8203,0x0108,0x8309,0x010c,0x0203,0x0108,0x8309,
+  0x010c,0x0108,0x8309,0x010c,0x8309,0x010c,0x0109,0x820a,0x010c,0x0109,0x820a,0x0109,
+  0x810a,0x010b,0x810a,0x010b,0x020a,0x8108,0x0109,0x0107,0x8208,0x010a,0x0106,0x8307,
+  0x010a,0x0106,0x8307,0x010a,0x0106,0x8407,0x0106,0x8407,0x0106,0x8407,0x0106,0x8407,
+  0x0106,0x8307,0x010a,0x0106,0x8307,0x010a,0x0106,0x8307,0x010a,0x0106,0x8307,0x010a,
+  0x0106,0x8307,0x010a,0x8406,0x010a,0x0105,0x8406,0x010a,0x0105,0x8306,0x0109,0x0105,
+  0x8306,0x0109,0x8405,0x0309,0x8605,0x010b,0x8705,0x0104,0x8705,0x0104,0x8705,0x0104,
+  0x8105,0x0106,0x8507,0x0304,0x8307,0x020a,0x0104,0x8105,0x0106,0x8307,0x010a,0x0104,
+  0x8505,0x010a,0x0104,0x8505,0x010a,0x0104,0x8505,0x010a,0x0104,0x8505,0x010a,0x0105,
+  0x8406,0x010a,0x8205,0x0207,0x8109,0x010a,0x0104,0x8205,0x0207,0x8209,0x0104,0x8205,
+  0x0207,0x8209,0x010b,0x8304,0x0207,0x8209,0x010b,0x0103,0x8304,0x0207,0x8309,0x010c,
+  0x8403,0x0207,0x8309,0x010c,0x0102,0x8403,0x0108,0x8309,0x010c,0x0102,0x8403,0x0108,
+  0x8309,0x010c,0x0102,0x8403,0x0108,0x8309,0x010c,0x0207,0x8109,0x0207,0x8109,0x010a,
+  0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x8506,0x010b,0x0105,0x8506,0x010b,0x8605,0x010b,0x0104,0x8605,
+  0x0104,0x8605,0x010b,0x0104,0x8705,0x0104,0x8705,0x010c,0x8804,0x010c,0x8804,0x010c,
+  0x8804,0x8504,0x0109,0x810a,0x010b,0x0104,0x8405,0x0109,0x0104,0x8405,0x0104,0x8405,
+  0x0105,0x8306,0x8405,0x0109,0x0104,0x8405,0x0109,0x8504,0x0103,0x8504,0x0103,0x8404,
+  0x0108,0x8504,0x0104,0x8405,0x0109,0x0104,0x8405,0x0109,0x0104,0x8405,0x0109,0x8405,
+  0x0109,0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x8407,0x010b,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,
+  0x8407,0x010b,0x0105,0x8506,0x010b,0x0105,0x8506,0x8605,0x010b,0x8705,0x0104,0x8705,
+  0x010c,0x0104,0x8705,0x010c,0x0104,0x8705,0x010c,0x0104,0x8705,0x0104,0x8405,0x0109,
+  0x810a,0x010b,0x0104,0x8405,0x0109,0x0104,0x8405,0x0104,0x8405,0x8405,0x8405,0x0104,
+  0x8305,0x0108,0x0104,0x8305,0x0108,0x0104,0x8305,0x0108,0x8404,0x0108,0x8504,0x8504,
+  0x0109,0x0104,0x8405,0x0109,0x0104,0x8405,0x0109,0x8405,0x0207,0x8109,0x0207,0x8109,
+  0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0205,
+  0x8407,0x010b,0x0105,0x8506,0x010b,0x0105,0x8506,0x010b,0x8605,0x010b,0x0104,0x8605,
+  0x010b,0x0104,0x8605,0x8704,0x010b,0x0103,0x8804,0x0103,0x8104,0x0105,0x8606,0x010c,
+  0x0103,0x8104,0x0105,0x8606,0x010c,0x0103,0x8804,0x010c,0x8804,0x0104,0x8405,0x0109,
+  0x810a,0x010b,0x8405,0x0109,0x0105,0x8306,0x0109,0x0105,0x8406,0x8505,0x010a,0x0104,
+  0x8205,0x0107,0x8308,0x010b,0x0104,0x8205,0x0107,0x8308,0x010b,0x8304,0x0107,0x8308,
+  0x010b,0x0103,0x8304,0x0107,0x8308,0x010b,0x0103,0x8204,0x0206,0x8308,0x010b,0x0103,
+  0x8204,0x0206,0x8308,0x0103,0x8304,0x0107,0x8208,0x010a,0x0103,0x8304,0x8208,0x0103,
+  0x8304,0x0208,0x0104,0x8105,0x0106,0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0205,0x8407,0x010b,0x0105,
+  0x8506,0x010b,0x8605,0x010b,0x0104,0x8605,0x010b,0x0104,0x8605,0x010b,0x0103,0x8704,
+  0x0103,0x8704,0x010b,0x0103,0x8804,0x0103,0x8104,0x0105,0x8606,0x010c,0x0103,0x8104,
+  0x0105,0x8606,0x010c,0x0103,0x8104,0x0105,0x8606,0x010c,0x0303,0x8606,0x0203,0x8405,
+  0x0109,0x810a,0x010b,0x0103,0x8504,0x0109,0x0102,0x8703,0x0102,0x8703,0x0102,0x8303,
+  0x0106,0x8407,0x010b,0x0102,0x8203,0x0105,0x0107,0x8308,0x010b,0x8302,0x0105,0x8308,
+  0x010b,0x8302,0x0105,0x8308,0x010b,0x0101,0x8302,0x8308,0x010b,0x0101,0x8202,0x0104,
+  0x8308,0x010b,0x0101,0x8202,0x0104,0x0108,0x8209,0x0101,0x8202,0x0104,0x0108,0x8109,
+  0x010a,0x0101,0x8202,0x0108,0x8109,0x010a,0x8102,0x0103,0x0108,0x8109,0x010a,0x0202,
+  0x0208,0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x0205,0x8407,0x010b,0x0104,0x8605,0x010b,0x0103,0x8704,
+  0x010b,0x0103,0x8704,0x010b,0x8803,0x010b,0x0102,0x8803,0x0102,0x8203,0x0105,0x8506,
+  0x010b,0x0102,0x8103,0x0204,0x8606,0x8103,0x0204,0x8606,0x010c,0x0203,0x8705,0x010c,
+  0x0104,0x8705,0x010c,0x8103,0x0104,0x8705,0x0102,0x8103,0x0104,0x8405,0x0109,0x810a,
+  0x010b,0x0102,0x8103,0x0104,0x8405,0x0109,0x8702,0x0109,0x0101,0x8902,0x010b,0x0101,
+  0x8a02,0x0101,0x8302,0x0105,0x8606,0x0101,0x8302,0x0205,0x8407,0x010b,0x0101,0x8302,
+  0x0105,0x0107,0x8308,0x010b,0x0101,0x8302,0x0105,0x0107,0x8308,0x010b,0x0101,0x8202,
+  0x8308,0x010b,0x0101,0x8102,0x0103,0x8308,0x010b,0x0101,0x8102,0x0108,0x8209,0x0201,
+  0x0108,0x8109,0x010a,0x0108,0x8109,0x010a,0x8109,0x0207,0x8109,0x0207,0x8109,0x010a,
+  0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x8506,0x010b,0x0105,
+  0x8506,0x0105,0x8506,0x010b,0x0105,0x8606,0x0105,0x8606,0x010c,0x0105,0x8606,0x010c,
+  0x0105,0x8606,0x010c,0x0105,0x8606,0x0105,0x8306,0x0109,0x810a,0x010b,0x0105,0x8306,
+  0x0109,0x0105,0x8306,0x0109,0x0105,0x8306,0x0109,0x0105,0x8306,0x0109,0x0104,0x8405,
+  0x0109,0x0104,0x8405,0x0109,0x0104,0x8405,0x0109,0x8504,0x0109,0x8504,0x0109,0x8504,
+  0x0109,0x8504,0x0109,0x0104,0x8205,0x0107,0x8108,0x0109,0x0104,0x8205,0x0107,0x8108,
+  0x0109,0x8105,0x0206,0x8108,0x0109,0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x8506,0x010b,0x0105,0x8506,0x0105,
+  0x8506,0x010b,0x0105,0x8606,0x0105,0x8606,0x010c,0x0105,0x8606,0x010c,0x0105,0x8606,
+  0x010c,0x8705,0x8405,0x0109,0x810a,0x010b,0x8405,0x8405,0x0104,0x8405,0x0104,0x8405,
+  0x8504,0x0109,0x8504,0x0109,0x0103,0x8504,0x0109,0x0103,0x8504,0x0103,0x8504,0x0103,
+  0x8504,0x0109,0x0103,0x8204,0x0106,0x8207,0x0109,0x0103,0x8104,0x0205,0x8207,0x0109,
+  0x0103,0x8104,0x0205,0x8207,0x0109,0x0203,0x0106,0x8207,0x0109,0x0207,0x8109,0x0207,
+  0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,
+  0x8407,0x010b,0x8506,0x8506,0x010b,0x0105,0x8606,0x0105,0x8606,0x010c,0x0105,0x8606,
+  0x010c,0x0105,0x8606,0x010c,0x0103,0x0105,0x8606,0x8103,0x0104,0x8605,0x010b,0x0102,
+  0x8103,0x0104,0x8505,0x010a,0x0102,0x8603,0x0109,0x0102,0x8603,0x0109,0x8702,0x0109,
+  0x0101,0x8502,0x0107,0x8108,0x0109,0x0101,0x8402,0x0107,0x8208,0x010a,0x0101,0x8302,
+  0x0105,0x0107,0x8208,0x010a,0x0101,0x8302,0x0105,0x0107,0x8308,0x8302,0x0105,0x0107,
+  0x8308,0x0103,0x8104,0x0105,0x0107,0x8308,0x0107,0x8208,0x010a,0x0107,0x8208,0x010a,
+  0x0107,0x8208,0x0107,0x8108,0x0109,0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x8506,0x010b,0x0105,0x8506,0x010b,0x0105,0x8506,0x0105,
+  0x8506,0x010b,0x0105,0x8606,0x0105,0x8606,0x010c,0x0202,0x8705,0x010c,0x0102,0x8103,
+  0x0104,0x8705,0x010c,0x8a02,0x0101,0x8902,0x010b,0x0101,0x8802,0x0101,0x8802,0x010a,
+  0x0101,0x8502,0x0107,0x8208,0x010a,0x0101,0x8402,0x0106,0x8308,0x010b,0x0101,0x8402,
+  0x0108,0x8309,0x0101,0x8302,0x0108,0x8309,0x0101,0x8102,0x0108,0x8309,0x0201,0x0108,
+  0x8209,0x010b,0x0108,0x8209,0x010b,0x0108,0x8209,0x010b,0x0108,0x8209,0x0108,0x8109,
+  0x010a,0x0108,0x8109,0x010a,0x0109,0x0207,0x8109,0x0207,0x8109,0x010a,0x8407,0x0106,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,
+  0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x8407,0x010b,0x8407,0x010b,
+  0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x8506,
+  0x010b,0x0105,0x8606,0x0105,0x8606,0x010c,0x8102,0x0103,0x0105,0x8606,0x010c,0x0101,
+  0x8102,0x0103,0x8705,0x010c,0x8301,0x0104,0x8705,0x0100,0x8301,0x0104,0x8605,0x010b,
+  0x0100,0x8801,0x0109,0x0100,0x8801,0x0109,0x020b,0x8c00,0x010c,0x8500,0x0105,0x8106,
+  0x0107,0x8408,0x010c,0x8500,0x0405,0x8309,0x010c,0x0100,0x8101,0x0102,0x8203,0x0108,
+  0x8309,0x010c,0x0203,0x0108,0x8309,0x010c,0x0108,0x8309,0x010c,0x8309,0x010c,0x0109,
+  0x820a,0x010c,0x0109,0x820a,0x0109,0x810a,0x010b,0x810a,0x010b,0x020a,0x0207,0x8109,
+  0x0207,0x8109,0x010a,0x8407,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,0x010b,0x0106,0x8407,
+  0x010b,0x8407,0x010b,0x0107,0x8308,0x010b,0x0107,0x8308,0x010b,0x0106,0x8407,0x010b,
+  0x8506,0x010b,0x0105,0x8506,0x0105,0x8406,0x010a,0x0105,0x8406,0x010a,0x8705,0x010c,
+  0x8705,0x010c,0x8705,0x010c,0x0104,0x8705,0x010c,0x0104,0x8705,0x010c,0x0104,0x8105,
+  0x0106,0x8507,0x010c,0x0304,0x8307,0x030a,0x0104,0x8105,0x0106,0x8307,0x0104,0x8505,
+  0x0104,0x8505,0x010a,0x0104,0x8505,0x010a,0x0104,0x8505,0x010a,0x0105,0x8406,0x010a,
+  0x8205,0x0207,0x8109,0x010a,0x0104,0x8205,0x0207,0x8209,0x0104,0x8205,0x0207,0x8209,
+  0x010b,0x8304,0x0207,0x8209,0x010b,0x0103,0x8304,0x0207,0x8309,0x010c,0x8403,0x0207,
+  0x8309,0x010c,0x0102,0x8403,0x0108,0x8309,0x010c,0x0102,0x8403,0x0108,0x8309,0x010c,
+  0x0102,0x8403,0x0108,0x8309,0x010c,
+};
+
+const unsigned char img_loserboy_bbox[] = {
+  0x03,0x27,0x03,0x0b, 0x03,0x27,0x04,0x0b, 0x03,0x27,0x03,0x0b, 0x03,0x27,0x01,0x0b, 
+  0x03,0x27,0x01,0x0c, 0x03,0x27,0x04,0x0b, 0x03,0x27,0x03,0x0b, 0x03,0x27,0x01,0x0b, 
+  0x03,0x27,0x01,0x0b, 0x03,0x27,0x00,0x0c, 0x01,0x27,0x02,0x0c, 0x03,0x27,0x03,0x0c, 
+  0x03,0x27,0x04,0x0c, 0x03,0x27,0x03,0x0c, 0x03,0x27,0x01,0x0c, 0x03,0x27,0x01,0x0c, 
+  0x03,0x27,0x04,0x0c, 0x03,0x27,0x03,0x0c, 0x03,0x27,0x01,0x0c, 0x03,0x27,0x01,0x0c, 
+  0x03,0x27,0x00,0x0c, 0x00,0x27,0x02,0x0c, 
 };
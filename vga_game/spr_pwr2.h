@@ -3,158 +3,2111 @@
 const int img_pwr2_width   = 54;
 const int img_pwr2_height  = 43;
 const int img_pwr2_stride  = 14;
-const int img_pwr2_num_spr = 2;
+const int img_pwr2_num_spr = 1;
 
 const unsigned int img_pwr2_data[] = {
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccc0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xd0d0d0d0u,
-  0xd0d0d0d0u,0xc0d0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0d0d0u,0xd0d0d0d0u,0xd0d0d0d0u,0xd0d0d0d0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xc0c0d0c0u,0xd0d0d0d0u,0xd0d0d0d0u,0xd0d0d0d0u,0xd0d0d0d0u,0xd0d0c0c0u,0xc0c0c0c0u,
-  0xccc0ccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0d0d0u,
-  0xd0d0d0d0u,0xe0d0e0e0u,0xe0e0e0e0u,0xd0e0d0d0u,0xd0d0c0d0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccc0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xd0d0d0d0u,0xd0d0e0e0u,0xe0e0e0e0u,
-  0xe4e4e0e0u,0xe0e0e0e0u,0xd0d0d0d0u,0xc0d0c0c0u,0xc0c0ccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xc0c0d0c0u,0xd0d0d0d0u,0xe0e0e4e0u,0xe4e4f4e4u,0xf4f4f4f4u,0xe4e4e0e4u,
-  0xd0e0d0d0u,0xd0d0c0c0u,0xc0c0ccc0u,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0d0d0u,0xd0d0e0e0u,0xe4e0f4e4u,0xf4f4f4f4u,0xf4f4f4f4u,0xf4f4e4f4u,0xe0e4d0e0u,0xd0d0c0d0u,
-  0xc0c0ccc0u,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xd0d0d0d0u,0xe0e0e4e0u,
-  0xf4f4f4f4u,0xf4f4f4f4u,0xf4f4f4f4u,0xf4f4f4f4u,0xe4f4e0e0u,0xd0d0c0d0u,0xc0c0c0c0u,0xccccc0c0u,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d0c0u,0xd0d0e0e0u,0xe4e4f4f4u,0xf4f4f4f4u,0xf8f4f8f8u,
-  0xf8f8f8f8u,0xf4f8f4f4u,0xf4f4e0e4u,0xd0e0d0d0u,0xc0c0c0c0u,0xccccc0c0u,0xccccccccu,0xccccccccu,
-  0xc0ccc0c0u,0xd0c0d0d0u,0xe0e0e4e4u,0xf4f4f4f4u,0xf4f4f8f8u,0xf8f8f9f8u,0xf9f9f9f9u,0xf8f9f4f8u,
-  0xf4f4e4f4u,0xe0e0d0d0u,0xc0d0c0c0u,0xccc0c0c0u,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xd0d0e0e0u,
-  0xf4e4f4f4u,0xf4f4f8f4u,0xf8f8f9f9u,0xfdf9fefeu,0xfefefefeu,0xf9fef8f9u,0xf4f8f4f4u,0xe0e4d0d0u,
-  0xc0d0c0c0u,0xccc0c0c0u,0xccccccccu,0xc0ccc0c0u,0xc0c0d0d0u,0xe0d0f4e4u,0xf4f4f4f4u,0xf8f8f8f8u,
-  0xf9f9fef9u,0xfefefefeu,0xfffeffffu,0xfefef9feu,0xf8f9f4f4u,0xe0f4d0e0u,0xc0d0c0c0u,0xccc0c0c0u,
-  0xccccc0ccu,0xc0c0d0c0u,0xd0d0e0e0u,0xf4e4f4f4u,0xf8f8f9f9u,0xf9f9fefeu,0xfefefffeu,0xffffffffu,
-  0xffffffffu,0xfffffefeu,0xf9f9f4f8u,0xe4f4d0e0u,0xd0d0c0c0u,0xc0c0c0c0u,0xc0c0d0c0u,0xd0d0e0e0u,
-  0xf4e4f4f4u,0xf4f4f8f8u,0xf9f8f9f9u,0xfefdfefeu,0xfefeffffu,0xffffffffu,0xffffffffu,0xfffffeffu,
-  0xf9fef4f8u,0xf4f4e0e0u,0xd0d0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xd0c0d0d0u,0xe0e0f4e4u,0xf4f4f4f4u,
-  0xf8f8f9f8u,0xf9f9fefeu,0xfefefefeu,0xffffffffu,0xffffffffu,0xffffffffu,0xfefef8f9u,0xf4f4e0e4u,
-  0xd0d0c0c0u,0xc0c0c0c0u,0xccccccccu,0xc0c0c0c0u,0xd0d0e0e0u,0xf4e4f4f4u,0xf8f4f8f8u,0xf9f9fef9u,
-  0xfefefefeu,0xffffffffu,0xffffffffu,0xffffffffu,0xfefef8f9u,0xf4f4e0e4u,0xd0d0c0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xc0ccc0c0u,0xd0d0e0e0u,0xf4e4f4f4u,0xf8f8f8f8u,0xf9f9fef9u,0xfefefefeu,0xffffffffu,
-  0xffffffffu,0xffffffffu,0xfefff9feu,0xf4f4e0e4u,0xd0d0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccc0c0u,
-  0xe0d0f4e4u,0xf4f4f8f8u,0xf8f8f9f9u,0xf9f9fefdu,0xfefefefeu,0xffffffffu,0xffffffffu,0xffffffffu,
-  0xfefff9feu,0xf4f4e0e4u,0xd0d0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccd0c0u,0xe4e0f4f4u,0xf8f4f8f8u,
-  0xf9f9f9f9u,0xfefdfefeu,0xfefefefeu,0xffffffffu,0xffffffffu,0xffffffffu,0xfefff9feu,0xf4f4e0e4u,
-  0xd0d0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccc0ccu,0xd0c0e4d0u,0xf4e4f8f4u,0xf8f8f9f8u,0xf9f9fefeu,
-  0xfefefefeu,0xffffffffu,0xffffffffu,0xffffffffu,0xfefff8f9u,0xf4f4e0e4u,0xd0d0c0c0u,0xc0c0c0c0u,
-  0xccccccccu,0xccccc0ccu,0xc0c0d0d0u,0xe4e0f4f4u,0xf4f4f8f8u,0xf9f9fdf9u,0xfefefefeu,0xfffeffffu,
-  0xffffffffu,0xffffffffu,0xfefef8f9u,0xf4f4e0e4u,0xd0d0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,
-  0xc0c0d0c0u,0xe0d0f4e4u,0xf4f4f8f8u,0xf9f9f9f9u,0xfefefefeu,0xfefeffffu,0xffffffffu,0xfffffeffu,
-  0xf9fef4f8u,0xf4f4d0e0u,0xd0d0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xc0c0d0c0u,0xe0d0e4e0u,
-  0xf4f4f8f4u,0xf9f8f9f9u,0xfefdfefeu,0xfefefffeu,0xffffffffu,0xfefffefeu,0xf9f9f4f8u,0xe4f4d0e0u,
-  0xd0d0c0c0u,0xccc0c0c0u,0xccccccccu,0xccccc0ccu,0xc0c0d0c0u,0xe0d0f4e4u,0xf4f4f8f8u,0xf9f8f9f9u,
-  0xfefefefeu,0xfefefefeu,0xfefefefeu,0xfefef9fdu,0xf8f8f4f4u,0xe0f4d0e0u,0xc0d0c0c0u,0xccc0c0c0u,
-  0xccccccccu,0xc0ccc0c0u,0xd0d0e0d0u,0xf4e4f4f4u,0xf8f4f8f8u,0xf9f9f9f9u,0xf9f9fef9u,0xfefefefeu,
-  0xfefef9f9u,0xf9f9f8f9u,0xf4f8f4f4u,0xe0e4d0d0u,0xc0d0c0c0u,0xccc0c0c0u,0xccccccccu,0xccccccccu,
-  0xc0c0d0c0u,0xd0d0e0d0u,0xe4e4f4f4u,0xf4f4f8f4u,0xf8f8f9f8u,0xf9f9f9f9u,0xf9f9f8f8u,0xf8f8f4f8u,
-  0xf4f4e4f4u,0xd0e0d0d0u,0xc0c0c0c0u,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccc0c0u,0xd0c0d0d0u,
-  0xe0d0e4e4u,0xf4f4f4f4u,0xf4f4f8f8u,0xf8f8f8f8u,0xf8f8f8f8u,0xf4f4f4f4u,0xf4f4e0e4u,0xd0d0d0d0u,
-  0xc0c0c0c0u,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0d0c0u,0xd0d0e0d0u,0xe4e0f4f4u,
-  0xf4f4f4f4u,0xf4f4f4f4u,0xf4f4f4f4u,0xf4f4f4f4u,0xe0e4d0e0u,0xd0d0c0d0u,0xc0c0ccc0u,0xccccc0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xd0c0d0d0u,0xe0d0e4e0u,0xf4e4f4f4u,0xf4f4f4f4u,
-  0xf4f4f4f4u,0xf4f4e4e4u,0xe0e0d0d0u,0xd0d0c0c0u,0xc0c0ccc0u,0xccccc0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xc0c0d0d0u,0xd0d0e0d0u,0xe0e0e4e4u,0xe4e4f4f4u,0xe4f4e4e4u,0xe0e4e0e0u,
-  0xd0e0d0d0u,0xc0d0c0c0u,0xc0c0ccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,
-  0xc0c0c0c0u,0xd0d0d0d0u,0xe0d0e0e0u,0xe0e0e0e0u,0xe0e0e0e0u,0xe0e0d0d0u,0xd0d0d0d0u,0xc0c0c0c0u,
-  0xccc0ccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0d0d0u,
-  0xd0d0d0d0u,0xe0d0e0e0u,0xe0e0d0e0u,0xd0d0d0d0u,0xd0d0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccc0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0d0c0u,0xd0d0d0d0u,0xd0d0d0d0u,
-  0xd0d0d0d0u,0xd0d0d0d0u,0xc0d0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0d0d0u,0xd0d0d0d0u,0xd0d0d0d0u,0xd0d0c0d0u,
-  0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0d0d0u,0xd0d0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,
-  0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xd0c0d0d0u,0xd0d0d0d0u,
-  0xd0d0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xc0c0d0d0u,0xd0d0d0d0u,0xd0d0d0d0u,0xd0d0d0d0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0c0c0u,0xd0d0d0d0u,0xd0d0d0d0u,0xd0d0d0d0u,0xd0d0d0d0u,0xd0d0c0d0u,0xc0c0c0c0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xc0c0c0c0u,0xc0c0d0c0u,0xd0d0d0d0u,
-  0xe0d0e0e0u,0xe0e0e0e0u,0xd0e0d0d0u,0xd0d0d0d0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xccccccccu,0xc0c0c0c0u,0xd0c0d0d0u,0xd0d0e0e0u,0xe0e0e0e0u,0xe4e4e0e0u,
-  0xe0e0e0e0u,0xd0d0d0d0u,0xd0d0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xccccc0ccu,0xc0c0c0c0u,0xd0d0d0d0u,0xe0d0e4e0u,0xe4e4f4f4u,0xf4f4e4f4u,0xe4e4e0e4u,0xe0e0d0d0u,
-  0xd0d0c0d0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccc0ccu,0xc0c0d0c0u,
-  0xd0d0e0d0u,0xe4e0f4e4u,0xf4f4f4f4u,0xf4f4f4f4u,0xf4f4e4f4u,0xe0e4e0e0u,0xd0d0d0d0u,0xc0c0c0c0u,
-  0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccc0c0u,0xc0c0d0c0u,0xd0d0e0e0u,0xf4e4f4f4u,
-  0xf4f4f4f4u,0xf4f4f4f4u,0xf4f4f4f4u,0xf4f4e0e4u,0xe0e0d0d0u,0xd0d0c0c0u,0xc0c0ccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xccccc0c0u,0xc0c0d0d0u,0xe0d0e4e0u,0xf4f4f4f4u,0xf8f4f8f8u,0xf8f8f8f8u,
-  0xf4f8f4f4u,0xf4f4f4f4u,0xe4e4e0e0u,0xd0d0c0d0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xc0ccc0c0u,0xd0c0d0d0u,0xe0e0f4e4u,0xf4f4f8f4u,0xf9f8f9f9u,0xf9f9f8f9u,0xf8f8f8f8u,0xf4f4f4f4u,
-  0xf4f4e4e4u,0xe0e0d0d0u,0xc0d0c0c0u,0xccc0ccccu,0xccccccccu,0xccccc0c0u,0xc0ccc0c0u,0xd0c0d0d0u,
-  0xe4e0f4f4u,0xf8f4f9f8u,0xfef9fefeu,0xfefefefeu,0xf9fdf9f9u,0xf8f8f4f8u,0xf4f4f4f4u,0xe4f4e0e0u,
-  0xd0d0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccc0c0u,0xc0ccc0c0u,0xd0c0e0d0u,0xf4e0f4f4u,0xf9f8fef9u,
-  0xfefeffffu,0xfefffefeu,0xfefef9feu,0xf9f9f8f8u,0xf8f8f4f4u,0xf4f4e4f4u,0xd0e0d0d0u,0xc0c0c0c0u,
-  0xccc0ccccu,0xccccc0c0u,0xc0c0c0c0u,0xd0d0e0d0u,0xf4e4f8f4u,0xf9f9fefeu,0xffffffffu,0xffffffffu,
-  0xfffffeffu,0xfefefefeu,0xf9f9f9f9u,0xf8f8f4f4u,0xe4f4e0e0u,0xd0d0c0d0u,0xc0c0ccc0u,0xccccc0c0u,
-  0xc0c0c0c0u,0xd0d0e0e0u,0xf4f4f8f4u,0xfef9fffeu,0xffffffffu,0xffffffffu,0xffffffffu,0xfefefefeu,
-  0xfdfef9f9u,0xf8f9f8f8u,0xf4f4f4f4u,0xe4f4e0e0u,0xd0d0c0d0u,0xc0c0c0c0u,0xc0c0c0c0u,0xd0d0e4e0u,
-  0xf4f4f9f8u,0xfefeffffu,0xffffffffu,0xffffffffu,0xfffffefeu,0xfefefefeu,0xf9f9f8f9u,0xf8f8f4f4u,
-  0xf4f4e4f4u,0xe0e0d0d0u,0xc0d0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xd0d0e4e0u,0xf4f4f9f8u,0xfefeffffu,
-  0xffffffffu,0xffffffffu,0xfffffefeu,0xfefef9feu,0xf9f9f8f8u,0xf4f8f4f4u,0xe4f4e0e0u,0xd0d0c0c0u,
-  0xc0c0ccccu,0xccccc0c0u,0xc0c0c0c0u,0xd0d0e4e0u,0xf4f4fef9u,0xfffeffffu,0xffffffffu,0xffffffffu,
-  0xfffffefeu,0xfefef9feu,0xf9f9f8f8u,0xf8f8f4f4u,0xe4f4e0e0u,0xd0d0c0c0u,0xccc0ccccu,0xccccc0c0u,
-  0xc0c0c0c0u,0xd0d0e4e0u,0xf4f4fef9u,0xfffeffffu,0xffffffffu,0xffffffffu,0xfffffefeu,0xfefefdfeu,
-  0xf9f9f9f9u,0xf8f8f8f8u,0xf4f4e4f4u,0xd0e0c0c0u,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xd0d0e4e0u,
-  0xf4f4fef9u,0xfffeffffu,0xffffffffu,0xffffffffu,0xfffffefeu,0xfefefefeu,0xfdfef9f9u,0xf9f9f8f8u,
-  0xf4f8f4f4u,0xe0e4c0d0u,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xd0d0e4e0u,0xf4f4f9f8u,0xfffeffffu,
-  0xffffffffu,0xffffffffu,0xfffffefeu,0xfefefefeu,0xf9f9f8f9u,0xf8f8f4f8u,0xe4f4d0e4u,0xc0d0ccc0u,
-  0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xd0d0e4e0u,0xf4f4f9f8u,0xfefeffffu,0xffffffffu,0xffffffffu,
-  0xfefffefeu,0xfefef9fdu,0xf9f9f8f8u,0xf4f4f4f4u,0xe0e4d0d0u,0xc0c0ccc0u,0xccccccccu,0xccccc0c0u,
-  0xc0c0c0c0u,0xd0d0e0d0u,0xf4f4f8f4u,0xfef9fffeu,0xffffffffu,0xffffffffu,0xfefefefeu,0xfefef9f9u,
-  0xf9f9f8f8u,0xf4f4e4f4u,0xd0e0c0d0u,0xc0c0ccccu,0xccccccccu,0xccccc0c0u,0xc0ccc0c0u,0xd0d0e0d0u,
-  0xf4e4f8f4u,0xf9f9fefeu,0xfffeffffu,0xfffffeffu,0xfefefefeu,0xfdfef9f9u,0xf8f9f4f8u,0xf4f4e0e4u,
-  0xd0e0c0d0u,0xc0c0ccccu,0xccccccccu,0xccccc0c0u,0xc0ccc0c0u,0xd0c0e0d0u,0xf4e0f4f4u,0xf8f8fdf9u,
-  0xfefefefeu,0xfefefefeu,0xfefefefeu,0xfefef9f9u,0xf8f9f8f8u,0xf4f4e4f4u,0xd0e0c0d0u,0xc0c0ccc0u,
-  0xccccccccu,0xccccc0c0u,0xc0ccc0c0u,0xd0c0d0d0u,0xe4e0f4f4u,0xf8f4f9f8u,0xf9f9f9f9u,0xfefefefeu,
-  0xfefef9feu,0xf9f9f9f9u,0xf9f9f8f8u,0xf4f8f4f4u,0xe4f4d0e0u,0xd0d0c0c0u,0xccc0ccccu,0xccccc0c0u,
-  0xccccc0c0u,0xc0c0d0d0u,0xe0d0f4e4u,0xf4f4f8f4u,0xf8f8f8f8u,0xf9f9f9f9u,0xf9f9f8f9u,0xf8f8f4f8u,
-  0xf4f4f4f4u,0xe4e4d0e0u,0xd0d0c0d0u,0xc0c0ccccu,0xccccccccu,0xccccc0c0u,0xccccc0c0u,0xc0c0d0d0u,
-  0xd0d0e4e0u,0xf4f4f4f4u,0xf4f4f8f8u,0xf8f8f8f8u,0xf8f8f8f8u,0xf4f4f4f4u,0xf4f4e4e4u,0xd0e0d0d0u,
-  0xc0d0c0c0u,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccc0ccu,0xc0c0d0c0u,0xd0d0e0d0u,0xe4e0f4f4u,
-  0xf4f4f4f4u,0xf4f4f4f4u,0xf4f4f4f4u,0xf4f4f4f4u,0xe0e4d0e0u,0xd0d0c0d0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xccccc0ccu,0xc0c0c0c0u,0xd0d0d0d0u,0xe0e0e4e4u,0xf4f4f4f4u,0xf4f4f4f4u,
-  0xf4f4f4f4u,0xe4f4e0e4u,0xd0e0d0d0u,0xc0d0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xccccccccu,0xc0c0c0c0u,0xd0c0d0d0u,0xe0d0e0e0u,0xe4e0e4e4u,0xf4e4f4f4u,0xe4e4e4e4u,0xe0e0d0e0u,
-  0xd0d0d0d0u,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xc0ccc0c0u,
-  0xc0c0d0d0u,0xd0d0d0d0u,0xe0e0e0e0u,0xe0e0e0e0u,0xe0e0e0e0u,0xd0e0d0d0u,0xd0d0c0c0u,0xc0c0ccc0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xc0ccc0c0u,0xc0c0c0c0u,0xd0d0d0d0u,
-  0xd0d0e0d0u,0xe0e0e0e0u,0xd0e0d0d0u,0xd0d0d0d0u,0xc0c0c0c0u,0xc0c0ccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,0xd0c0d0d0u,0xd0d0d0d0u,0xd0d0d0d0u,
-  0xd0d0d0d0u,0xd0d0c0d0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0d0c0u,0xd0d0d0d0u,0xd0d0d0d0u,0xd0d0d0d0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xd0d0d0d0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccc0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,
-  0xc0c0c0c0u,0xc0c0ccc0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xc0c0c0c0u,0xc0c0c0c0u,0xccc0ccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccc0ccu,0xc0c0c0c0u,0xccccccccu,0xccccccccu,0xccccccccu,0xccccccccu,
-  0xccccccccu,0xccccccccu,0xccccccccu,0xccccc0c0u,
+  0x11111111u,0x11111111u,0x11111111u,0x00001101u,0x00110000u,0x11111111u,0x11001111u,0x11111111u,
+  0x11111111u,0x11111111u,0x00000000u,0x00000000u,0x11111011u,0x11001111u,0x11111111u,0x11111111u,
+  0x11001111u,0x00000000u,0x00000000u,0x11110010u,0x11001111u,0x11111111u,0x11111111u,0x00001111u,
+  0x00000000u,0x00000000u,0x10110000u,0x11001111u,0x11111111u,0x11111111u,0x00001101u,0x22220000u,
+  0x02002222u,0x00110000u,0x11001111u,0x11111111u,0x11111111u,0x00001100u,0x22220022u,0x22222222u,
+  0x00000000u,0x11001111u,0x11111111u,0x11111111u,0x00200100u,0x22222222u,0x22222222u,0x00002200u,
+  0x11001011u,0x11111111u,0x11111111u,0x00220000u,0x32332222u,0x23223333u,0x00002202u,0x11000011u,
+  0x11111111u,0x11011111u,0x22220000u,0x33332233u,0x33334433u,0x02002222u,0x11000011u,0x11111111u,
+  0x11001111u,0x22220020u,0x44543343u,0x44345555u,0x22002322u,0x11000010u,0x11111111u,0x01001111u,
+  0x22330022u,0x55554354u,0x55455555u,0x22023423u,0x11000010u,0x11111111u,0x00001111u,0x33432222u,
+  0x55555555u,0x55555555u,0x22024533u,0x11000000u,0x11111111u,0x00201101u,0x44552233u,0x65665555u,
+  0x56556666u,0x23225534u,0x11000000u,0x11111111u,0x20220100u,0x55553344u,0x66765566u,0x67567777u,
+  0x33225545u,0x10000200u,0x11011111u,0x22330000u,0x55655455u,0x87996677u,0x79679999u,0x34225655u,
+  0x10000200u,0x01001111u,0x32540022u,0x66665555u,0x99997797u,0x9979a9aau,0x35236755u,0x10000200u,
+  0x00201101u,0x54552233u,0x77996677u,0xaaaa99a9u,0xaa99aaaau,0x45237756u,0x00002200u,0x22330020u,
+  0x55665455u,0x98997677u,0xaaaa99aau,0xaa9aaaaau,0x55337956u,0x00002200u,0x20220000u,0x55553354u,
+  0x77996676u,0xaaaa9999u,0xaaaaaaaau,0x55349967u,0x00002200u,0x00001111u,0x54552233u,0x77976566u,
+  0xaaaa9999u,0xaaaaaaaau,0x55349967u,0x00002200u,0x01001111u,0x54552233u,0x77976666u,0xaaaa9999u,
+  0xaaaaaaaau,0x55349a79u,0x00002200u,0x11001111u,0x55663254u,0x77986677u,0xaaaa9999u,0xaaaaaaaau,
+  0x55349a79u,0x00002200u,0x11201111u,0x65664355u,0x98997777u,0xaaaa9999u,0xaaaaaaaau,0x55349a79u,
+  0x00002200u,0x11011111u,0x54652042u,0x77996676u,0xaaaa9999u,0xaaaaaaaau,0x55349a67u,0x00002200u,
+  0x11011111u,0x43550022u,0x77875566u,0xa9aa9999u,0xaaaaaaaau,0x55349967u,0x00002200u,0x11111111u,
+  0x32540020u,0x77775566u,0x99aa9999u,0xaa9aaaaau,0x55237956u,0x00002200u,0x11111111u,0x32430020u,
+  0x76775565u,0x99a99899u,0x9a99aaaau,0x45237756u,0x10002200u,0x11011111u,0x32540020u,0x76775566u,
+  0x99999999u,0x99789999u,0x35236655u,0x10000200u,0x01001111u,0x54552232u,0x77776566u,0x99997797u,
+  0x77679977u,0x34225655u,0x10000200u,0x11111111u,0x22320020u,0x55654455u,0x77776676u,0x66567766u,
+  0x23225545u,0x11000000u,0x11111111u,0x20221100u,0x55553244u,0x66665566u,0x55556666u,0x22225534u,
+  0x11000000u,0x11111111u,0x00201101u,0x43552232u,0x55555555u,0x55555555u,0x22023423u,0x11000010u,
+  0x11111111u,0x01001111u,0x32432022u,0x55555455u,0x55445555u,0x22003322u,0x11000010u,0x11111111u,
+  0x11001111u,0x22320022u,0x44553344u,0x34334544u,0x02002322u,0x11000011u,0x11111111u,0x11011111u,
+  0x22220000u,0x33333233u,0x33223333u,0x00002222u,0x11001011u,0x11111111u,0x11111111u,0x00220000u,
+  0x32332222u,0x22223323u,0x00002200u,0x11001011u,0x11111111u,0x11111111u,0x00200100u,0x22222222u,
+  0x22222222u,0x00000200u,0x11001111u,0x11111111u,0x11111111u,0x00001100u,0x22220022u,0x22022222u,
+  0x00100000u,0x11001111u,0x11111111u,0x11111111u,0x00001101u,0x00220000u,0x00002200u,0x00110000u,
+  0x11001111u,0x11111111u,0x11111111u,0x01001111u,0x00000000u,0x00000000u,0x11110000u,0x11001111u,
+  0x11111111u,0x11111111u,0x11011111u,0x00000000u,0x00000000u,0x11110011u,0x11001111u,0x11111111u,
+  0x11111111u,0x11111111u,0x00000100u,0x00100000u,0x11111111u,0x11001111u,0x11111111u,0x11111111u,
+  0x11111111u,0x11001111u,0x11110010u,0x11111111u,0x11001111u,
+};
+
+const unsigned int img_pwr2_shifted_data[] = {
+  0x11111111u,0x11111111u,0x11111111u,0x00001111u,0x00100000u,0x11111111u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00000100u,0x00000000u,0x11110011u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11011111u,0x00000000u,0x00000000u,0x11110000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x01001111u,0x00000000u,0x00000000u,0x00110000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001111u,0x20220000u,0x22002222u,0x00100000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001101u,0x22220020u,0x22222222u,0x00000200u,0x11111011u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001100u,0x22222222u,0x22222222u,0x00002202u,0x11110011u,0x00001111u,
+  0x11111111u,0x11111111u,0x00200100u,0x22332222u,0x33223333u,0x00002222u,0x11110010u,0x00001111u,
+  0x11111111u,0x11111111u,0x20220000u,0x33332232u,0x33334334u,0x22002322u,0x11110010u,0x00001111u,
+  0x11111111u,0x11011111u,0x22220000u,0x44443233u,0x45445555u,0x22023322u,0x11110000u,0x00001111u,
+  0x11111111u,0x11001111u,0x22320020u,0x55553344u,0x55555555u,0x22224433u,0x11110000u,0x00001111u,
+  0x11111111u,0x01001111u,0x32332022u,0x55555455u,0x55555555u,0x23225534u,0x10110000u,0x00001111u,
+  0x11111111u,0x00001111u,0x43542232u,0x55665555u,0x66556666u,0x33225545u,0x10110200u,0x00001111u,
+  0x11111111u,0x00221100u,0x54553243u,0x66665565u,0x77667777u,0x34235555u,0x00112200u,0x00001111u,
+  0x11111111u,0x20320000u,0x55554355u,0x77986676u,0x99779999u,0x45236655u,0x00112200u,0x00001111u,
+  0x11001111u,0x22430020u,0x65665555u,0x99997677u,0x9a9999aau,0x55337756u,0x00112200u,0x00001111u,
+  0x00001111u,0x43552232u,0x77976576u,0xaaaa9999u,0xaa9aaaaau,0x55347967u,0x00102202u,0x00001111u,
+  0x22320100u,0x55654355u,0x87996677u,0xaaaa99a9u,0xaaaaaaaau,0x55359967u,0x00102302u,0x00001111u,
+  0x00220100u,0x55553243u,0x77976566u,0xa9aa9999u,0xaaaaaaaau,0x56459a79u,0x00102302u,0x00001111u,
+  0x01001111u,0x43552032u,0x76775566u,0xa9aa9999u,0xaaaaaaaau,0x56459a79u,0x00102302u,0x00001111u,
+  0x11001111u,0x43552032u,0x76776566u,0xa9aa9999u,0xaaaaaaaau,0x5745aa99u,0x00102302u,0x00001111u,
+  0x11011111u,0x55652043u,0x77876676u,0xa9aa9999u,0xaaaaaaaau,0x5745aa99u,0x00102302u,0x00001111u,
+  0x11011111u,0x55663254u,0x87997677u,0xa9aa9999u,0xaaaaaaaau,0x5745aa99u,0x00102302u,0x00001111u,
+  0x11111111u,0x44550022u,0x77976666u,0xa9aa9999u,0xaaaaaaaau,0x5645aa79u,0x00102302u,0x00001111u,
+  0x11111111u,0x32540020u,0x76775565u,0x99aa9899u,0xaaaaaaaau,0x56459a79u,0x00102302u,0x00001111u,
+  0x11111111u,0x22430100u,0x76775565u,0x99a99799u,0xaaaaaaaau,0x55359967u,0x00102202u,0x00001111u,
+  0x11111111u,0x22330100u,0x66775455u,0x99998799u,0xaa99aaaau,0x55347967u,0x00112202u,0x00001111u,
+  0x11111111u,0x22430000u,0x66775565u,0x99999799u,0x99899999u,0x55336756u,0x00112200u,0x00001111u,
+  0x11001111u,0x43552022u,0x76775566u,0x99997777u,0x77779979u,0x45236655u,0x00112200u,0x00001111u,
+  0x11111111u,0x22220100u,0x55554354u,0x77776666u,0x66667767u,0x34225555u,0x10110200u,0x00001111u,
+  0x11111111u,0x00221101u,0x54552243u,0x66665565u,0x56556666u,0x23225545u,0x10110200u,0x00001111u,
+  0x11111111u,0x00001111u,0x33542222u,0x55555555u,0x55555555u,0x22224533u,0x11110000u,0x00001111u,
+  0x11111111u,0x11001111u,0x22330022u,0x55554455u,0x55455555u,0x22023423u,0x11110000u,0x00001111u,
+  0x11111111u,0x11011111u,0x22220020u,0x44543343u,0x44335544u,0x22003322u,0x11110010u,0x00001111u,
+  0x11111111u,0x11111111u,0x20220000u,0x33332233u,0x33233333u,0x02002222u,0x11110011u,0x00001111u,
+  0x11111111u,0x11111111u,0x00200100u,0x22332222u,0x22223333u,0x00002202u,0x11110011u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001100u,0x22222222u,0x22222222u,0x00002200u,0x11111011u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001101u,0x22220020u,0x22222222u,0x00000000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001111u,0x00200000u,0x00002202u,0x00100000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11001111u,0x00000000u,0x00000000u,0x10110000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00000000u,0x00000000u,0x11110010u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00001100u,0x00000000u,0x11111111u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x11011111u,0x11110000u,0x11111111u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x01001111u,0x00000000u,0x11111111u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00001100u,0x00000000u,0x11110010u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00000000u,0x00000000u,0x10110000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11001111u,0x00000000u,0x00000000u,0x00100000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x01001111u,0x00220000u,0x22022222u,0x00000000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001111u,0x22220000u,0x22222222u,0x00002200u,0x11110011u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001101u,0x22222022u,0x22222222u,0x00002222u,0x11110010u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001100u,0x22322222u,0x33233333u,0x02002222u,0x11110000u,0x00001111u,
+  0x11111111u,0x11111111u,0x00220100u,0x33332222u,0x33333344u,0x22023322u,0x11110000u,0x00001111u,
+  0x11111111u,0x11111111u,0x20220000u,0x43442233u,0x55445455u,0x22223423u,0x10110000u,0x00001111u,
+  0x11111111u,0x11011111u,0x22220000u,0x54553343u,0x55555555u,0x23224534u,0x10110200u,0x00001111u,
+  0x11111111u,0x11001111u,0x22330022u,0x55554355u,0x55555555u,0x33225545u,0x00110200u,0x00001111u,
+  0x11111111u,0x01001111u,0x33442022u,0x55655555u,0x66566666u,0x34235555u,0x00112200u,0x00001111u,
+  0x11111111u,0x00201101u,0x44552233u,0x66665555u,0x77677677u,0x45335655u,0x00102202u,0x00001111u,
+  0x11111111u,0x00220100u,0x55553354u,0x77876566u,0x99799999u,0x55346756u,0x00102202u,0x00001111u,
+  0x11011111u,0x22320000u,0x55665455u,0x97996677u,0xaa9999a9u,0x55357967u,0x00102302u,0x00001111u,
+  0x01001111u,0x33542022u,0x77775566u,0xa9aa9999u,0xaaaaaaaau,0x56459977u,0x00002322u,0x00001111u,
+  0x20221100u,0x55553354u,0x77986676u,0xaaaa9999u,0xaaaaaaaau,0x56559a79u,0x00003322u,0x00001111u,
+  0x00201100u,0x54552233u,0x76775566u,0x99aa9999u,0xaaaaaaaau,0x6755aa99u,0x00003422u,0x00001111u,
+  0x11001111u,0x33540022u,0x66775565u,0x99aa9799u,0xaaaaaaaau,0x6755aa99u,0x00003422u,0x00001111u,
+  0x11011111u,0x33540022u,0x66775566u,0x99aa9799u,0xaaaaaaaau,0x7955aa9au,0x00003422u,0x00001111u,
+  0x11111111u,0x54550032u,0x77776666u,0x99aa9899u,0xaaaaaaaau,0x7955aa9au,0x00003422u,0x00001111u,
+  0x11111111u,0x55652043u,0x77986677u,0x99aa9999u,0xaaaaaaaau,0x7955aa9au,0x00003422u,0x00001111u,
+  0x11111111u,0x42540120u,0x76776566u,0x99aa9999u,0xaaaaaaaau,0x6755aa9au,0x00003422u,0x00001111u,
+  0x11111111u,0x22430100u,0x66775555u,0x99a98799u,0xaaaaaaaau,0x6755aa99u,0x00003422u,0x00001111u,
+  0x11111111u,0x20321100u,0x66775455u,0x99997799u,0xaaaaaaaau,0x56559a79u,0x00002322u,0x00001111u,
+  0x11111111u,0x20321100u,0x65764355u,0x99997798u,0xaa9aa9aau,0x56459977u,0x00102322u,0x00001111u,
+  0x11111111u,0x20320100u,0x66765455u,0x99997799u,0x99999999u,0x55357866u,0x00102302u,0x00001111u,
+  0x11011111u,0x32540022u,0x66775565u,0x97997777u,0x77779999u,0x55346756u,0x00102202u,0x00001111u,
+  0x11111111u,0x20221100u,0x55553244u,0x76776566u,0x66667777u,0x45235655u,0x00112200u,0x00001111u,
+  0x11111111u,0x00201111u,0x44552232u,0x66665555u,0x66556666u,0x34225555u,0x00112200u,0x00001111u,
+  0x11111111u,0x01001111u,0x32432022u,0x55555555u,0x55555555u,0x23225534u,0x10110200u,0x00001111u,
+  0x11111111u,0x11011111u,0x22320020u,0x55554354u,0x55555555u,0x22224433u,0x10110000u,0x00001111u,
+  0x11111111u,0x11111111u,0x22220000u,0x44443233u,0x44345545u,0x22023323u,0x11110000u,0x00001111u,
+  0x11111111u,0x11111111u,0x00220100u,0x33332232u,0x33333333u,0x22002222u,0x11110010u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001100u,0x22322222u,0x23223333u,0x00002222u,0x11110010u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001101u,0x22222022u,0x22222222u,0x00002202u,0x11110011u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001111u,0x22220000u,0x22222222u,0x00000200u,0x11111011u,0x00001111u,
+  0x11111111u,0x11111111u,0x01001111u,0x00000000u,0x00002222u,0x00000000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11011111u,0x00000000u,0x00000000u,0x00110000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00000100u,0x00000000u,0x11110000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00001101u,0x00000000u,0x11111011u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x11111111u,0x10110000u,0x11111111u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x11001111u,0x00000000u,0x11111011u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00001101u,0x00000000u,0x11110000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00000100u,0x00000000u,0x00110000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11011111u,0x00000000u,0x00000000u,0x00000000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11001111u,0x00200000u,0x22222222u,0x00000000u,0x11111011u,0x00001111u,
+  0x11111111u,0x11111111u,0x01001111u,0x20220000u,0x22222222u,0x00002202u,0x11110010u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001111u,0x22220022u,0x22222222u,0x02002222u,0x11110000u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001101u,0x22222022u,0x33333333u,0x22002222u,0x10110000u,0x00001111u,
+  0x11111111u,0x11111111u,0x00201100u,0x32332222u,0x34333343u,0x22223323u,0x10110000u,0x00001111u,
+  0x11111111u,0x11111111u,0x00220100u,0x33442232u,0x55454455u,0x22224433u,0x00110200u,0x00001111u,
+  0x11111111u,0x11111111u,0x20220000u,0x44553233u,0x55555555u,0x33225544u,0x00112200u,0x00001111u,
+  0x11111111u,0x11011111u,0x22320020u,0x55553354u,0x55555555u,0x34235555u,0x00102200u,0x00001111u,
+  0x11111111u,0x11001111u,0x32430022u,0x55555455u,0x66666666u,0x45335555u,0x00102202u,0x00001111u,
+  0x11111111u,0x00001111u,0x43542232u,0x65665555u,0x77776677u,0x55346655u,0x00002322u,0x00001111u,
+  0x11111111u,0x00201100u,0x55553243u,0x76775566u,0x99999899u,0x55457766u,0x00002322u,0x00001111u,
+  0x11111111u,0x20220000u,0x55654355u,0x77996676u,0xaa9a9999u,0x56559977u,0x00003322u,0x00001111u,
+  0x11001111u,0x32430022u,0x76775565u,0x99aa9799u,0xaaaaaaaau,0x67559a79u,0x02003422u,0x00001011u,
+  0x00221101u,0x55553243u,0x77876566u,0xa9aa9999u,0xaaaaaaaau,0x6755aa99u,0x02003523u,0x00001011u,
+  0x00001101u,0x43552232u,0x66775565u,0x99a99799u,0xaaaaaaaau,0x7956aa9au,0x02004523u,0x00001011u,
+  0x11011111u,0x32430020u,0x66765555u,0x99a97799u,0xaaaaaaaau,0x7956aa9au,0x02004523u,0x00001011u,
+  0x11111111u,0x32430020u,0x66765565u,0x99a97799u,0xaaaaaaaau,0x9957aaaau,0x02004523u,0x00001011u,
+  0x11111111u,0x43550120u,0x76776566u,0x99a98799u,0xaaaaaaaau,0x9957aaaau,0x02004523u,0x00001011u,
+  0x11111111u,0x54550132u,0x77876676u,0x99a99999u,0xaaaaaaaau,0x9957aaaau,0x02004523u,0x00001011u,
+  0x11111111u,0x22441100u,0x66775566u,0x99a99799u,0xaaaaaaaau,0x7956aaaau,0x02004523u,0x00001011u,
+  0x11111111u,0x20321100u,0x65765455u,0x99997798u,0xaaaaaaaau,0x7956aa9au,0x02004523u,0x00001011u,
+  0x11111111u,0x00221101u,0x65764355u,0x99997797u,0xaaaaa9aau,0x6755aa99u,0x02003522u,0x00001011u,
+  0x11111111u,0x00221101u,0x55663354u,0x99997787u,0xaaaa99aau,0x67559979u,0x02003422u,0x00001111u,
+  0x11111111u,0x00221100u,0x65664355u,0x99997797u,0x99999999u,0x56558967u,0x00003322u,0x00001111u,
+  0x11111111u,0x22430020u,0x66765555u,0x77997777u,0x79779999u,0x55457766u,0x00002322u,0x00001111u,
+  0x11111111u,0x00221101u,0x54552243u,0x66775566u,0x67667777u,0x55346655u,0x00102202u,0x00001111u,
+  0x11111111u,0x01001111u,0x43542222u,0x65665555u,0x66566666u,0x45235555u,0x00102202u,0x00001111u,
+  0x11111111u,0x11001111u,0x22330022u,0x55555455u,0x55555555u,0x33225545u,0x00112200u,0x00001111u,
+  0x11111111u,0x11111111u,0x22220000u,0x55553344u,0x55555555u,0x23224534u,0x00110200u,0x00001111u,
+  0x11111111u,0x11111111u,0x20220100u,0x43442233u,0x44445455u,0x22223333u,0x10110000u,0x00001111u,
+  0x11111111u,0x11111111u,0x00201100u,0x33332222u,0x33333333u,0x22022322u,0x11110000u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001101u,0x22222022u,0x33223333u,0x02002222u,0x11110000u,0x00001111u,
+  0x11111111u,0x11111111u,0x00001111u,0x22220022u,0x22222222u,0x00002222u,0x11110010u,0x00001111u,
+  0x11111111u,0x11111111u,0x01001111u,0x20220000u,0x22222222u,0x00002200u,0x11110011u,0x00001111u,
+  0x11111111u,0x11111111u,0x11001111u,0x00000000u,0x02002022u,0x00000000u,0x11111011u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00000000u,0x00000000u,0x00100000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00001100u,0x00000000u,0x10110000u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x00001111u,0x00000000u,0x11110011u,0x11111111u,0x00001111u,
+  0x11111111u,0x11111111u,0x11111111u,0x11111111u,0x00110100u,0x11111111u,0x11111111u,0x00001111u,
+};
+
+const unsigned char img_pwr2_palettes[] = {
+  0x00, 0x0c, 0x10, 0x20, 0x24, 0x34, 0x38, 0x39, 0x3d, 0x3e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const unsigned char img_pwr2_palette_index[] = {
+  0,
+};
+
+const unsigned short img_pwr2_span_index[] = {
+  0x0000,0x0003,0x0005,0x0008,0x000a,0x000d,0x000f,0x0012,0x0014,0x0017,0x001a,0x001d,
+  0x001e,0x0020,0x0023,0x0026,0x0029,0x002c,0x002e,0x0030,0x0032,0x0035,0x0038,0x003b,
+  0x003e,0x0041,0x0043,0x0045,0x0048,0x004b,0x004c,0x004e,0x0051,0x0054,0x0057,0x005a,
+  0x005c,0x005e,0x0061,0x0064,0x0066,0x0069,0x006c,0x006d,
+};
+
+const unsigned short img_pwr2_spans[] = {
+  0x0106,0x8207,0x0109,0x8406,0x010a,0x0105,0x8406,0x010a,0x8605,0x010b,0x0104,0x8605,
+  0x010b,0x0104,0x8705,0x0104,0x8705,0x010c,0x8804,0x010c,0x0103,0x8804,0x010c,0x0103,
+  0x8804,0x010c,0x0103,0x8804,0x010c,0x8a03,0x0102,0x8a03,0x0102,0x8a03,0x010d,0x0101,
+  0x8b02,0x010d,0x0101,0x8b02,0x010d,0x0100,0x8c01,0x010d,0x8d00,0x010d,0x8d00,0x010d,
+  0x8c01,0x010d,0x0101,0x8b02,0x010d,0x0101,0x8b02,0x010d,0x0101,0x8b02,0x010d,0x0101,
+  0x8b02,0x010d,0x0101,0x8b02,0x010d,0x8b02,0x010d,0x8b02,0x010d,0x0101,0x8b02,0x010d,
+  0x0101,0x8b02,0x010d,0x8b02,0x0102,0x8a03,0x0102,0x8903,0x010c,0x0103,0x8804,0x010c,
+  0x0103,0x8804,0x010c,0x0103,0x8804,0x010c,0x8804,0x010c,0x0104,0x8705,0x0104,0x8605,
+  0x010b,0x0104,0x8605,0x010b,0x0105,0x8506,0x0105,0x8406,0x010a,0x0106,0x8207,0x0109,
+  0x0207,
+};
+
+const unsigned char img_pwr2_bbox[] = {
+  0x00,0x2a,0x00,0x0d, 
+};
+
+static void img_pwr2_compiled_0_0(unsigned char **lines, int block_x, unsigned int sb)
+{
+  unsigned int *s;
+  s = (unsigned int *) lines[0] + block_x;
+  s[6] = (s[6] & 0xffffc0ffu) | 0x00000000u;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = (s[9] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[1] + block_x;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = (s[10] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[2] + block_x;
+  s[5] = (s[5] & 0xffffc0c0u) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = (s[10] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[3] + block_x;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[4] + block_x;
+  s[4] = (s[4] & 0xffffc0ffu) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x00100000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[5] + block_x;
+  s[4] = (s[4] & 0xffffc0c0u) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00001010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = 0x00000000u | sb;
+  s = (unsigned int *) lines[6] + block_x;
+  s[4] = (s[4] & 0xc0ffc0c0u) | 0x00000000u;
+  s[5] = 0x00001000u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10100000u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[7] + block_x;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x00001010u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x20102020u | sb;
+  s[8] = 0x20202020u | sb;
+  s[9] = 0x10201010u | sb;
+  s[10] = 0x10100010u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[8] + block_x;
+  s[3] = (s[3] & 0xffffc0ffu) | 0x00000000u;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x10101010u | sb;
+  s[6] = 0x10102020u | sb;
+  s[7] = 0x20202020u | sb;
+  s[8] = 0x24242020u | sb;
+  s[9] = 0x20202020u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x00100000u | sb;
+  s[12] = (s[12] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[9] + block_x;
+  s[3] = (s[3] & 0xffffc0c0u) | 0x00000000u;
+  s[4] = 0x00001000u | sb;
+  s[5] = 0x10101010u | sb;
+  s[6] = 0x20202420u | sb;
+  s[7] = 0x24243424u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x24242024u | sb;
+  s[10] = 0x10201010u | sb;
+  s[11] = 0x10100000u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[10] + block_x;
+  s[3] = (s[3] & 0xc0ffc0c0u) | 0x00000000u;
+  s[4] = 0x00001010u | sb;
+  s[5] = 0x10102020u | sb;
+  s[6] = 0x24203424u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34342434u | sb;
+  s[10] = 0x20241020u | sb;
+  s[11] = 0x10100010u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[11] + block_x;
+  s[3] = 0x00000000u | sb;
+  s[4] = 0x10101010u | sb;
+  s[5] = 0x20202420u | sb;
+  s[6] = 0x34343434u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x24342020u | sb;
+  s[11] = 0x10100010u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[12] + block_x;
+  s[2] = (s[2] & 0xffffc0ffu) | 0x00000000u;
+  s[3] = 0x00001000u | sb;
+  s[4] = 0x10102020u | sb;
+  s[5] = 0x24243434u | sb;
+  s[6] = 0x34343434u | sb;
+  s[7] = 0x38343838u | sb;
+  s[8] = 0x38383838u | sb;
+  s[9] = 0x34383434u | sb;
+  s[10] = 0x34342024u | sb;
+  s[11] = 0x10201010u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[13] + block_x;
+  s[2] = (s[2] & 0xc0ffc0c0u) | 0x00000000u;
+  s[3] = 0x10001010u | sb;
+  s[4] = 0x20202424u | sb;
+  s[5] = 0x34343434u | sb;
+  s[6] = 0x34343838u | sb;
+  s[7] = 0x38383938u | sb;
+  s[8] = 0x39393939u | sb;
+  s[9] = 0x38393438u | sb;
+  s[10] = 0x34342434u | sb;
+  s[11] = 0x20201010u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[14] + block_x;
+  s[1] = (s[1] & 0xffffc0ffu) | 0x00000000u;
+  s[2] = 0x00000000u | sb;
+  s[3] = 0x10102020u | sb;
+  s[4] = 0x34243434u | sb;
+  s[5] = 0x34343834u | sb;
+  s[6] = 0x38383939u | sb;
+  s[7] = 0x3d393e3eu | sb;
+  s[8] = 0x3e3e3e3eu | sb;
+  s[9] = 0x393e3839u | sb;
+  s[10] = 0x34383434u | sb;
+  s[11] = 0x20241010u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[15] + block_x;
+  s[1] = (s[1] & 0xc0ffc0c0u) | 0x00000000u;
+  s[2] = 0x00001010u | sb;
+  s[3] = 0x20103424u | sb;
+  s[4] = 0x34343434u | sb;
+  s[5] = 0x38383838u | sb;
+  s[6] = 0x39393e39u | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3f3e3f3fu | sb;
+  s[9] = 0x3e3e393eu | sb;
+  s[10] = 0x38393434u | sb;
+  s[11] = 0x20341020u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[16] + block_x;
+  s[0] = (s[0] & 0xffffc0ffu) | 0x00000000u;
+  s[1] = 0x00001000u | sb;
+  s[2] = 0x10102020u | sb;
+  s[3] = 0x34243434u | sb;
+  s[4] = 0x38383939u | sb;
+  s[5] = 0x39393e3eu | sb;
+  s[6] = 0x3e3e3f3eu | sb;
+  s[7] = 0x3f3f3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3e3eu | sb;
+  s[10] = 0x39393438u | sb;
+  s[11] = 0x24341020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[17] + block_x;
+  s[0] = 0x00001000u | sb;
+  s[1] = 0x10102020u | sb;
+  s[2] = 0x34243434u | sb;
+  s[3] = 0x34343838u | sb;
+  s[4] = 0x39383939u | sb;
+  s[5] = 0x3e3d3e3eu | sb;
+  s[6] = 0x3e3e3f3fu | sb;
+  s[7] = 0x3f3f3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3e3fu | sb;
+  s[10] = 0x393e3438u | sb;
+  s[11] = 0x34342020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[18] + block_x;
+  s[0] = 0x00000000u | sb;
+  s[1] = 0x10001010u | sb;
+  s[2] = 0x20203424u | sb;
+  s[3] = 0x34343434u | sb;
+  s[4] = 0x38383938u | sb;
+  s[5] = 0x39393e3eu | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3f3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3e3839u | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[19] + block_x;
+  s[1] = 0x00000000u | sb;
+  s[2] = 0x10102020u | sb;
+  s[3] = 0x34243434u | sb;
+  s[4] = 0x38343838u | sb;
+  s[5] = 0x39393e39u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3f3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3e3839u | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[20] + block_x;
+  s[1] = (s[1] & 0xc0ffc0c0u) | 0x00000000u;
+  s[2] = 0x10102020u | sb;
+  s[3] = 0x34243434u | sb;
+  s[4] = 0x38383838u | sb;
+  s[5] = 0x39393e39u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3f3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3f393eu | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[21] + block_x;
+  s[1] = (s[1] & 0xffffc0c0u) | 0x00000000u;
+  s[2] = 0x20103424u | sb;
+  s[3] = 0x34343838u | sb;
+  s[4] = 0x38383939u | sb;
+  s[5] = 0x39393e3du | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3f3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3f393eu | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[22] + block_x;
+  s[1] = (s[1] & 0xffffc0c0u) | 0x00001000u;
+  s[2] = 0x24203434u | sb;
+  s[3] = 0x38343838u | sb;
+  s[4] = 0x39393939u | sb;
+  s[5] = 0x3e3d3e3eu | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3f3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3f393eu | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[23] + block_x;
+  s[1] = (s[1] & 0xffffc0ffu) | 0x00000000u;
+  s[2] = 0x10002410u | sb;
+  s[3] = 0x34243834u | sb;
+  s[4] = 0x38383938u | sb;
+  s[5] = 0x39393e3eu | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3f3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3f3839u | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[24] + block_x;
+  s[1] = (s[1] & 0xffffc0ffu) | 0x00000000u;
+  s[2] = 0x00001010u | sb;
+  s[3] = 0x24203434u | sb;
+  s[4] = 0x34343838u | sb;
+  s[5] = 0x39393d39u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3e3839u | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[25] + block_x;
+  s[2] = 0x00001000u | sb;
+  s[3] = 0x20103424u | sb;
+  s[4] = 0x34343838u | sb;
+  s[5] = 0x39393939u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3e3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3e3fu | sb;
+  s[10] = 0x393e3438u | sb;
+  s[11] = 0x34341020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[26] + block_x;
+  s[2] = 0x00001000u | sb;
+  s[3] = 0x20102420u | sb;
+  s[4] = 0x34343834u | sb;
+  s[5] = 0x39383939u | sb;
+  s[6] = 0x3e3d3e3eu | sb;
+  s[7] = 0x3e3e3f3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3e3f3e3eu | sb;
+  s[10] = 0x39393438u | sb;
+  s[11] = 0x24341020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[27] + block_x;
+  s[1] = (s[1] & 0xffffc0ffu) | 0x00000000u;
+  s[2] = 0x00001000u | sb;
+  s[3] = 0x20103424u | sb;
+  s[4] = 0x34343838u | sb;
+  s[5] = 0x39383939u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3e3e3e3eu | sb;
+  s[9] = 0x3e3e393du | sb;
+  s[10] = 0x38383434u | sb;
+  s[11] = 0x20341020u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[28] + block_x;
+  s[1] = (s[1] & 0xc0ffc0c0u) | 0x00000000u;
+  s[2] = 0x10102010u | sb;
+  s[3] = 0x34243434u | sb;
+  s[4] = 0x38343838u | sb;
+  s[5] = 0x39393939u | sb;
+  s[6] = 0x39393e39u | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3e3e3939u | sb;
+  s[9] = 0x39393839u | sb;
+  s[10] = 0x34383434u | sb;
+  s[11] = 0x20241010u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[29] + block_x;
+  s[2] = 0x00001000u | sb;
+  s[3] = 0x10102010u | sb;
+  s[4] = 0x24243434u | sb;
+  s[5] = 0x34343834u | sb;
+  s[6] = 0x38383938u | sb;
+  s[7] = 0x39393939u | sb;
+  s[8] = 0x39393838u | sb;
+  s[9] = 0x38383438u | sb;
+  s[10] = 0x34342434u | sb;
+  s[11] = 0x10201010u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[30] + block_x;
+  s[2] = (s[2] & 0xffffc0c0u) | 0x00000000u;
+  s[3] = 0x10001010u | sb;
+  s[4] = 0x20102424u | sb;
+  s[5] = 0x34343434u | sb;
+  s[6] = 0x34343838u | sb;
+  s[7] = 0x38383838u | sb;
+  s[8] = 0x38383838u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x34342024u | sb;
+  s[11] = 0x10101010u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[31] + block_x;
+  s[2] = (s[2] & 0xffffc0ffu) | 0x00000000u;
+  s[3] = 0x00001000u | sb;
+  s[4] = 0x10102010u | sb;
+  s[5] = 0x24203434u | sb;
+  s[6] = 0x34343434u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x20241020u | sb;
+  s[11] = 0x10100010u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[32] + block_x;
+  s[3] = (s[3] & 0xc0ffc0c0u) | 0x00000000u;
+  s[4] = 0x10001010u | sb;
+  s[5] = 0x20102420u | sb;
+  s[6] = 0x34243434u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34342424u | sb;
+  s[10] = 0x20201010u | sb;
+  s[11] = 0x10100000u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[33] + block_x;
+  s[3] = (s[3] & 0xffffc0c0u) | 0x00000000u;
+  s[4] = 0x00001010u | sb;
+  s[5] = 0x10102010u | sb;
+  s[6] = 0x20202424u | sb;
+  s[7] = 0x24243434u | sb;
+  s[8] = 0x24342424u | sb;
+  s[9] = 0x20242020u | sb;
+  s[10] = 0x10201010u | sb;
+  s[11] = 0x00100000u | sb;
+  s[12] = (s[12] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[34] + block_x;
+  s[3] = (s[3] & 0xffffc0ffu) | 0x00000000u;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x10101010u | sb;
+  s[6] = 0x20102020u | sb;
+  s[7] = 0x20202020u | sb;
+  s[8] = 0x20202020u | sb;
+  s[9] = 0x20201010u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[35] + block_x;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x00001010u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x20102020u | sb;
+  s[8] = 0x20201020u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10100000u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[36] + block_x;
+  s[4] = (s[4] & 0xc0ffc0c0u) | 0x00000000u;
+  s[5] = 0x00001000u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x00100000u | sb;
+  s[11] = 0x00000000u | sb;
+  s = (unsigned int *) lines[37] + block_x;
+  s[4] = (s[4] & 0xffffc0c0u) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00001010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10100010u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[38] + block_x;
+  s[4] = (s[4] & 0xffffc0ffu) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00001010u | sb;
+  s[8] = 0x10100000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[39] + block_x;
+  s[5] = (s[5] & 0xc0ffc0c0u) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s = (unsigned int *) lines[40] + block_x;
+  s[5] = (s[5] & 0xffffc0ffu) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = (s[10] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[41] + block_x;
+  s[6] = (s[6] & 0xc0ffc0c0u) | 0x00000000u;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = (s[9] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[42] + block_x;
+  s[7] = (s[7] & 0xffffc0c0u) | 0x00000000u;
+  s[8] = (s[8] & 0xc0c0ffc0u) | 0x00000000u;
+}
+
+static void img_pwr2_compiled_0_1(unsigned char **lines, int block_x, unsigned int sb)
+{
+  unsigned int *s;
+  s = (unsigned int *) lines[0] + block_x;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = (s[9] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[1] + block_x;
+  s[6] = (s[6] & 0xc0ffc0c0u) | 0x00000000u;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = (s[10] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[2] + block_x;
+  s[5] = (s[5] & 0xffffc0ffu) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s = (unsigned int *) lines[3] + block_x;
+  s[5] = (s[5] & 0xc0ffc0c0u) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[4] + block_x;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x10001010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10100000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[5] + block_x;
+  s[4] = (s[4] & 0xffffc0ffu) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00001000u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x00100000u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[6] + block_x;
+  s[4] = (s[4] & 0xffffc0c0u) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10100010u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[7] + block_x;
+  s[4] = (s[4] & 0xc0ffc0c0u) | 0x00000000u;
+  s[5] = 0x00001000u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x10102020u | sb;
+  s[8] = 0x20202020u | sb;
+  s[9] = 0x20201010u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[8] + block_x;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x10001010u | sb;
+  s[6] = 0x10102010u | sb;
+  s[7] = 0x20202020u | sb;
+  s[8] = 0x24202024u | sb;
+  s[9] = 0x20202020u | sb;
+  s[10] = 0x10201010u | sb;
+  s[11] = 0x10100000u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[9] + block_x;
+  s[3] = (s[3] & 0xffffc0ffu) | 0x00000000u;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x10101010u | sb;
+  s[6] = 0x20102020u | sb;
+  s[7] = 0x24242424u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x24342424u | sb;
+  s[10] = 0x20201010u | sb;
+  s[11] = 0x10100010u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[10] + block_x;
+  s[3] = (s[3] & 0xffffc0c0u) | 0x00000000u;
+  s[4] = 0x00001000u | sb;
+  s[5] = 0x10102010u | sb;
+  s[6] = 0x20202424u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x24242020u | sb;
+  s[11] = 0x10101010u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[11] + block_x;
+  s[3] = (s[3] & 0xc0ffc0c0u) | 0x00000000u;
+  s[4] = 0x10001010u | sb;
+  s[5] = 0x20102020u | sb;
+  s[6] = 0x34243434u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x34342024u | sb;
+  s[11] = 0x10201010u | sb;
+  s[12] = 0x00000000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[12] + block_x;
+  s[3] = 0x00000000u | sb;
+  s[4] = 0x10102010u | sb;
+  s[5] = 0x24203424u | sb;
+  s[6] = 0x34343434u | sb;
+  s[7] = 0x34343838u | sb;
+  s[8] = 0x38383838u | sb;
+  s[9] = 0x38383434u | sb;
+  s[10] = 0x34342434u | sb;
+  s[11] = 0x20201010u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[13] + block_x;
+  s[2] = (s[2] & 0xffffc0c0u) | 0x00000000u;
+  s[3] = 0x00001010u | sb;
+  s[4] = 0x20102420u | sb;
+  s[5] = 0x34243434u | sb;
+  s[6] = 0x34343834u | sb;
+  s[7] = 0x38383838u | sb;
+  s[8] = 0x39393939u | sb;
+  s[9] = 0x39393838u | sb;
+  s[10] = 0x34343434u | sb;
+  s[11] = 0x20241020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[14] + block_x;
+  s[2] = 0x00000000u | sb;
+  s[3] = 0x10002010u | sb;
+  s[4] = 0x24203434u | sb;
+  s[5] = 0x34343434u | sb;
+  s[6] = 0x38383938u | sb;
+  s[7] = 0x39393e3du | sb;
+  s[8] = 0x3e3e3e3eu | sb;
+  s[9] = 0x3e3e3939u | sb;
+  s[10] = 0x38383434u | sb;
+  s[11] = 0x24341020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[15] + block_x;
+  s[1] = (s[1] & 0xffffc0c0u) | 0x00000000u;
+  s[2] = 0x00001000u | sb;
+  s[3] = 0x10102420u | sb;
+  s[4] = 0x34343434u | sb;
+  s[5] = 0x38343838u | sb;
+  s[6] = 0x39383939u | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3e3e3f3fu | sb;
+  s[9] = 0x3e3f3e3eu | sb;
+  s[10] = 0x39393438u | sb;
+  s[11] = 0x34342020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[16] + block_x;
+  s[1] = 0x00000000u | sb;
+  s[2] = 0x10102010u | sb;
+  s[3] = 0x24203434u | sb;
+  s[4] = 0x38343938u | sb;
+  s[5] = 0x39393e39u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3f3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3e3fu | sb;
+  s[10] = 0x393e3839u | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[17] + block_x;
+  s[0] = (s[0] & 0xc0ffc0c0u) | 0x00000000u;
+  s[1] = 0x10102010u | sb;
+  s[2] = 0x24203434u | sb;
+  s[3] = 0x34343834u | sb;
+  s[4] = 0x38383939u | sb;
+  s[5] = 0x3d393e3eu | sb;
+  s[6] = 0x3e3e3f3eu | sb;
+  s[7] = 0x3f3f3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3e3839u | sb;
+  s[11] = 0x34342034u | sb;
+  s[12] = 0x10200010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[18] + block_x;
+  s[0] = (s[0] & 0xc0ffc0c0u) | 0x00000000u;
+  s[1] = 0x00001010u | sb;
+  s[2] = 0x20102420u | sb;
+  s[3] = 0x34343434u | sb;
+  s[4] = 0x38343838u | sb;
+  s[5] = 0x39393e39u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3f393eu | sb;
+  s[11] = 0x34382434u | sb;
+  s[12] = 0x10200010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[19] + block_x;
+  s[1] = (s[1] & 0xc0ffc0c0u) | 0x00000000u;
+  s[2] = 0x10002010u | sb;
+  s[3] = 0x24203434u | sb;
+  s[4] = 0x34343838u | sb;
+  s[5] = 0x39383939u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3f393eu | sb;
+  s[11] = 0x34382434u | sb;
+  s[12] = 0x10200010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[20] + block_x;
+  s[1] = (s[1] & 0xffffc0c0u) | 0x00000000u;
+  s[2] = 0x10002010u | sb;
+  s[3] = 0x24203434u | sb;
+  s[4] = 0x38343838u | sb;
+  s[5] = 0x39383939u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3eu | sb;
+  s[11] = 0x34392434u | sb;
+  s[12] = 0x10200010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[21] + block_x;
+  s[1] = (s[1] & 0xffffc0ffu) | 0x00000000u;
+  s[2] = 0x10002420u | sb;
+  s[3] = 0x34343834u | sb;
+  s[4] = 0x38383938u | sb;
+  s[5] = 0x39393d39u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3eu | sb;
+  s[11] = 0x34392434u | sb;
+  s[12] = 0x10200010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[22] + block_x;
+  s[1] = (s[1] & 0xffffc0ffu) | 0x00000000u;
+  s[2] = 0x20103424u | sb;
+  s[3] = 0x34343838u | sb;
+  s[4] = 0x39383939u | sb;
+  s[5] = 0x3d393e3eu | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3eu | sb;
+  s[11] = 0x34392434u | sb;
+  s[12] = 0x10200010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[23] + block_x;
+  s[2] = 0x00001010u | sb;
+  s[3] = 0x24243434u | sb;
+  s[4] = 0x38383838u | sb;
+  s[5] = 0x39393e39u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f393eu | sb;
+  s[11] = 0x34382434u | sb;
+  s[12] = 0x10200010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[24] + block_x;
+  s[2] = 0x00001000u | sb;
+  s[3] = 0x20103424u | sb;
+  s[4] = 0x34343834u | sb;
+  s[5] = 0x39383939u | sb;
+  s[6] = 0x3e3d3e3eu | sb;
+  s[7] = 0x3e3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3f393eu | sb;
+  s[11] = 0x34382434u | sb;
+  s[12] = 0x10200010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[25] + block_x;
+  s[2] = (s[2] & 0xc0ffc0c0u) | 0x00000000u;
+  s[3] = 0x10102420u | sb;
+  s[4] = 0x34343834u | sb;
+  s[5] = 0x39383939u | sb;
+  s[6] = 0x3e393e3eu | sb;
+  s[7] = 0x3e3e3f3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3e3839u | sb;
+  s[11] = 0x34342034u | sb;
+  s[12] = 0x10100010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[26] + block_x;
+  s[2] = (s[2] & 0xc0ffc0c0u) | 0x00000000u;
+  s[3] = 0x10102020u | sb;
+  s[4] = 0x34243434u | sb;
+  s[5] = 0x38383939u | sb;
+  s[6] = 0x3d393e3eu | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3e3eu | sb;
+  s[10] = 0x393e3839u | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100010u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[27] + block_x;
+  s[2] = 0x00000000u | sb;
+  s[3] = 0x10102420u | sb;
+  s[4] = 0x34343834u | sb;
+  s[5] = 0x38383939u | sb;
+  s[6] = 0x3e393e3eu | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3e3e3e3eu | sb;
+  s[9] = 0x3e3e3d3eu | sb;
+  s[10] = 0x38393438u | sb;
+  s[11] = 0x34342020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[28] + block_x;
+  s[1] = (s[1] & 0xffffc0c0u) | 0x00000000u;
+  s[2] = 0x10001010u | sb;
+  s[3] = 0x24203434u | sb;
+  s[4] = 0x34343838u | sb;
+  s[5] = 0x39383939u | sb;
+  s[6] = 0x39393939u | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3e3e393eu | sb;
+  s[9] = 0x39393939u | sb;
+  s[10] = 0x38383434u | sb;
+  s[11] = 0x24341020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[29] + block_x;
+  s[2] = (s[2] & 0xc0ffc0c0u) | 0x00000000u;
+  s[3] = 0x10101010u | sb;
+  s[4] = 0x24203424u | sb;
+  s[5] = 0x34343434u | sb;
+  s[6] = 0x38383838u | sb;
+  s[7] = 0x39393939u | sb;
+  s[8] = 0x39393839u | sb;
+  s[9] = 0x38383838u | sb;
+  s[10] = 0x34343434u | sb;
+  s[11] = 0x20241010u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[30] + block_x;
+  s[2] = (s[2] & 0xffffc0ffu) | 0x00000000u;
+  s[3] = 0x00001010u | sb;
+  s[4] = 0x10102420u | sb;
+  s[5] = 0x34243434u | sb;
+  s[6] = 0x34343834u | sb;
+  s[7] = 0x38383838u | sb;
+  s[8] = 0x38383838u | sb;
+  s[9] = 0x34383434u | sb;
+  s[10] = 0x34342434u | sb;
+  s[11] = 0x10201010u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[31] + block_x;
+  s[3] = 0x00000000u | sb;
+  s[4] = 0x10101010u | sb;
+  s[5] = 0x20203424u | sb;
+  s[6] = 0x34343434u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x24342020u | sb;
+  s[11] = 0x10101010u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[32] + block_x;
+  s[3] = (s[3] & 0xffffc0c0u) | 0x00000000u;
+  s[4] = 0x00001010u | sb;
+  s[5] = 0x10102020u | sb;
+  s[6] = 0x24243434u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34342434u | sb;
+  s[10] = 0x20241020u | sb;
+  s[11] = 0x10100010u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[33] + block_x;
+  s[3] = (s[3] & 0xffffc0ffu) | 0x00000000u;
+  s[4] = 0x00001000u | sb;
+  s[5] = 0x10101010u | sb;
+  s[6] = 0x20202420u | sb;
+  s[7] = 0x24243424u | sb;
+  s[8] = 0x34342424u | sb;
+  s[9] = 0x24242020u | sb;
+  s[10] = 0x20201010u | sb;
+  s[11] = 0x10100000u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[34] + block_x;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x10001010u | sb;
+  s[6] = 0x10102020u | sb;
+  s[7] = 0x20202020u | sb;
+  s[8] = 0x20202020u | sb;
+  s[9] = 0x20201020u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x00100000u | sb;
+  s[12] = (s[12] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[35] + block_x;
+  s[4] = (s[4] & 0xc0ffc0c0u) | 0x00000000u;
+  s[5] = 0x00001000u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x10102020u | sb;
+  s[8] = 0x20202020u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10100010u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[36] + block_x;
+  s[4] = (s[4] & 0xffffc0c0u) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10100000u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[37] + block_x;
+  s[4] = (s[4] & 0xffffc0ffu) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00001000u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = 0x00000000u | sb;
+  s = (unsigned int *) lines[38] + block_x;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00001000u | sb;
+  s[8] = 0x10100010u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[39] + block_x;
+  s[5] = (s[5] & 0xffffc0c0u) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[40] + block_x;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = (s[10] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[41] + block_x;
+  s[6] = (s[6] & 0xffffc0c0u) | 0x00000000u;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s = (unsigned int *) lines[42] + block_x;
+  s[7] = (s[7] & 0xffffc0ffu) | 0x00000000u;
+  s[8] = 0x00000000u | sb;
+}
+
+static void img_pwr2_compiled_0_2(unsigned char **lines, int block_x, unsigned int sb)
+{
+  unsigned int *s;
+  s = (unsigned int *) lines[0] + block_x;
+  s[7] = (s[7] & 0xc0ffc0c0u) | 0x00000000u;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s = (unsigned int *) lines[1] + block_x;
+  s[6] = (s[6] & 0xffffc0c0u) | 0x00000000u;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = (s[10] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[2] + block_x;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[3] + block_x;
+  s[5] = (s[5] & 0xffffc0c0u) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[4] + block_x;
+  s[5] = (s[5] & 0xc0ffc0c0u) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00001010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10100010u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = 0x00000000u | sb;
+  s = (unsigned int *) lines[5] + block_x;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10100000u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[6] + block_x;
+  s[4] = (s[4] & 0xffffc0ffu) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x10001010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[7] + block_x;
+  s[4] = (s[4] & 0xffffc0c0u) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x10102010u | sb;
+  s[8] = 0x20202020u | sb;
+  s[9] = 0x20201020u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x00100000u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[8] + block_x;
+  s[4] = (s[4] & 0xc0ffc0c0u) | 0x00000000u;
+  s[5] = 0x00001010u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x20202020u | sb;
+  s[8] = 0x20202424u | sb;
+  s[9] = 0x20202020u | sb;
+  s[10] = 0x20201010u | sb;
+  s[11] = 0x10100010u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[9] + block_x;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x10001010u | sb;
+  s[6] = 0x10102020u | sb;
+  s[7] = 0x24202424u | sb;
+  s[8] = 0x34243434u | sb;
+  s[9] = 0x34342424u | sb;
+  s[10] = 0x20241020u | sb;
+  s[11] = 0x10101010u | sb;
+  s[12] = 0x00000000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[10] + block_x;
+  s[3] = (s[3] & 0xffffc0ffu) | 0x00000000u;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x10101010u | sb;
+  s[6] = 0x20202420u | sb;
+  s[7] = 0x34243434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x24342024u | sb;
+  s[11] = 0x10201010u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[11] + block_x;
+  s[3] = (s[3] & 0xffffc0c0u) | 0x00000000u;
+  s[4] = 0x00001010u | sb;
+  s[5] = 0x10102020u | sb;
+  s[6] = 0x24203434u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x34342434u | sb;
+  s[11] = 0x20201010u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[12] + block_x;
+  s[3] = (s[3] & 0xc0ffc0c0u) | 0x00000000u;
+  s[4] = 0x10001010u | sb;
+  s[5] = 0x20202424u | sb;
+  s[6] = 0x34343434u | sb;
+  s[7] = 0x34343834u | sb;
+  s[8] = 0x38383838u | sb;
+  s[9] = 0x38383438u | sb;
+  s[10] = 0x34343434u | sb;
+  s[11] = 0x20241020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[13] + block_x;
+  s[2] = (s[2] & 0xffffc0ffu) | 0x00000000u;
+  s[3] = 0x00001000u | sb;
+  s[4] = 0x10102020u | sb;
+  s[5] = 0x24243434u | sb;
+  s[6] = 0x34343434u | sb;
+  s[7] = 0x38383838u | sb;
+  s[8] = 0x39383939u | sb;
+  s[9] = 0x39393839u | sb;
+  s[10] = 0x34383434u | sb;
+  s[11] = 0x24342020u | sb;
+  s[12] = 0x10100010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[14] + block_x;
+  s[2] = (s[2] & 0xc0ffc0c0u) | 0x00000000u;
+  s[3] = 0x00001010u | sb;
+  s[4] = 0x20203424u | sb;
+  s[5] = 0x34343434u | sb;
+  s[6] = 0x38343838u | sb;
+  s[7] = 0x39393d39u | sb;
+  s[8] = 0x3e3e3e3eu | sb;
+  s[9] = 0x3e3e393eu | sb;
+  s[10] = 0x38393438u | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[15] + block_x;
+  s[1] = (s[1] & 0xffffc0ffu) | 0x00000000u;
+  s[2] = 0x00000000u | sb;
+  s[3] = 0x10102010u | sb;
+  s[4] = 0x34243434u | sb;
+  s[5] = 0x34343838u | sb;
+  s[6] = 0x38383939u | sb;
+  s[7] = 0x3e393e3eu | sb;
+  s[8] = 0x3e3e3f3eu | sb;
+  s[9] = 0x3f3f3e3eu | sb;
+  s[10] = 0x393e3839u | sb;
+  s[11] = 0x34342034u | sb;
+  s[12] = 0x10200010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[16] + block_x;
+  s[1] = (s[1] & 0xc0ffc0c0u) | 0x00000000u;
+  s[2] = 0x10001010u | sb;
+  s[3] = 0x20203424u | sb;
+  s[4] = 0x34343838u | sb;
+  s[5] = 0x39393939u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3e3939u | sb;
+  s[11] = 0x34382434u | sb;
+  s[12] = 0x10201010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[17] + block_x;
+  s[0] = (s[0] & 0xffffc0c0u) | 0x00000000u;
+  s[1] = 0x10001010u | sb;
+  s[2] = 0x20203424u | sb;
+  s[3] = 0x34343434u | sb;
+  s[4] = 0x38383938u | sb;
+  s[5] = 0x39393e3du | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3f3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3f393eu | sb;
+  s[11] = 0x34383434u | sb;
+  s[12] = 0x20201010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[18] + block_x;
+  s[0] = (s[0] & 0xffffc0c0u) | 0x00000000u;
+  s[1] = 0x00001000u | sb;
+  s[2] = 0x10102020u | sb;
+  s[3] = 0x34243434u | sb;
+  s[4] = 0x34343838u | sb;
+  s[5] = 0x39383939u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3e3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3eu | sb;
+  s[11] = 0x38393434u | sb;
+  s[12] = 0x20241010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[19] + block_x;
+  s[1] = (s[1] & 0xffffc0c0u) | 0x00000000u;
+  s[2] = 0x00001010u | sb;
+  s[3] = 0x20203424u | sb;
+  s[4] = 0x34343834u | sb;
+  s[5] = 0x38383939u | sb;
+  s[6] = 0x3e393e3eu | sb;
+  s[7] = 0x3e3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3eu | sb;
+  s[11] = 0x38393434u | sb;
+  s[12] = 0x20241010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[20] + block_x;
+  s[1] = (s[1] & 0xffffc0ffu) | 0x00000000u;
+  s[2] = 0x00001010u | sb;
+  s[3] = 0x20203424u | sb;
+  s[4] = 0x34343838u | sb;
+  s[5] = 0x38383939u | sb;
+  s[6] = 0x3e393e3eu | sb;
+  s[7] = 0x3e3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3fu | sb;
+  s[11] = 0x393e3434u | sb;
+  s[12] = 0x20241010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[21] + block_x;
+  s[2] = 0x00002010u | sb;
+  s[3] = 0x34243434u | sb;
+  s[4] = 0x38383838u | sb;
+  s[5] = 0x39393939u | sb;
+  s[6] = 0x3e3d3e3eu | sb;
+  s[7] = 0x3e3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3fu | sb;
+  s[11] = 0x393e3434u | sb;
+  s[12] = 0x20241010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[22] + block_x;
+  s[2] = 0x10002420u | sb;
+  s[3] = 0x34343834u | sb;
+  s[4] = 0x38383939u | sb;
+  s[5] = 0x39393e3du | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3e3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3fu | sb;
+  s[11] = 0x393e3434u | sb;
+  s[12] = 0x20241010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[23] + block_x;
+  s[2] = (s[2] & 0xc0ffc0c0u) | 0x00001000u;
+  s[3] = 0x24103424u | sb;
+  s[4] = 0x38343838u | sb;
+  s[5] = 0x39383939u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3e3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3fu | sb;
+  s[11] = 0x38393434u | sb;
+  s[12] = 0x20241010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[24] + block_x;
+  s[2] = (s[2] & 0xc0ffc0c0u) | 0x00000000u;
+  s[3] = 0x10102420u | sb;
+  s[4] = 0x34343434u | sb;
+  s[5] = 0x38383939u | sb;
+  s[6] = 0x3d393e3eu | sb;
+  s[7] = 0x3e3e3f3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3eu | sb;
+  s[11] = 0x38393434u | sb;
+  s[12] = 0x20241010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[25] + block_x;
+  s[2] = (s[2] & 0xffffc0c0u) | 0x00000000u;
+  s[3] = 0x10002010u | sb;
+  s[4] = 0x34243434u | sb;
+  s[5] = 0x38383939u | sb;
+  s[6] = 0x39393e3eu | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3f393eu | sb;
+  s[11] = 0x34383434u | sb;
+  s[12] = 0x10201010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[26] + block_x;
+  s[2] = (s[2] & 0xffffc0c0u) | 0x00000000u;
+  s[3] = 0x10002010u | sb;
+  s[4] = 0x24203434u | sb;
+  s[5] = 0x38343938u | sb;
+  s[6] = 0x39393e3du | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3f3e3f3fu | sb;
+  s[9] = 0x3f3f3e3fu | sb;
+  s[10] = 0x3e3e3939u | sb;
+  s[11] = 0x34382434u | sb;
+  s[12] = 0x10201010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[27] + block_x;
+  s[2] = (s[2] & 0xc0ffc0c0u) | 0x00000000u;
+  s[3] = 0x10002010u | sb;
+  s[4] = 0x34243434u | sb;
+  s[5] = 0x38383938u | sb;
+  s[6] = 0x39393e3eu | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3e3e3e3eu | sb;
+  s[9] = 0x3e3e3e3eu | sb;
+  s[10] = 0x393d3838u | sb;
+  s[11] = 0x34342034u | sb;
+  s[12] = 0x10200010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[28] + block_x;
+  s[1] = (s[1] & 0xffffc0ffu) | 0x00000000u;
+  s[2] = 0x00001010u | sb;
+  s[3] = 0x20103424u | sb;
+  s[4] = 0x34343834u | sb;
+  s[5] = 0x38383939u | sb;
+  s[6] = 0x39393939u | sb;
+  s[7] = 0x3e393e3eu | sb;
+  s[8] = 0x3e3e3e3eu | sb;
+  s[9] = 0x39393939u | sb;
+  s[10] = 0x38393438u | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[29] + block_x;
+  s[2] = (s[2] & 0xffffc0c0u) | 0x00000000u;
+  s[3] = 0x10001010u | sb;
+  s[4] = 0x20102424u | sb;
+  s[5] = 0x34343434u | sb;
+  s[6] = 0x38343838u | sb;
+  s[7] = 0x39383939u | sb;
+  s[8] = 0x39393939u | sb;
+  s[9] = 0x38383838u | sb;
+  s[10] = 0x34383434u | sb;
+  s[11] = 0x24341020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[30] + block_x;
+  s[3] = 0x00001000u | sb;
+  s[4] = 0x10102010u | sb;
+  s[5] = 0x24243434u | sb;
+  s[6] = 0x34343434u | sb;
+  s[7] = 0x38383838u | sb;
+  s[8] = 0x38383838u | sb;
+  s[9] = 0x38383434u | sb;
+  s[10] = 0x34343434u | sb;
+  s[11] = 0x20241010u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[31] + block_x;
+  s[3] = (s[3] & 0xc0ffc0c0u) | 0x00000000u;
+  s[4] = 0x10001010u | sb;
+  s[5] = 0x20102420u | sb;
+  s[6] = 0x34343434u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x34342024u | sb;
+  s[11] = 0x10201010u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[32] + block_x;
+  s[3] = (s[3] & 0xffffc0ffu) | 0x00000000u;
+  s[4] = 0x00001000u | sb;
+  s[5] = 0x10102010u | sb;
+  s[6] = 0x24203424u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x24242020u | sb;
+  s[11] = 0x10101010u | sb;
+  s[12] = 0x00000000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[33] + block_x;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x10101010u | sb;
+  s[6] = 0x20102020u | sb;
+  s[7] = 0x24242424u | sb;
+  s[8] = 0x34342434u | sb;
+  s[9] = 0x24242024u | sb;
+  s[10] = 0x20201020u | sb;
+  s[11] = 0x10100010u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[34] + block_x;
+  s[4] = (s[4] & 0xc0ffc0c0u) | 0x00000000u;
+  s[5] = 0x00001010u | sb;
+  s[6] = 0x10102010u | sb;
+  s[7] = 0x20202020u | sb;
+  s[8] = 0x20202020u | sb;
+  s[9] = 0x20202020u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x10100000u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[35] + block_x;
+  s[4] = (s[4] & 0xffffc0c0u) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x10102010u | sb;
+  s[8] = 0x20202020u | sb;
+  s[9] = 0x10201010u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[36] + block_x;
+  s[4] = (s[4] & 0xffffc0ffu) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x10001010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10100010u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[37] + block_x;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x00100000u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[38] + block_x;
+  s[5] = (s[5] & 0xc0ffc0c0u) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = 0x00000000u | sb;
+  s = (unsigned int *) lines[39] + block_x;
+  s[5] = (s[5] & 0xffffc0ffu) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[40] + block_x;
+  s[6] = (s[6] & 0xc0ffc0c0u) | 0x00000000u;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s = (unsigned int *) lines[41] + block_x;
+  s[6] = (s[6] & 0xffffc0ffu) | 0x00000000u;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = (s[10] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[42] + block_x;
+  s[8] = 0x00000000u | sb;
+  s[9] = (s[9] & 0xffc0ffffu) | 0x00000000u;
+}
+
+static void img_pwr2_compiled_0_3(unsigned char **lines, int block_x, unsigned int sb)
+{
+  unsigned int *s;
+  s = (unsigned int *) lines[0] + block_x;
+  s[7] = (s[7] & 0xffffc0c0u) | 0x00000000u;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = (s[10] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[1] + block_x;
+  s[6] = (s[6] & 0xffffc0ffu) | 0x00000000u;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s = (unsigned int *) lines[2] + block_x;
+  s[6] = (s[6] & 0xc0ffc0c0u) | 0x00000000u;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[3] + block_x;
+  s[5] = (s[5] & 0xffffc0ffu) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = 0x00000000u | sb;
+  s = (unsigned int *) lines[4] + block_x;
+  s[5] = (s[5] & 0xffffc0c0u) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00001000u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[5] + block_x;
+  s[5] = (s[5] & 0xc0ffc0c0u) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x10001010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10100010u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[6] + block_x;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00001010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x00100000u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[7] + block_x;
+  s[4] = (s[4] & 0xffffc0ffu) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x10001010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x20202020u | sb;
+  s[9] = 0x20202020u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x10100000u | sb;
+  s[12] = 0x00000000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[8] + block_x;
+  s[4] = (s[4] & 0xffffc0c0u) | 0x00000000u;
+  s[5] = 0x00001000u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x20102020u | sb;
+  s[8] = 0x20202420u | sb;
+  s[9] = 0x20242020u | sb;
+  s[10] = 0x20201020u | sb;
+  s[11] = 0x10101010u | sb;
+  s[12] = 0x00000000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[9] + block_x;
+  s[4] = (s[4] & 0xc0ffc0c0u) | 0x00000000u;
+  s[5] = 0x00001010u | sb;
+  s[6] = 0x10102010u | sb;
+  s[7] = 0x20202424u | sb;
+  s[8] = 0x24243434u | sb;
+  s[9] = 0x34342434u | sb;
+  s[10] = 0x24242020u | sb;
+  s[11] = 0x10101010u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[10] + block_x;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x10001010u | sb;
+  s[6] = 0x20102020u | sb;
+  s[7] = 0x24243434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x34342424u | sb;
+  s[11] = 0x20201010u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[11] + block_x;
+  s[3] = (s[3] & 0xffffc0ffu) | 0x00000000u;
+  s[4] = 0x00001000u | sb;
+  s[5] = 0x10102010u | sb;
+  s[6] = 0x20203424u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x34343434u | sb;
+  s[11] = 0x20241020u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[12] + block_x;
+  s[3] = (s[3] & 0xffffc0c0u) | 0x00000000u;
+  s[4] = 0x00001010u | sb;
+  s[5] = 0x20102420u | sb;
+  s[6] = 0x34243434u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x38383838u | sb;
+  s[9] = 0x38383838u | sb;
+  s[10] = 0x34343434u | sb;
+  s[11] = 0x24342020u | sb;
+  s[12] = 0x10100010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[13] + block_x;
+  s[3] = 0x00000000u | sb;
+  s[4] = 0x10102010u | sb;
+  s[5] = 0x24203424u | sb;
+  s[6] = 0x34343434u | sb;
+  s[7] = 0x38343838u | sb;
+  s[8] = 0x38383939u | sb;
+  s[9] = 0x39393939u | sb;
+  s[10] = 0x38383434u | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10201010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[14] + block_x;
+  s[2] = (s[2] & 0xffffc0c0u) | 0x00000000u;
+  s[3] = 0x00001000u | sb;
+  s[4] = 0x20102420u | sb;
+  s[5] = 0x34343434u | sb;
+  s[6] = 0x34343838u | sb;
+  s[7] = 0x39383939u | sb;
+  s[8] = 0x3e3d3e3eu | sb;
+  s[9] = 0x3e3e3e3eu | sb;
+  s[10] = 0x39393838u | sb;
+  s[11] = 0x34342434u | sb;
+  s[12] = 0x10201010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[15] + block_x;
+  s[2] = 0x00000000u | sb;
+  s[3] = 0x10001010u | sb;
+  s[4] = 0x24203434u | sb;
+  s[5] = 0x34343834u | sb;
+  s[6] = 0x38383938u | sb;
+  s[7] = 0x39393e3eu | sb;
+  s[8] = 0x3e3e3e3eu | sb;
+  s[9] = 0x3f3f3e3fu | sb;
+  s[10] = 0x3e3e3939u | sb;
+  s[11] = 0x34383434u | sb;
+  s[12] = 0x20201010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[16] + block_x;
+  s[1] = (s[1] & 0xffffc0c0u) | 0x00000000u;
+  s[2] = 0x00001010u | sb;
+  s[3] = 0x20102420u | sb;
+  s[4] = 0x34343834u | sb;
+  s[5] = 0x39383939u | sb;
+  s[6] = 0x3e393e3eu | sb;
+  s[7] = 0x3e3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3f393eu | sb;
+  s[11] = 0x38393434u | sb;
+  s[12] = 0x20241010u | sb;
+  s[13] = 0x00100000u | sb;
+  s[14] = (s[14] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[17] + block_x;
+  s[0] = (s[0] & 0xffffc0ffu) | 0x00000000u;
+  s[1] = 0x00001010u | sb;
+  s[2] = 0x20102420u | sb;
+  s[3] = 0x34343434u | sb;
+  s[4] = 0x38343838u | sb;
+  s[5] = 0x39393d39u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3f3e3f3fu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3eu | sb;
+  s[11] = 0x38393434u | sb;
+  s[12] = 0x20341020u | sb;
+  s[13] = 0x00100000u | sb;
+  s[14] = (s[14] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[18] + block_x;
+  s[0] = (s[0] & 0xffffc0ffu) | 0x00000000u;
+  s[1] = 0x00000000u | sb;
+  s[2] = 0x10102010u | sb;
+  s[3] = 0x24203434u | sb;
+  s[4] = 0x34343834u | sb;
+  s[5] = 0x38383939u | sb;
+  s[6] = 0x3e393e3eu | sb;
+  s[7] = 0x3e3e3f3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3fu | sb;
+  s[11] = 0x393e3438u | sb;
+  s[12] = 0x24341020u | sb;
+  s[13] = 0x00100000u | sb;
+  s[14] = (s[14] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[19] + block_x;
+  s[1] = (s[1] & 0xffffc0ffu) | 0x00000000u;
+  s[2] = 0x00001000u | sb;
+  s[3] = 0x20102420u | sb;
+  s[4] = 0x34343434u | sb;
+  s[5] = 0x38383938u | sb;
+  s[6] = 0x39393e3eu | sb;
+  s[7] = 0x3e3e3f3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3fu | sb;
+  s[11] = 0x393e3438u | sb;
+  s[12] = 0x24341020u | sb;
+  s[13] = 0x00100000u | sb;
+  s[14] = (s[14] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[20] + block_x;
+  s[2] = 0x00001000u | sb;
+  s[3] = 0x20102420u | sb;
+  s[4] = 0x34343834u | sb;
+  s[5] = 0x38383938u | sb;
+  s[6] = 0x39393e3eu | sb;
+  s[7] = 0x3e3e3f3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3f3fu | sb;
+  s[11] = 0x3e3e3439u | sb;
+  s[12] = 0x24341020u | sb;
+  s[13] = 0x00100000u | sb;
+  s[14] = (s[14] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[21] + block_x;
+  s[2] = (s[2] & 0xc0ffc0c0u) | 0x00001000u;
+  s[3] = 0x24203434u | sb;
+  s[4] = 0x38343838u | sb;
+  s[5] = 0x39383939u | sb;
+  s[6] = 0x3d393e3eu | sb;
+  s[7] = 0x3e3e3f3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3f3fu | sb;
+  s[11] = 0x3e3e3439u | sb;
+  s[12] = 0x24341020u | sb;
+  s[13] = 0x00100000u | sb;
+  s[14] = (s[14] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[22] + block_x;
+  s[2] = (s[2] & 0xc0ffc0c0u) | 0x00002010u;
+  s[3] = 0x34243434u | sb;
+  s[4] = 0x38383938u | sb;
+  s[5] = 0x39393d39u | sb;
+  s[6] = 0x3e3e3e3eu | sb;
+  s[7] = 0x3e3e3f3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3f3fu | sb;
+  s[11] = 0x3e3e3439u | sb;
+  s[12] = 0x24341020u | sb;
+  s[13] = 0x00100000u | sb;
+  s[14] = (s[14] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[23] + block_x;
+  s[2] = (s[2] & 0xffffc0c0u) | 0x00000000u;
+  s[3] = 0x10102424u | sb;
+  s[4] = 0x34343838u | sb;
+  s[5] = 0x38383939u | sb;
+  s[6] = 0x3e393e3eu | sb;
+  s[7] = 0x3e3e3f3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3f3fu | sb;
+  s[11] = 0x393e3438u | sb;
+  s[12] = 0x24341020u | sb;
+  s[13] = 0x00100000u | sb;
+  s[14] = (s[14] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[24] + block_x;
+  s[2] = (s[2] & 0xffffc0c0u) | 0x00000000u;
+  s[3] = 0x10002010u | sb;
+  s[4] = 0x34243434u | sb;
+  s[5] = 0x38343938u | sb;
+  s[6] = 0x39393e3du | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3f3f3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3fu | sb;
+  s[11] = 0x393e3438u | sb;
+  s[12] = 0x24341020u | sb;
+  s[13] = 0x00100000u | sb;
+  s[14] = (s[14] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[25] + block_x;
+  s[2] = (s[2] & 0xffffc0ffu) | 0x00000000u;
+  s[3] = 0x00001010u | sb;
+  s[4] = 0x24203434u | sb;
+  s[5] = 0x38343938u | sb;
+  s[6] = 0x39393e39u | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3f3e3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3f3f3e3eu | sb;
+  s[11] = 0x38393434u | sb;
+  s[12] = 0x20341010u | sb;
+  s[13] = 0x00100000u | sb;
+  s[14] = (s[14] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[26] + block_x;
+  s[2] = (s[2] & 0xffffc0ffu) | 0x00000000u;
+  s[3] = 0x00001010u | sb;
+  s[4] = 0x20203424u | sb;
+  s[5] = 0x34343838u | sb;
+  s[6] = 0x39393d39u | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3e3e3f3fu | sb;
+  s[9] = 0x3f3f3f3fu | sb;
+  s[10] = 0x3e3e393eu | sb;
+  s[11] = 0x38393434u | sb;
+  s[12] = 0x20241010u | sb;
+  s[13] = 0x00100000u | sb;
+  s = (unsigned int *) lines[27] + block_x;
+  s[2] = (s[2] & 0xffffc0c0u) | 0x00000000u;
+  s[3] = 0x00001010u | sb;
+  s[4] = 0x24203434u | sb;
+  s[5] = 0x38343838u | sb;
+  s[6] = 0x39393e39u | sb;
+  s[7] = 0x3e3e3e3eu | sb;
+  s[8] = 0x3e3e3e3eu | sb;
+  s[9] = 0x3e3e3e3eu | sb;
+  s[10] = 0x3d3e3839u | sb;
+  s[11] = 0x34383434u | sb;
+  s[12] = 0x20201010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[28] + block_x;
+  s[2] = 0x00001000u | sb;
+  s[3] = 0x10102420u | sb;
+  s[4] = 0x34343434u | sb;
+  s[5] = 0x38383938u | sb;
+  s[6] = 0x39393939u | sb;
+  s[7] = 0x39393e3eu | sb;
+  s[8] = 0x3e3e3e3eu | sb;
+  s[9] = 0x393e3939u | sb;
+  s[10] = 0x39393838u | sb;
+  s[11] = 0x34342434u | sb;
+  s[12] = 0x10201010u | sb;
+  s[13] = 0x00000000u | sb;
+  s = (unsigned int *) lines[29] + block_x;
+  s[2] = (s[2] & 0xffffc0ffu) | 0x00000000u;
+  s[3] = 0x00001010u | sb;
+  s[4] = 0x10102420u | sb;
+  s[5] = 0x34243434u | sb;
+  s[6] = 0x34343838u | sb;
+  s[7] = 0x38383939u | sb;
+  s[8] = 0x39393939u | sb;
+  s[9] = 0x38393838u | sb;
+  s[10] = 0x38383434u | sb;
+  s[11] = 0x34342024u | sb;
+  s[12] = 0x10100010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[30] + block_x;
+  s[3] = (s[3] & 0xc0ffc0c0u) | 0x00000000u;
+  s[4] = 0x10101010u | sb;
+  s[5] = 0x24203424u | sb;
+  s[6] = 0x34343434u | sb;
+  s[7] = 0x38343838u | sb;
+  s[8] = 0x38383838u | sb;
+  s[9] = 0x38383438u | sb;
+  s[10] = 0x34343434u | sb;
+  s[11] = 0x24341020u | sb;
+  s[12] = 0x10100010u | sb;
+  s[13] = (s[13] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[31] + block_x;
+  s[3] = (s[3] & 0xffffc0c0u) | 0x00000000u;
+  s[4] = 0x00001010u | sb;
+  s[5] = 0x10102020u | sb;
+  s[6] = 0x34243434u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x34342434u | sb;
+  s[11] = 0x20201010u | sb;
+  s[12] = 0x10100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[32] + block_x;
+  s[4] = 0x00000000u | sb;
+  s[5] = 0x10101010u | sb;
+  s[6] = 0x20202424u | sb;
+  s[7] = 0x34343434u | sb;
+  s[8] = 0x34343434u | sb;
+  s[9] = 0x34343434u | sb;
+  s[10] = 0x24342024u | sb;
+  s[11] = 0x10201010u | sb;
+  s[12] = 0x00100000u | sb;
+  s[13] = (s[13] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[33] + block_x;
+  s[4] = (s[4] & 0xc0ffc0c0u) | 0x00000000u;
+  s[5] = 0x10001010u | sb;
+  s[6] = 0x10102020u | sb;
+  s[7] = 0x24202424u | sb;
+  s[8] = 0x34243434u | sb;
+  s[9] = 0x24242424u | sb;
+  s[10] = 0x20202020u | sb;
+  s[11] = 0x10101010u | sb;
+  s[12] = 0x00000000u | sb;
+  s[13] = (s[13] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[34] + block_x;
+  s[4] = (s[4] & 0xffffc0c0u) | 0x00000000u;
+  s[5] = 0x00001000u | sb;
+  s[6] = 0x10101010u | sb;
+  s[7] = 0x20202020u | sb;
+  s[8] = 0x20202020u | sb;
+  s[9] = 0x20202020u | sb;
+  s[10] = 0x10201010u | sb;
+  s[11] = 0x10100010u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[35] + block_x;
+  s[4] = (s[4] & 0xffffc0ffu) | 0x00000000u;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x10001010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x20202020u | sb;
+  s[9] = 0x20201010u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x00100000u | sb;
+  s[12] = 0x00000000u | sb;
+  s = (unsigned int *) lines[36] + block_x;
+  s[5] = 0x00000000u | sb;
+  s[6] = 0x00001010u | sb;
+  s[7] = 0x10101010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10101010u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[37] + block_x;
+  s[5] = (s[5] & 0xc0ffc0c0u) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x10001010u | sb;
+  s[8] = 0x10101010u | sb;
+  s[9] = 0x10101010u | sb;
+  s[10] = 0x10100000u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[38] + block_x;
+  s[5] = (s[5] & 0xffffc0c0u) | 0x00000000u;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x10001010u | sb;
+  s[9] = 0x00100000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = 0x00000000u | sb;
+  s[12] = (s[12] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[39] + block_x;
+  s[6] = 0x00000000u | sb;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xc0c0ffc0u) | 0x00000000u;
+  s = (unsigned int *) lines[40] + block_x;
+  s[6] = (s[6] & 0xffffc0c0u) | 0x00000000u;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = 0x00000000u | sb;
+  s[11] = (s[11] & 0xffc0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[41] + block_x;
+  s[7] = 0x00000000u | sb;
+  s[8] = 0x00000000u | sb;
+  s[9] = 0x00000000u | sb;
+  s[10] = (s[10] & 0xc0c0ffffu) | 0x00000000u;
+  s = (unsigned int *) lines[42] + block_x;
+  s[8] = (s[8] & 0xc0ffc0c0u) | 0x00000000u;
+  s[9] = (s[9] & 0xc0c0ffffu) | 0x00000000u;
+}
+
+void (*const img_pwr2_compiled[])(unsigned char **lines, int block_x, unsigned int sb) = {
+  img_pwr2_compiled_0_0, img_pwr2_compiled_0_1, img_pwr2_compiled_0_2, img_pwr2_compiled_0_3,
+};
+const unsigned short img_pwr2_compiled_words[] = {
+  429, 423, 422, 429,
 };
@@ -17,6 +17,7 @@
 
 #define delay(n) vTaskDelay((n) / portTICK_PERIOD_MS)
 unsigned long millis();
+unsigned long micros();
 
 #endif /* ARDUINO_ARCH_ESP32 */
 
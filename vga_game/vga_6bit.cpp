@@ -4,8 +4,8 @@
  * Most of this code was inspired by or stolen from bitluni's
  * excellent ESP32Lib. I made this because ESP32Lib has a lot of extra
  * stuff I don't need (like 16 bit output, drawing functions,
- * etc.). My only addition an interrupt handler to count frames, which
- * is used to wait for the right time to swap framebuffers.
+ * etc.). My only addition an interrupt handler to swap framebuffers
+ * at the end of the frame, waking up the task waiting for the swap.
  *
  * === Overview ========================================================
  *
@@ -22,6 +22,13 @@
  * can be swapped so while one of them is being sent out, the other is
  * being drawn.
  *
+ * Optionally, a third framebuffer can be used (if there's enough DMA
+ * memory), so a frame can be drawn while the previous one waits to
+ * be displayed. In this case, swapping buffers only waits for the end
+ * of the frame if there are already two frames waiting, and at the
+ * end of the frame only the newest waiting frame is displayed (the
+ * others are dropped).
+ *
  * Each byte of the framebuffer always contains the vsync and hsync
  * signal at bits 7 and 6 (the high bits). The other 6 bits are set by
  * the user: usually (msb)RRGGBB(lsb), but other configurations are
@@ -54,15 +61,51 @@
  * with vga_get_sync_bits(). They depend only on the video mode so
  * it's safe to store them in a variable at the start of the program.
  *
+ * Rows of a single solid color (e.g. sky or HUD backgrounds) can be
+ * shown from a shared line buffer instead of the framebuffer with
+ * vga_set_solid_line(), so they don't need to be drawn. To save
+ * memory, vga_set_border() can be called before vga_init() to make
+ * the framebuffers shorter, with the remaining top and bottom rows
+ * always shown from a solid line buffer.
+ *
+ * Similarly, vga_set_hud() reserves lines above and below the
+ * framebuffers for a HUD (heads-up display) that's always displayed.
+ * It has a single copy (not swapped with the framebuffers), so it only
+ * needs to be drawn when its contents change.
+ *
+ * To save even more memory, vga_set_line_buffer() can be called before
+ * vga_init() to use no framebuffer at all: only a few lines are
+ * allocated, and each line is rendered by a user function just before
+ * it's sent to the monitor.
+ *
+ * Alternatively, vga_set_segments() can be called before vga_init() to
+ * compose each line from a few pieces of DMA memory (segments) chosen
+ * by the user for each frame instead of a framebuffer, e.g. pointing
+ * directly to rows of background tiles. Only the list of segments of
+ * each line is swapped at the end of the frame.
+ *
+ * With a single framebuffer, vga_set_beam_bands() can be called before
+ * vga_init() to split the framebuffer in horizontal bands, with an
+ * interrupt at the end of each band. vga_wait_beam_band() can then be
+ * used to draw each band right after it's sent to the monitor ("racing
+ * the beam"), so it's ready before it's sent again in the next frame.
+ *
+ * The video mode can be changed at any time with vga_set_mode(), which
+ * stops the output, frees all buffers and initializes everything again
+ * (vga_deinit() only stops the output and frees the memory).
+ *
  * 3) When you're done drawing a frame, call vga_swap_buffers() to
  * swap the front and back buffers. By default, this function waits
- * for the current frame to end. It you don't want this, call it
- * passing `false` (but if you do this, expect a wandering horizontal
- * line on the screeb).
+ * for the current frame to end (the swap is done by the interrupt
+ * handler, and the calling task sleeps until then) unless there's a
+ * free third framebuffer. It you don't want this, call it passing
+ * `false` (but if you do this, expect a wandering horizontal line on
+ * the screeb).
  *
  * =====================================================================
  */
 
+#include <cstring>
 #include <esp_heap_caps.h>
 #include <soc/rtc.h>
 #include <soc/i2s_reg.h>
@@ -82,6 +125,8 @@
 #include <freertos/task.h>
 #define DELAY(n) vTaskDelay((n) / portTICK_PERIOD_MS)
 #endif
+#include <freertos/semphr.h>
+#include <esp_timer.h>
 
 #include "vga_6bit.h"
 
@@ -126,21 +171,24 @@ const VgaMode vga_mode_240x240(48, 48, 64, 240,  11, 2,  31, 480,  2,   12587500
 
 
 /*
- * We use 2 DMA buffer descriptors per VGA line, their buffers are:
+ * Blank lines use a single DMA buffer descriptor (up to
+ * VGA_BLANK_LINES_PER_DESC consecutive blank lines can share one
+ * descriptor), visible lines use 2 descriptors (or 1 plus the number of
+ * segments per line in segment mode). Their buffers are:
  *
  *                  |--hsync--|       |------------h_pixels------------|
  *
  *           +------+---------+-------+--------------------------------+
  *           |      |         |       |                                |
- *           |  dma_buf_hblank_vnorm  |   dma_buf_vblank_vnorm         |
+ *           |  dma_buf_blank_vnorm                                    |
  *           |      |         |       |                                |
  *     ---   +------+---------+-------+--------------------------------+
  *      |    |      |         |       |                                |
- *    vsync  |  dma_buf_hblank_vsync  |   dma_buf_vblank_vsync         |
+ *    vsync  |  dma_buf_blank_vsync                                    |
  *      |    |      |         |       |                                |
  *     ---   +------+---------+-------+--------------------------------+
  *           |      |         |       |                                |
- *           |  dma_buf_hblank_vnorm  |   dma_buf_vblank_vnorm         |
+ *           |  dma_buf_blank_vnorm                                    |
  *           |      |         |       |                                |
  *     ---   +------+---------+-------+--------------------------------+
  *      |    |      |         |       |                                |
@@ -149,27 +197,118 @@ const VgaMode vga_mode_240x240(48, 48, 64, 240,  11, 2,  31, 480,  2,   12587500
  *     ---   +------+---------+-------+--------------------------------+
  */
 
+// Max. number of consecutive blank lines sharing a DMA buffer
+// descriptor. Each extra line uses a full line of DMA memory in the
+// blank buffers, and saves a descriptor (12 bytes) for every
+// VGA_BLANK_LINES_PER_DESC lines, so 1 uses the least memory.
+#ifndef VGA_BLANK_LINES_PER_DESC
+#define VGA_BLANK_LINES_PER_DESC  1
+#endif
+#define VGA_MAX_DMA_BUF_LEN       4092   // max. length of a DMA buffer (multiple of 4)
+
 // DMA buffer descriptors
 static int dma_buf_desc_count;
 static lldesc_t *dma_buf_desc;
+static int DRAM_ATTR dma_buf_desc_pixels;   // index of the descriptor of the first visible line
+static int DRAM_ATTR line_pixel_descs;      // pixel descriptors of each visible line (after the hblank descriptor)
 
 // DMA buffers for hblank/vblank
-static uint8_t *dma_buf_hblank_vnorm;       // horizontal blank, outside vsync
-static uint8_t *dma_buf_hblank_vsync;       // horizontal blank, inside vsync
-static uint8_t *dma_buf_vblank_vnorm;       // blank pixel data, outside vsync
-static uint8_t *dma_buf_vblank_vsync;       // blank pixel data, inside vsync
+static uint8_t *dma_buf_blank_vnorm;        // blank lines (hblank and pixel data), outside vsync
+static uint8_t *dma_buf_blank_vsync;        // blank lines (hblank and pixel data), inside vsync
+static uint8_t *dma_buf_hblank_vnorm;       // horizontal blank of visible lines
 
 // DMA buffers for pixels (framebuffers)
-static int num_framebuffers;                // number of framebuffers (1 or 2, user-selected)
-static int active_framebuffer;              // index of current active (display) framebuffer
+#define VGA_MAX_FRAMEBUFFERS    3
+#define VGA_MIN_FREE_DMA_MEM    (64*1024)   // DMA memory to keep free when deciding to use a third framebuffer
+
+static int num_framebuffers;                // number of framebuffers (1, 2 or 3, user-selected)
+static volatile int DRAM_ATTR active_framebuffer;  // index of current active (display) framebuffer
 static int back_framebuffer;                // index of current back (drawing) framebuffer
-static uint8_t **framebuffer[2];            // framebuffer (pixel data + sync bits)
+static uint8_t **framebuffer[VGA_MAX_FRAMEBUFFERS];  // framebuffer (pixel data + sync bits)
+static int framebuffer_height;              // number of framebuffer lines (screen lines minus border)
+
+// shared read-only lines of a solid color, which can be displayed
+// instead of any framebuffer line
+#define VGA_MAX_SOLID_LINES     8
+static int num_solid_lines;
+static uint8_t solid_line_color[VGA_MAX_SOLID_LINES];
+static uint8_t *solid_line[VGA_MAX_SOLID_LINES];
+static uint8_t **solid_line_map[VGA_MAX_FRAMEBUFFERS];  // solid line displayed for each framebuffer line, or nullptr
+static int border_top;                      // screen lines above the framebuffer
+static int border_bottom;                   // screen lines below the framebuffer
+static uint8_t border_color;
+static uint8_t *border_line;                // solid line displayed in the border
+
+// beam racing: the framebuffer is split in bands of lines, each one
+// triggering an interrupt when it's sent
+#define VGA_MAX_BEAM_BANDS      16
+static int num_beam_bands;                  // 0 if beam racing is disabled
+static lldesc_t *DRAM_ATTR beam_band_desc[VGA_MAX_BEAM_BANDS];  // descriptor of the last line of each band
+static volatile unsigned int DRAM_ATTR vga_beam_band_count;  // bands sent since the start
+static volatile unsigned int DRAM_ATTR vga_beam_band_target; // band count awaited by a task, or 0
+static SemaphoreHandle_t vga_beam_done;     // given by I2S interrupt handler when vga_beam_band_target is reached
+
+// line buffer mode: instead of framebuffers, a ring of lines rendered
+// by a task just before they're sent (line y is stored in ring line
+// y % num_ring_lines, and an interrupt is triggered after each half of
+// the ring is sent). The task runs on core 0, so it never takes the
+// CPU from the game loop (on core 1), with the highest priority there,
+// since the lines must be ready before they're sent (the WiFi and
+// Bluetooth tasks can wait for a few lines).
+#define VGA_MAX_RING_LINES      32
+#define VGA_RING_TASK_STACK     4096
+#define VGA_RING_TASK_PRIORITY  (configMAX_PRIORITIES-1)
+#define VGA_RING_TASK_CORE      0
+static int num_ring_lines;                  // 0 if line buffer mode is disabled
+static uint8_t *ring_line[VGA_MAX_RING_LINES];
+static vga_frame_func ring_start_frame;     // user function called before rendering each frame
+static vga_line_func ring_render_line;      // user function to render a line
+static void *ring_data;                     // user data for ring_start_frame and ring_render_line
+static TaskHandle_t ring_task;              // task rendering the ring lines
+static volatile unsigned int DRAM_ATTR ring_sent_lines;  // lines sent since the start
+static unsigned int ring_rendered_lines;    // lines rendered since the start
+static int ring_render_y;                   // next framebuffer line to render
+static volatile bool ring_frame_ready;      // true if vga_swap_buffers() is waiting for the next frame to start
+static volatile unsigned int vga_late_lines;  // lines rendered after being sent
+
+// segment mode: instead of framebuffers, each framebuffer line is
+// composed of num_segments pieces of DMA memory chosen by the user,
+// and only the segment lists are swapped
+#define VGA_MAX_SEGMENTS        16
+static int DRAM_ATTR num_segments;          // segments per line, 0 if segment mode is disabled
+static VgaSegment *segment_list[VGA_MAX_FRAMEBUFFERS];  // segments of each line (used as framebuffers)
+
+// HUD lines, displayed between the border and the framebuffer
+static int hud_top;                         // HUD lines above the framebuffer
+static int hud_bottom;                      // HUD lines below the framebuffer
+static uint8_t **hud_lines;                 // top HUD lines followed by bottom HUD lines
+
+// framebuffer memory: each framebuffer is allocated in a single block
+// of DMA memory if possible, or else split in a few blocks (chunks) of
+// consecutive lines
+#define VGA_MAX_FB_CHUNKS       16
+#define VGA_HEAP_BLOCK_OVERHEAD 12          // approximate heap overhead of each allocated block (for the startup log)
+static int framebuffer_stride;              // bytes per framebuffer line
+static int num_framebuffer_chunks[VGA_MAX_FRAMEBUFFERS];
+static uint8_t *framebuffer_chunk[VGA_MAX_FRAMEBUFFERS][VGA_MAX_FB_CHUNKS];
+
+// finished frames waiting for the end of the displayed frame (oldest first)
+static volatile int DRAM_ATTR pending_framebuffer[VGA_MAX_FRAMEBUFFERS];
+static volatile int DRAM_ATTR num_pending_framebuffers;
+static volatile unsigned int DRAM_ATTR vga_queued_frames;   // frames swapped without waiting
+static volatile unsigned int DRAM_ATTR vga_dropped_frames;  // finished frames never displayed
 
 // interrupt handler stuff
+static volatile unsigned int DRAM_ATTR vga_frame_count;  // frames sent since the start
 static intr_handle_t i2s_isr_handle;        // I2S interrupt handler (triggered at end of frame)
-static volatile int DRAM_ATTR vga_frame_count = 0;    // incremented by I2S interrupt handler
+static portMUX_TYPE vga_swap_lock = portMUX_INITIALIZER_UNLOCKED;  // protects pending framebuffers
+static SemaphoreHandle_t vga_swap_done;     // given by I2S interrupt handler after swapping framebuffers
+static volatile bool DRAM_ATTR vga_swap_waiting;      // true if a task is waiting for vga_swap_done
+static volatile int64_t DRAM_ATTR vga_swap_isr_time;  // time of last swap by I2S interrupt handler (microseconds)
+static int vga_swap_latency;                // microseconds from last swap by I2S interrupt handler to task wakeup
 
 static const VgaMode *vga_mode;
+static int vga_pin_map[8];                  // pins selected in vga_init() (for vga_set_mode())
 
 
 /*
@@ -224,13 +363,45 @@ static lldesc_t *alloc_dma_buf_desc_array(int num)
 /*
  * Set buffer and length of a DMA buffer descriptor
  */
-static void set_dma_buf_desc_buffer(lldesc_t *buf_desc, uint8_t *buffer, int len)
+static void IRAM_ATTR set_dma_buf_desc_buffer(lldesc_t *buf_desc, uint8_t *buffer, int len)
 {
   buf_desc->length = len;
   buf_desc->size = len;
   buf_desc->buf = buffer;
 }
 
+/*
+ * Fill a blank line buffer with hblank and blank pixel data.
+ */
+static void fill_blank_line(uint8_t *buf, int hblank_len, uint8_t vsync)
+{
+  for (int i = 0; i < hblank_len; i++) {
+    if (i < vga_mode->h_front || i >= vga_mode->h_front+vga_mode->h_sync) {
+      buf[i^2] = vga_mode->hsync_inv_bit() | vsync;
+    } else {
+      buf[i^2] = vga_mode->hsync_bit() | vsync;
+    }
+  }
+  for (int i = 0; i < vga_mode->h_pixels; i++) {
+    buf[hblank_len + (i^2)] = vga_mode->hsync_inv_bit() | vsync;
+  }
+}
+
+/*
+ * Set the DMA buffer descriptors for a sequence of `num_lines` blank
+ * lines, using up to `max_fold` lines of `buf` per descriptor. Return
+ * the index of the next descriptor.
+ */
+static int set_blank_lines_desc(int d, uint8_t *buf, int line_len, int num_lines, int max_fold)
+{
+  while (num_lines > 0) {
+    int n = (num_lines < max_fold) ? num_lines : max_fold;
+    set_dma_buf_desc_buffer(&dma_buf_desc[d++], buf, n * line_len);
+    num_lines -= n;
+  }
+  return d;
+}
+
 /*
  * Allocate DMA buffers and descriptors for VGA output via I2S.
  *
@@ -241,34 +412,36 @@ static void set_dma_buf_desc_buffer(lldesc_t *buf_desc, uint8_t *buffer, int len
  */
 static void allocate_vga_i2s_buffers()
 {
-  // prepare DMA buffers for hblank/vblank areas
+  // prepare DMA buffers for hblank/vblank areas (folded blank lines
+  // must start at a 4-byte boundary to keep the byte order)
   int hblank_len = (vga_mode->h_front + vga_mode->h_sync + vga_mode->h_back + 3) & 0xfffffffc;
+  int line_len = hblank_len + vga_mode->h_pixels;
+  int fold = (vga_mode->h_pixels % 4 == 0) ? VGA_BLANK_LINES_PER_DESC : 1;
+  if (fold > VGA_MAX_DMA_BUF_LEN / line_len) fold = VGA_MAX_DMA_BUF_LEN / line_len;
+  if (fold < 1) fold = 1;
+  int fold_vsync = (fold < vga_mode->v_sync) ? fold : vga_mode->v_sync;
+  dma_buf_blank_vnorm = (uint8_t *) heap_caps_malloc(line_len * fold, MALLOC_CAP_DMA);
+  dma_buf_blank_vsync = (uint8_t *) heap_caps_malloc(line_len * fold_vsync, MALLOC_CAP_DMA);
   dma_buf_hblank_vnorm = (uint8_t *) heap_caps_malloc(hblank_len, MALLOC_CAP_DMA);
-  dma_buf_hblank_vsync = (uint8_t *) heap_caps_malloc(hblank_len, MALLOC_CAP_DMA);
-  dma_buf_vblank_vnorm = (uint8_t *) heap_caps_malloc((vga_mode->h_pixels+3) & 0xfffffffc, MALLOC_CAP_DMA);
-  dma_buf_vblank_vsync = (uint8_t *) heap_caps_malloc((vga_mode->h_pixels+3) & 0xfffffffc, MALLOC_CAP_DMA);
 
+  check_alloc(dma_buf_blank_vnorm, "not enough DMA memory for I2S buffers");
+  check_alloc(dma_buf_blank_vsync, "not enough DMA memory for I2S buffers");
   check_alloc(dma_buf_hblank_vnorm, "not enough DMA memory for I2S buffers");
-  check_alloc(dma_buf_hblank_vsync, "not enough DMA memory for I2S buffers");
-  check_alloc(dma_buf_vblank_vnorm, "not enough DMA memory for I2S buffers");
-  check_alloc(dma_buf_vblank_vsync, "not enough DMA memory for I2S buffers");
 
-  for (int i = 0; i < hblank_len; i++) {
-    if (i < vga_mode->h_front || i >= vga_mode->h_front+vga_mode->h_sync) {
-      dma_buf_hblank_vnorm[i^2] = vga_mode->hsync_inv_bit() | vga_mode->vsync_inv_bit();
-      dma_buf_hblank_vsync[i^2] = vga_mode->hsync_inv_bit() | vga_mode->vsync_bit();
-    } else {
-      dma_buf_hblank_vnorm[i^2] = vga_mode->hsync_bit() | vga_mode->vsync_inv_bit();
-      dma_buf_hblank_vsync[i^2] = vga_mode->hsync_bit() | vga_mode->vsync_bit();
-    }
+  for (int i = 0; i < fold; i++) {
+    fill_blank_line(dma_buf_blank_vnorm + i*line_len, hblank_len, vga_mode->vsync_inv_bit());
   }
-  for (int i = 0; i < vga_mode->h_pixels; i++) {
-    dma_buf_vblank_vnorm[i^2] = vga_mode->hsync_inv_bit() | vga_mode->vsync_inv_bit();
-    dma_buf_vblank_vsync[i^2] = vga_mode->hsync_inv_bit() | vga_mode->vsync_bit();
+  for (int i = 0; i < fold_vsync; i++) {
+    fill_blank_line(dma_buf_blank_vsync + i*line_len, hblank_len, vga_mode->vsync_bit());
   }
+  memcpy(dma_buf_hblank_vnorm, dma_buf_blank_vnorm, hblank_len);
 
   // allocate DMA buffer descriptors
-  dma_buf_desc_count = 2 * (vga_mode->v_front + vga_mode->v_sync + vga_mode->v_back + vga_mode->v_pixels);
+  line_pixel_descs = (num_segments > 0) ? num_segments : 1;
+  dma_buf_desc_count = ((vga_mode->v_front + fold - 1) / fold +
+                        (vga_mode->v_sync + fold_vsync - 1) / fold_vsync +
+                        (vga_mode->v_back + fold - 1) / fold +
+                        (1 + line_pixel_descs) * vga_mode->v_pixels);
   dma_buf_desc = alloc_dma_buf_desc_array(dma_buf_desc_count);
   check_alloc(dma_buf_desc, "not enough memory for DMA buffer descriptors");
   for (int i = 0; i < dma_buf_desc_count; i++) {
@@ -278,32 +451,94 @@ static void allocate_vga_i2s_buffers()
 
   // stitch together the DMA buffers to compose a full VGA frame
   int d = 0;
-  for (int i = 0; i < vga_mode->v_front; i++) {
+  d = set_blank_lines_desc(d, dma_buf_blank_vnorm, line_len, vga_mode->v_front, fold);
+  d = set_blank_lines_desc(d, dma_buf_blank_vsync, line_len, vga_mode->v_sync, fold_vsync);
+  d = set_blank_lines_desc(d, dma_buf_blank_vnorm, line_len, vga_mode->v_back, fold);
+  dma_buf_desc_pixels = d;
+  for (int i = 0; i < vga_mode->v_pixels; i++) {
     set_dma_buf_desc_buffer(&dma_buf_desc[d++], dma_buf_hblank_vnorm, hblank_len);
-    set_dma_buf_desc_buffer(&dma_buf_desc[d++], dma_buf_vblank_vnorm, vga_mode->h_pixels);
+    for (int s = 0; s < line_pixel_descs; s++) {
+      set_dma_buf_desc_buffer(&dma_buf_desc[d++], (uint8_t *) 0, 0);  // set later with set_vga_i2s_active_framebuffer()
+    }
   }
-  for (int i = 0; i < vga_mode->v_sync; i++) {
-    set_dma_buf_desc_buffer(&dma_buf_desc[d++], dma_buf_hblank_vsync, hblank_len);
-    set_dma_buf_desc_buffer(&dma_buf_desc[d++], dma_buf_vblank_vsync, vga_mode->h_pixels);
+
+  // trigger interrupt at the end of the last screen line of each band
+  for (int b = 0; b < num_beam_bands; b++) {
+    int last_y = border_top + hud_top + vga_get_beam_band_line(b+1) - 1;
+    int last_i = last_y * vga_mode->v_div + vga_mode->v_div - 1;
+    beam_band_desc[b] = &dma_buf_desc[dma_buf_desc_pixels + (1 + line_pixel_descs)*last_i + line_pixel_descs];
+    beam_band_desc[b]->eof = true;
   }
-  for (int i = 0; i < vga_mode->v_back; i++) {
-    set_dma_buf_desc_buffer(&dma_buf_desc[d++], dma_buf_hblank_vnorm, hblank_len);
-    set_dma_buf_desc_buffer(&dma_buf_desc[d++], dma_buf_vblank_vnorm, vga_mode->h_pixels);
+
+  // trigger interrupt at the end of each half of the line buffer ring
+  for (int y = num_ring_lines/2 - 1; y < framebuffer_height && num_ring_lines > 0; y += num_ring_lines/2) {
+    int last_i = (border_top + hud_top + y) * vga_mode->v_div + vga_mode->v_div - 1;
+    dma_buf_desc[dma_buf_desc_pixels + (1 + line_pixel_descs)*last_i + line_pixel_descs].eof = true;
   }
-  for (int i = 0; i < vga_mode->v_pixels; i++) {
-    set_dma_buf_desc_buffer(&dma_buf_desc[d++], dma_buf_hblank_vnorm, hblank_len);
-    set_dma_buf_desc_buffer(&dma_buf_desc[d++], (uint8_t *) 0, vga_mode->h_pixels);  // set later with set_vga_i2s_active_framebuffer()
+}
+
+/*
+ * Split a line of `len` bytes in `num` segments of (almost) the same
+ * length, keeping them multiples of 4 bytes.
+ */
+static void IRAM_ATTR split_line_segments(VgaSegment *seg, int num, uint8_t *line, int len)
+{
+  int seg_len = (len / num) & 0xfffffffc;
+  for (int s = 0; s < num; s++) {
+    seg[s].buf = line + s*seg_len;
+    seg[s].len = (s == num-1) ? len - s*seg_len : seg_len;
   }
 }
 
 /*
- * Set the framebuffer memory as the buffers for the DMA buffer
- * descriptors for I2S output.
+ * Set the framebuffer memory (or the solid lines replacing it) as the
+ * buffers for the DMA buffer descriptors for I2S output.
+ *
+ * This is called from the I2S interrupt handler at the end of the
+ * frame, so the descriptors are changed while the DMA is sending the
+ * vblank lines.
  */
-static void set_vga_i2s_active_framebuffer(unsigned char **fb)
+static void IRAM_ATTR set_vga_i2s_active_framebuffer(int index)
 {
+  unsigned char **fb = framebuffer[index];
+  unsigned char **solid = solid_line_map[index];  // (the ring lines are used in line buffer mode)
   for (int i = 0; i < vga_mode->v_pixels; i++) {
-    set_dma_buf_desc_buffer(&dma_buf_desc[2*(vga_mode->v_front+vga_mode->v_sync+vga_mode->v_back+i)+1], fb[i/vga_mode->v_div], vga_mode->h_pixels);
+    lldesc_t *desc = &dma_buf_desc[dma_buf_desc_pixels + (1 + line_pixel_descs)*i + 1];
+    int y = i/vga_mode->v_div - border_top;
+    uint8_t *line;
+    if (y < 0) {
+      line = border_line;
+    } else if (y < hud_top) {
+      line = hud_lines[y];
+    } else if ((y -= hud_top) < framebuffer_height) {
+      if (num_segments > 0) {
+        VgaSegment *seg = &segment_list[index][y * num_segments];
+        for (int s = 0; s < num_segments; s++) {
+          set_dma_buf_desc_buffer(&desc[s], seg[s].buf, seg[s].len);
+        }
+        continue;
+      }
+      if (num_ring_lines > 0) {
+        line = ring_line[y % num_ring_lines];
+      } else {
+        line = (solid[y]) ? solid[y] : fb[y];
+      }
+    } else if ((y -= framebuffer_height) < hud_bottom) {
+      line = hud_lines[hud_top + y];
+    } else {
+      line = border_line;
+    }
+    if (line_pixel_descs == 1) {
+      set_dma_buf_desc_buffer(desc, line, vga_mode->h_pixels);
+    } else {
+      // segment mode: lines that aren't composed of segments are split
+      // across the line descriptors
+      VgaSegment seg[VGA_MAX_SEGMENTS];
+      split_line_segments(seg, line_pixel_descs, line, vga_mode->h_pixels);
+      for (int s = 0; s < line_pixel_descs; s++) {
+        set_dma_buf_desc_buffer(&desc[s], seg[s].buf, seg[s].len);
+      }
+    }
   }
 }
 
@@ -313,15 +548,62 @@ static void set_vga_i2s_active_framebuffer(unsigned char **fb)
  * ==========================================================================
  */
 
-static unsigned char **alloc_framebuffer()
+/*
+ * Allocate the framebuffer memory in as few blocks as possible: try a
+ * single block first, and if the DMA memory is too fragmented for it,
+ * try 2, 4, ... blocks of consecutive lines.
+ */
+static unsigned char **alloc_framebuffer(int index)
+{
+  int height = framebuffer_height;
+  unsigned char **fb = (unsigned char **) malloc(sizeof(unsigned char *) * height);
+  if (! fb) return nullptr;
+
+  uint8_t **chunk = framebuffer_chunk[index];
+  for (int num_chunks = 1; num_chunks <= VGA_MAX_FB_CHUNKS; num_chunks *= 2) {
+    int chunk_lines = (height + num_chunks - 1) / num_chunks;
+    int num_used = (height + chunk_lines - 1) / chunk_lines;
+    int c;
+    for (c = 0; c < num_used; c++) {
+      int lines = (height - c*chunk_lines < chunk_lines) ? height - c*chunk_lines : chunk_lines;
+      chunk[c] = (uint8_t *) heap_caps_malloc(lines * framebuffer_stride, MALLOC_CAP_DMA);
+      if (! chunk[c]) break;
+    }
+    if (c < num_used) {
+      while (c-- > 0) {
+        heap_caps_free(chunk[c]);
+      }
+      continue;
+    }
+
+    num_framebuffer_chunks[index] = num_used;
+    for (int i = 0; i < height; i++) {
+      fb[i] = chunk[i / chunk_lines] + (i % chunk_lines) * framebuffer_stride;
+    }
+    return fb;
+  }
+  free(fb);
+  return nullptr;
+}
+
+/*
+ * Return a shared line of the given color, allocating it if necessary.
+ * Return nullptr if there's no memory or too many colors are used.
+ */
+static uint8_t *get_solid_line(uint8_t color)
 {
-  unsigned char **fb = (unsigned char **) malloc(sizeof(unsigned char *) * vga_mode->y_res());
-  check_alloc(fb, "not enough memory for framebuffer");
-  for (int i = 0; i < vga_mode->y_res(); i++) {
-    fb[i] = (uint8_t *) heap_caps_malloc((vga_mode->h_pixels+3) & 0xfffffffc, MALLOC_CAP_DMA);
-    check_alloc(fb[i], "not enough DMA memory for framebuffer");
+  color &= 0x3f;
+  for (int i = 0; i < num_solid_lines; i++) {
+    if (solid_line_color[i] == color) return solid_line[i];
   }
-  return fb;
+  if (num_solid_lines >= VGA_MAX_SOLID_LINES) return nullptr;
+  uint8_t *line = (uint8_t *) heap_caps_malloc(framebuffer_stride, MALLOC_CAP_DMA);
+  if (! line) return nullptr;
+  memset(line, vga_mode->sync_bits() | color, framebuffer_stride);
+  solid_line_color[num_solid_lines] = color;
+  solid_line[num_solid_lines] = line;
+  num_solid_lines++;
+  return line;
 }
 
 static void clear_framebuffer(unsigned char **fb, uint8_t color)
@@ -331,7 +613,7 @@ static void clear_framebuffer(unsigned char **fb, uint8_t color)
                              (clear_byte << 16) |
                              (clear_byte <<  8) |
                              (clear_byte <<  0));
-  for (int y = 0; y < vga_mode->y_res(); y++) {
+  for (int y = 0; y < framebuffer_height; y++) {
     unsigned int *line = (unsigned int *) fb[y];
     for (int x = 0; x < vga_mode->x_res()/4; x++) {
       line[x] = clear_data;
@@ -370,13 +652,173 @@ static void reset_i2s_dma()
 }
 
 /*
- * Interrupt handler function: just increment the frame count to let
- * the main logic to know when it's safe to swap framebuffers.
+ * Update the count of beam racing bands sent when the band ending with
+ * the given descriptor is sent, and wake up the task waiting for it.
+ * The count is calculated from the frame count, so it's still right if
+ * an interrupt is missed.
+ */
+static void IRAM_ATTR update_beam_band_count(lldesc_t *desc)
+{
+  int band = 0;
+  while (band < num_beam_bands && beam_band_desc[band] != desc) {
+    band++;
+  }
+  if (band == num_beam_bands) return;
+
+  bool wake = false;
+  portENTER_CRITICAL_ISR(&vga_swap_lock);
+  vga_beam_band_count = vga_frame_count * num_beam_bands + band + 1;
+  if (vga_beam_band_target != 0 && (int) (vga_beam_band_count - vga_beam_band_target) >= 0) {
+    vga_beam_band_target = 0;
+    wake = true;
+  }
+  portEXIT_CRITICAL_ISR(&vga_swap_lock);
+
+  if (wake) {
+    BaseType_t task_woken = pdFALSE;
+    xSemaphoreGiveFromISR(vga_beam_done, &task_woken);
+    if (task_woken) {
+      portYIELD_FROM_ISR();
+    }
+  }
+}
+
+/*
+ * Update the count of lines sent in line buffer mode when the line of
+ * the given descriptor is sent, and wake up the task rendering the
+ * ring lines.
+ */
+static void IRAM_ATTR update_ring_sent_lines(lldesc_t *desc)
+{
+  int i = ((desc - dma_buf_desc) - dma_buf_desc_pixels) / (1 + line_pixel_descs);
+  int y = i / vga_mode->v_div - border_top - hud_top;
+  if (y < 0 || y >= framebuffer_height) return;
+
+  ring_sent_lines = vga_frame_count * framebuffer_height + y + 1;
+  BaseType_t task_woken = pdFALSE;
+  vTaskNotifyGiveFromISR(ring_task, &task_woken);
+  if (task_woken) {
+    portYIELD_FROM_ISR();
+  }
+}
+
+/*
+ * Interrupt handler function: at the end of the frame, swap in the
+ * newest framebuffer finished by vga_swap_buffers() (if any), dropping
+ * the older ones, and wake up the task waiting for it. With beam
+ * racing or in line buffer mode, this is also called at the end of
+ * each band or half of the line ring.
  */
 static void IRAM_ATTR i2s_isr(void *arg)
 {
   REG_WRITE(I2S_INT_CLR_REG(1), (REG_READ(I2S_INT_RAW_REG(1)) & 0xffffffc0) | 0x3f); // 1 means I2S1
+
+  lldesc_t *desc = (lldesc_t *) I2S1.out_eof_des_addr;
+  if (num_beam_bands > 0) {
+    update_beam_band_count(desc);
+  }
+  if (num_ring_lines > 0) {
+    update_ring_sent_lines(desc);
+  }
+  if (desc != &dma_buf_desc[dma_buf_desc_count-1]) return;
   vga_frame_count++;
+
+  int fb = -1;
+  bool wake = false;
+  portENTER_CRITICAL_ISR(&vga_swap_lock);
+  if (num_pending_framebuffers > 0) {
+    fb = pending_framebuffer[num_pending_framebuffers-1];
+    vga_dropped_frames += num_pending_framebuffers-1;
+    num_pending_framebuffers = 0;
+    active_framebuffer = fb;
+    wake = vga_swap_waiting;
+    vga_swap_waiting = false;
+  }
+  portEXIT_CRITICAL_ISR(&vga_swap_lock);
+
+  if (fb >= 0) {
+    set_vga_i2s_active_framebuffer(fb);
+    vga_swap_isr_time = esp_timer_get_time();
+  }
+  if (wake) {
+    BaseType_t task_woken = pdFALSE;
+    xSemaphoreGiveFromISR(vga_swap_done, &task_woken);
+    if (task_woken) {
+      portYIELD_FROM_ISR();
+    }
+  }
+}
+
+/*
+ * Render lines in line buffer mode until `count` lines (since the
+ * start) are rendered, starting a new frame with ring_start_frame()
+ * before line 0 if vga_swap_buffers() is waiting for it.
+ */
+static void render_ring_lines(unsigned int count)
+{
+  while ((int) (count - ring_rendered_lines) > 0) {
+    if (ring_render_y == 0 && ring_frame_ready) {
+      ring_start_frame(ring_data);
+      ring_frame_ready = false;
+      xSemaphoreGive(vga_swap_done);
+    }
+    if ((int) (ring_sent_lines - ring_rendered_lines) >= 0) {
+      vga_late_lines++;
+    }
+    ring_render_line(ring_render_y, ring_line[ring_render_y % num_ring_lines], ring_data);
+    ring_rendered_lines++;
+    if (++ring_render_y == framebuffer_height) {
+      ring_render_y = 0;
+    }
+  }
+}
+
+/*
+ * Task rendering the ring lines in line buffer mode: each time half of
+ * the ring is sent, render the lines up to a full ring ahead.
+ */
+static void ring_task_func(void *arg)
+{
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    render_ring_lines(ring_sent_lines + num_ring_lines);
+  }
+}
+
+/*
+ * Allocate the ring lines for line buffer mode and start the task
+ * rendering them. The first frame is blank, the task starts rendering
+ * the next one when it's woken up by the interrupt handler.
+ */
+static void setup_line_ring()
+{
+  // the ring must have an even number of lines, and the framebuffer
+  // height must be a multiple of it (so each line always uses the same
+  // ring line)
+  int n = (num_ring_lines > VGA_MAX_RING_LINES) ? VGA_MAX_RING_LINES : num_ring_lines;
+  while (n >= 2 && (n % 2 != 0 || framebuffer_height % n != 0)) {
+    n--;
+  }
+  if (n < 2) die("invalid number of lines for VGA line buffer mode");
+  num_ring_lines = n;
+
+  uint8_t *ring = (uint8_t *) heap_caps_malloc(num_ring_lines * framebuffer_stride, MALLOC_CAP_DMA);
+  check_alloc(ring, "not enough DMA memory for VGA line buffer");
+  memset(ring, vga_mode->sync_bits(), num_ring_lines * framebuffer_stride);
+  for (int i = 0; i < num_ring_lines; i++) {
+    ring_line[i] = ring + i * framebuffer_stride;
+  }
+
+  ring_sent_lines = 0;
+  ring_rendered_lines = framebuffer_height;
+  ring_render_y = 0;
+  ring_frame_ready = false;
+  if (xTaskCreatePinnedToCore(ring_task_func, "vga_lines", VGA_RING_TASK_STACK, nullptr,
+                              VGA_RING_TASK_PRIORITY, &ring_task, VGA_RING_TASK_CORE) != pdPASS) {
+    die("can't create VGA line buffer task");
+  }
+  printf("VGA: line buffer mode with %d lines, using %d bytes of DMA memory\n",
+         num_ring_lines, num_ring_lines * framebuffer_stride);
 }
 
 /*
@@ -490,6 +932,23 @@ static void start_i2s_output()
  * ==========================================================================
  */
 
+/*
+ * Return a framebuffer that's not displayed or waiting to be
+ * displayed, or -1 if there's none. Must be called with
+ * vga_swap_lock held.
+ */
+static int get_free_framebuffer()
+{
+  for (int i = 0; i < num_framebuffers; i++) {
+    bool used = (i == active_framebuffer && num_framebuffers > 1);
+    for (int j = 0; j < num_pending_framebuffers; j++) {
+      if (pending_framebuffer[j] == i) used = true;
+    }
+    if (! used) return i;
+  }
+  return -1;
+}
+
 /**
  * Initialize VGA output.
  *
@@ -502,21 +961,95 @@ static void start_i2s_output()
  *   [5] blue  bit 1 (msb)
  *   [6] H-sync
  *   [7] V-sync
+ *
+ * `num_fb` is the number of framebuffers (1, 2 or 3). A third
+ * framebuffer is only allocated if there's enough DMA memory left for
+ * it, use vga_get_num_framebuffers() to check.
  */
-void vga_init(const int *pin_map, const VgaMode &mode, bool double_buffered)
+void vga_init(const int *pin_map, const VgaMode &mode, int num_fb)
 {
+  memcpy(vga_pin_map, pin_map, sizeof(vga_pin_map));
   vga_mode = &mode;
-  num_framebuffers = (double_buffered) ? 2 : 1;
-  for (int i = 0; i < num_framebuffers; i++) {
-    framebuffer[i] = alloc_framebuffer();
+  num_framebuffers = (num_fb < 1) ? 1 : (num_fb > VGA_MAX_FRAMEBUFFERS) ? VGA_MAX_FRAMEBUFFERS : num_fb;
+  framebuffer_stride = (vga_mode->h_pixels+3) & 0xfffffffc;
+  framebuffer_height = vga_mode->y_res() - border_top - border_bottom - hud_top - hud_bottom;
+  if (framebuffer_height < 1) die("VGA border and HUD are too large");
+  if (num_beam_bands > framebuffer_height) num_beam_bands = framebuffer_height;
+  if (num_ring_lines > 0) num_framebuffers = 0;
+  if (num_segments > 0) num_framebuffers = 2;
+  size_t free_before = heap_caps_get_free_size(MALLOC_CAP_DMA);
+  size_t largest_before = heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+  for (int i = 0; i < num_framebuffers && num_segments > 0; i++) {
+    segment_list[i] = (VgaSegment *) malloc(sizeof(VgaSegment) * framebuffer_height * num_segments);
+    check_alloc(segment_list[i], "not enough memory for VGA segment list");
+    solid_line_map[i] = (uint8_t **) calloc(framebuffer_height, sizeof(uint8_t *));
+    check_alloc(solid_line_map[i], "not enough memory for VGA segment list");
+  }
+  for (int i = 0; i < num_framebuffers && num_segments == 0; i++) {
+    if (i == 2 && heap_caps_get_free_size(MALLOC_CAP_DMA) < (size_t) (framebuffer_height * framebuffer_stride + VGA_MIN_FREE_DMA_MEM)) {
+      num_framebuffers = 2;
+      break;
+    }
+    framebuffer[i] = alloc_framebuffer(i);
+    check_alloc(framebuffer[i], "not enough DMA memory for framebuffer");
+    clear_framebuffer(framebuffer[i], 0);
+    solid_line_map[i] = (uint8_t **) calloc(framebuffer_height, sizeof(uint8_t *));
+    check_alloc(solid_line_map[i], "not enough memory for framebuffer");
+  }
+  border_line = get_solid_line(border_color);
+  check_alloc(border_line, "not enough DMA memory for border");
+  for (int i = 0; i < num_framebuffers && num_segments > 0; i++) {
+    for (int y = 0; y < framebuffer_height; y++) {
+      split_line_segments(&segment_list[i][y * num_segments], num_segments, border_line, vga_mode->h_pixels);
+    }
+  }
+  if (hud_top + hud_bottom > 0) {
+    uint8_t *hud = (uint8_t *) heap_caps_malloc((hud_top + hud_bottom) * framebuffer_stride, MALLOC_CAP_DMA);
+    hud_lines = (uint8_t **) malloc(sizeof(uint8_t *) * (hud_top + hud_bottom));
+    check_alloc(hud, "not enough DMA memory for HUD");
+    check_alloc(hud_lines, "not enough memory for HUD");
+    for (int i = 0; i < hud_top + hud_bottom; i++) {
+      hud_lines[i] = hud + i * framebuffer_stride;
+    }
+    memset(hud, vga_mode->sync_bits(), (hud_top + hud_bottom) * framebuffer_stride);
+  }
+  size_t free_after = heap_caps_get_free_size(MALLOC_CAP_DMA);
+  if (num_ring_lines > 0 || num_segments > 0) {
+    // (the ring lines and the segment descriptors are reported when allocated below)
+    printf("VGA: %s, no framebuffers, using %u bytes of DMA memory for 0 bytes of pixels\n",
+           (num_ring_lines > 0) ? "line buffer mode" : "segment mode", (unsigned) (free_before - free_after));
+  } else {
+    int num_lines = num_framebuffers * framebuffer_height;
+    int num_blocks = 0;
+    for (int i = 0; i < num_framebuffers; i++) {
+      num_blocks += num_framebuffer_chunks[i];
+    }
+    printf("VGA: %d framebuffers in %d block(s), using %u bytes of DMA memory for %u bytes of pixels (~%d bytes less than one block per line)\n",
+           num_framebuffers, num_blocks, (unsigned) (free_before - free_after), (unsigned) (num_lines * framebuffer_stride),
+           (num_lines - num_blocks) * VGA_HEAP_BLOCK_OVERHEAD);
   }
+  printf("VGA: free DMA memory %u -> %u bytes, largest free block %u -> %u bytes\n",
+         (unsigned) free_before, (unsigned) free_after,
+         (unsigned) largest_before, (unsigned) heap_caps_get_largest_free_block(MALLOC_CAP_DMA));
+
   active_framebuffer = 0;
-  back_framebuffer = (active_framebuffer+1) % num_framebuffers;
-  clear_framebuffer(framebuffer[active_framebuffer], 0);
-  clear_framebuffer(framebuffer[back_framebuffer], 0);
+  back_framebuffer = (num_framebuffers > 0) ? (active_framebuffer+1) % num_framebuffers : 0;
+  num_pending_framebuffers = 0;
+
+  vga_swap_done = xSemaphoreCreateBinary();
+  check_alloc(vga_swap_done, "not enough memory for vsync semaphore");
+  vga_beam_done = xSemaphoreCreateBinary();
+  check_alloc(vga_beam_done, "not enough memory for beam racing semaphore");
+  if (num_ring_lines > 0) {
+    setup_line_ring();
+  }
 
   allocate_vga_i2s_buffers();
-  set_vga_i2s_active_framebuffer(framebuffer[active_framebuffer]);
+  set_vga_i2s_active_framebuffer(active_framebuffer);
+  if (num_segments > 0) {
+    printf("VGA: segment mode with %d segments per line, using %u bytes of DMA memory for descriptors\n",
+           num_segments, (unsigned) (sizeof(lldesc_t) * dma_buf_desc_count));
+  }
 
   setup_i2s_output(pin_map);
   start_i2s_output();
@@ -533,25 +1066,394 @@ void vga_init(const int *pin_map, const VgaMode &mode, bool double_buffered)
 #endif
 }
 
+/**
+ * Stop the VGA output and free all memory allocated by vga_init().
+ * The settings made with the other vga_set_*() functions are kept for
+ * the next vga_init().
+ */
+void vga_deinit()
+{
+  if (! vga_mode) return;
+
+  // stop the DMA and the interrupt handler
+  esp_intr_disable(i2s_isr_handle);
+  I2S1.conf.tx_start = 0;
+  I2S1.out_link.stop = 1;
+  I2S1.int_ena.val = 0;
+  I2S1.int_clr.val = I2S1.int_raw.val;
+  reset_i2s_dma();
+  reset_i2s_fifo();
+  esp_intr_free(i2s_isr_handle);
+  i2s_isr_handle = 0;
+
+  if (ring_task) {
+    vTaskDelete(ring_task);
+    ring_task = nullptr;
+    heap_caps_free(ring_line[0]);
+  }
+  for (int i = 0; i < VGA_MAX_FRAMEBUFFERS; i++) {
+    for (int c = 0; c < num_framebuffer_chunks[i]; c++) {
+      heap_caps_free(framebuffer_chunk[i][c]);
+    }
+    num_framebuffer_chunks[i] = 0;
+    free(framebuffer[i]);
+    free(solid_line_map[i]);
+    free(segment_list[i]);
+    framebuffer[i] = nullptr;
+    solid_line_map[i] = nullptr;
+    segment_list[i] = nullptr;
+  }
+  for (int i = 0; i < num_solid_lines; i++) {
+    heap_caps_free(solid_line[i]);
+  }
+  num_solid_lines = 0;
+  border_line = nullptr;
+  if (hud_lines) {
+    heap_caps_free(hud_lines[0]);
+    free(hud_lines);
+    hud_lines = nullptr;
+  }
+  heap_caps_free(dma_buf_desc);
+  heap_caps_free(dma_buf_blank_vnorm);
+  heap_caps_free(dma_buf_blank_vsync);
+  heap_caps_free(dma_buf_hblank_vnorm);
+  dma_buf_desc = nullptr;
+  vSemaphoreDelete(vga_swap_done);
+  vSemaphoreDelete(vga_beam_done);
+
+  // the counters of lines and bands sent are relative to the frame count
+  vga_frame_count = 0;
+  vga_beam_band_count = 0;
+  vga_beam_band_target = 0;
+  num_pending_framebuffers = 0;
+  vga_swap_waiting = false;
+  vga_mode = nullptr;
+}
+
+/**
+ * Change the video mode and number of framebuffers: stop the output,
+ * free all memory and initialize again with the pins and settings
+ * used before. The screen goes blank for a frame or two while the
+ * monitor syncs to the new mode, and all framebuffer contents are lost.
+ */
+void vga_set_mode(const VgaMode &mode, int num_fb)
+{
+  vga_deinit();
+  vga_init(vga_pin_map, mode, num_fb);
+}
+
+/**
+ * Return the current video mode.
+ */
+const VgaMode &vga_get_mode()
+{
+  return *vga_mode;
+}
+
 /**
  * Swap the back (drawing) and active (display) framebuffers.
  *
- * If `wait_vsync` is true, wait for a vertical sync before
- * swapping. Use false only for measure your drawing code performance,
- * since it will result in an annoying horizontal line on the screen.
+ * If `wait_vsync` is true, the swap is done by the interrupt handler
+ * at the end of the current frame. This function only blocks until
+ * then if there's no free framebuffer to use as the next back buffer
+ * (with 3 framebuffers, when two finished frames are already waiting).
+ * Use false only for measure your drawing code performance, since it
+ * will result in an annoying horizontal line on the screen.
  */
 void vga_swap_buffers(bool wait_vsync)
 {
+  if (num_ring_lines > 0) {
+    // line buffer mode: wait until the rendering task starts the next frame
+    ring_frame_ready = true;
+    xSemaphoreTake(vga_swap_done, portMAX_DELAY);
+    return;
+  }
+
+  portENTER_CRITICAL(&vga_swap_lock);
   if (wait_vsync) {
+    pending_framebuffer[num_pending_framebuffers++] = back_framebuffer;
+  } else {
+    vga_dropped_frames += num_pending_framebuffers;
+    num_pending_framebuffers = 0;
+    active_framebuffer = back_framebuffer;
+  }
+  int fb = get_free_framebuffer();
+  if (fb < 0) vga_swap_waiting = true;
+  portEXIT_CRITICAL(&vga_swap_lock);
+
+  if (! wait_vsync) {
+    set_vga_i2s_active_framebuffer(back_framebuffer);
+  } else if (fb >= 0) {
+    vga_queued_frames++;
+  } else {
     // we might wait up to 1s/60 = 16.7 milliseconds here
-    vga_frame_count = 0;
-    while (vga_frame_count == 0) {
-      vTaskDelay(1);
-    }
+    xSemaphoreTake(vga_swap_done, portMAX_DELAY);
+    vga_swap_latency = (int) (esp_timer_get_time() - vga_swap_isr_time);
+    portENTER_CRITICAL(&vga_swap_lock);
+    fb = get_free_framebuffer();
+    portEXIT_CRITICAL(&vga_swap_lock);
   }
-  active_framebuffer = back_framebuffer;
-  back_framebuffer = (active_framebuffer+1) % num_framebuffers;
-  set_vga_i2s_active_framebuffer(framebuffer[active_framebuffer]);
+  back_framebuffer = fb;
+  memset(solid_line_map[back_framebuffer], 0, framebuffer_height * sizeof(uint8_t *));
+}
+
+/**
+ * Display line `y` of the back (drawing) framebuffer as a line of the
+ * given color (0b00BBGGRR) when it's swapped in, so the line doesn't
+ * need to be drawn. This is reset for each new frame. Return false if
+ * it's not possible (a few different colors can be used per frame).
+ */
+bool vga_set_solid_line(int y, uint8_t color)
+{
+  if (y < 0 || y >= framebuffer_height || num_framebuffers == 0 || num_segments > 0) return false;
+  uint8_t *line = get_solid_line(color);
+  if (! line) return false;
+  solid_line_map[back_framebuffer][y] = line;
+  return true;
+}
+
+/**
+ * Split the framebuffer in `num_bands` bands of lines for beam racing,
+ * triggering an interrupt when each band is sent to the monitor (0
+ * disables it). This must be called before vga_init(), and only makes
+ * sense with a single framebuffer.
+ */
+void vga_set_beam_bands(int num_bands)
+{
+  num_beam_bands = (num_bands < 0) ? 0 : (num_bands > VGA_MAX_BEAM_BANDS) ? VGA_MAX_BEAM_BANDS : num_bands;
+}
+
+/**
+ * Return the number of beam racing bands (0 if disabled).
+ */
+int vga_get_beam_bands()
+{
+  return num_beam_bands;
+}
+
+/**
+ * Return the first framebuffer line of the given beam racing band
+ * (for `band` equal to the number of bands, return the number of
+ * framebuffer lines).
+ */
+int vga_get_beam_band_line(int band)
+{
+  return band * framebuffer_height / num_beam_bands;
+}
+
+/**
+ * Return the number of beam racing bands sent to the monitor since the
+ * start. Band `b` of frame `f` is finished when the count reaches
+ * `f*num_bands + b + 1`.
+ */
+unsigned int vga_get_beam_band_count()
+{
+  return vga_beam_band_count;
+}
+
+/**
+ * Wait until the count of beam racing bands sent to the monitor
+ * reaches `count` (see vga_get_beam_band_count()), and return the
+ * current count.
+ */
+unsigned int vga_wait_beam_band(unsigned int count)
+{
+  if (count == 0) count = 1;  // 0 means no task is waiting
+  portENTER_CRITICAL(&vga_swap_lock);
+  bool done = (int) (vga_beam_band_count - count) >= 0;
+  if (! done) vga_beam_band_target = count;
+  portEXIT_CRITICAL(&vga_swap_lock);
+
+  if (! done) {
+    xSemaphoreTake(vga_beam_done, portMAX_DELAY);
+  }
+  return vga_beam_band_count;
+}
+
+/**
+ * Allocate one more framebuffer (e.g. to switch from beam racing with
+ * a single framebuffer to double buffering). The new framebuffer is
+ * used as the back framebuffer. Return false if there's not enough DMA
+ * memory.
+ */
+bool vga_add_framebuffer()
+{
+  int index = num_framebuffers;
+  if (index >= VGA_MAX_FRAMEBUFFERS || num_ring_lines > 0 || num_segments > 0) return false;
+  solid_line_map[index] = (uint8_t **) calloc(framebuffer_height, sizeof(uint8_t *));
+  if (! solid_line_map[index]) return false;
+  framebuffer[index] = alloc_framebuffer(index);
+  if (! framebuffer[index]) {
+    free(solid_line_map[index]);
+    solid_line_map[index] = nullptr;
+    return false;
+  }
+  clear_framebuffer(framebuffer[index], 0);
+
+  portENTER_CRITICAL(&vga_swap_lock);
+  num_framebuffers++;
+  portEXIT_CRITICAL(&vga_swap_lock);
+  back_framebuffer = index;
+  return true;
+}
+
+/**
+ * Use line buffer mode instead of framebuffers: only a ring of
+ * `num_lines` lines is allocated, and they're rendered by a task just
+ * before they're sent to the monitor, calling `render_line` for each
+ * line (with the line number and the line pixels to write). Before
+ * line 0 of each frame, `start_frame` is called if the game has called
+ * vga_swap_buffers() since the last frame (so the game state can be
+ * read without interfering with the game); the function
+ * vga_swap_buffers() returns after that. This must be called before
+ * vga_init() (use 0 lines to disable it).
+ *
+ * The rendering task runs on core 0 (the game loop runs on core 1, so
+ * it keeps running while the lines are rendered) with a high priority,
+ * so the render function must be fast (a bit less than `num_lines/2`
+ * lines of time for each `num_lines/2` lines), and the start function
+ * should do the slow work of the frame (like decompressing images).
+ * The number of lines is reduced if necessary so it's even and divides
+ * the number of framebuffer lines.
+ */
+void vga_set_line_buffer(int num_lines, vga_frame_func start_frame, vga_line_func render_line, void *data)
+{
+  num_ring_lines = (num_lines < 0) ? 0 : num_lines;
+  ring_start_frame = start_frame;
+  ring_render_line = render_line;
+  ring_data = data;
+}
+
+/**
+ * Return the number of lines of the line buffer ring (0 if line buffer
+ * mode is disabled).
+ */
+int vga_get_line_buffer_lines()
+{
+  return num_ring_lines;
+}
+
+/**
+ * Return the number of lines (approximately) rendered in line buffer
+ * mode after the time they should have been sent to the monitor.
+ */
+unsigned int vga_get_late_lines()
+{
+  return vga_late_lines;
+}
+
+/**
+ * Use segment mode instead of framebuffers: each framebuffer line is
+ * composed of `num` segments (pieces of DMA memory) set by the user
+ * in the segment list returned by vga_get_segments(), which is
+ * swapped by vga_swap_buffers() like a framebuffer. This must be
+ * called before vga_init() (use 0 to disable it).
+ */
+void vga_set_segments(int num)
+{
+  num_segments = (num < 0) ? 0 : (num > VGA_MAX_SEGMENTS) ? VGA_MAX_SEGMENTS : num;
+}
+
+/**
+ * Return the number of segments per line (0 if segment mode is
+ * disabled).
+ */
+int vga_get_num_segments()
+{
+  return num_segments;
+}
+
+/**
+ * Return the back segment list: the segments of framebuffer line `y`
+ * are at `[y*num_segments]`. Each segment must point to DMA memory
+ * (see vga_alloc_dma()) at a 4-byte boundary, with a length multiple
+ * of 4 between 4 and 4092, and the lengths of the segments of each
+ * line must add up to the horizontal resolution. The memory must not
+ * change until the list is swapped out of the display.
+ */
+VgaSegment *vga_get_segments()
+{
+  return segment_list[back_framebuffer];
+}
+
+/**
+ * Allocate DMA memory (e.g. for segments), or return nullptr if
+ * there's not enough.
+ */
+void *vga_alloc_dma(int size)
+{
+  return heap_caps_malloc(size, MALLOC_CAP_DMA);
+}
+
+/**
+ * Reserve screen lines above and below the framebuffer for a HUD.
+ * This must be called before vga_init(). The HUD lines are displayed
+ * in every frame (they're not swapped), and vga_get_yres() doesn't
+ * include them.
+ */
+void vga_set_hud(int top, int bottom)
+{
+  hud_top = (top < 0) ? 0 : top;
+  hud_bottom = (bottom < 0) ? 0 : bottom;
+}
+
+/**
+ * Return the HUD lines (the top lines followed by the bottom lines),
+ * or nullptr if there's no HUD. Changes to them are displayed in the
+ * next frame sent to the monitor.
+ */
+uint8_t **vga_get_hud_lines()
+{
+  return hud_lines;
+}
+
+/**
+ * Set the number of screen lines above and below the framebuffer,
+ * displayed with the given color (0b00BBGGRR). This must be called
+ * before vga_init(). The border lines don't use framebuffer memory,
+ * and vga_get_yres() doesn't include them.
+ */
+void vga_set_border(int top, int bottom, uint8_t color)
+{
+  border_top = (top < 0) ? 0 : top;
+  border_bottom = (bottom < 0) ? 0 : bottom;
+  border_color = color;
+}
+
+/**
+ * Return the number of framebuffers in use.
+ */
+int vga_get_num_framebuffers()
+{
+  return num_framebuffers;
+}
+
+/**
+ * Return the number of frames swapped without waiting for the end of
+ * the displayed frame (with 3 framebuffers).
+ */
+unsigned int vga_get_queued_frames()
+{
+  return vga_queued_frames;
+}
+
+/**
+ * Return the number of finished frames that were never displayed
+ * because a newer frame was finished before the end of the displayed
+ * frame (with 3 framebuffers).
+ */
+unsigned int vga_get_dropped_frames()
+{
+  return vga_dropped_frames;
+}
+
+/**
+ * Return the time (in microseconds) between the end of the frame and
+ * the return of the last vga_swap_buffers() waiting for it.
+ */
+int vga_get_swap_latency()
+{
+  return vga_swap_latency;
 }
 
 /**
@@ -559,6 +1461,7 @@ void vga_swap_buffers(bool wait_vsync)
  */
 void vga_clear_screen(uint8_t color)
 {
+  if (num_framebuffers == 0 || num_segments > 0) return;
   clear_framebuffer(vga_get_framebuffer(), color);
 }
 
@@ -583,7 +1486,28 @@ int vga_get_xres()
  */
 int vga_get_yres()
 {
-  return vga_mode->y_res();
+  return framebuffer_height;
+}
+
+/**
+ * Return the number of bytes between the start of consecutive lines
+ * of a framebuffer allocated in a single block.
+ */
+int vga_get_framebuffer_stride()
+{
+  return framebuffer_stride;
+}
+
+/**
+ * Return a pointer to the first line of the back (drawing)
+ * framebuffer if it's allocated in a single block (so line `y` starts
+ * at `base + y*stride`), or nullptr if it's split in more blocks (use
+ * the line pointers from vga_get_framebuffer() in this case).
+ */
+uint8_t *vga_get_framebuffer_base()
+{
+  if (num_framebuffer_chunks[back_framebuffer] != 1) return nullptr;
+  return framebuffer_chunk[back_framebuffer][0];
 }
 
 /**
@@ -9,10 +9,44 @@ extern const VgaMode vga_mode_320x240;
 extern const VgaMode vga_mode_288x240;
 extern const VgaMode vga_mode_240x240;
 
-void vga_init(const int *vga_pins, const VgaMode &mode = vga_mode_320x240, bool double_buffered = true);
+typedef void (*vga_frame_func)(void *data);
+typedef void (*vga_line_func)(int y, uint8_t *line, void *data);
+
+struct VgaSegment {
+  uint8_t *buf;
+  int len;
+};
+
+void vga_init(const int *vga_pins, const VgaMode &mode = vga_mode_320x240, int num_fb = 2);
+void vga_deinit();
+void vga_set_mode(const VgaMode &mode, int num_fb = 2);
+const VgaMode &vga_get_mode();
 void vga_swap_buffers(bool wait_vsync = true);
+int vga_get_swap_latency();
+int vga_get_num_framebuffers();
+unsigned int vga_get_queued_frames();
+unsigned int vga_get_dropped_frames();
 void vga_clear_screen(uint8_t color);
+bool vga_set_solid_line(int y, uint8_t color);
+void vga_set_border(int top, int bottom, uint8_t color);
+void vga_set_hud(int top, int bottom);
+void vga_set_beam_bands(int num_bands);
+int vga_get_beam_bands();
+int vga_get_beam_band_line(int band);
+unsigned int vga_get_beam_band_count();
+unsigned int vga_wait_beam_band(unsigned int count);
+bool vga_add_framebuffer();
+void vga_set_line_buffer(int num_lines, vga_frame_func start_frame, vga_line_func render_line, void *data);
+int vga_get_line_buffer_lines();
+unsigned int vga_get_late_lines();
+void vga_set_segments(int num);
+int vga_get_num_segments();
+VgaSegment *vga_get_segments();
+void *vga_alloc_dma(int size);
+uint8_t **vga_get_hud_lines();
 uint8_t **vga_get_framebuffer();
+uint8_t *vga_get_framebuffer_base();
+int vga_get_framebuffer_stride();
 uint8_t vga_get_sync_bits();
 int vga_get_xres();
 int vga_get_yres();
@@ -11,6 +11,13 @@
 #define CONTROLLER_TYPE  CONTROLLER_WII_WIRED  // one of CONTROLLER_xxx from game_joy.h
 #define ENABLE_NETWORK   1                     // 1=enabled, 0=disabled
 #define DEFAULT_NETWORK_STATE  0               // 1=enabled, 0=disabled
+#define ENABLE_BG_CACHE  0                     // 1=enabled, 0=disabled (uses ~75KB of RAM)
+#define HUD_TOP_LINES    0                     // lines above the game screen for debug info (e.g. 40)
+#define HUD_BOTTOM_LINES 0                     // lines below the game screen for debug info (e.g. 20)
+#define BEAM_RACING_BANDS 0                    // bands rendered racing the beam with a single framebuffer (e.g. 8), 0=disabled
+#define LINE_BUFFER_LINES 0                    // lines rendered just in time with no framebuffer (e.g. 16), 0=disabled
+#define TILE_MODE        0                     // 1=display tile rows directly with no framebuffer, 0=disabled
+#define IMAGE_CACHE_SLOTS 20                   // frames of the compressed images kept decompressed in RAM (2KB each)
 
 // Joystick input pins (for Arduino joystick shield)
 #define PIN_JOY_A      13
@@ -89,7 +96,19 @@ void setup()
   }
 #endif
 
+  if (! game_image_cache_init(IMAGE_CACHE_SLOTS)) {
+    // the compressed images can't be drawn without the cache
+    printf("\n\n**** ERROR: not enough memory for image cache\n");
+    while (true) {
+      delay(100);
+    }
+  }
+  screen.setHudLines(HUD_TOP_LINES, HUD_BOTTOM_LINES);
+  screen.setBeamRacing(BEAM_RACING_BANDS);
+  screen.setLineBuffer(LINE_BUFFER_LINES);
+  screen.setTileMode(TILE_MODE);
   screen.init(pin_config, &network, &joystick);
+  screen.enableBackgroundCache(ENABLE_BG_CACHE);
   screen.clear();
 }
 